@@ -56,7 +56,7 @@
 #define orxANIMSET_KU32_FLAG_NONE                   0x00000000  /**< No flags. */
 
 #define orxANIMSET_KU32_FLAG_REFERENCE_LOCK         0x00010000  /**< If there's already a reference on it, the AnimSet is locked for changes. */
-#define orxANIMSET_KU32_FLAG_LINK_STATIC            0x00020000  /**< If not static, animpointer should duplicate the link table upon linking/creation. */
+#define orxANIMSET_KU32_FLAG_LINK_STATIC            0x00020000  /**< If not static, animpointer should create a loop overlay upon linking/creation. */
 
 /** AnimSet Link Flags
  */
@@ -80,6 +80,10 @@ typedef struct __orxANIMSET_t                       orxANIMSET;
  */
 typedef struct __orxANIMSET_LINK_TABLE_t            orxANIMSET_LINK_TABLE;
 
+/** Internal Loop Overlay structure (per animation pointer loop counters)
+ */
+typedef struct __orxANIMSET_LOOP_OVERLAY_t          orxANIMSET_LOOP_OVERLAY;
+
 
 /** AnimSet module setup
  */
@@ -122,16 +126,17 @@ extern orxDLLAPI void orxFASTCALL                   orxAnimSet_AddReference(orxA
  */
 extern orxDLLAPI void orxFASTCALL                   orxAnimSet_RemoveReference(orxANIMSET *_pstAnimSet);
 
-/** Clones an AnimSet Link Table
- * @param[in]		_pstAnimSet													AnimSet to clone
- * @return An internally allocated clone of the AnimSet
+/** Creates a loop overlay for an AnimSet: per animation pointer loop counters, sharing the AnimSet link table and its routes
+ * @param[in]		_pstAnimSet													Concerned AnimSet
+ * @note Only links using a loop counter when the overlay is created are counted by it
+ * @return An internally allocated loop overlay / orxNULL
  */
-extern orxDLLAPI orxANIMSET_LINK_TABLE *orxFASTCALL orxAnimSet_CloneLinkTable(const orxANIMSET *_pstAnimSet);
+extern orxDLLAPI orxANIMSET_LOOP_OVERLAY *orxFASTCALL orxAnimSet_CreateLoopOverlay(orxANIMSET *_pstAnimSet);
 
-/** Deletes a Link table
- * @param[in]		_pstLinkTable											  Link table to delete (should have been created using the clone function)
+/** Deletes a loop overlay
+ * @param[in]		_pstLoopOverlay											Loop overlay to delete (should have been created using the create function)
  */
-extern orxDLLAPI void orxFASTCALL                   orxAnimSet_DeleteLinkTable(orxANIMSET_LINK_TABLE *_pstLinkTable);
+extern orxDLLAPI void orxFASTCALL                   orxAnimSet_DeleteLoopOverlay(orxANIMSET_LOOP_OVERLAY *_pstLoopOverlay);
 
 
 /** Adds an Anim to an AnimSet
@@ -200,12 +205,12 @@ extern orxDLLAPI orxU32 orxFASTCALL                 orxAnimSet_GetLinkProperty(c
  * @param[in]   _hSrcAnim                           Source (current) Anim handle
  * @param[in]   _hDstAnim                           Destination Anim handle, if none (auto mode) set it to orxHANDLE_UNDEFINED
  * @param[in,out] _pfTime                           Pointer to the current timestamp relative to the source Anim (time elapsed since the beginning of this anim)
- * @param[in,out] _pstLinkTable                     Anim Pointer link table (updated if AnimSet link table isn't static, when using loop counters for example)
+ * @param[in,out] _pstLoopOverlay                   Anim Pointer loop overlay (updated if AnimSet link table isn't static, ie. when using loop counters), exhausted counters block their links
  * @param[out] _pbCut                               Animation has been cut
  * @param[out] _pbClearTarget                       Animation has requested a target clearing
  * @return Current Anim handle. If it's not the source one, _pu32Time will contain the new timestamp, relative to the new Anim
 */
-extern orxDLLAPI orxHANDLE orxFASTCALL              orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxHANDLE _hSrcAnim, orxHANDLE _hDstAnim, orxFLOAT *_pfTime, orxANIMSET_LINK_TABLE *_pstLinkTable, orxBOOL *_pbCut, orxBOOL *_pbClearTarget);
+extern orxDLLAPI orxHANDLE orxFASTCALL              orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxHANDLE _hSrcAnim, orxHANDLE _hDstAnim, orxFLOAT *_pfTime, orxANIMSET_LOOP_OVERLAY *_pstLoopOverlay, orxBOOL *_pbCut, orxBOOL *_pbClearTarget);
 
 /** AnimSet Anim get accessor
  * @param[in]		_pstAnimSet													Concerned AnimSet
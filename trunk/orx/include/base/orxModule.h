@@ -131,7 +131,7 @@ extern orxDLLAPI void orxFASTCALL         orxModule_AddDependency(orxMODULE_ID _
  */
 extern orxDLLAPI void orxFASTCALL         orxModule_AddOptionalDependency(orxMODULE_ID _eModuleID, orxMODULE_ID _eDependID);
 
-/** Updates dependencies for all modules */
+/** Updates dependencies for all modules: computes the init order, dependencies first, and checks there are no cycles */
 extern orxDLLAPI void orxFASTCALL         orxModule_UpdateDependencies();
 
 /** Calls a module setup callback
@@ -139,7 +139,7 @@ extern orxDLLAPI void orxFASTCALL         orxModule_UpdateDependencies();
  */
 extern orxDLLAPI void orxFASTCALL         orxModule_Setup(orxMODULE_ID _eModuleID);
 
-/** Calls all module setups */
+/** Calls all module setups, then updates dependencies */
 extern orxDLLAPI void orxFASTCALL         orxModule_SetupAll();
 
 /** Inits a module
@@ -148,7 +148,7 @@ extern orxDLLAPI void orxFASTCALL         orxModule_SetupAll();
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL    orxModule_Init(orxMODULE_ID _eModuleID);
 
-/** Inits all modules
+/** Inits all modules, following dependency order. Modules listed in [Module] DeferredList are skipped and will be initialized on first use
  * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL    orxModule_InitAll();
@@ -167,6 +167,12 @@ extern orxDLLAPI void orxFASTCALL         orxModule_ExitAll();
  */
 extern orxDLLAPI orxBOOL orxFASTCALL      orxModule_IsInitialized(orxMODULE_ID _eModuleID);
 
+/** Gets the time spent in a module init function, its dependencies excluded
+ * @param[in]   _eModuleID                Concerned module ID
+ * @return      Init time in seconds, orxFLOAT_0 if not initialized or if initialized before the system module
+ */
+extern orxDLLAPI orxFLOAT orxFASTCALL     orxModule_GetInitTime(orxMODULE_ID _eModuleID);
+
 #endif /* _orxMODULE_H_ */
 
 /** @} */
@@ -226,7 +226,7 @@ extern orxDLLAPI orxCLOCK *orxFASTCALL                orxClock_GetFromInfo(const
 
 /** Sets a clock modifier
  * @param[in]   _pstClock                             Concerned clock
- * @param[in]   _eModType                             Modifier type
+ * @param[in]   _eModType                             Modifier type, orxCLOCK_MOD_TYPE_NONE to remove modifier
  * @param[in]   _fModValue                            Modifier value
  * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
@@ -333,6 +333,21 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxClock_AddGlobalTimer(co
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxClock_RemoveGlobalTimer(const orxCLOCK_FUNCTION _pfnCallback, orxFLOAT _fDelay);
 
+/** Enables/disables the clock profiler: when enabled, the time spent in each registered callback is accumulated per module
+ * @param[in]   _bEnable                              Enable / disable
+ */
+extern orxDLLAPI void orxFASTCALL                     orxClock_EnableProfiler(orxBOOL _bEnable);
+
+/** Resets all the profiler times
+ */
+extern orxDLLAPI void orxFASTCALL                     orxClock_ResetProfiler();
+
+/** Gets the time spent in a module's clock callbacks since last profiler reset
+ * @param[in]   _eModuleID                            Concerned module ID
+ * @return      Time spent in the module's callbacks (in seconds)
+ */
+extern orxDLLAPI orxFLOAT orxFASTCALL                 orxClock_GetProfilerTime(orxMODULE_ID _eModuleID);
+
 
 #endif /* _orxCLOCK_H_ */
 
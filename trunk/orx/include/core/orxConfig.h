@@ -51,6 +51,30 @@
 typedef orxBOOL (orxFASTCALL *orxCONFIG_SAVE_FUNCTION)(const orxSTRING _zSectionName, const orxSTRING _zKeyName, orxBOOL _bUseEncryption);
 
 
+/** Event enum
+ */
+typedef enum __orxCONFIG_EVENT_t
+{
+  orxCONFIG_EVENT_RELOAD_START = 0,                     /**< Event sent before reloading config files */
+  orxCONFIG_EVENT_SECTION_UPDATE,                       /**< Event sent for every section updated by a reload */
+  orxCONFIG_EVENT_RELOAD_STOP,                          /**< Event sent once config files have been reloaded */
+
+  orxCONFIG_EVENT_NUMBER,
+
+  orxCONFIG_EVENT_NONE = orxENUM_NONE
+
+} orxCONFIG_EVENT;
+
+/** Config event payload
+ */
+typedef struct __orxCONFIG_EVENT_PAYLOAD_t
+{
+  orxSTRING zFileName;                                  /**< Reloaded file name, orxNULL when the whole history is reloaded : 4 */
+  orxSTRING zSectionName;                               /**< Updated section name, section update event only : 8 */
+
+} orxCONFIG_EVENT_PAYLOAD;
+
+
 /** Config module setup
  */
 extern orxDLLAPI void orxFASTCALL       orxConfig_Setup();
@@ -94,6 +118,18 @@ extern orxDLLAPI orxSTATUS orxFASTCALL  orxConfig_Load(const orxSTRING _zFileNam
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxConfig_ReloadHistory();
 
+/** Reloads a config file from history, only updating the keys it modified/removed and sending an event for every updated section.
+ * Values set at runtime or overridden by a file loaded afterwards are kept.
+ * @param[in] _zFileName        File name, as it was loaded
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxConfig_ReloadFile(const orxSTRING _zFileName);
+
+/** Checks watched config files (requires History & Watch in the [Config] section) and reloads the modified ones, should be called once per frame
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxConfig_UpdateWatch();
+
 /** Writes config to given file. Will overwrite any existing file, including all comments.
  * @param[in] _zFileName        File name, if null or empty the default file name will be used
  * @param[in] _bUseEncryption   Use file encryption to make it human non-readable?
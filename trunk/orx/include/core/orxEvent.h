@@ -82,6 +82,8 @@ typedef enum __orxEVENT_TYPE_t
   orxEVENT_TYPE_SOUND,
   orxEVENT_TYPE_SPAWNER,
   orxEVENT_TYPE_SYSTEM,
+  orxEVENT_TYPE_CONFIG,
+  orxEVENT_TYPE_DISPLAY,
 
   orxEVENT_TYPE_CORE_NUMBER,
 
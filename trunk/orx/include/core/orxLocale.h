@@ -122,6 +122,12 @@ extern orxDLLAPI orxBOOL orxFASTCALL    orxLocale_HasString(const orxSTRING _zKe
  */
 extern orxDLLAPI orxSTRING orxFASTCALL  orxLocale_GetString(const orxSTRING _zKey);
 
+/** Reads a string in the current language for the given pre-hashed key (inherited keys aren't found)
+ * @param[in] _u32KeyID         Key ID (orxString_ToCRC of its name)
+ * @return The value / orxNULL if not found
+ */
+extern orxDLLAPI orxSTRING orxFASTCALL  orxLocale_GetStringFromID(orxU32 _u32KeyID);
+
 /** Writes a string in the current language for the given key
  * @param[in] _zKey             Key name
  * @param[in] _zValue           Value
@@ -121,6 +121,23 @@ typedef struct __orxCOLOR_t
 } orxCOLOR;
 
 
+/** Event enum
+ */
+typedef enum __orxDISPLAY_EVENT_t
+{
+  orxDISPLAY_EVENT_DELETE_BITMAP = 0,   /**< Event sent before a bitmap is deleted */
+  orxDISPLAY_EVENT_DELETE_TEXT,         /**< Event sent before a text is deleted */
+  orxDISPLAY_EVENT_UPDATE_TEXT,         /**< Event sent before a text string or font is modified */
+  orxDISPLAY_EVENT_UPDATE_BITMAP,       /**< Event sent before a bitmap color or color key is modified */
+  orxDISPLAY_EVENT_ACQUIRE_CONTEXT,     /**< Event sent before display context is used outside of render plugin (screen capture, shaders) */
+
+  orxDISPLAY_EVENT_NUMBER,
+
+  orxDISPLAY_EVENT_NONE = orxENUM_NONE
+
+} orxDISPLAY_EVENT;
+
+
 #define orxDISPLAY_KZ_CONFIG_SECTION    "Display"
 #define orxDISPLAY_KZ_CONFIG_WIDTH      "ScreenWidth"
 #define orxDISPLAY_KZ_CONFIG_HEIGHT     "ScreenHeight"
@@ -430,7 +447,7 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetBitmapClippi
 
 /** Blits a bitmap (no transformation)
  * @param[in]   _pstDst                               Bitmap where to blit
- * @param[in]   _pstSrc                               Bitmap to blit (will begin at top left corner)
+ * @param[in]   _pstSrc                               Bitmap to blit (will begin at top left corner). If it's the screen, its clipped area gets copied to the top left corner of _pstDst
  * @param[in]   _fPosX                                X-axis value of the position where to blit the source bitmap
  * @param[in]   _fPosY                                Y-axis value of the position where to blit the source bitmap
  * @param[in]   _eBlendMode                           Blend mode
@@ -452,6 +469,14 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SaveBitmap(cons
  */
 extern orxDLLAPI orxBITMAP *orxFASTCALL               orxDisplay_LoadBitmap(const orxSTRING _zFileName);
 
+/** Gets a bitmap data (RGBA, 4 bytes per pixel, rows from top to bottom)
+ * @param[in]   _pstBitmap                            Concerned bitmap, can be screen
+ * @param[out]  _au8Data                              Buffer where to copy the bitmap data
+ * @param[in]   _u32ByteNumber                        Size of the buffer, has to be width * height * 4
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber);
+
 
 /** Gets a bitmap size
  * @param[in]   _pstBitmap                            Concerned bitmap
@@ -565,6 +590,12 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetVideoMode(co
  */
 extern orxDLLAPI orxBOOL orxFASTCALL                  orxDisplay_IsVideoModeAvailable(const orxDISPLAY_VIDEO_MODE *_pstVideoMode);
 
+/** Enables/disables display context for the calling thread (a context can only be enabled for one thread at a time)
+ * @param[in]  _bEnable                               Enable / disable
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the display can't be used from another thread
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_EnableContext(orxBOOL _bEnable);
+
 
 #endif /* _orxDISPLAY_H_ */
 
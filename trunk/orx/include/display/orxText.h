@@ -48,6 +48,16 @@
 /** Internal text structure */
 typedef struct __orxTEXT_t                orxTEXT;
 
+/** Text glyph: a laid out character, only used with bitmap fonts */
+typedef struct __orxTEXT_GLYPH_t
+{
+  orxBITMAP  *pstBitmap;                  /**< Atlas page bitmap : 4 */
+  orxFLOAT    fX, fY;                     /**< Position in text : 12 */
+  orxFLOAT    fU, fV;                     /**< Top left corner in atlas page : 20 */
+  orxCHAR     cCharacter;                 /**< Character : 21 */
+
+} orxTEXT_GLYPH;
+
 
 /** Setups the text module
  */
@@ -114,6 +124,15 @@ extern orxDLLAPI const orxSTRING orxFASTCALL orxText_GetFont(const orxTEXT *_pst
  */
 extern orxDLLAPI orxDISPLAY_TEXT *orxFASTCALL orxText_GetData(const orxTEXT *_pstText);
 
+/** Gets text glyph layout, only available for texts using a bitmap font
+ * @param[in]   _pstText          Concerned text
+ * @param[out]  _pastGlyphList    Glyph list
+ * @param[out]  _pu32GlyphNumber  Number of glyphs
+ * @param[out]  _pvCharacterSize  Character size
+ * @return      orxSTATUS_SUCCESS if text uses a bitmap font / orxSTATUS_FAILURE otherwise
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL    orxText_GetGlyphList(const orxTEXT *_pstText, const orxTEXT_GLYPH **_pastGlyphList, orxU32 *_pu32GlyphNumber, orxVECTOR *_pvCharacterSize);
+
 /** Sets text string 
  * @param[in]   _pstText      Concerned text
  * @param[in]   _zString      String to contain
@@ -121,7 +140,7 @@ extern orxDLLAPI orxDISPLAY_TEXT *orxFASTCALL orxText_GetData(const orxTEXT *_ps
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL    orxText_SetString(orxTEXT *_pstText, const orxSTRING _zString);
 
-/** Sets text font
+/** Sets text font: config sections defining Texture, CharacterList & CharacterSize are used as bitmap fonts
  * @param[in]   _pstText      Concerned text
  * @param[in]   _zFont        Font name / orxNULL to use default
  * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
@@ -32,6 +32,8 @@
  * 
  * File plugin module
  * Module that handles file access
+ * Mounted packs (archives with a hashed path index) are searched ahead of the native file system
+ * for read-only accesses. Packed paths use '/' as separator and are case sensitive.
  *
  * @{
  */
@@ -48,11 +50,22 @@
 #define orxFILE_KU32_FLAG_OPEN_APPEND 0x00000004 /**< descriptor positioned at the end of file */
 #define orxFILE_KU32_FLAG_OPEN_BINARY 0x00000008 /**< binary file accessing */
 
+#define orxFILE_KU32_FLAG_MAP_SEQUENTIAL  0x00000001 /**< mapped content will be read sequentially */
+#define orxFILE_KU32_FLAG_MAP_READ_AHEAD  0x00000002 /**< mapped content will be needed soon, starts reading it ahead */
+
 
 /** Internal File structure
  */
 typedef struct __orxFILE_t orxFILE;
 
+/** Read-only view on a whole file content */
+typedef struct __orxFILE_VIEW_t
+{
+  const orxCHAR  *pcData;     /**< File content, not null-terminated */
+  orxU32          u32Size;    /**< File content size (in bytes) */
+  orxHANDLE       hInternal;  /**< Internal use handle */
+} orxFILE_VIEW;
+
 
 /** File module setup */
 extern orxDLLAPI void orxFASTCALL       orxFile_Setup();
@@ -111,6 +124,59 @@ extern orxDLLAPI orxBOOL orxFASTCALL    orxFile_ReadLine(orxSTRING _zBuffer, orx
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxFile_Close(orxFILE *_pstFile);
 
+/** Maps a whole file in memory for reading, without copying it when the platform supports memory mapping
+ * @param[in] _zPath               Full file's path to map
+ * @param[in] _u32MapFlags         Access hints (orxFILE_KU32_FLAG_MAP_*)
+ * @param[out] _pstView            View on the file content
+ * @return Returns the status of the operation
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxFile_Map(const orxSTRING _zPath, orxU32 _u32MapFlags, orxFILE_VIEW *_pstView);
+
+/** Unmaps a file view
+ * @param[in] _pstView             View to unmap, its content can't be accessed anymore
+ * @return Returns the status of the operation
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxFile_Unmap(orxFILE_VIEW *_pstView);
+
+/** Mounts a pack, its content will be searched ahead of the native file system and of previously mounted packs
+ * @param[in] _zArchive            Pack's path
+ * @return Returns the status of the operation
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxFile_Mount(const orxSTRING _zArchive);
+
+/** Unmounts a pack, all files & views opened from it have to be closed beforehand
+ * @param[in] _zArchive            Pack's path, as given to orxFile_Mount
+ * @return Returns the status of the operation
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxFile_Unmount(const orxSTRING _zArchive);
+
+/** Creates a pack from native files, they'll be stored under the given paths
+ * @param[in] _zArchive            Pack's path
+ * @param[in] _azFileList          List of file paths to store
+ * @param[in] _u32FileNumber       Number of files
+ * @param[in] _bCompress           If orxTRUE, files will be LZ4 compressed when it saves space
+ * @return Returns the status of the operation
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxFile_Pack(const orxSTRING _zArchive, const orxSTRING *_azFileList, orxU32 _u32FileNumber, orxBOOL _bCompress);
+
+/** Gets info about a file stored in a mounted pack
+ * @param[in] _zPath               File's path
+ * @param[out] _pu32Size           File's size (in bytes), can be orxNULL
+ * @param[out] _pu32TimeStamp      File's last modification time stamp, can be orxNULL
+ * @return Returns orxTRUE if the file is stored in a mounted pack, else returns orxFALSE.
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL    orxFile_GetPackedInfo(const orxSTRING _zPath, orxU32 *_pu32Size, orxU32 *_pu32TimeStamp);
+
+/** Finds next file stored in mounted packs, directly inside a directory (files shadowed by more recent packs are skipped)
+ * @param[in] _zDirectory          Directory's path, empty for root
+ * @param[in,out] _pu32Cursor      Search cursor, 0 for the first file. Will be updated to the next one
+ * @param[out] _ppcName            File's name, without directory (null-terminated)
+ * @param[out] _pu32Size           File's size (in bytes)
+ * @param[out] _pu32TimeStamp      File's last modification time stamp
+ * @return Returns orxTRUE if a file has been found, else returns orxFALSE.
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL    orxFile_FindNextPacked(const orxSTRING _zDirectory, orxU32 *_pu32Cursor, const orxCHAR **_ppcName, orxU32 *_pu32Size, orxU32 *_pu32TimeStamp);
+
 #endif /* _orxFILE_H_ */
 
 /** @} */
@@ -60,6 +60,7 @@ typedef struct __orxFILESYSTEM_INFO_t
   orxU32 u32TimeStamp;      /**< Timestamp of the last modification */
   orxU32 u32Size;           /**< File's size (in bytes) */
   orxHANDLE hInternal;      /**< Internal use handle */
+  orxU32 u32PackCursor;     /**< Internal use pack search cursor */
   orxCHAR zName[256];       /**< File's name */
   orxCHAR zPattern[256];    /**< Search pattern */
   orxCHAR zPath[1024];      /**< Directory's name where is stored the file */
@@ -90,6 +91,7 @@ extern orxDLLAPI void orxFASTCALL       orxFileSystem_Exit();
 extern orxDLLAPI orxBOOL orxFASTCALL    orxFileSystem_Exists(const orxSTRING _zFileName);
 
 /** Starts a new search. Find the first file that will match to the given pattern (e.g : /bin/toto* or c:\*.*)
+ * Files stored in mounted packs are found first, native files are then searched.
  * @param[in] _zSearchPattern      Pattern to find
  * @param[out] _pstFileInfo        Informations about the first file found
  * @return orxTRUE if a file has been found, else orxFALSE
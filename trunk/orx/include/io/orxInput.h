@@ -248,6 +248,32 @@ extern orxDLLAPI const orxSTRING orxFASTCALL orxInput_GetBindingName(orxINPUT_TY
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxInput_GetActiveBinding(orxINPUT_TYPE *_peType, orxENUM *_peID);
 
+
+/** Starts recording inputs to a file (core clock DT & active input values, for each tick)
+ * @param[in]   _zFileName      Record file name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxInput_StartRecording(const orxSTRING _zFileName);
+
+/** Stops recording inputs
+ */
+extern orxDLLAPI void orxFASTCALL       orxInput_StopRecording();
+
+/** Starts replaying inputs from a record file: devices are ignored and core clock is locked on recorded DTs till the end of the replay
+ * @param[in]   _zFileName      Record file name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxInput_StartReplay(const orxSTRING _zFileName);
+
+/** Stops replaying inputs: devices are used again and core clock modifier is restored
+ */
+extern orxDLLAPI void orxFASTCALL       orxInput_StopReplay();
+
+/** Is replaying inputs?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL    orxInput_IsReplaying();
+
 #endif /*_orxINPUT_H_*/
 
 /** @} */
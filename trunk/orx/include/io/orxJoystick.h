@@ -188,6 +188,14 @@ extern orxDLLAPI orxFLOAT orxFASTCALL         orxJoystick_GetAxisValue(orxU32 _u
  */
 extern orxDLLAPI orxBOOL orxFASTCALL          orxJoystick_IsButtonPressed(orxU32 _u32ID, orxJOYSTICK_BUTTON _eButton);
 
+/** Gets the whole state of a joystick at once
+ * @param[in] _u32ID              ID of the joystick to query
+ * @param[out] _pu32ButtonBitset  Button bitset to fill, one bit per button
+ * @param[out] _afAxisList        Axis values to fill
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the plugin can't provide it (buttons & axes then have to be queried one by one)
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxJoystick_GetState(orxU32 _u32ID, orxU32 *_pu32ButtonBitset, orxFLOAT _afAxisList[orxJOYSTICK_AXIS_NUMBER]);
+
 /** Gets axis literal name
  * @param[in] _eAxis        Concerned axis
  * @return Axis's name
@@ -155,6 +155,8 @@ typedef enum __orxKEYBOARD_KEY_t
 
 } orxKEYBOARD_KEY;
 
+#define orxKEYBOARD_KU32_KEY_BITSET_SIZE  ((orxKEYBOARD_KEY_NUMBER + 31) >> 5) /**< Number of orxU32 needed to store one bit per key */
+
 
 /** Event enum
  */
@@ -221,6 +223,12 @@ extern orxDLLAPI orxKEYBOARD_KEY orxFASTCALL  orxKeyboard_Read();
  */
 extern orxDLLAPI void orxFASTCALL             orxKeyboard_ClearBuffer();
 
+/** Gets the state of all keys at once, one bit per key (bit (_eKey & 31) of word (_eKey >> 5))
+ * @param[out] _au32KeyBitset Key bitset to fill
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the plugin can't provide it (keys then have to be queried one by one)
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxKeyboard_GetKeyBitset(orxU32 _au32KeyBitset[orxKEYBOARD_KU32_KEY_BITSET_SIZE]);
+
 /** Gets key literal name
  * @param[in] _eKey       Concerned key
  * @return Key's name
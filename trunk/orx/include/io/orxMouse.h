@@ -146,6 +146,12 @@ extern orxDLLAPI orxFLOAT orxFASTCALL         orxMouse_GetWheelDelta();
 */
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxMouse_ShowCursor(orxBOOL _bShow);
 
+/** Gets the state of all mouse buttons at once, one bit per button (wheel excluded)
+ * @param[out] _pu32ButtonBitset  Button bitset to fill
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the plugin can't provide it (buttons then have to be queried one by one)
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxMouse_GetButtonBitset(orxU32 *_pu32ButtonBitset);
+
 /** Gets button literal name
  * @param[in] _eButton          Concerned button
  * @return Button's name
@@ -0,0 +1,193 @@
+/* Orx - Portable Game Engine
+ *
+ * Orx is the legal property of its developers, whose names
+ * are listed in the COPYRIGHT file distributed
+ * with this source distribution.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file orxBatch.h
+ * @date 19/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * @todo
+ */
+
+/**
+ * @addtogroup orxBatch
+ *
+ * Batch math module
+ * Module that runs vector & oriented box operations on structure of arrays (SoA) data.
+ * Kernels use AVX, SSE or NEON when available at compile time and a scalar path otherwise.
+ * Arrays don't need to be aligned and can be orxNULL when there are no elements to process.
+ *
+ * @{
+ */
+
+
+#ifndef _orxBATCH_H_
+#define _orxBATCH_H_
+
+#include "orxInclude.h"
+
+#include "math/orxOBox.h"
+
+
+/** 2D affine transform (row-major 2x3 matrix)
+ */
+typedef struct __orxBATCH_TRANSFORM_t
+{
+  orxFLOAT fXX, fXY, fTX;             /**< First row : 12 */
+  orxFLOAT fYX, fYY, fTY;             /**< Second row : 24 */
+
+} orxBATCH_TRANSFORM;
+
+/** 2D oriented box definitions, as given to orxOBox_2DSet
+ */
+typedef struct __orxBATCH_OBOX_DEF_t
+{
+  const orxFLOAT *afPositionX;        /**< World positions, X : 4 */
+  const orxFLOAT *afPositionY;        /**< World positions, Y : 8 */
+  const orxFLOAT *afPositionZ;        /**< World positions, Z : 12 */
+  const orxFLOAT *afPivotX;           /**< Pivots, X : 16 */
+  const orxFLOAT *afPivotY;           /**< Pivots, Y : 20 */
+  const orxFLOAT *afSizeX;            /**< Sizes, X : 24 */
+  const orxFLOAT *afSizeY;            /**< Sizes, Y : 28 */
+  const orxFLOAT *afSizeZ;            /**< Sizes, Z : 32 */
+  const orxFLOAT *afAngle;            /**< Z-axis angles (radians), orxNULL for axis aligned boxes : 36 */
+
+} orxBATCH_OBOX_DEF;
+
+/** 2D oriented boxes, SoA layout of orxOBOX
+ */
+typedef struct __orxBATCH_OBOX_t
+{
+  orxFLOAT *afOriginX;                /**< Box origins (position - pivot), X : 4 */
+  orxFLOAT *afOriginY;                /**< Box origins (position - pivot), Y : 8 */
+  orxFLOAT *afXX;                     /**< X axes, X : 12 */
+  orxFLOAT *afXY;                     /**< X axes, Y : 16 */
+  orxFLOAT *afYX;                     /**< Y axes, X : 20 */
+  orxFLOAT *afYY;                     /**< Y axes, Y : 24 */
+  orxFLOAT *afZ;                      /**< Z positions : 28 */
+  orxFLOAT *afDepth;                  /**< Z sizes : 32 */
+
+} orxBATCH_OBOX;
+
+
+/* *** Batch inlined functions *** */
+
+
+/** Sets a 2D transform from position, rotation and scale
+ * @param[out]  _pstRes                       Transform to set
+ * @param[in]   _pvPosition                   Translation
+ * @param[in]   _fRotation                    Z-axis rotation (radians)
+ * @param[in]   _pvScale                      Scale
+ * @return      orxBATCH_TRANSFORM
+ */
+static orxINLINE orxBATCH_TRANSFORM *         orxBatch_2DSetTransform(orxBATCH_TRANSFORM *_pstRes, const orxVECTOR *_pvPosition, orxFLOAT _fRotation, const orxVECTOR *_pvScale)
+{
+  orxFLOAT fCos, fSin;
+
+  /* Checks */
+  orxASSERT(_pstRes != orxNULL);
+  orxASSERT(_pvPosition != orxNULL);
+  orxASSERT(_pvScale != orxNULL);
+
+  /* Gets cosine and sine */
+  fCos = orxMath_Cos(_fRotation);
+  fSin = orxMath_Sin(_fRotation);
+
+  /* Sets matrix */
+  _pstRes->fXX = fCos * _pvScale->fX;
+  _pstRes->fXY = -fSin * _pvScale->fY;
+  _pstRes->fTX = _pvPosition->fX;
+  _pstRes->fYX = fSin * _pvScale->fX;
+  _pstRes->fYY = fCos * _pvScale->fY;
+  _pstRes->fTY = _pvPosition->fY;
+
+  /* Done! */
+  return _pstRes;
+}
+
+
+/* *** Batch functions *** */
+
+
+/** Gets the name of the instruction set used by the kernels
+ * @return      "avx", "sse", "neon" or "scalar"
+ */
+extern orxDLLAPI const orxSTRING orxFASTCALL  orxBatch_GetInstructionSet();
+
+/** Transforms 2D positions
+ * @param[in]   _pstTransform                 Transform to apply
+ * @param[in]   _afX                          Positions, X
+ * @param[in]   _afY                          Positions, Y
+ * @param[out]  _afResX                       Transformed positions, X
+ * @param[out]  _afResY                       Transformed positions, Y
+ * @param[in]   _u32Number                    Number of positions
+ */
+extern orxDLLAPI void orxFASTCALL             orxBatch_2DTransform(const orxBATCH_TRANSFORM *_pstTransform, const orxFLOAT *_afX, const orxFLOAT *_afY, orxFLOAT *_afResX, orxFLOAT *_afResY, orxU32 _u32Number);
+
+/** Sets 2D oriented boxes, same as calling orxOBox_2DSet on each of them
+ * @param[out]  _pstRes                       Boxes to set
+ * @param[in]   _pstDef                       Box definitions
+ * @param[in]   _u32Number                    Number of boxes
+ */
+extern orxDLLAPI void orxFASTCALL             orxBatch_2DSetOBox(const orxBATCH_OBOX *_pstRes, const orxBATCH_OBOX_DEF *_pstDef, orxU32 _u32Number);
+
+/** Tests 2D oriented boxes against a single one, same as orxOBox_2DTestIntersection
+ * @param[in]   _pstBoxes                     Boxes to test
+ * @param[in]   _u32Number                    Number of boxes
+ * @param[in]   _pstBox                       Box to test against
+ * @param[out]  _au8Result                    Per box result: 1 if intersecting, 0 otherwise
+ * @return      Number of intersecting boxes
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxBatch_2DTestOBoxIntersection(const orxBATCH_OBOX *_pstBoxes, orxU32 _u32Number, const orxOBOX *_pstBox, orxU8 *_au8Result);
+
+/** Tests if a 2D position is inside oriented boxes, same as orxOBox_2DIsInside
+ * @param[in]   _pstBoxes                     Boxes to test
+ * @param[in]   _u32Number                    Number of boxes
+ * @param[in]   _pvPosition                   Position to test (no Z-test)
+ * @param[out]  _au8Result                    Per box result: 1 if position is inside, 0 otherwise
+ * @return      Number of boxes containing the position
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxBatch_2DIsInsideOBox(const orxBATCH_OBOX *_pstBoxes, orxU32 _u32Number, const orxVECTOR *_pvPosition, orxU8 *_au8Result);
+
+/** Tests 2D circles against a single one
+ * @param[in]   _afX                          Circle centers, X
+ * @param[in]   _afY                          Circle centers, Y
+ * @param[in]   _afRadius                     Circle radii, orxNULL for points
+ * @param[in]   _u32Number                    Number of circles
+ * @param[in]   _pvCenter                     Center of the circle to test against (no Z-test)
+ * @param[in]   _fRadius                      Radius of the circle to test against
+ * @param[out]  _au8Result                    Per circle result: 1 if intersecting, 0 otherwise
+ * @return      Number of intersecting circles
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxBatch_2DTestCircleIntersection(const orxFLOAT *_afX, const orxFLOAT *_afY, const orxFLOAT *_afRadius, orxU32 _u32Number, const orxVECTOR *_pvCenter, orxFLOAT _fRadius, orxU8 *_au8Result);
+
+/** Gets 2D square distances to a position
+ * @param[in]   _afX                          Positions, X
+ * @param[in]   _afY                          Positions, Y
+ * @param[in]   _u32Number                    Number of positions
+ * @param[in]   _pvPosition                   Position to get distances from (no Z)
+ * @param[out]  _afRes                        Square distances
+ */
+extern orxDLLAPI void orxFASTCALL             orxBatch_2DGetSquareDistance(const orxFLOAT *_afX, const orxFLOAT *_afY, orxU32 _u32Number, const orxVECTOR *_pvPosition, orxFLOAT *_afRes);
+
+#endif /* _orxBATCH_H_ */
+
+/** @} */
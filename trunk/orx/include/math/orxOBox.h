@@ -42,6 +42,7 @@
 
 #include "orxInclude.h"
 
+#include "math/orxAABox.h"
 #include "math/orxVector.h"
 
 
@@ -135,6 +136,35 @@ static orxINLINE orxVECTOR *                  orxOBox_GetCenter(const orxOBOX *_
   return _pvRes;
 }
 
+/** Gets the 2D axis aligned box enclosing an OBox (its Z range is the OBox one)
+ * @param[in]   _pstOp                        Concerned OBox
+ * @param[out]  _pstRes                       Enclosing AABox
+ * @return      Enclosing AABox
+ */
+static orxINLINE orxAABOX *                   orxOBox_2DGetAABox(const orxOBOX *_pstOp, orxAABOX *_pstRes)
+{
+  orxFLOAT fOriginX, fOriginY;
+
+  /* Checks */
+  orxASSERT(_pstOp != orxNULL);
+  orxASSERT(_pstRes != orxNULL);
+
+  /* Gets box origin */
+  fOriginX = _pstOp->vPosition.fX - _pstOp->vPivot.fX;
+  fOriginY = _pstOp->vPosition.fY - _pstOp->vPivot.fY;
+
+  /* Gets extrema from both axis, as corners are origin + {0, X, Y, X + Y} */
+  _pstRes->vTL.fX = fOriginX + orxMIN(orxFLOAT_0, _pstOp->vX.fX) + orxMIN(orxFLOAT_0, _pstOp->vY.fX);
+  _pstRes->vTL.fY = fOriginY + orxMIN(orxFLOAT_0, _pstOp->vX.fY) + orxMIN(orxFLOAT_0, _pstOp->vY.fY);
+  _pstRes->vTL.fZ = _pstOp->vPosition.fZ;
+  _pstRes->vBR.fX = fOriginX + orxMAX(orxFLOAT_0, _pstOp->vX.fX) + orxMAX(orxFLOAT_0, _pstOp->vY.fX);
+  _pstRes->vBR.fY = fOriginY + orxMAX(orxFLOAT_0, _pstOp->vX.fY) + orxMAX(orxFLOAT_0, _pstOp->vY.fY);
+  _pstRes->vBR.fZ = _pstOp->vPosition.fZ + _pstOp->vZ.fZ;
+
+  /* Done! */
+  return _pstRes;
+}
+
 /** Moves an OBox
  * @param[out]  _pstRes                       OBox where to store result
  * @param[in]   _pstOp                        OBox to move
@@ -55,6 +55,24 @@ typedef struct __orxBANK_t orxBANK;
 /* Define flags */
 #define orxBANK_KU32_FLAG_NONE              0x00000000  /**< No flags (default behaviour) */
 #define orxBANK_KU32_FLAG_NOT_EXPANDABLE    0x00000001  /**< The bank will not be expandable */
+#define orxBANK_KU32_FLAG_FRAME_MEMORY      0x00000002  /**< The bank will be allocated with orxMemory_AllocateFrame and will only be valid until the end of the current frame */
+
+/* Define histogram */
+#define orxBANK_KU32_HISTOGRAM_SIZE         6           /**< Segment occupancy buckets: empty, 1-25%, 26-50%, 51-75%, 76-99%, full */
+
+/** Bank statistics
+ */
+typedef struct __orxBANK_STATS_t
+{
+  orxMEMORY_TYPE  eMemType;                             /**< Memory type */
+  orxU32          u32ElemSize;                          /**< Size of a cell */
+  orxU32          u32Counter;                           /**< Number of allocated cells */
+  orxU32          u32Capacity;                          /**< Number of cells in all segments */
+  orxU32          u32SegmentCounter;                    /**< Number of segments */
+  orxU32          u32Size;                              /**< Size used by the bank, in bytes */
+  orxU32          au32Histogram[orxBANK_KU32_HISTOGRAM_SIZE]; /**< Number of segments per occupancy bucket */
+
+} orxBANK_STATS;
 
 /** Setups the bank module
  */
@@ -114,6 +132,22 @@ extern orxDLLAPI void *orxFASTCALL          orxBank_GetNext(const orxBANK *_pstB
  */
 extern orxDLLAPI orxU32 orxFASTCALL         orxBank_GetCounter(const orxBANK *_pstBank);
 
+/** Gets bank statistics, the bank mustn't be modified by another thread meanwhile
+ * @param[in]  _pstBank   Concerned bank
+ * @param[out] _pstStats  Statistics of the bank
+ */
+extern orxDLLAPI void orxFASTCALL           orxBank_GetStats(const orxBANK *_pstBank, orxBANK_STATS *_pstStats);
+
+/** Gets the next bank, iterating isn't protected against banks being created or deleted by other threads (orxBank_LogStats is)
+ * @param[in]  _pstBank   Current bank, orxNULL to get the first one
+ * @return Next bank / orxNULL
+ */
+extern orxDLLAPI orxBANK *orxFASTCALL       orxBank_GetNextBank(const orxBANK *_pstBank);
+
+/** Logs statistics of all banks
+ */
+extern orxDLLAPI void orxFASTCALL           orxBank_LogStats();
+
 /*******************************************************************************
  * DEBUG FUNCTION
  ******************************************************************************/
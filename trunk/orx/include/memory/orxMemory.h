@@ -66,6 +66,23 @@ typedef enum __orxMEMORY_TYPE_t
 
 } orxMEMORY_TYPE;
 
+/** Memory type statistics
+ */
+typedef struct __orxMEMORY_STATS_t
+{
+  orxU32 u32Counter;                    /**< Number of live allocations */
+  orxU32 u32PeakCounter;                /**< Peak number of live allocations */
+  orxU32 u32Size;                       /**< Live allocated size, in bytes */
+  orxU32 u32PeakSize;                   /**< Peak allocated size, in bytes */
+  orxU32 u32TotalCounter;               /**< Number of allocations since init */
+
+} orxMEMORY_STATS;
+
+/** Custom allocator functions
+ */
+typedef void *(orxFASTCALL *orxMEMORY_ALLOCATE_FUNCTION)(orxU32 _u32Size, void *_pContext);
+typedef void (orxFASTCALL *orxMEMORY_FREE_FUNCTION)(void *_pMem, void *_pContext);
+
 
 /** Setups the memory module
  */
@@ -92,6 +109,49 @@ extern orxDLLAPI void *orxFASTCALL      orxMemory_Allocate(orxU32 _u32Size, orxM
  */
 extern orxDLLAPI void orxFASTCALL       orxMemory_Free(void *_pMem);
 
+/** Enables / disables statistics (disabled by default), only blocks allocated while they're enabled are counted
+ * @param[in]  _bEnable  Enable / disable
+ */
+extern orxDLLAPI void orxFASTCALL       orxMemory_EnableStats(orxBOOL _bEnable);
+
+/** Gets the number of allocations made while statistics were enabled
+ * @return Allocation counter
+ */
+extern orxDLLAPI orxU32 orxFASTCALL     orxMemory_GetAllocationCounter();
+
+/** Gets statistics of a memory type
+ * @param[in]  _eMemType Concerned memory type
+ * @param[out] _pstStats Statistics of the memory type
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxMemory_GetStats(orxMEMORY_TYPE _eMemType, orxMEMORY_STATS *_pstStats);
+
+/** Logs statistics of all memory types
+ */
+extern orxDLLAPI void orxFASTCALL       orxMemory_LogStats();
+
+/** Allocates frame memory from a linear arena: it's only valid until the end of the current frame and mustn't be given to orxMemory_Free
+ * @param[in] _u32Size    Size of the memory to allocate
+ * @return Allocated memory (16-byte aligned) / orxNULL
+ * @note Main thread only
+ */
+extern orxDLLAPI void *orxFASTCALL      orxMemory_AllocateFrame(orxU32 _u32Size);
+
+/** Resets the frame arena, releasing all memory allocated with orxMemory_AllocateFrame
+ * @note Called once per frame by the clock module, main thread only
+ */
+extern orxDLLAPI void orxFASTCALL       orxMemory_ResetFrameArena();
+
+/** Sets a custom allocator for a memory type
+ * @param[in]  _eMemType    Concerned memory type
+ * @param[in]  _pfnAllocate Allocate function, orxNULL to restore the system allocator
+ * @param[in]  _pfnFree     Free function, orxNULL to restore the system allocator
+ * @param[in]  _pContext    Context that will be given to both functions
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ * @note The allocator can only be changed when the memory type has no live allocation, which is only checked for blocks counted in statistics
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxMemory_SetAllocator(orxMEMORY_TYPE _eMemType, orxMEMORY_ALLOCATE_FUNCTION _pfnAllocate, orxMEMORY_FREE_FUNCTION _pfnFree, void *_pContext);
+
 /** Gets the an aligned data size
  * @param[in]  _u32OriginalValue Original value (ex: 70)
  * @param[in]  _u32AlignValue    Align size (The value has to be a power of 2 and > 0) (ex : 32)
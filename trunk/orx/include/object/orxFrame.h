@@ -135,6 +135,12 @@ extern orxDLLAPI orxBOOL orxFASTCALL          orxFrame_IsRootChild(const orxFRAM
  */
 extern orxDLLAPI orxBOOL orxFASTCALL          orxFrame_IsDirty(const orxFRAME *_pstFrame);
 
+/** Gets a frame revision, which changes every time the frame global data (position, rotation or scale) changes
+ * @param[in]   _pstFrame       Concerned frame
+ * @return Revision, unique among all frames
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxFrame_GetRevision(orxFRAME *_pstFrame);
+
 
 /** Sets a frame position
  * @param[in]   _pstFrame       Concerned frame
@@ -50,6 +50,7 @@
 #include "anim/orxAnimSet.h"
 #include "display/orxDisplay.h"
 #include "math/orxOBox.h"
+#include "physics/orxPhysics.h"
 #include "sound/orxSound.h"
 
 
@@ -142,6 +143,18 @@ extern orxDLLAPI void orxFASTCALL           orxObject_SetRendered(orxOBJECT *_ps
  */
 extern orxDLLAPI orxBOOL orxFASTCALL        orxObject_IsRendered(const orxOBJECT *_pstObject);
 
+/** Sets static status of an object (static objects can be cached by viewports that have a static cache)
+ * @param[in]   _pstObject    Concerned object
+ * @param[in]   _bStatic      Static or not
+ */
+extern orxDLLAPI void orxFASTCALL           orxObject_SetStatic(orxOBJECT *_pstObject, orxBOOL _bStatic);
+
+/** Is object static?
+ * @param[in]   _pstObject    Concerned object
+ * @return      orxTRUE if static, orxFALSE otherwise
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL        orxObject_IsStatic(const orxOBJECT *_pstObject);
+
 
 /** Sets user data for an object
  * @param[in]   _pstObject    Concerned object
@@ -386,6 +399,13 @@ extern orxDLLAPI orxBOOL orxFASTCALL        orxObject_IsTargetAnim(const orxOBJE
  */
 extern orxDLLAPI orxOBOX *orxFASTCALL       orxObject_GetBoundingBox(const orxOBJECT *_pstObject, orxOBOX *_pstBoundingBox);
 
+/** Gets object's axis aligned bounding box (AABB), ie. the one enclosing its bounding box
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _pstBoundingBox Axis aligned bounding box result
+ * @return      Axis aligned bounding box / orxNULL
+ */
+extern orxDLLAPI orxAABOX *orxFASTCALL      orxObject_GetBoundingAABox(const orxOBJECT *_pstObject, orxAABOX *_pstBoundingBox);
+
 
 /** Sets an object speed
  * @param[in]   _pstObject      Concerned object
@@ -493,6 +513,15 @@ extern orxDLLAPI orxSTATUS orxFASTCALL      orxObject_ApplyImpulse(orxOBJECT *_p
  */
 extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_Raycast(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxVECTOR *_pvContact, orxVECTOR *_pvNormal);
 
+/** Issues a batch of queries (rays, box & sphere overlaps) to test for potential objects
+ * @param[in]   _astQueryList   List of queries
+ * @param[in]   _u32QueryNumber Number of queries
+ * @param[out]  _astHitList     List that will receive the hits: hOwner will hold the orxOBJECT (orxNULL if the body isn't owned by an object)
+ * @param[in]   _u32HitNumber   Size of the hit list, extra hits are dropped
+ * @return Number of hits written in _astHitList
+ */
+extern orxDLLAPI orxU32 orxFASTCALL         orxObject_Query(const orxPHYSICS_QUERY *_astQueryList, orxU32 _u32QueryNumber, orxPHYSICS_HIT *_astHitList, orxU32 _u32HitNumber);
+
 
 /** Sets object color
  * @param[in]   _pstObject      Concerned object
@@ -616,7 +645,7 @@ extern orxDLLAPI const orxSTRING orxFASTCALL orxObject_GetName(const orxOBJECT *
 
 /** Creates a list of object at neighboring of the given box (ie. whose bounding volume intersects this box)
  * @param[in]   _pstCheckBox    Box to check intersection with
- * @return      orxBANK / orxNULL
+ * @return      orxBANK (only valid until the end of the current frame) / orxNULL
  */
 extern orxDLLAPI orxBANK *orxFASTCALL       orxObject_CreateNeighborList(const orxOBOX *_pstCheckBox);
 
@@ -95,6 +95,12 @@
 
 #define orxSTRUCTURE_MAGIC_TAG_DELETED    0xDEADC0DE
 
+/** Structure handle: slot index (bits 0-31), structure ID (bits 32-39) & slot generation (bits 40-63)
+ */
+typedef orxU64 orxSTRUCTURE_HANDLE;
+
+#define orxSTRUCTURE_HANDLE_NONE          ((orxSTRUCTURE_HANDLE)0)
+
 
 /** Structure IDs
  */
@@ -224,6 +230,34 @@ extern orxDLLAPI orxSTRUCTURE *orxFASTCALL              orxStructure_Create(orxS
 extern orxDLLAPI orxSTATUS orxFASTCALL                  orxStructure_Delete(void *_pStructure);
 
 
+/** Gets structure handle, it becomes stale as soon as the structure is deleted
+ * @param[in]   _pStructure    Concerned structure
+ * @return      orxSTRUCTURE_HANDLE
+ */
+extern orxDLLAPI orxSTRUCTURE_HANDLE orxFASTCALL        orxStructure_GetHandle(const void *_pStructure);
+
+/** Gets structure from its handle (O(1))
+ * @param[in]   _hHandle       Concerned handle
+ * @return      orxSTRUCTURE / orxNULL if the structure has been deleted
+ */
+extern orxDLLAPI orxSTRUCTURE *orxFASTCALL              orxStructure_GetFromHandle(orxSTRUCTURE_HANDLE _hHandle);
+
+/** Is the structure referenced by the handle still alive?
+ * @param[in]   _hHandle       Concerned handle
+ * @return      orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL                    orxStructure_IsAlive(orxSTRUCTURE_HANDLE _hHandle);
+
+
+/** Gets all the structures of a given type as a packed array, for linear iteration
+ * Deleting a structure moves the last one in its place, hence the array order differs from the storage one
+ * @param[in]   _eStructureID   Concerned structure ID
+ * @param[out]  _pu32Number     Number of structures in the array
+ * @return      Structure array (valid till next creation/deletion of this type) / orxNULL
+ */
+extern orxDLLAPI orxSTRUCTURE *const *orxFASTCALL       orxStructure_GetArray(orxSTRUCTURE_ID _eStructureID, orxU32 *_pu32Number);
+
+
 /** Gets structure storage type
  * @param[in]   _eStructureID   Concerned structure ID
  * @return      orxSTRUCTURE_STORAGE_TYPE
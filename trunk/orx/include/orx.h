@@ -111,10 +111,10 @@ static void orxFASTCALL orx_MainSetup()
   orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_EVENT);
   orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_FILE);
   orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_FILESYSTEM);
-  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_LOCALE);
   orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PLUGIN);
   orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_OBJECT);
 
+  orxModule_AddOptionalDependency(orxMODULE_ID_MAIN, orxMODULE_ID_LOCALE);
   orxModule_AddOptionalDependency(orxMODULE_ID_MAIN, orxMODULE_ID_SCREENSHOT);
 
   return;
@@ -173,6 +173,9 @@ static orxINLINE void orx_Execute(orxU32 _u32NbParams, orxSTRING _azParams[], co
 
           /* Updates clock system */
           eClockStatus = orxClock_Update();
+
+          /* Reloads modified config files */
+          orxConfig_UpdateWatch();
         }
       }
 
@@ -71,6 +71,7 @@
 #include "main/orxParam.h"
 
 #include "math/orxAABox.h"
+#include "math/orxBatch.h"
 #include "math/orxMath.h"
 #include "math/orxOBox.h"
 #include "math/orxVector.h"
@@ -282,6 +282,15 @@ extern orxDLLAPI orxSTATUS orxFASTCALL        orxBody_ApplyImpulse(orxBODY *_pst
  */
 extern orxDLLAPI orxBODY *orxFASTCALL         orxBody_Raycast(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxVECTOR *_pvContact, orxVECTOR *_pvNormal);
 
+/** Issues a batch of queries (rays, box & sphere overlaps) to test for potential bodies
+ * @param[in]   _astQueryList   List of queries
+ * @param[in]   _u32QueryNumber Number of queries
+ * @param[out]  _astHitList     List that will receive the hits: hBody will hold the orxBODY and hOwner its owner
+ * @param[in]   _u32HitNumber   Size of the hit list, extra hits are dropped
+ * @return Number of hits written in _astHitList
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxBody_Query(const orxPHYSICS_QUERY *_astQueryList, orxU32 _u32QueryNumber, orxPHYSICS_HIT *_astHitList, orxU32 _u32HitNumber);
+
 
 /** Applies physics simulation result to the Body
  * @param[in]   _pstBody                      Concerned body
@@ -150,6 +150,45 @@ typedef struct __orxPHYSICS_EVENT_PAYLOAD_t
 
 } orxPHYSICS_EVENT_PAYLOAD;
 
+/** Query type enum
+ */
+typedef enum __orxPHYSICS_QUERY_TYPE_t
+{
+  orxPHYSICS_QUERY_TYPE_RAY = 0,          /**< Segment, first hit only */
+  orxPHYSICS_QUERY_TYPE_BOX,              /**< Axis aligned box overlap, all hits */
+  orxPHYSICS_QUERY_TYPE_SPHERE,           /**< Sphere overlap, all hits */
+
+  orxPHYSICS_QUERY_TYPE_NUMBER,
+
+  orxPHYSICS_QUERY_TYPE_NONE = orxENUM_NONE
+
+} orxPHYSICS_QUERY_TYPE;
+
+/** Query structure
+ */
+typedef struct __orxPHYSICS_QUERY_t
+{
+  orxVECTOR             vStart;           /**< Ray start / box top left / sphere center : 12 */
+  orxVECTOR             vEnd;             /**< Ray end / box bottom right : 24 */
+  orxFLOAT              fRadius;          /**< Sphere radius : 28 */
+  orxPHYSICS_QUERY_TYPE eType;            /**< Query type : 32 */
+  orxU16                u16SelfFlags;     /**< Self flags used for filtering (0xFFFF for no filtering) : 34 */
+  orxU16                u16CheckMask;     /**< Check mask used for filtering (0xFFFF for no filtering) : 36 */
+
+} orxPHYSICS_QUERY;
+
+/** Query hit structure
+ */
+typedef struct __orxPHYSICS_HIT_t
+{
+  orxVECTOR             vContact;         /**< Contact position (rays only, body position otherwise) : 12 */
+  orxVECTOR             vNormal;          /**< Contact normal (rays only, null vector otherwise) : 24 */
+  orxHANDLE             hBody;            /**< Hit body's user data : 28 */
+  orxHANDLE             hOwner;           /**< Hit body's owner (filled by orxBody_Query) : 32 */
+  orxU32                u32QueryIndex;    /**< Index of the query that produced this hit : 36 */
+
+} orxPHYSICS_HIT;
+
 /** Internal physics body structure
  */
 typedef struct __orxPHYSICS_BODY_t        orxPHYSICS_BODY;
@@ -344,6 +383,17 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxPhysics_ApplyImpulse(or
  */
 extern orxDLLAPI orxHANDLE orxFASTCALL                orxPhysics_Raycast(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxVECTOR *_pvContact, orxVECTOR *_pvNormal);
 
+/** Issues a batch of queries (rays, box & sphere overlaps) against the physics world
+ * Hits are tested against the actual body part shapes and reported in query order. Rays report their closest hit only,
+ * overlaps report every overlapping body once. Queries use the world's broadphase and must be issued from the thread that updates physics.
+ * @param[in]   _astQueryList                         List of queries
+ * @param[in]   _u32QueryNumber                       Number of queries
+ * @param[out]  _astHitList                           List that will receive the hits
+ * @param[in]   _u32HitNumber                         Size of the hit list, extra hits are dropped
+ * @return Number of hits written in _astHitList
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxPhysics_Query(const orxPHYSICS_QUERY *_astQueryList, orxU32 _u32QueryNumber, orxPHYSICS_HIT *_astHitList, orxU32 _u32HitNumber);
+
 
 /** Enables/disables physics simulation
  * @param[in]   _bEnable                              Enable / disable
@@ -51,6 +51,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_t
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_DELETE_BITMAP,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SAVE_BITMAP,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_LOAD_BITMAP,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_BITMAP_DATA,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_TRANSFORM_BITMAP,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_CLEAR_BITMAP,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_BLIT_BITMAP,
@@ -85,6 +86,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_t
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_VIDEO_MODE,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_VIDEO_MODE,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_IS_VIDEO_MODE_AVAILABLE,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_ENABLE_CONTEXT,
 
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_NUMBER,
 
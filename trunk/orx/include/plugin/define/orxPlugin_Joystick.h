@@ -49,6 +49,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_JOYSTICK_t
 
   orxPLUGIN_FUNCTION_BASE_ID_JOYSTICK_GET_AXIS_VALUE,
   orxPLUGIN_FUNCTION_BASE_ID_JOYSTICK_IS_BUTTON_PRESSED,
+  orxPLUGIN_FUNCTION_BASE_ID_JOYSTICK_GET_STATE,
 
   orxPLUGIN_FUNCTION_BASE_ID_JOYSTICK_NUMBER,
 
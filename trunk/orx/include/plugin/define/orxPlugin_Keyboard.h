@@ -50,6 +50,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_KEYBOARD_t
   orxPLUGIN_FUNCTION_BASE_ID_KEYBOARD_HIT,
   orxPLUGIN_FUNCTION_BASE_ID_KEYBOARD_READ,
   orxPLUGIN_FUNCTION_BASE_ID_KEYBOARD_CLEAR_BUFFER,
+  orxPLUGIN_FUNCTION_BASE_ID_KEYBOARD_GET_KEY_BITSET,
 
   orxPLUGIN_FUNCTION_BASE_ID_KEYBOARD_NUMBER,
 
@@ -52,6 +52,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_MOUSE_t
   orxPLUGIN_FUNCTION_BASE_ID_MOUSE_GET_MOVE_DELTA,
   orxPLUGIN_FUNCTION_BASE_ID_MOUSE_GET_WHEEL_DELTA,
   orxPLUGIN_FUNCTION_BASE_ID_MOUSE_SHOW_CURSOR,
+  orxPLUGIN_FUNCTION_BASE_ID_MOUSE_GET_BUTTON_BITSET,
 
   orxPLUGIN_FUNCTION_BASE_ID_MOUSE_NUMBER,
 
@@ -74,6 +74,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_t
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_APPLY_IMPULSE,
 
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_RAYCAST,
+  orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_QUERY,
 
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_ENABLE_SIMULATION,
 
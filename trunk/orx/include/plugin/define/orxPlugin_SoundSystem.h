@@ -49,6 +49,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_t
   orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_EXIT,
   orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_LOAD_SAMPLE,
   orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_UNLOAD_SAMPLE,
+  orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_GET_SAMPLE_SIZE,
   orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_CREATE_FROM_SAMPLE,
   orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_CREATE_STREAM_FROM_FILE,
   orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_DELETE,
@@ -105,6 +105,12 @@ extern orxDLLAPI orxHANDLE orxFASTCALL          orxPlugin_GetHandle(const orxSTR
  */
 extern orxDLLAPI const orxSTRING orxFASTCALL    orxPlugin_GetName(orxHANDLE _hPluginHandle);
 
+/** Is a core function loaded? Used to probe optional core functions without calling their default implementation
+ * @param[in] _eFunctionID      Concerned core function ID (see orxPLUGIN_MAKE_CORE_FUNCTION_ID)
+ * @return orxTRUE if a plugin provides it, orxFALSE otherwise
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL            orxPlugin_IsCoreFunctionLoaded(orxPLUGIN_FUNCTION_ID _eFunctionID);
+
 #endif /* _orxPLUGIN_H_ */
 
 /** @} */
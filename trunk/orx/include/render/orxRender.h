@@ -53,6 +53,7 @@
 #define orxRENDER_KZ_CONFIG_SECTION       "Render"
 #define orxRENDER_KZ_CONFIG_SHOW_FPS      "ShowFPS"
 #define orxRENDER_KZ_CONFIG_MIN_FREQUENCY "MinFrequency"
+#define orxRENDER_KZ_CONFIG_THREADED      "Threaded"
 
 
 /** Event enum
@@ -152,6 +152,45 @@ extern orxDLLAPI void orxFASTCALL             orxViewport_EnableBackgroundCleari
  */
 extern orxDLLAPI orxBOOL orxFASTCALL          orxViewport_IsBackgroundClearingEnabled(const orxVIEWPORT *_pstViewport);
 
+/** Enables / disables static objects cache for a viewport: static objects are then rendered once in a cache that is composited below dynamic ones
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _bEnable        Enable / disable
+ */
+extern orxDLLAPI void orxFASTCALL             orxViewport_EnableStaticCache(orxVIEWPORT *_pstViewport, orxBOOL _bEnable);
+
+/** Has a viewport static objects cache enabled?
+ * @param[in]   _pstViewport    Concerned viewport
+ * @return      orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxViewport_IsStaticCacheEnabled(const orxVIEWPORT *_pstViewport);
+
+/** Gets a viewport static objects cache, (re)creating it if its size doesn't match
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _u32Width       Cache width
+ * @param[in]   _u32Height      Cache height
+ * @return      orxBITMAP / orxNULL
+ */
+extern orxDLLAPI orxBITMAP *orxFASTCALL       orxViewport_GetStaticCache(orxVIEWPORT *_pstViewport, orxU32 _u32Width, orxU32 _u32Height);
+
+/** Is a viewport static objects cache valid for a signature (camera & static objects state)?
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _u32Signature   Current signature
+ * @return      orxTRUE if cache content is valid for this signature, orxFALSE if it has to be redrawn
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxViewport_IsStaticCacheValid(const orxVIEWPORT *_pstViewport, orxU32 _u32Signature);
+
+/** Validates a viewport static objects cache for a signature, once its content has been successfully captured
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _pstCache       Cache bitmap that has been captured, ignored if it's not the current cache anymore
+ * @param[in]   _u32Signature   Signature of the captured content
+ */
+extern orxDLLAPI void orxFASTCALL             orxViewport_ValidateStaticCache(orxVIEWPORT *_pstViewport, const orxBITMAP *_pstCache, orxU32 _u32Signature);
+
+/** Invalidates a viewport static objects cache, forcing it to be redrawn (needed when static objects' textures are modified)
+ * @param[in]   _pstViewport    Concerned viewport
+ */
+extern orxDLLAPI void orxFASTCALL             orxViewport_InvalidateStaticCache(orxVIEWPORT *_pstViewport);
+
 
 /** Sets a viewport camera
  * @param[in]   _pstViewport    Concerned viewport
@@ -87,6 +87,22 @@ typedef struct __orxSOUND_EVENT_PAYLOAD_t
 
 } orxSOUND_EVENT_PAYLOAD;
 
+/** Sample cache stats
+ */
+typedef struct __orxSOUND_CACHE_STATS_t
+{
+  orxU32    u32HitCounter;                    /**< Sample loads served from cache : 4 */
+  orxU32    u32MissCounter;                   /**< Sample loads from file : 8 */
+  orxU32    u32EvictionCounter;               /**< Unused samples evicted to fit in budget : 12 */
+  orxU32    u32SampleCounter;                 /**< Loaded samples : 16 */
+  orxU32    u32IdleCounter;                   /**< Loaded samples currently unused : 20 */
+  orxU32    u32ResidentSize;                  /**< Size of loaded samples, in bytes : 24 */
+  orxU32    u32IdleSize;                      /**< Size of unused samples, in bytes : 28 */
+  orxU32    u32Budget;                        /**< Cache budget, in bytes : 32 */
+  orxFLOAT  fHitRate;                         /**< Hit rate (0.0 - 1.0) : 36 */
+
+} orxSOUND_CACHE_STATS;
+
 
 /** Sound module setup
  */
@@ -233,6 +249,31 @@ extern orxDLLAPI orxSOUND_STATUS orxFASTCALL  orxSound_GetStatus(const orxSOUND
  */
 extern orxDLLAPI const orxSTRING orxFASTCALL  orxSound_GetName(const orxSOUND *_pstSound);
 
+
+/** Prefetches a group of sounds: their samples stay loaded till the group is released
+ * @param[in]   _zGroupID     Config ID of the group, its SoundList contains sound config IDs
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxSound_PrefetchGroup(const orxSTRING _zGroupID);
+
+/** Releases a prefetched group of sounds: its samples can then be evicted once unused
+ * @param[in]   _zGroupID     Config ID of the group
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxSound_ReleaseGroup(const orxSTRING _zGroupID);
+
+/** Sets sample cache budget, evicting unused samples if needed
+ * @param[in]   _u32Budget    Budget, in bytes. Unused samples are never kept beyond it, samples in use may exceed it
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxSound_SetCacheBudget(orxU32 _u32Budget);
+
+/** Gets sample cache stats
+ * @param[out]  _pstStats     Cache stats
+ * @return      orxSOUND_CACHE_STATS
+ */
+extern orxDLLAPI orxSOUND_CACHE_STATS *orxFASTCALL orxSound_GetCacheStats(orxSOUND_CACHE_STATS *_pstStats);
+
 #endif /*_orxSOUND_H_*/
 
 /** @} */
@@ -109,6 +109,12 @@ extern orxDLLAPI orxSOUNDSYSTEM_SAMPLE *orxFASTCALL   orxSoundSystem_LoadSample(
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxSoundSystem_UnloadSample(orxSOUNDSYSTEM_SAMPLE *_pstSample);
 
+/** Gets the memory size of a sound sample's decoded data
+ * @param[in]   _pstSample                            Concerned sample
+ * @return      Size in bytes, 0 if unknown
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxSoundSystem_GetSampleSize(const orxSOUNDSYSTEM_SAMPLE *_pstSample);
+
 /** Creates a sound from preloaded sample (can be played directly)
  * @param[in]   _pstSample                            Concerned sample
  * @return orxSOUNDSYSTEM_SOUND / orxNULL
@@ -32,6 +32,8 @@
  * 
  * Screenshot module
  * Module that captures screenshots
+ * TGA, PNG & raw (RGBA) screenshots are encoded and written by a background thread, using pooled staging buffers.
+ * Other extensions are saved synchronously by the display plugin.
  *
  * @{
  */
@@ -50,6 +52,7 @@
 #define orxSCREENSHOT_KZ_DEFAULT_BASE_NAME      "screenshot-"
 #define orxSCREENSHOT_KZ_DEFAULT_EXTENSION      "tga"
 #define orxSCREENSHOT_KU32_DEFAULT_DIGITS       4
+#define orxSCREENSHOT_KU32_DEFAULT_BUFFER_NUMBER 4
 
 
 /** Screenshot module setup
@@ -70,6 +73,26 @@ extern orxDLLAPI void orxFASTCALL       orxScreenshot_Exit();
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxScreenshot_Capture();
 
+/** Waits till all pending screenshots have been written
+ */
+extern orxDLLAPI void orxFASTCALL       orxScreenshot_Flush();
+
+/** Starts recording: captures every rendered frame, with the core clock running at a fixed DT
+ * @param[in]   _u32FrameNumber         Number of frames to record, 0 for recording till orxScreenshot_StopRecording is called
+ * @param[in]   _fDT                    Fixed DT to use, <= 0 to keep the current core clock modifier
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxScreenshot_StartRecording(orxU32 _u32FrameNumber, orxFLOAT _fDT);
+
+/** Stops recording, restoring core clock modifier
+ */
+extern orxDLLAPI void orxFASTCALL       orxScreenshot_StopRecording();
+
+/** Is recording?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL    orxScreenshot_IsRecording();
+
 #endif /* _orxSCREENSHOT_H_ */
 
 /** @} */
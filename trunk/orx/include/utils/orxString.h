@@ -68,6 +68,11 @@
 #define orxSTRING_KC_VECTOR_END_ALT     '}'
 
 
+/** Gets the name of the CRC implementation selected at build time (CRCs are only stable within a same implementation)
+ * @return CRC implementation name
+ */
+extern orxDLLAPI const orxSTRING orxFASTCALL orxString_GetCRCImplementation();
+
 /** Continues a CRC with a string one
  * @param[in] _zString        String used to continue the given CRC
  * @param[in] _u32CRC         Base CRC.
@@ -0,0 +1,758 @@
+/* Orx - Portable Game Engine
+ *
+ * Orx is the legal property of its developers, whose names
+ * are listed in the COPYRIGHT file distributed
+ * with this source distribution.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file orxDisplay.c
+ * @date 19/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * Dummy display plugin implementation
+ *
+ * Headless display: bitmaps and texts only keep their sizes and colors,
+ * nothing is ever drawn. Used to run orx without any window (benchmarks, servers).
+ *
+ */
+
+
+#include "orxPluginAPI.h"
+
+
+/** Module flags
+ */
+#define orxDISPLAY_KU32_STATIC_FLAG_NONE              0x00000000 /**< No flags */
+
+#define orxDISPLAY_KU32_STATIC_FLAG_READY             0x00000001 /**< Ready flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_VSYNC             0x00000002 /**< VSync flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN        0x00000004 /**< FullScreen flag */
+
+#define orxDISPLAY_KU32_STATIC_MASK_ALL               0xFFFFFFFF /**< All mask */
+
+/** Misc defines
+ */
+#define orxDISPLAY_KU32_SCREEN_WIDTH                  1024
+#define orxDISPLAY_KU32_SCREEN_HEIGHT                 768
+#define orxDISPLAY_KU32_SCREEN_DEPTH                  32
+
+#define orxDISPLAY_KU32_BITMAP_BANK_SIZE              128
+#define orxDISPLAY_KU32_TEXT_BANK_SIZE                32
+
+#define orxDISPLAY_KU32_LOADED_BITMAP_SIZE            32          /**< Size reported for all loaded bitmaps */
+#define orxDISPLAY_KF_CHARACTER_WIDTH                 orx2F(8.0f) /**< Fixed character width */
+#define orxDISPLAY_KF_CHARACTER_HEIGHT                orx2F(16.0f)/**< Fixed character height */
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Bitmap structure
+ */
+struct __orxBITMAP_t
+{
+  orxFLOAT  fWidth, fHeight;
+  orxRGBA   stColor;
+};
+
+/** Text structure
+ */
+struct __orxDISPLAY_TEXT_t
+{
+  orxSTRING zString;
+  orxSTRING zFont;
+};
+
+/** Static structure
+ */
+typedef struct __orxDISPLAY_STATIC_t
+{
+  orxU32    u32Flags;
+  orxU32    u32ScreenDepth;
+  orxBITMAP stScreen;
+  orxBANK  *pstBitmapBank;
+  orxBANK  *pstTextBank;
+
+} orxDISPLAY_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxDISPLAY_STATIC sstDisplay;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Allocates a bitmap
+ * @param[in]   _fWidth                               Bitmap width
+ * @param[in]   _fHeight                              Bitmap height
+ * @return orxBITMAP / orxNULL
+ */
+static orxINLINE orxBITMAP *orxDisplay_Dummy_AllocateBitmap(orxFLOAT _fWidth, orxFLOAT _fHeight)
+{
+  orxBITMAP *pstResult;
+
+  /* Allocates it */
+  pstResult = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+
+  /* Valid? */
+  if(pstResult != orxNULL)
+  {
+    /* Inits it */
+    pstResult->fWidth   = _fWidth;
+    pstResult->fHeight  = _fHeight;
+    pstResult->stColor  = orx2RGBA(0xFF, 0xFF, 0xFF, 0xFF);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+
+/***************************************************************************
+ * Public functions                                                        *
+ ***************************************************************************/
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_GetScreen()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return &(sstDisplay.stScreen);
+}
+
+orxDISPLAY_TEXT *orxFASTCALL orxDisplay_Dummy_CreateText()
+{
+  orxDISPLAY_TEXT *pstResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Allocates it */
+  pstResult = (orxDISPLAY_TEXT *)orxBank_Allocate(sstDisplay.pstTextBank);
+
+  /* Valid? */
+  if(pstResult != orxNULL)
+  {
+    /* No string nor font */
+    pstResult->zString  = orxNULL;
+    pstResult->zFont    = orxNULL;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+void orxFASTCALL orxDisplay_Dummy_DeleteText(orxDISPLAY_TEXT *_pstText)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstText != orxNULL);
+
+  /* Frees text */
+  orxBank_Free(sstDisplay.pstTextBank, _pstText);
+
+  return;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_TransformText(orxBITMAP *_pstDst, const orxDISPLAY_TEXT *_pstText, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstDst != orxNULL);
+  orxASSERT(_pstText != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetTextString(orxDISPLAY_TEXT *_pstText, const orxSTRING _zString)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstText != orxNULL);
+
+  /* Stores it (owned by text module) */
+  _pstText->zString = _zString;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetTextFont(orxDISPLAY_TEXT *_pstText, const orxSTRING _zFont)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstText != orxNULL);
+
+  /* Stores it (owned by text module) */
+  _pstText->zFont = _zFont;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTRING orxFASTCALL orxDisplay_Dummy_GetTextString(const orxDISPLAY_TEXT *_pstText)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstText != orxNULL);
+
+  /* Done! */
+  return (_pstText->zString != orxNULL) ? _pstText->zString : orxSTRING_EMPTY;
+}
+
+orxSTRING orxFASTCALL orxDisplay_Dummy_GetTextFont(const orxDISPLAY_TEXT *_pstText)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstText != orxNULL);
+
+  /* Done! */
+  return (_pstText->zFont != orxNULL) ? _pstText->zFont : orxSTRING_EMPTY;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetTextSize(const orxDISPLAY_TEXT *_pstText, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstText != orxNULL);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Uses fixed size characters */
+  *_pfWidth   = (_pstText->zString != orxNULL) ? orxDISPLAY_KF_CHARACTER_WIDTH * orxU2F(orxString_GetLength(_pstText->zString)) : orxFLOAT_0;
+  *_pfHeight  = orxDISPLAY_KF_CHARACTER_HEIGHT;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_PrintString(const orxBITMAP *_pstBitmap, const orxSTRING _zString, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+void orxFASTCALL orxDisplay_Dummy_DeleteBitmap(orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Not screen? */
+  if(_pstBitmap != &(sstDisplay.stScreen))
+  {
+    /* Frees it */
+    orxBank_Free(sstDisplay.pstBitmapBank, _pstBitmap);
+  }
+
+  return;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_CreateBitmap(orxU32 _u32Width, orxU32 _u32Height)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxDisplay_Dummy_AllocateBitmap(orxU2F(_u32Width), orxU2F(_u32Height));
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_ClearBitmap(orxBITMAP *_pstBitmap, orxRGBA _stColor)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_Swap()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapColorKey(orxBITMAP *_pstBitmap, orxRGBA _stColor, orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapColor(orxBITMAP *_pstBitmap, orxRGBA _stColor)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Stores it */
+  _pstBitmap->stColor = _stColor;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxRGBA orxFASTCALL orxDisplay_Dummy_GetBitmapColor(const orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Done! */
+  return _pstBitmap->stColor;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_BlitBitmap(orxBITMAP *_pstDst, const orxBITMAP *_pstSrc, const orxFLOAT _fPosX, orxFLOAT _fPosY, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstDst != orxNULL);
+  orxASSERT(_pstSrc != orxNULL);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_TransformBitmap(orxBITMAP *_pstDst, const orxBITMAP *_pstSrc, const orxDISPLAY_TRANSFORM *_pstTransform, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstDst != orxNULL);
+  orxASSERT(_pstSrc != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFilename)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_zFilename != orxNULL);
+
+  /* Nothing to save */
+  return orxSTATUS_FAILURE;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_LoadBitmap(const orxSTRING _zFilename)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zFilename != orxNULL);
+
+  /* Doesn't decode anything: all loaded bitmaps get the same size */
+  return orxDisplay_Dummy_AllocateBitmap(orxU2F(orxDISPLAY_KU32_LOADED_BITMAP_SIZE), orxU2F(orxDISPLAY_KU32_LOADED_BITMAP_SIZE));
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Valid size? */
+  if(_u32ByteNumber == orxF2U(_pstBitmap->fWidth) * orxF2U(_pstBitmap->fHeight) * 4)
+  {
+    orxU32 i;
+
+    /* Nothing is ever drawn: clears it to opaque black */
+    orxMemory_Zero(_au8Data, _u32ByteNumber);
+    for(i = 3; i < _u32ByteNumber; i += 4)
+    {
+      _au8Data[i] = 0xFF;
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetBitmapSize(const orxBITMAP *_pstBitmap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Gets size */
+  *_pfWidth   = _pstBitmap->fWidth;
+  *_pfHeight  = _pstBitmap->fHeight;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetScreenSize(orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Gets size */
+  *_pfWidth   = sstDisplay.stScreen.fWidth;
+  *_pfHeight  = sstDisplay.stScreen.fHeight;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapClipping(orxBITMAP *_pstBitmap, orxU32 _u32TLX, orxU32 _u32TLY, orxU32 _u32BRX, orxU32 _u32BRY)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_EnableVSync(orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates status */
+  if(_bEnable != orxFALSE)
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VSYNC, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_VSYNC);
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Dummy_IsVSyncEnabled()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VSYNC) ? orxTRUE : orxFALSE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetFullScreen(orxBOOL _bFullScreen)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates status */
+  if(_bFullScreen != orxFALSE)
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN);
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Dummy_IsFullScreen()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN) ? orxTRUE : orxFALSE;
+}
+
+orxU32 orxFASTCALL orxDisplay_Dummy_GetVideoModeCounter()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Only the current one */
+  return 1;
+}
+
+orxDISPLAY_VIDEO_MODE *orxFASTCALL orxDisplay_Dummy_GetVideoMode(orxU32 _u32Index, orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  orxDISPLAY_VIDEO_MODE *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Valid index? */
+  if(_u32Index == 0)
+  {
+    /* Stores current mode */
+    _pstVideoMode->u32Width   = orxF2U(sstDisplay.stScreen.fWidth);
+    _pstVideoMode->u32Height  = orxF2U(sstDisplay.stScreen.fHeight);
+    _pstVideoMode->u32Depth   = sstDisplay.u32ScreenDepth;
+
+    /* Updates result */
+    pstResult = _pstVideoMode;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetVideoMode(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Stores it */
+  sstDisplay.stScreen.fWidth  = orxU2F(_pstVideoMode->u32Width);
+  sstDisplay.stScreen.fHeight = orxU2F(_pstVideoMode->u32Height);
+  sstDisplay.u32ScreenDepth   = _pstVideoMode->u32Depth;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Dummy_IsVideoModeAvailable(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Any mode will do */
+  return orxTRUE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_EnableContext(orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* No context: any thread will do */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_Init()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Was not already initialized? */
+  if(!(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY))
+  {
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+
+    /* Creates banks */
+    sstDisplay.pstBitmapBank  = orxBank_Create(orxDISPLAY_KU32_BITMAP_BANK_SIZE, sizeof(orxBITMAP), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_VIDEO);
+    sstDisplay.pstTextBank    = orxBank_Create(orxDISPLAY_KU32_TEXT_BANK_SIZE, sizeof(orxDISPLAY_TEXT), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Valid? */
+    if((sstDisplay.pstBitmapBank != orxNULL) && (sstDisplay.pstTextBank != orxNULL))
+    {
+      orxU32 u32ConfigWidth, u32ConfigHeight, u32ConfigDepth;
+
+      /* Gets resolution from config */
+      orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+      u32ConfigWidth  = orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_WIDTH);
+      u32ConfigHeight = orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_HEIGHT);
+      u32ConfigDepth  = orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_DEPTH);
+
+      /* Stores screen values */
+      sstDisplay.stScreen.fWidth  = orxU2F((u32ConfigWidth > 0) ? u32ConfigWidth : orxDISPLAY_KU32_SCREEN_WIDTH);
+      sstDisplay.stScreen.fHeight = orxU2F((u32ConfigHeight > 0) ? u32ConfigHeight : orxDISPLAY_KU32_SCREEN_HEIGHT);
+      sstDisplay.stScreen.stColor = orx2RGBA(0xFF, 0xFF, 0xFF, 0xFF);
+      sstDisplay.u32ScreenDepth   = (u32ConfigDepth > 0) ? u32ConfigDepth : orxDISPLAY_KU32_SCREEN_DEPTH;
+
+      /* Updates status */
+      sstDisplay.u32Flags = orxDISPLAY_KU32_STATIC_FLAG_READY;
+
+      /* Stores display modes */
+      orxDisplay_Dummy_EnableVSync(orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_VSYNC));
+      orxDisplay_Dummy_SetFullScreen(orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_FULLSCREEN));
+
+      /* Pops config section */
+      orxConfig_PopSection();
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Failed to create bitmap/text banks.");
+
+      /* Deletes banks */
+      if(sstDisplay.pstBitmapBank != orxNULL)
+      {
+        orxBank_Delete(sstDisplay.pstBitmapBank);
+        sstDisplay.pstBitmapBank = orxNULL;
+      }
+      if(sstDisplay.pstTextBank != orxNULL)
+      {
+        orxBank_Delete(sstDisplay.pstTextBank);
+        sstDisplay.pstTextBank = orxNULL;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+void orxFASTCALL orxDisplay_Dummy_Exit()
+{
+  /* Was initialized? */
+  if(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY)
+  {
+    /* Deletes banks */
+    orxBank_Delete(sstDisplay.pstBitmapBank);
+    orxBank_Delete(sstDisplay.pstTextBank);
+
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+  }
+
+  return;
+}
+
+orxHANDLE orxFASTCALL orxDisplay_Dummy_CreateShader(const orxSTRING _zCode, const orxLINKLIST *_pstParamList)
+{
+  /* No shader support */
+  return orxHANDLE_UNDEFINED;
+}
+
+void orxFASTCALL orxDisplay_Dummy_DeleteShader(orxHANDLE _hShader)
+{
+  return;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_RenderShader(orxHANDLE _hShader)
+{
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetShaderBitmap(orxHANDLE _hShader, const orxSTRING _zParam, orxBITMAP *_pstValue)
+{
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetShaderFloat(orxHANDLE _hShader, const orxSTRING _zParam, orxFLOAT _fValue)
+{
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetShaderVector(orxHANDLE _hShader, const orxSTRING _zParam, const orxVECTOR *_pvValue)
+{
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxHANDLE orxFASTCALL orxDisplay_Dummy_GetApplicationInput()
+{
+  /* No application input */
+  return orxHANDLE_UNDEFINED;
+}
+
+
+/***************************************************************************
+ * Plugin Related                                                          *
+ ***************************************************************************/
+
+orxPLUGIN_USER_CORE_FUNCTION_START(DISPLAY);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_Init, DISPLAY, INIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_Exit, DISPLAY, EXIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_Swap, DISPLAY, SWAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_CreateBitmap, DISPLAY, CREATE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DeleteBitmap, DISPLAY, DELETE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SaveBitmap, DISPLAY, SAVE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_LoadBitmap, DISPLAY, LOAD_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetScreenSize, DISPLAY, GET_SCREEN_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetScreen, DISPLAY, GET_SCREEN_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_ClearBitmap, DISPLAY, CLEAR_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBitmapClipping, DISPLAY, SET_BITMAP_CLIPPING);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_BlitBitmap, DISPLAY, BLIT_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBitmapColorKey, DISPLAY, SET_BITMAP_COLOR_KEY);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBitmapColor, DISPLAY, SET_BITMAP_COLOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetBitmapColor, DISPLAY, GET_BITMAP_COLOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_CreateText, DISPLAY, CREATE_TEXT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DeleteText, DISPLAY, DELETE_TEXT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_TransformText, DISPLAY, TRANSFORM_TEXT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetTextString, DISPLAY, SET_TEXT_STRING);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetTextFont, DISPLAY, SET_TEXT_FONT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetTextString, DISPLAY, GET_TEXT_STRING);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetTextFont, DISPLAY, GET_TEXT_FONT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetTextSize, DISPLAY, GET_TEXT_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_PrintString, DISPLAY, PRINT_STRING);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_CreateShader, DISPLAY, CREATE_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DeleteShader, DISPLAY, DELETE_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_RenderShader, DISPLAY, RENDER_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetShaderBitmap, DISPLAY, SET_SHADER_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetShaderFloat, DISPLAY, SET_SHADER_FLOAT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetShaderVector, DISPLAY, SET_SHADER_VECTOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetApplicationInput, DISPLAY, GET_APPLICATION_INPUT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_EnableVSync, DISPLAY, ENABLE_VSYNC);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_IsVSyncEnabled, DISPLAY, IS_VSYNC_ENABLED);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetFullScreen, DISPLAY, SET_FULL_SCREEN);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_IsFullScreen, DISPLAY, IS_FULL_SCREEN);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetVideoModeCounter, DISPLAY, GET_VIDEO_MODE_COUNTER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetVideoMode, DISPLAY, GET_VIDEO_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetVideoMode, DISPLAY, SET_VIDEO_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_IsVideoModeAvailable, DISPLAY, IS_VIDEO_MODE_AVAILABLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_EnableContext, DISPLAY, ENABLE_CONTEXT);
+orxPLUGIN_USER_CORE_FUNCTION_END();
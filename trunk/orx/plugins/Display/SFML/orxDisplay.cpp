@@ -32,6 +32,13 @@
 #include "orxPluginAPI.h"
 
 #include <SFML/Graphics.hpp>
+
+#ifdef __orxLINUX__
+
+/* Declared here as Xlib's macros (None, Status, ...) clash with SFML's identifiers */
+extern "C" int XInitThreads();
+
+#endif /* __orxLINUX__ */
 #include "render/orxShader.h"
 
 
@@ -78,6 +85,7 @@ typedef struct __orxDISPLAY_STATIC_t
 {
   orxU32            u32Flags;
   orxU32            u32ScreenWidth, u32ScreenHeight, u32ScreenDepth;
+  orxU32            u32ScreenClipTLX, u32ScreenClipTLY, u32ScreenClipBRX, u32ScreenClipBRY;
   unsigned long     ulWindowStyle;
   orxBOOL           bDefaultSmooth;
   sf::RenderWindow *poRenderWindow;
@@ -120,11 +128,14 @@ static orxINLINE sf::Font *orxDisplay_SFML_LoadFont(const orxSTRING _zFontName)
     /* Not already loaded? */
     if((poResult = (sf::Font *)orxHashTable_Get(sstDisplay.pstFontTable, u32Key)) == orxNULL)
     {
+      orxFILE_VIEW stView;
+
       /* Allocates it */
       poResult = new sf::Font;
 
-      /* Tries to load it */
-      if(poResult->LoadFromFile(_zFontName) != false)
+      /* Tries to load it from memory (glyphs are rendered when loading) */
+      if((orxFile_Map(_zFontName, orxFILE_KU32_FLAG_MAP_SEQUENTIAL, &stView) != orxSTATUS_FAILURE)
+      && (poResult->LoadFromMemory(stView.pcData, stView.u32Size) != false))
       {
         /* Stores it */
         orxHashTable_Add(sstDisplay.pstFontTable, u32Key, poResult);
@@ -135,6 +146,9 @@ static orxINLINE sf::Font *orxDisplay_SFML_LoadFont(const orxSTRING _zFontName)
         delete poResult;
         poResult = (sf::Font *)orxNULL;
       }
+
+      /* Unmaps file */
+      orxFile_Unmap(&stView);
     }
   }
 
@@ -142,6 +156,38 @@ static orxINLINE sf::Font *orxDisplay_SFML_LoadFont(const orxSTRING _zFontName)
   return poResult;
 }
 
+/** Reads an area of the frame buffer, top to bottom
+ */
+static orxSTATUS orxFASTCALL orxDisplay_SFML_ReadScreen(orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Width, orxU32 _u32Height, orxU8 *_au8Data)
+{
+  orxU8  *pu8Top, *pu8Bottom;
+  orxU32  u32RowSize, i;
+
+  /* Reads frame buffer directly (bottom to top), without going through an intermediate image */
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glReadPixels((GLint)_u32X, (GLint)(sstDisplay.poRenderWindow->GetHeight() - (_u32Y + _u32Height)), (GLsizei)_u32Width, (GLsizei)_u32Height, GL_RGBA, GL_UNSIGNED_BYTE, _au8Data);
+
+  /* Gets row size */
+  u32RowSize = _u32Width * 4;
+
+  /* Flips rows in place */
+  for(pu8Top = _au8Data, pu8Bottom = _au8Data + (_u32Height - 1) * u32RowSize; pu8Top < pu8Bottom; pu8Top += u32RowSize, pu8Bottom -= u32RowSize)
+  {
+    for(i = 0; i < u32RowSize; i++)
+    {
+      orxU8 u8Temp;
+
+      /* Swaps bytes */
+      u8Temp        = pu8Top[i];
+      pu8Top[i]     = pu8Bottom[i];
+      pu8Bottom[i]  = u8Temp;
+    }
+  }
+
+  /* Done! */
+  return (glGetError() == GL_NO_ERROR) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+}
+
 /** Get SFML blend mode
  */
 static orxINLINE sf::Blend::Mode orxDisplay_SFML_GetBlendMode(orxDISPLAY_BLEND_MODE _eBlendMode)
@@ -311,6 +357,7 @@ static void orxFASTCALL orxDisplay_SFML_EventUpdate(const orxCLOCK_INFO *_pstClo
       case sf::Event::TextEntered:
       case sf::Event::JoyButtonPressed:
       case sf::Event::JoyButtonReleased:
+      case sf::Event::JoyMoved:
       {
         /* Sends reserved event */
         orxEVENT_SEND(orxEVENT_TYPE_FIRST_RESERVED + oEvent.Type, oEvent.Type, orxNULL, orxNULL, &oEvent);
@@ -813,22 +860,76 @@ extern "C" orxSTATUS orxFASTCALL orxDisplay_SFML_BlitBitmap(orxBITMAP *_pstDst,
 
   /* Checks */
   orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
-  orxASSERT((_pstSrc != orxNULL) && (_pstSrc != orxDisplay::spoScreen));
-  orxASSERT((_pstDst == orxDisplay::spoScreen) && "Can only draw on screen with this version!");
+  orxASSERT((_pstSrc != orxNULL) && (_pstDst != orxNULL) && (_pstSrc != _pstDst));
+  orxASSERT(((_pstDst == orxDisplay::spoScreen) || (_pstSrc == orxDisplay::spoScreen)) && "Can only draw on screen with this version!");
 
-  /* Gets sprite */
-  poSprite = (sf::Sprite *)_pstSrc;
+  /* Copies from screen? */
+  if(_pstSrc == orxDisplay::spoScreen)
+  {
+    sf::Image  *poImage;
+    orxU32      u32X, u32Y, u32Width, u32Height;
 
-  /* Updates its position */
-  vPosition.x = _fPosX;
-  vPosition.y = _fPosY;
-  poSprite->SetPosition(vPosition);
+    /* Has clipping? */
+    if(sstDisplay.u32ScreenClipBRX > sstDisplay.u32ScreenClipTLX)
+    {
+      /* Uses it */
+      u32X      = sstDisplay.u32ScreenClipTLX;
+      u32Y      = sstDisplay.u32ScreenClipTLY;
+      u32Width  = sstDisplay.u32ScreenClipBRX - sstDisplay.u32ScreenClipTLX;
+      u32Height = sstDisplay.u32ScreenClipBRY - sstDisplay.u32ScreenClipTLY;
+    }
+    else
+    {
+      /* Uses whole screen */
+      u32X      = u32Y = 0;
+      u32Width  = sstDisplay.poRenderWindow->GetWidth();
+      u32Height = sstDisplay.poRenderWindow->GetHeight();
+    }
+
+    /* Gets destination image */
+    poImage = const_cast<sf::Image *>(((sf::Sprite *)_pstDst)->GetImage());
+
+    /* Size doesn't match? */
+    if((poImage->GetWidth() != u32Width) || (poImage->GetHeight() != u32Height))
+    {
+      /* Resizes it (its texture is only recreated here) */
+      eResult = (poImage->Create(u32Width, u32Height) != false) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    }
+
+    /* Valid? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      GLint iPreviousTexture;
 
-  /* Updates sprite blend mode */
-  poSprite->SetBlendMode(orxDisplay_SFML_GetBlendMode(_eBlendMode));
+      /* Copies screen area straight into destination texture (top left corner, position is ignored) */
+      glGetIntegerv(GL_TEXTURE_BINDING_2D, &iPreviousTexture);
+      poImage->Bind();
+      glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, (GLint)u32X, (GLint)(sstDisplay.poRenderWindow->GetHeight() - (u32Y + u32Height)), (GLsizei)u32Width, (GLsizei)u32Height);
+      glBindTexture(GL_TEXTURE_2D, iPreviousTexture);
 
-  /* Draws it */
-  sstDisplay.poRenderWindow->Draw(*poSprite);
+      /* Rows are stored bottom to top: flips sprite instead of pixels */
+      ((sf::Sprite *)_pstDst)->FlipY(true);
+
+      /* Updates result */
+      eResult = (glGetError() == GL_NO_ERROR) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    /* Gets sprite */
+    poSprite = (sf::Sprite *)_pstSrc;
+
+    /* Updates its position */
+    vPosition.x = _fPosX;
+    vPosition.y = _fPosY;
+    poSprite->SetPosition(vPosition);
+
+    /* Updates sprite blend mode */
+    poSprite->SetBlendMode(orxDisplay_SFML_GetBlendMode(_eBlendMode));
+
+    /* Draws it */
+    sstDisplay.poRenderWindow->Draw(*poSprite);
+  }
 
   /* Done! */
   return eResult;
@@ -956,8 +1057,9 @@ extern "C" orxSTATUS orxFASTCALL orxDisplay_SFML_SaveBitmap(const orxBITMAP *_ps
 
 extern "C" orxBITMAP *orxFASTCALL orxDisplay_SFML_LoadBitmap(const orxSTRING _zFilename)
 {
-  orxBITMAP *pstResult;
-  sf::Image *poImage;
+  orxFILE_VIEW  stView;
+  orxBITMAP    *pstResult;
+  sf::Image    *poImage;
 
   /* Checks */
   orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
@@ -966,8 +1068,9 @@ extern "C" orxBITMAP *orxFASTCALL orxDisplay_SFML_LoadBitmap(const orxSTRING _zF
   /* Creates empty image */
   poImage = new sf::Image();
 
-  /* Loads it from file */
-  if(poImage->LoadFromFile(_zFilename) != false)
+  /* Loads it from memory */
+  if((orxFile_Map(_zFilename, orxFILE_KU32_FLAG_MAP_SEQUENTIAL, &stView) != orxSTATUS_FAILURE)
+  && (poImage->LoadFromMemory(stView.pcData, stView.u32Size) != false))
   {
     sf::Sprite *poSprite;
 
@@ -995,10 +1098,60 @@ extern "C" orxBITMAP *orxFASTCALL orxDisplay_SFML_LoadBitmap(const orxSTRING _zF
     pstResult = (orxBITMAP *)orxNULL;
   }
 
+  /* Unmaps file */
+  orxFile_Unmap(&stView);
+
   /* Done! */
   return pstResult;
 }
 
+extern "C" orxSTATUS orxFASTCALL orxDisplay_SFML_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Not screen? */
+  if(_pstBitmap != orxDisplay::spoScreen)
+  {
+    const sf::Image *poImage;
+
+    /* Gets image */
+    poImage = ((sf::Sprite *)_pstBitmap)->GetImage();
+
+    /* Valid size? */
+    if(_u32ByteNumber == poImage->GetWidth() * poImage->GetHeight() * 4)
+    {
+      /* Copies its pixels */
+      orxMemory_Copy(_au8Data, poImage->GetPixelsPtr(), _u32ByteNumber);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+  else
+  {
+    orxU32 u32Width, u32Height;
+
+    /* Gets screen size */
+    u32Width  = sstDisplay.poRenderWindow->GetWidth();
+    u32Height = sstDisplay.poRenderWindow->GetHeight();
+
+    /* Valid size? */
+    if(_u32ByteNumber == u32Width * u32Height * 4)
+    {
+      /* Reads whole screen */
+      eResult = orxDisplay_SFML_ReadScreen(0, 0, u32Width, u32Height, _au8Data);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 extern "C" orxSTATUS orxFASTCALL orxDisplay_SFML_GetBitmapSize(const orxBITMAP *_pstBitmap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -1065,6 +1218,12 @@ extern "C" orxSTATUS orxFASTCALL orxDisplay_SFML_SetBitmapClipping(orxBITMAP *_p
   /* Screen? */
   if(_pstBitmap == orxDisplay::spoScreen)
   {
+    /* Stores it */
+    sstDisplay.u32ScreenClipTLX = _u32TLX;
+    sstDisplay.u32ScreenClipTLY = _u32TLY;
+    sstDisplay.u32ScreenClipBRX = _u32BRX;
+    sstDisplay.u32ScreenClipBRY = _u32BRY;
+
     /* Stores screen clipping */
     glScissor(_u32TLX, sstDisplay.u32ScreenHeight - _u32BRY, _u32BRX - _u32TLX, _u32BRY - _u32TLY);
 
@@ -1272,6 +1431,20 @@ extern "C" orxBOOL orxFASTCALL orxDisplay_SFML_IsVideoModeAvailable(const orxDIS
   return bResult;
 }
 
+extern "C" orxSTATUS orxFASTCALL orxDisplay_SFML_EnableContext(orxBOOL _bEnable)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates window context for calling thread */
+  eResult = (sstDisplay.poRenderWindow->SetActive((_bEnable != orxFALSE) ? true : false) != false) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+  /* Done! */
+  return eResult;
+}
+
 extern "C" orxSTATUS orxFASTCALL orxDisplay_SFML_SetVideoMode(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
 {
   orxSTATUS eResult;
@@ -1398,6 +1571,13 @@ extern "C" orxSTATUS orxFASTCALL orxDisplay_SFML_Init()
               sstDisplay.ulWindowStyle = sf::Style::None;
             }
 
+#ifdef __orxLINUX__
+
+            /* Lets the window be used from the render thread while events are polled from the main one */
+            XInitThreads();
+
+#endif /* __orxLINUX__ */
+
             /* Not valid? */
             if((sstDisplay.poRenderWindow = new sf::RenderWindow(sf::VideoMode(u32ConfigWidth, u32ConfigHeight, u32ConfigDepth), orxConfig_GetString(orxDISPLAY_KZ_CONFIG_TITLE), sstDisplay.ulWindowStyle)) == orxNULL)
             {
@@ -1771,6 +1951,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_DeleteBitmap, DISPLAY, DELETE_B
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_SaveBitmap, DISPLAY, SAVE_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_LoadBitmap, DISPLAY, LOAD_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_GetScreenSize, DISPLAY, GET_SCREEN_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_GetScreen, DISPLAY, GET_SCREEN_BITMAP);
@@ -1804,4 +1985,5 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_GetVideoModeCounter, DISPLAY, G
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_GetVideoMode, DISPLAY, GET_VIDEO_MODE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_SetVideoMode, DISPLAY, SET_VIDEO_MODE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_IsVideoModeAvailable, DISPLAY, IS_VIDEO_MODE_AVAILABLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_SFML_EnableContext, DISPLAY, ENABLE_CONTEXT);
 orxPLUGIN_USER_CORE_FUNCTION_END();
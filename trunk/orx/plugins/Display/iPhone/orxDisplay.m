@@ -500,18 +500,110 @@ orxSTATUS orxFASTCALL orxDisplay_iPhone_SaveBitmap(const orxBITMAP *_pstBitmap,
 
 orxBITMAP *orxFASTCALL orxDisplay_iPhone_LoadBitmap(const orxSTRING _zFilename)
 {
-  orxBITMAP *pstResult = orxNULL;
+  orxFILE_VIEW  stView;
+  orxBITMAP    *pstResult = orxNULL;
 
   /* Checks */
   orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
 
-  /* Loads image */
-  pstResult = (orxBITMAP *)IMG_Load(_zFilename);
+  /* Gets file content */
+  if(orxFile_Map(_zFilename, orxFILE_KU32_FLAG_MAP_SEQUENTIAL, &stView) != orxSTATUS_FAILURE)
+  {
+    /* Loads image from memory */
+    pstResult = (orxBITMAP *)IMG_Load_RW(SDL_RWFromConstMem(stView.pcData, (int)stView.u32Size), 1);
+
+    /* Unmaps file */
+    orxFile_Unmap(&stView);
+  }
 
   /* Done! */
   return pstResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_iPhone_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  SDL_Surface  *pstSurface;
+  orxSTATUS     eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Gets surface */
+  pstSurface = (SDL_Surface *)_pstBitmap;
+
+  /* Valid size? */
+  if(_u32ByteNumber == (orxU32)pstSurface->w * (orxU32)pstSurface->h * 4)
+  {
+    /* Locks surface */
+    if(SDL_LockSurface(pstSurface) == 0)
+    {
+      orxU8  *pu8Dst;
+      orxS32  i, j;
+
+      /* For all rows */
+      for(j = 0, pu8Dst = _au8Data; j < pstSurface->h; j++)
+      {
+        const orxU8 *pu8Src;
+
+        /* Gets row start */
+        pu8Src = (const orxU8 *)pstSurface->pixels + j * pstSurface->pitch;
+
+        /* For all pixels */
+        for(i = 0; i < pstSurface->w; i++, pu8Src += pstSurface->format->BytesPerPixel, pu8Dst += 4)
+        {
+          Uint32 u32Pixel;
+
+          /* Depending on depth */
+          switch(pstSurface->format->BytesPerPixel)
+          {
+            case 1:
+            {
+              u32Pixel = *pu8Src;
+              break;
+            }
+
+            case 2:
+            {
+              u32Pixel = *(const Uint16 *)pu8Src;
+              break;
+            }
+
+            case 3:
+            {
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+              u32Pixel = (pu8Src[0] << 16) | (pu8Src[1] << 8) | pu8Src[2];
+#else /* SDL_BYTEORDER == SDL_BIG_ENDIAN */
+              u32Pixel = pu8Src[0] | (pu8Src[1] << 8) | (pu8Src[2] << 16);
+#endif /* SDL_BYTEORDER == SDL_BIG_ENDIAN */
+              break;
+            }
+
+            default:
+            {
+              u32Pixel = *(const Uint32 *)pu8Src;
+              break;
+            }
+          }
+
+          /* Converts it */
+          SDL_GetRGBA(u32Pixel, pstSurface->format, &pu8Dst[0], &pu8Dst[1], &pu8Dst[2], &pu8Dst[3]);
+        }
+      }
+
+      /* Unlocks surface */
+      SDL_UnlockSurface(pstSurface);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_iPhone_GetBitmapSize(const orxBITMAP *_pstBitmap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -917,6 +1009,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iPhone_DeleteBitmap, DISPLAY, DELETE
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iPhone_SaveBitmap, DISPLAY, SAVE_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iPhone_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iPhone_LoadBitmap, DISPLAY, LOAD_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iPhone_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iPhone_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iPhone_GetScreenSize, DISPLAY, GET_SCREEN_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iPhone_GetScreen, DISPLAY, GET_SCREEN_BITMAP);
@@ -77,6 +77,18 @@ orxBOOL orxFASTCALL orxJoystick_Dummy_IsButtonPressed(orxU32 _u32ID, orxJOYSTICK
   return bResult;
 }
 
+orxSTATUS orxFASTCALL orxJoystick_Dummy_GetState(orxU32 _u32ID, orxU32 *_pu32ButtonBitset, orxFLOAT _afAxisList[orxJOYSTICK_AXIS_NUMBER])
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Nothing pressed, all axes centered */
+  *_pu32ButtonBitset = 0;
+  orxMemory_Zero(_afAxisList, orxJOYSTICK_AXIS_NUMBER * sizeof(orxFLOAT));
+
+  /* Done! */
+  return eResult;
+}
+
 
 /***************************************************************************
  * Plugin related                                                          *
@@ -87,4 +99,5 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_Dummy_Init, JOYSTICK, INIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_Dummy_Exit, JOYSTICK, EXIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_Dummy_GetAxisValue, JOYSTICK, GET_AXIS_VALUE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_Dummy_IsButtonPressed, JOYSTICK, IS_BUTTON_PRESSED);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_Dummy_GetState, JOYSTICK, GET_STATE);
 orxPLUGIN_USER_CORE_FUNCTION_END();
@@ -271,6 +271,51 @@ orxBOOL orxFASTCALL orxJoystick_SDL_IsButtonPressed(orxU32 _u32ID, orxJOYSTICK_B
   return bResult;
 }
 
+orxSTATUS orxFASTCALL orxJoystick_SDL_GetState(orxU32 _u32ID, orxU32 *_pu32ButtonBitset, orxFLOAT _afAxisList[orxJOYSTICK_AXIS_NUMBER])
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstJoystick.u32Flags & orxJOYSTICK_KU32_STATIC_FLAG_READY) == orxJOYSTICK_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pu32ButtonBitset != orxNULL);
+  orxASSERT(_afAxisList != orxNULL);
+
+  /* Clears state */
+  *_pu32ButtonBitset = 0;
+  orxMemory_Zero(_afAxisList, orxJOYSTICK_AXIS_NUMBER * sizeof(orxFLOAT));
+
+  /* Is ID valid? */
+  if(_u32ID < sstJoystick.u32JoystickNumber)
+  {
+    SDL_Joystick *pstJoystick;
+    orxS32        i, s32Number;
+
+    /* Gets joystick */
+    pstJoystick = sstJoystick.apstJoystickList[_u32ID];
+
+    /* For all its buttons */
+    for(i = 0, s32Number = orxMIN(SDL_JoystickNumButtons(pstJoystick), orxJOYSTICK_BUTTON_NUMBER); i < s32Number; i++)
+    {
+      /* Is pressed? */
+      if(SDL_JoystickGetButton(pstJoystick, i))
+      {
+        /* Updates button bitset */
+        *_pu32ButtonBitset |= 1U << i;
+      }
+    }
+
+    /* For all its axes */
+    for(i = 0, s32Number = orxMIN(SDL_JoystickNumAxes(pstJoystick), orxJOYSTICK_AXIS_NUMBER); i < s32Number; i++)
+    {
+      /* Stores its value */
+      _afAxisList[i] = orxS2F(SDL_JoystickGetAxis(pstJoystick, i));
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 
 /***************************************************************************
  * Plugin related                                                          *
@@ -281,4 +326,5 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_SDL_Init, JOYSTICK, INIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_SDL_Exit, JOYSTICK, EXIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_SDL_GetAxisValue, JOYSTICK, GET_AXIS_VALUE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_SDL_IsButtonPressed, JOYSTICK, IS_BUTTON_PRESSED);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_SDL_GetState, JOYSTICK, GET_STATE);
 orxPLUGIN_USER_CORE_FUNCTION_END();
@@ -43,6 +43,11 @@
 #define orxJOYSTICK_KU32_STATIC_MASK_ALL      0xFFFFFFFF /**< All mask */
 
 
+/** Misc defines
+ */
+#define orxJOYSTICK_KU32_MAX_NUMBER           2          /**< Max number of joysticks handled by SFML */
+
+
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
@@ -53,6 +58,8 @@ typedef struct __orxJOYSTICK_STATIC_t
 {
   orxU32            u32Flags;
   sf::Input        *poInput;
+  orxU32            au32ButtonBitset[orxJOYSTICK_KU32_MAX_NUMBER];
+  orxFLOAT          aafAxisList[orxJOYSTICK_KU32_MAX_NUMBER][orxJOYSTICK_AXIS_NUMBER];
 
 } orxJOYSTICK_STATIC;
 
@@ -92,9 +99,48 @@ static orxSTATUS orxFASTCALL orxJoystick_SFML_EventHandler(const orxEVENT *_pstE
     stPayload.u32JoystickID = poEvent->JoyButton.JoystickId;
     stPayload.eButton       = (orxJOYSTICK_BUTTON)poEvent->JoyButton.Button;
 
+    /* Handled joystick & button? */
+    if((stPayload.u32JoystickID < orxJOYSTICK_KU32_MAX_NUMBER)
+    && (stPayload.eButton < orxJOYSTICK_BUTTON_NUMBER))
+    {
+      /* Updates button bitset */
+      if(_pstEvent->eID == sf::Event::JoyButtonPressed)
+      {
+        sstJoystick.au32ButtonBitset[stPayload.u32JoystickID] |= 1U << stPayload.eButton;
+      }
+      else
+      {
+        sstJoystick.au32ButtonBitset[stPayload.u32JoystickID] &= ~(1U << stPayload.eButton);
+      }
+    }
+
     /* Sends event */
     orxEVENT_SEND(orxEVENT_TYPE_JOYSTICK, (_pstEvent->eID == sf::Event::JoyButtonPressed) ? orxJOYSTICK_EVENT_BUTTON_PRESSED : orxJOYSTICK_EVENT_BUTTON_RELEASED, orxNULL, orxNULL, &stPayload);
   }
+  /* Is an axis moved? */
+  else if((_pstEvent->eType == orxEVENT_TYPE_FIRST_RESERVED + sf::Event::JoyMoved)
+       && (_pstEvent->eID == sf::Event::JoyMoved))
+  {
+    sf::Event *poEvent;
+
+    /* Gets SFML event */
+    poEvent = (sf::Event *)(_pstEvent->pstPayload);
+
+    /* Handled joystick & axis? (SFML axes are declared in the same order as ours) */
+    if((poEvent->JoyMove.JoystickId < orxJOYSTICK_KU32_MAX_NUMBER)
+    && ((orxU32)poEvent->JoyMove.Axis < orxJOYSTICK_AXIS_NUMBER))
+    {
+      /* Stores axis value */
+      sstJoystick.aafAxisList[poEvent->JoyMove.JoystickId][poEvent->JoyMove.Axis] = orx2F(poEvent->JoyMove.Position);
+    }
+  }
+  /* Lost focus? */
+  else if((_pstEvent->eType == orxEVENT_TYPE_SYSTEM)
+       && (_pstEvent->eID == orxSYSTEM_EVENT_FOCUS_LOST))
+  {
+    /* Releases all buttons as we won't get their release events */
+    orxMemory_Zero(sstJoystick.au32ButtonBitset, orxJOYSTICK_KU32_MAX_NUMBER * sizeof(orxU32));
+  }
 
   /* Done! */
   return eResult;
@@ -112,7 +158,9 @@ extern "C" orxSTATUS orxFASTCALL orxJoystick_SFML_Init()
 
     /* Registers our keyboard event handlers */
     if((orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::JoyButtonPressed), orxJoystick_SFML_EventHandler) != orxSTATUS_FAILURE)
-    && (orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::JoyButtonReleased), orxJoystick_SFML_EventHandler) != orxSTATUS_FAILURE))
+    && (orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::JoyButtonReleased), orxJoystick_SFML_EventHandler) != orxSTATUS_FAILURE)
+    && (orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::JoyMoved), orxJoystick_SFML_EventHandler) != orxSTATUS_FAILURE)
+    && (orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, orxJoystick_SFML_EventHandler) != orxSTATUS_FAILURE))
     {
       /* Terrible hack : gets application input from display SFML plugin */
       sstJoystick.poInput = (sf::Input *)orxDisplay_GetApplicationInput();
@@ -120,6 +168,19 @@ extern "C" orxSTATUS orxFASTCALL orxJoystick_SFML_Init()
       /* Valid? */
       if(sstJoystick.poInput != orxNULL)
       {
+        orxU32 i, j;
+
+        /* For all joysticks */
+        for(i = 0; i < orxJOYSTICK_KU32_MAX_NUMBER; i++)
+        {
+          /* For all axes */
+          for(j = 0; j < orxJOYSTICK_AXIS_NUMBER; j++)
+          {
+            /* Gets its initial value, further updates will come from events */
+            sstJoystick.aafAxisList[i][j] = sstJoystick.poInput->GetJoystickAxis(i, (sf::Joy::Axis)j);
+          }
+        }
+
         /* Updates status */
         sstJoystick.u32Flags |= orxJOYSTICK_KU32_STATIC_FLAG_READY;
 
@@ -132,6 +193,8 @@ extern "C" orxSTATUS orxFASTCALL orxJoystick_SFML_Init()
       /* Removes event handlers */
       orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::JoyButtonPressed), orxJoystick_SFML_EventHandler);
       orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::JoyButtonReleased), orxJoystick_SFML_EventHandler);
+      orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::JoyMoved), orxJoystick_SFML_EventHandler);
+      orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, orxJoystick_SFML_EventHandler);
     }
   }
 
@@ -147,6 +210,8 @@ extern "C" void orxFASTCALL orxJoystick_SFML_Exit()
     /* Removes event handlers */
     orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::JoyButtonPressed), orxJoystick_SFML_EventHandler);
     orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::JoyButtonReleased), orxJoystick_SFML_EventHandler);
+    orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::JoyMoved), orxJoystick_SFML_EventHandler);
+    orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, orxJoystick_SFML_EventHandler);
 
     /* Cleans static controller */
     orxMemory_Zero(&sstJoystick, sizeof(orxJOYSTICK_STATIC));
@@ -157,78 +222,17 @@ extern "C" void orxFASTCALL orxJoystick_SFML_Exit()
 
 extern "C" orxFLOAT orxFASTCALL orxJoystick_SFML_GetAxisValue(orxU32 _u32ID, orxJOYSTICK_AXIS _eAxis)
 {
-  sf::Joy::Axis eSFMLAxis;
-  orxFLOAT      fResult;
+  orxFLOAT fResult;
 
   /* Checks */
   orxASSERT((sstJoystick.u32Flags & orxJOYSTICK_KU32_STATIC_FLAG_READY) == orxJOYSTICK_KU32_STATIC_FLAG_READY);
   orxASSERT(_eAxis < orxJOYSTICK_AXIS_NUMBER);
 
-  /* Depending on axis */
-  switch(_eAxis)
-  {
-    case orxJOYSTICK_AXIS_X:
-    {
-      /* Gets SFML axis */
-      eSFMLAxis = sf::Joy::AxisX;
-      break;
-    }
-
-    case orxJOYSTICK_AXIS_Y:
-    {
-      /* Gets SFML axis */
-      eSFMLAxis = sf::Joy::AxisY;
-      break;
-    }
-
-    case orxJOYSTICK_AXIS_Z:
-    {
-      /* Gets SFML axis */
-      eSFMLAxis = sf::Joy::AxisZ;
-      break;
-    }
-
-    case orxJOYSTICK_AXIS_R:
-    {
-      /* Gets SFML axis */
-      eSFMLAxis = sf::Joy::AxisR;
-      break;
-    }
-
-    case orxJOYSTICK_AXIS_U:
-    {
-      /* Gets SFML axis */
-      eSFMLAxis = sf::Joy::AxisU;
-      break;
-    }
-
-    case orxJOYSTICK_AXIS_V:
-    {
-      /* Gets SFML axis */
-      eSFMLAxis = sf::Joy::AxisV;
-      break;
-    }
-
-    case orxJOYSTICK_AXIS_POV:
-    {
-      /* Gets SFML axis */
-      eSFMLAxis = sf::Joy::AxisPOV;
-      break;
-    }
-
-    default:
-    {
-      /* Updates result */
-      eSFMLAxis = sf::Joy::Count;
-      break;
-    }
-  }
-
   /* Valid? */
-  if(eSFMLAxis < sf::Joy::Count)
+  if(_u32ID < orxJOYSTICK_KU32_MAX_NUMBER)
   {
     /* Updates result */
-    fResult = sstJoystick.poInput->GetJoystickAxis(_u32ID, eSFMLAxis);
+    fResult = sstJoystick.aafAxisList[_u32ID][_eAxis];
   }
   else
   {
@@ -249,12 +253,39 @@ extern "C" orxBOOL orxFASTCALL orxJoystick_SFML_IsButtonPressed(orxU32 _u32ID, o
   orxASSERT(_eButton < orxJOYSTICK_BUTTON_NUMBER);
 
   /* Updates result */
-  bResult = sstJoystick.poInput->IsJoystickButtonDown(_u32ID, _eButton) ? orxTRUE : orxFALSE;
+  bResult = ((_u32ID < orxJOYSTICK_KU32_MAX_NUMBER) && (sstJoystick.au32ButtonBitset[_u32ID] & (1U << _eButton))) ? orxTRUE : orxFALSE;
 
   /* Done! */
   return bResult;
 }
 
+extern "C" orxSTATUS orxFASTCALL orxJoystick_SFML_GetState(orxU32 _u32ID, orxU32 *_pu32ButtonBitset, orxFLOAT _afAxisList[orxJOYSTICK_AXIS_NUMBER])
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstJoystick.u32Flags & orxJOYSTICK_KU32_STATIC_FLAG_READY) == orxJOYSTICK_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pu32ButtonBitset != orxNULL);
+  orxASSERT(_afAxisList != orxNULL);
+
+  /* Valid? */
+  if(_u32ID < orxJOYSTICK_KU32_MAX_NUMBER)
+  {
+    /* Copies state */
+    *_pu32ButtonBitset = sstJoystick.au32ButtonBitset[_u32ID];
+    orxMemory_Copy(_afAxisList, sstJoystick.aafAxisList[_u32ID], orxJOYSTICK_AXIS_NUMBER * sizeof(orxFLOAT));
+  }
+  else
+  {
+    /* Clears state */
+    *_pu32ButtonBitset = 0;
+    orxMemory_Zero(_afAxisList, orxJOYSTICK_AXIS_NUMBER * sizeof(orxFLOAT));
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 
 /***************************************************************************
  * Plugin related                                                          *
@@ -265,4 +296,5 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_SFML_Init, JOYSTICK, INIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_SFML_Exit, JOYSTICK, EXIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_SFML_GetAxisValue, JOYSTICK, GET_AXIS_VALUE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_SFML_IsButtonPressed, JOYSTICK, IS_BUTTON_PRESSED);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxJoystick_SFML_GetState, JOYSTICK, GET_STATE);
 orxPLUGIN_USER_CORE_FUNCTION_END();
@@ -90,6 +90,17 @@ void orxFASTCALL orxKeyboard_iPhone_ClearBuffer()
   return;
 }
 
+orxSTATUS orxFASTCALL orxKeyboard_iPhone_GetKeyBitset(orxU32 _au32KeyBitset[orxKEYBOARD_KU32_KEY_BITSET_SIZE])
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* No key pressed */
+  orxMemory_Zero(_au32KeyBitset, orxKEYBOARD_KU32_KEY_BITSET_SIZE * sizeof(orxU32));
+
+  /* Done! */
+  return eResult;
+}
+
 /***************************************************************************
  * Plugin related                                                          *
  ***************************************************************************/
@@ -101,4 +112,5 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_iPhone_IsKeyPressed, KEYBOARD, IS_K
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_iPhone_Hit, KEYBOARD, HIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_iPhone_Read, KEYBOARD, READ);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_iPhone_ClearBuffer, KEYBOARD, CLEAR_BUFFER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_iPhone_GetKeyBitset, KEYBOARD, GET_KEY_BITSET);
 orxPLUGIN_USER_CORE_FUNCTION_END();
@@ -333,6 +333,42 @@ void orxFASTCALL orxKeyboard_SDL_ClearBuffer()
   return;
 }
 
+orxSTATUS orxFASTCALL orxKeyboard_SDL_GetKeyBitset(orxU32 _au32KeyBitset[orxKEYBOARD_KU32_KEY_BITSET_SIZE])
+{
+  orxU8    *pu8KeyState;
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstKeyboard.u32Flags & orxKEYBOARD_KU32_STATIC_FLAG_READY) == orxKEYBOARD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_au32KeyBitset != orxNULL);
+
+  /* Clears key bitset */
+  orxMemory_Zero(_au32KeyBitset, orxKEYBOARD_KU32_KEY_BITSET_SIZE * sizeof(orxU32));
+
+  /* Gets key state */
+  pu8KeyState = SDL_GetKeyState(orxNULL);
+
+  /* For all keys */
+  for(i = 0; i < orxKEYBOARD_KEY_NUMBER; i++)
+  {
+    SDLKey eSDLKey;
+
+    /* Gets SDL key enum */
+    eSDLKey = orxKeyboard_SDL_GetSDLKey((orxKEYBOARD_KEY)i);
+
+    /* Is handled and pressed? */
+    if((eSDLKey != SDLK_LAST) && (pu8KeyState[eSDLKey]))
+    {
+      /* Updates key bitset */
+      _au32KeyBitset[i >> 5] |= 1U << (i & 31);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /***************************************************************************
  * Plugin related                                                          *
  ***************************************************************************/
@@ -344,4 +380,5 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_SDL_IsKeyPressed, KEYBOARD, IS_KEY_
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_SDL_Hit, KEYBOARD, HIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_SDL_Read, KEYBOARD, READ);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_SDL_ClearBuffer, KEYBOARD, CLEAR_BUFFER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_SDL_GetKeyBitset, KEYBOARD, GET_KEY_BITSET);
 orxPLUGIN_USER_CORE_FUNCTION_END();
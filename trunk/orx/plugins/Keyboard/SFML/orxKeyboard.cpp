@@ -53,6 +53,7 @@ typedef struct __orxKEYBOARD_STATIC_t
 {
   orxU32            u32Flags;
   sf::Input        *poInput;
+  orxU32            au32KeyBitset[orxKEYBOARD_KU32_KEY_BITSET_SIZE];
 } orxKEYBOARD_STATIC;
 
 
@@ -321,6 +322,20 @@ static orxSTATUS orxFASTCALL orxKeyboard_SFML_EventHandler(const orxEVENT *_pstE
     stPayload.eKey        = orxKeyboard_SFML_GetKeyID(poEvent->Key.Code);
     stPayload.u32Unicode  = 0;
 
+    /* Handled key? */
+    if(stPayload.eKey < orxKEYBOARD_KEY_NUMBER)
+    {
+      /* Updates key bitset */
+      if(_pstEvent->eID == sf::Event::KeyPressed)
+      {
+        sstKeyboard.au32KeyBitset[stPayload.eKey >> 5] |= 1U << (stPayload.eKey & 31);
+      }
+      else
+      {
+        sstKeyboard.au32KeyBitset[stPayload.eKey >> 5] &= ~(1U << (stPayload.eKey & 31));
+      }
+    }
+
     /* Sends event */
     orxEVENT_SEND(orxEVENT_TYPE_KEYBOARD, (_pstEvent->eID == sf::Event::KeyPressed) ? orxKEYBOARD_EVENT_KEY_PRESSED : orxKEYBOARD_EVENT_KEY_RELEASED, orxNULL, orxNULL, &stPayload);
   }
@@ -341,6 +356,13 @@ static orxSTATUS orxFASTCALL orxKeyboard_SFML_EventHandler(const orxEVENT *_pstE
     /* Sends event */
     orxEVENT_SEND(orxEVENT_TYPE_KEYBOARD, orxKEYBOARD_EVENT_KEY_PRESSED, orxNULL, orxNULL, &stPayload);
   }
+  /* Lost focus? */
+  else if((_pstEvent->eType == orxEVENT_TYPE_SYSTEM)
+       && (_pstEvent->eID == orxSYSTEM_EVENT_FOCUS_LOST))
+  {
+    /* Releases all keys as we won't get their release events */
+    orxMemory_Zero(sstKeyboard.au32KeyBitset, orxKEYBOARD_KU32_KEY_BITSET_SIZE * sizeof(orxU32));
+  }
 
   /* Done! */
   return eResult;
@@ -359,7 +381,8 @@ extern "C" orxSTATUS orxFASTCALL orxKeyboard_SFML_Init()
     /* Registers our keyboard event handlers */
     if((orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::KeyPressed), orxKeyboard_SFML_EventHandler) != orxSTATUS_FAILURE)
     && (orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::KeyReleased), orxKeyboard_SFML_EventHandler) != orxSTATUS_FAILURE)
-    && (orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::TextEntered), orxKeyboard_SFML_EventHandler) != orxSTATUS_FAILURE))
+    && (orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::TextEntered), orxKeyboard_SFML_EventHandler) != orxSTATUS_FAILURE)
+    && (orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, orxKeyboard_SFML_EventHandler) != orxSTATUS_FAILURE))
     {
       /* Terrible hack : gets application input from SFML display plugin */
       sstKeyboard.poInput = (sf::Input *)orxDisplay_GetApplicationInput();
@@ -380,6 +403,7 @@ extern "C" orxSTATUS orxFASTCALL orxKeyboard_SFML_Init()
       orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::KeyPressed), orxKeyboard_SFML_EventHandler);
       orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::KeyReleased), orxKeyboard_SFML_EventHandler);
       orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::TextEntered), orxKeyboard_SFML_EventHandler);
+      orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, orxKeyboard_SFML_EventHandler);
     }
   }
 
@@ -396,6 +420,7 @@ extern "C" void orxFASTCALL orxKeyboard_SFML_Exit()
     orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::KeyPressed), orxKeyboard_SFML_EventHandler);
     orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::KeyReleased), orxKeyboard_SFML_EventHandler);
     orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::TextEntered), orxKeyboard_SFML_EventHandler);
+    orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, orxKeyboard_SFML_EventHandler);
 
     /* Cleans static controller */
     orxMemory_Zero(&sstKeyboard, sizeof(orxKEYBOARD_STATIC));
@@ -406,21 +431,17 @@ extern "C" void orxFASTCALL orxKeyboard_SFML_Exit()
 
 extern "C" orxBOOL orxFASTCALL orxKeyboard_SFML_IsKeyPressed(orxKEYBOARD_KEY _eKey)
 {
-  orxBOOL       bResult;
-  sf::Key::Code eSFMLKey;
+  orxBOOL bResult;
 
   /* Checks */
   orxASSERT(_eKey < orxKEYBOARD_KEY_NUMBER);
   orxASSERT((sstKeyboard.u32Flags & orxKEYBOARD_KU32_STATIC_FLAG_READY) == orxKEYBOARD_KU32_STATIC_FLAG_READY);
 
-  /* Gets SFML key enum */
-  eSFMLKey = orxKeyboard_SFML_GetSFMLKey(_eKey);
-
-  /* Valid? */
-  if(eSFMLKey < sf::Key::Count)
+  /* Handled by SFML? */
+  if(orxKeyboard_SFML_GetSFMLKey(_eKey) < sf::Key::Count)
   {
     /* Updates result */
-    bResult = sstKeyboard.poInput->IsKeyDown(eSFMLKey) ? orxTRUE : orxFALSE;
+    bResult = (sstKeyboard.au32KeyBitset[_eKey >> 5] & (1U << (_eKey & 31))) ? orxTRUE : orxFALSE;
   }
   else
   {
@@ -443,14 +464,19 @@ extern "C" orxKEYBOARD_KEY orxFASTCALL orxKeyboard_SFML_Read()
   /* Checks */
   orxASSERT((sstKeyboard.u32Flags & orxKEYBOARD_KU32_STATIC_FLAG_READY) == orxKEYBOARD_KU32_STATIC_FLAG_READY);
 
-  /* For all keys */
-  for(i = 0; i < orxKEYBOARD_KEY_NUMBER; i++)
+  /* For all key words */
+  for(i = 0; i < orxKEYBOARD_KU32_KEY_BITSET_SIZE; i++)
   {
-    /* Is pressed? */
-    if(orxKeyboard_SFML_IsKeyPressed((orxKEYBOARD_KEY)i) != orxFALSE)
+    /* Has a pressed key? */
+    if(sstKeyboard.au32KeyBitset[i] != 0)
     {
+      orxU32 u32Bit;
+
+      /* Finds its lowest pressed key */
+      for(u32Bit = 0; !(sstKeyboard.au32KeyBitset[i] & (1U << u32Bit)); u32Bit++);
+
       /* Updates result */
-      eResult = (orxKEYBOARD_KEY)i;
+      eResult = (orxKEYBOARD_KEY)((i << 5) + u32Bit);
 
       break;
     }
@@ -486,6 +512,21 @@ extern "C" void orxFASTCALL orxKeyboard_SFML_ClearBuffer()
   return;
 }
 
+extern "C" orxSTATUS orxFASTCALL orxKeyboard_SFML_GetKeyBitset(orxU32 _au32KeyBitset[orxKEYBOARD_KU32_KEY_BITSET_SIZE])
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstKeyboard.u32Flags & orxKEYBOARD_KU32_STATIC_FLAG_READY) == orxKEYBOARD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_au32KeyBitset != orxNULL);
+
+  /* Copies key bitset */
+  orxMemory_Copy(_au32KeyBitset, sstKeyboard.au32KeyBitset, orxKEYBOARD_KU32_KEY_BITSET_SIZE * sizeof(orxU32));
+
+  /* Done! */
+  return eResult;
+}
+
 /***************************************************************************
  * Plugin related                                                          *
  ***************************************************************************/
@@ -497,4 +538,5 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_SFML_IsKeyPressed, KEYBOARD, IS_KEY
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_SFML_Hit, KEYBOARD, HIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_SFML_Read, KEYBOARD, READ);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_SFML_ClearBuffer, KEYBOARD, CLEAR_BUFFER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxKeyboard_SFML_GetKeyBitset, KEYBOARD, GET_KEY_BITSET);
 orxPLUGIN_USER_CORE_FUNCTION_END();
@@ -0,0 +1,137 @@
+/* Orx - Portable Game Engine
+ *
+ * Orx is the legal property of its developers, whose names
+ * are listed in the COPYRIGHT file distributed 
+ * with this source distribution.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file orxMouse.c
+ * @date 19/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * Dummy mouse plugin implementation
+ *
+ */
+
+
+#include "orxPluginAPI.h"
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+orxSTATUS orxFASTCALL orxMouse_Dummy_Init()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Done! */
+  return eResult;
+}
+
+void orxFASTCALL orxMouse_Dummy_Exit()
+{
+  /* Done! */
+  return;
+}
+
+orxSTATUS orxFASTCALL orxMouse_Dummy_SetPosition(const orxVECTOR *_pvPosition)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Done! */
+  return eResult;
+}
+
+orxVECTOR *orxFASTCALL orxMouse_Dummy_GetPosition(orxVECTOR *_pvPosition)
+{
+  orxVECTOR *pvResult = orxNULL;
+
+  /* Done! */
+  return pvResult;
+}
+
+orxBOOL orxFASTCALL orxMouse_Dummy_IsButtonPressed(orxMOUSE_BUTTON _eButton)
+{
+  orxBOOL bResult = orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+orxVECTOR *orxFASTCALL orxMouse_Dummy_GetMoveDelta(orxVECTOR *_pvMoveDelta)
+{
+  orxVECTOR *pvResult = orxNULL;
+
+  /* Done! */
+  return pvResult;
+}
+
+orxFLOAT orxFASTCALL orxMouse_Dummy_GetWheelDelta()
+{
+  orxFLOAT fResult = orxFLOAT_0;
+
+  /* Done! */
+  return fResult;
+}
+
+orxSTATUS orxFASTCALL orxMouse_Dummy_ShowCursor(orxBOOL _bShow)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxMouse_Dummy_GetButtonBitset(orxU32 *_pu32ButtonBitset)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* No button pressed */
+  *_pu32ButtonBitset = 0;
+
+  /* Done! */
+  return eResult;
+}
+
+
+/***************************************************************************
+ * Plugin related                                                          *
+ ***************************************************************************/
+
+orxPLUGIN_USER_CORE_FUNCTION_START(MOUSE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_Dummy_Init, MOUSE, INIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_Dummy_Exit, MOUSE, EXIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_Dummy_SetPosition, MOUSE, SET_POSITION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_Dummy_GetPosition, MOUSE, GET_POSITION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_Dummy_IsButtonPressed, MOUSE, IS_BUTTON_PRESSED);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_Dummy_GetMoveDelta, MOUSE, GET_MOVE_DELTA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_Dummy_GetWheelDelta, MOUSE, GET_WHEEL_DELTA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_Dummy_ShowCursor, MOUSE, SHOW_CURSOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_Dummy_GetButtonBitset, MOUSE, GET_BUTTON_BITSET);
+orxPLUGIN_USER_CORE_FUNCTION_END();
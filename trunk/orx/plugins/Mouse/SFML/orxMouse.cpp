@@ -55,6 +55,7 @@ typedef struct __orxMOUSE_STATIC_t
   orxVECTOR   vMouseMove, vMouseBackup;
   orxFLOAT    fWheelMove;
   orxBOOL     bClearWheel;
+  orxU32      u32ButtonBitset;
   sf::Input  *poInput;
 
 } orxMOUSE_STATIC;
@@ -176,9 +177,26 @@ static orxSTATUS orxFASTCALL orxMouse_SFML_EventHandler(const orxEVENT *_pstEven
       }
     }
 
+    /* Updates button bitset */
+    if(_pstEvent->eID == sf::Event::MouseButtonPressed)
+    {
+      sstMouse.u32ButtonBitset |= 1U << stPayload.eButton;
+    }
+    else
+    {
+      sstMouse.u32ButtonBitset &= ~(1U << stPayload.eButton);
+    }
+
     /* Sends event */
     orxEVENT_SEND(orxEVENT_TYPE_MOUSE, (_pstEvent->eID == sf::Event::MouseButtonPressed) ? orxMOUSE_EVENT_BUTTON_PRESSED : orxMOUSE_EVENT_BUTTON_RELEASED, orxNULL, orxNULL, &stPayload);
   }
+  /* Lost focus? */
+  else if((_pstEvent->eType == orxEVENT_TYPE_SYSTEM)
+       && (_pstEvent->eID == orxSYSTEM_EVENT_FOCUS_LOST))
+  {
+    /* Releases all buttons as we won't get their release events */
+    sstMouse.u32ButtonBitset = 0;
+  }
 
   /* Done! */
   return eResult;
@@ -216,7 +234,8 @@ extern "C" orxSTATUS orxFASTCALL orxMouse_SFML_Init()
     if((orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseMoved), orxMouse_SFML_EventHandler) != orxSTATUS_FAILURE)
     && (orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseWheelMoved), orxMouse_SFML_EventHandler) != orxSTATUS_FAILURE)
     && (orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseButtonPressed), orxMouse_SFML_EventHandler) != orxSTATUS_FAILURE)
-    && (orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseButtonReleased), orxMouse_SFML_EventHandler) != orxSTATUS_FAILURE))
+    && (orxEvent_AddHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseButtonReleased), orxMouse_SFML_EventHandler) != orxSTATUS_FAILURE)
+    && (orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, orxMouse_SFML_EventHandler) != orxSTATUS_FAILURE))
     {
       /* Terrible hack : gets application input from display SFML plugin */
       sstMouse.poInput = (sf::Input *)orxDisplay_GetApplicationInput();
@@ -250,6 +269,7 @@ extern "C" orxSTATUS orxFASTCALL orxMouse_SFML_Init()
         orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseWheelMoved), orxMouse_SFML_EventHandler);
         orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseButtonPressed), orxMouse_SFML_EventHandler);
         orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseButtonReleased), orxMouse_SFML_EventHandler);
+        orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, orxMouse_SFML_EventHandler);
       }
     }
     else
@@ -259,6 +279,7 @@ extern "C" orxSTATUS orxFASTCALL orxMouse_SFML_Init()
       orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseWheelMoved), orxMouse_SFML_EventHandler);
       orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseButtonPressed), orxMouse_SFML_EventHandler);
       orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseButtonReleased), orxMouse_SFML_EventHandler);
+      orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, orxMouse_SFML_EventHandler);
     }
   }
 
@@ -276,6 +297,7 @@ extern "C" void orxFASTCALL orxMouse_SFML_Exit()
     orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseWheelMoved), orxMouse_SFML_EventHandler);
     orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseButtonPressed), orxMouse_SFML_EventHandler);
     orxEvent_RemoveHandler((orxEVENT_TYPE)(orxEVENT_TYPE_FIRST_RESERVED + sf::Event::MouseButtonReleased), orxMouse_SFML_EventHandler);
+    orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, orxMouse_SFML_EventHandler);
 
     /* Cleans static controller */
     orxMemory_Zero(&sstMouse, sizeof(orxMOUSE_STATIC));
@@ -327,56 +349,19 @@ extern "C" orxBOOL orxFASTCALL orxMouse_SFML_IsButtonPressed(orxMOUSE_BUTTON _eB
   orxASSERT((sstMouse.u32Flags & orxMOUSE_KU32_STATIC_FLAG_READY) == orxMOUSE_KU32_STATIC_FLAG_READY);
   orxASSERT(_eButton < orxMOUSE_BUTTON_NUMBER);
 
-  /* Depending on button */
-  switch(_eButton)
+  /* Wheel? */
+  if((_eButton == orxMOUSE_BUTTON_WHEEL_UP) || (_eButton == orxMOUSE_BUTTON_WHEEL_DOWN))
   {
-    case orxMOUSE_BUTTON_LEFT:
-    {
-      /* Updates result */
-      bResult = sstMouse.poInput->IsMouseButtonDown(sf::Mouse::Left) ? orxTRUE : orxFALSE;
-      break;
-    }
-
-    case orxMOUSE_BUTTON_RIGHT:
-    {
-      /* Updates result */
-      bResult = sstMouse.poInput->IsMouseButtonDown(sf::Mouse::Right) ? orxTRUE : orxFALSE;
-      break;
-    }
-
-    case orxMOUSE_BUTTON_MIDDLE:
-    {
-      /* Updates result */
-      bResult = sstMouse.poInput->IsMouseButtonDown(sf::Mouse::Middle) ? orxTRUE : orxFALSE;
-      break;
-    }
-
-    case orxMOUSE_BUTTON_EXTRA_1:
-    {
-      /* Updates result */
-      bResult = sstMouse.poInput->IsMouseButtonDown(sf::Mouse::XButton1) ? orxTRUE : orxFALSE;
-      break;
-    }
-
-    case orxMOUSE_BUTTON_EXTRA_2:
-    {
-      /* Updates result */
-      bResult = sstMouse.poInput->IsMouseButtonDown(sf::Mouse::XButton2) ? orxTRUE : orxFALSE;
-      break;
-    }
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_MOUSE, "The wheel button <%ld> can't be queried directly with this SFML plugin.", _eButton);
 
-    case orxMOUSE_BUTTON_WHEEL_UP:
-    case orxMOUSE_BUTTON_WHEEL_DOWN:
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_MOUSE, "The wheel button <%ld> can't be queried directly with this SFML plugin.", _eButton);
-    }
-    default:
-    {
-      /* Updates result */
-      bResult = orxFALSE;
-      break;
-    }
+    /* Updates result */
+    bResult = orxFALSE;
+  }
+  else
+  {
+    /* Updates result */
+    bResult = (sstMouse.u32ButtonBitset & (1U << _eButton)) ? orxTRUE : orxFALSE;
   }
 
   /* Done! */
@@ -418,6 +403,21 @@ extern "C" orxFLOAT orxFASTCALL orxMouse_SFML_GetWheelDelta()
   return fResult;
 }
 
+extern "C" orxSTATUS orxFASTCALL orxMouse_SFML_GetButtonBitset(orxU32 *_pu32ButtonBitset)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstMouse.u32Flags & orxMOUSE_KU32_STATIC_FLAG_READY) == orxMOUSE_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pu32ButtonBitset != orxNULL);
+
+  /* Updates result */
+  *_pu32ButtonBitset = sstMouse.u32ButtonBitset;
+
+  /* Done! */
+  return eResult;
+}
+
 
 /***************************************************************************
  * Plugin related                                                          *
@@ -432,4 +432,5 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_SFML_IsButtonPressed, MOUSE, IS_BUTTON
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_SFML_GetMoveDelta, MOUSE, GET_MOVE_DELTA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_SFML_GetWheelDelta, MOUSE, GET_WHEEL_DELTA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_SFML_ShowCursor, MOUSE, SHOW_CURSOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_SFML_GetButtonBitset, MOUSE, GET_BUTTON_BITSET);
 orxPLUGIN_USER_CORE_FUNCTION_END();
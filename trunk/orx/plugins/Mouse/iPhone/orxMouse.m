@@ -370,6 +370,33 @@ orxFLOAT orxFASTCALL orxMouse_SDL_GetWheelDelta()
   return fResult;
 }
 
+orxSTATUS orxFASTCALL orxMouse_SDL_GetButtonBitset(orxU32 *_pu32ButtonBitset)
+{
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstMouse.u32Flags & orxMOUSE_KU32_STATIC_FLAG_READY) == orxMOUSE_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pu32ButtonBitset != orxNULL);
+
+  /* Clears button bitset */
+  *_pu32ButtonBitset = 0;
+
+  /* For all buttons (wheel is reported through its delta) */
+  for(i = 0; i < orxMOUSE_BUTTON_WHEEL_UP; i++)
+  {
+    /* Is pressed? */
+    if(orxMouse_SDL_IsButtonPressed((orxMOUSE_BUTTON)i) != orxFALSE)
+    {
+      /* Updates button bitset */
+      *_pu32ButtonBitset |= 1U << i;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 
 /***************************************************************************
  * Plugin related                                                          *
@@ -384,4 +411,5 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_SDL_IsButtonPressed, MOUSE, IS_BUTTON_
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_SDL_GetMoveDelta, MOUSE, GET_MOVE_DELTA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_SDL_GetWheelDelta, MOUSE, GET_WHEEL_DELTA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_SDL_ShowCursor, MOUSE, SHOW_CURSOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxMouse_SDL_GetButtonBitset, MOUSE, GET_BUTTON_BITSET);
 orxPLUGIN_USER_CORE_FUNCTION_END();
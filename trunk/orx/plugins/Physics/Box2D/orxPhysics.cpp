@@ -56,6 +56,8 @@ namespace orxPhysics
   static const orxU32   su32DefaultIterations   = 10;
   static const orxFLOAT sfDefaultDimensionRatio = orx2F(0.01f);
   static const orxU32   su32MessageBankSize     = 64;
+  static const orxU32   su32QueryFixtureNumber  = 256;
+  static const orxU32   su32BodyBankSize        = 512;
 }
 
 
@@ -75,6 +77,16 @@ typedef struct __orxPHYSICS_EVENT_STORAGE_t
 
 } orxPHYSICS_EVENT_STORAGE;
 
+/** Body node: Box2D body user data, awake dynamic bodies are also linked in the active list
+ */
+typedef struct __orxPHYSICS_BODY_NODE_t
+{
+  orxLINKLIST_NODE                  stNode;           /**< Link list node */
+  orxHANDLE                         hUserData;        /**< User data (orxBODY) */
+  b2Body                           *poBody;           /**< Box2D body */
+
+} orxPHYSICS_BODY_NODE;
+
 /** Contact listener
  */
 class orxPhysicsContactListener : public b2ContactListener
@@ -82,6 +94,7 @@ class orxPhysicsContactListener : public b2ContactListener
 public:
   void BeginContact(b2Contact *_poContact);
   void EndContact(b2Contact *_poContact);
+  void PostSolve(const b2Contact *_poContact, const b2ContactImpulse *_pstImpulse);
 };
 
 /** Boundary listener
@@ -102,8 +115,9 @@ typedef struct __orxPHYSICS_STATIC_t
   orxFLOAT                    fRecDimensionRatio; /**< Reciprocal dimension ratio */
   orxLINKLIST                 stEventList;        /**< Event link list */
   orxBANK                    *pstEventBank;       /**< Event bank */
+  orxLINKLIST                 stActiveList;       /**< Active (awake dynamic) body link list */
+  orxBANK                    *pstBodyBank;        /**< Body node bank */
   b2World                    *poWorld;            /**< World */
-  b2Fixture                  *poRaycastFixture;   /**< Raycast fixture */
   orxPhysicsContactListener  *poContactListener;  /**< Contact listener */
   orxPhysicsBoundaryListener *poBoundaryListener; /**< Boundary listener */
 
@@ -123,6 +137,58 @@ static orxPHYSICS_STATIC sstPhysics;
  * Private functions                                                       *
  ***************************************************************************/
 
+static orxINLINE orxHANDLE orxPhysics_Box2D_GetUserData(const b2Body *_poBody)
+{
+  orxPHYSICS_BODY_NODE *pstNode;
+
+  /* Checks */
+  orxASSERT(_poBody != orxNULL);
+
+  /* Gets its node */
+  pstNode = (orxPHYSICS_BODY_NODE *)_poBody->GetUserData();
+
+  /* Done! */
+  return (pstNode != orxNULL) ? pstNode->hUserData : orxNULL;
+}
+
+/** Links a body to the active list if it's dynamic and awake
+ */
+static orxINLINE void orxPhysics_Box2D_Activate(b2Body *_poBody)
+{
+  orxPHYSICS_BODY_NODE *pstNode;
+
+  /* Checks */
+  orxASSERT(_poBody != orxNULL);
+
+  /* Gets its node */
+  pstNode = (orxPHYSICS_BODY_NODE *)_poBody->GetUserData();
+
+  /* Valid, not already active, dynamic and awake? */
+  if((pstNode != orxNULL)
+  && (orxLinkList_GetList(&(pstNode->stNode)) == orxNULL)
+  && !_poBody->IsStatic()
+  && !_poBody->IsSleeping())
+  {
+    /* Adds it to the active list */
+    orxLinkList_AddEnd(&(sstPhysics.stActiveList), &(pstNode->stNode));
+  }
+
+  return;
+}
+
+/** Wakes up a body and links it to the active list
+ */
+static orxINLINE void orxPhysics_Box2D_WakeUp(b2Body *_poBody)
+{
+  /* Wakes it up */
+  _poBody->WakeUp();
+
+  /* Activates it */
+  orxPhysics_Box2D_Activate(_poBody);
+
+  return;
+}
+
 static orxINLINE orxU32 orxPhysics_Box2D_GetFixtureIndex(const b2Body *_poBody, const b2Fixture *_poFixture)
 {
   orxBODY  *pstBody;
@@ -133,7 +199,7 @@ static orxINLINE orxU32 orxPhysics_Box2D_GetFixtureIndex(const b2Body *_poBody,
   orxASSERT(_poFixture != orxNULL);
 
   /* Gets corresponding body */
-  pstBody = orxBODY(const_cast<b2Body *>(_poBody)->GetUserData());
+  pstBody = orxBODY(orxPhysics_Box2D_GetUserData(_poBody));
 
   /* Valid? */
   if(pstBody != orxNULL)
@@ -171,6 +237,230 @@ static orxINLINE orxU32 orxPhysics_Box2D_GetFixtureIndex(const b2Body *_poBody,
   return u32Result;
 }
 
+static orxINLINE orxBOOL orxPhysics_Box2D_CheckFilter(const b2FilterData &_rstQueryFilter, const b2FilterData &_rstFixtureFilter)
+{
+  /* Done! */
+  return (((_rstQueryFilter.maskBits & _rstFixtureFilter.categoryBits) != 0) && ((_rstQueryFilter.categoryBits & _rstFixtureFilter.maskBits) != 0)) ? orxTRUE : orxFALSE;
+}
+
+static orxINLINE float32 orxPhysics_Box2D_GetSegmentDistanceSquared(const b2Vec2 &_rvPoint, const b2Vec2 &_rvStart, const b2Vec2 &_rvEnd)
+{
+  b2Vec2  vDirection;
+  float32 fLengthSquared, fT = 0.0f;
+
+  /* Gets segment direction */
+  vDirection      = _rvEnd - _rvStart;
+  fLengthSquared  = b2Dot(vDirection, vDirection);
+
+  /* Not degenerated? */
+  if(fLengthSquared > 0.0f)
+  {
+    /* Gets clamped projection */
+    fT = b2Clamp(b2Dot(_rvPoint - _rvStart, vDirection) / fLengthSquared, 0.0f, 1.0f);
+  }
+
+  /* Done! */
+  return b2DistanceSquared(_rvPoint, _rvStart + fT * vDirection);
+}
+
+static orxBOOL orxFASTCALL orxPhysics_Box2D_TestSphere(b2Fixture *_poFixture, const b2Vec2 &_rvCenter, float32 _fRadius)
+{
+  const b2Shape  *poShape;
+  b2Vec2          vLocalCenter;
+  float32         fRadiusSquared;
+  orxBOOL         bResult = orxFALSE;
+
+  /* Gets shape */
+  poShape = _poFixture->GetShape();
+
+  /* Gets center in shape space */
+  vLocalCenter    = b2MulT(_poFixture->GetBody()->GetXForm(), _rvCenter);
+  fRadiusSquared  = (_fRadius + poShape->m_radius) * (_fRadius + poShape->m_radius);
+
+  /* Depending on shape type */
+  switch(poShape->GetType())
+  {
+    case b2_circleShape:
+    {
+      /* Updates result */
+      bResult = (b2DistanceSquared(vLocalCenter, static_cast<const b2CircleShape *>(poShape)->m_p) <= fRadiusSquared) ? orxTRUE : orxFALSE;
+
+      break;
+    }
+
+    case b2_polygonShape:
+    {
+      const b2PolygonShape *poPolygon;
+      int32                 i;
+
+      /* Gets polygon */
+      poPolygon = static_cast<const b2PolygonShape *>(poShape);
+
+      /* Is center inside? */
+      if(poShape->TestPoint(_poFixture->GetBody()->GetXForm(), _rvCenter))
+      {
+        /* Updates result */
+        bResult = orxTRUE;
+      }
+      else
+      {
+        /* For all edges */
+        for(i = 0; (i < poPolygon->m_vertexCount) && (bResult == orxFALSE); i++)
+        {
+          /* Updates result */
+          bResult = (orxPhysics_Box2D_GetSegmentDistanceSquared(vLocalCenter, poPolygon->m_vertices[i], poPolygon->m_vertices[(i + 1) % poPolygon->m_vertexCount]) <= fRadiusSquared) ? orxTRUE : orxFALSE;
+        }
+      }
+
+      break;
+    }
+
+    case b2_edgeShape:
+    {
+      const b2EdgeShape *poEdge;
+
+      /* Gets edge */
+      poEdge = static_cast<const b2EdgeShape *>(poShape);
+
+      /* Updates result */
+      bResult = (orxPhysics_Box2D_GetSegmentDistanceSquared(vLocalCenter, poEdge->GetVertex1(), poEdge->GetVertex2()) <= fRadiusSquared) ? orxTRUE : orxFALSE;
+
+      break;
+    }
+
+    default:
+    {
+      break;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+static orxBOOL orxFASTCALL orxPhysics_Box2D_TestBox(b2Fixture *_poFixture, const b2PolygonShape &_roBox)
+{
+  const b2Shape  *poShape;
+  b2XForm         stIdentity;
+  b2Manifold      stManifold;
+  orxBOOL         bResult = orxFALSE;
+
+  /* Gets shape */
+  poShape = _poFixture->GetShape();
+
+  /* Box is defined in world space */
+  stIdentity.SetIdentity();
+
+  /* Depending on shape type */
+  switch(poShape->GetType())
+  {
+    case b2_circleShape:
+    {
+      /* Collides them */
+      b2CollidePolygonAndCircle(&stManifold, &_roBox, stIdentity, static_cast<const b2CircleShape *>(poShape), _poFixture->GetBody()->GetXForm());
+
+      /* Updates result */
+      bResult = (stManifold.m_pointCount > 0) ? orxTRUE : orxFALSE;
+
+      break;
+    }
+
+    case b2_polygonShape:
+    {
+      /* Collides them */
+      b2CollidePolygons(&stManifold, &_roBox, stIdentity, static_cast<const b2PolygonShape *>(poShape), _poFixture->GetBody()->GetXForm());
+
+      /* Updates result */
+      bResult = (stManifold.m_pointCount > 0) ? orxTRUE : orxFALSE;
+
+      break;
+    }
+
+    case b2_edgeShape:
+    {
+      const b2EdgeShape  *poEdge;
+      b2Segment           stSegment;
+      b2Vec2              vNormal;
+      float32             fLambda;
+
+      /* Gets edge */
+      poEdge = static_cast<const b2EdgeShape *>(poShape);
+
+      /* Gets its world segment */
+      stSegment.p1 = b2Mul(_poFixture->GetBody()->GetXForm(), poEdge->GetVertex1());
+      stSegment.p2 = b2Mul(_poFixture->GetBody()->GetXForm(), poEdge->GetVertex2());
+
+      /* Updates result (edge starts inside or crosses the box) */
+      bResult = (_roBox.TestSegment(stIdentity, &fLambda, &vNormal, stSegment, 1.0f) != b2_missCollide) ? orxTRUE : orxFALSE;
+
+      break;
+    }
+
+    default:
+    {
+      break;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+static b2Fixture *orxFASTCALL orxPhysics_Box2D_CastRay(const b2Segment &_rstSegment, const b2FilterData &_rstFilterData, float32 *_pfLambda, b2Vec2 *_pvNormal)
+{
+  b2Fixture  *apoFixtureList[orxPhysics::su32QueryFixtureNumber];
+  b2AABB      stAABB;
+  float32     fClosestLambda = 1.0f;
+  orxU32      u32FixtureNumber, i;
+  b2Fixture  *poResult = orxNULL;
+
+  /* Gets segment's AABB */
+  stAABB.lowerBound = b2Min(_rstSegment.p1, _rstSegment.p2);
+  stAABB.upperBound = b2Max(_rstSegment.p1, _rstSegment.p2);
+
+  /* Gets potential fixtures from broadphase */
+  u32FixtureNumber = (orxU32)sstPhysics.poWorld->Query(stAABB, apoFixtureList, (int32)orxPhysics::su32QueryFixtureNumber);
+
+  /* For all potential fixtures */
+  for(i = 0; i < u32FixtureNumber; i++)
+  {
+    b2Fixture *poFixture;
+
+    /* Gets it */
+    poFixture = apoFixtureList[i];
+
+    /* User body that passes filtering? */
+    if((orxPhysics_Box2D_GetUserData(poFixture->GetBody()) != orxNULL)
+    && (orxPhysics_Box2D_CheckFilter(_rstFilterData, poFixture->GetFilterData()) != orxFALSE))
+    {
+      b2Vec2  vNormal;
+      float32 fLambda;
+
+      /* Hit closer than the current one? */
+      if(poFixture->TestSegment(&fLambda, &vNormal, _rstSegment, fClosestLambda) == b2_hitCollide)
+      {
+        /* Stores it */
+        fClosestLambda  = fLambda;
+        *_pvNormal      = vNormal;
+        poResult        = poFixture;
+      }
+    }
+  }
+
+  /* Broadphase overflow? */
+  if(u32FixtureNumber == orxPhysics::su32QueryFixtureNumber)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PHYSICS, "Ray reached the maximum of %ld fixtures, closest hit may be missing.", orxPhysics::su32QueryFixtureNumber);
+  }
+
+  /* Stores lambda */
+  *_pfLambda = fClosestLambda;
+
+  /* Done! */
+  return poResult;
+}
+
 static void orxFASTCALL orxPhysics_Box2D_SendContactEvent(b2Contact *_poContact, orxPHYSICS_EVENT _eEventID)
 {
   b2Body *poSource, *poDestination;
@@ -179,9 +469,11 @@ static void orxFASTCALL orxPhysics_Box2D_SendContactEvent(b2Contact *_poContact,
   poSource      = _poContact->GetFixtureA()->GetBody();
   poDestination = _poContact->GetFixtureB()->GetBody();
 
-  /* Doesn't involve ground? */
+  /* Doesn't involve ground nor a body being deleted? */
   if((poSource != sstPhysics.poWorld->GetGroundBody())
-  && (poDestination != sstPhysics.poWorld->GetGroundBody()))
+  && (poDestination != sstPhysics.poWorld->GetGroundBody())
+  && (poSource->GetUserData() != orxNULL)
+  && (poDestination->GetUserData() != orxNULL))
   {
     orxPHYSICS_EVENT_STORAGE *pstEventStorage;
     orxBOOL                   bSendEvent = orxTRUE;
@@ -285,8 +577,8 @@ static void orxFASTCALL orxPhysics_Box2D_SendContactEvent(b2Contact *_poContact,
           }
 
           /* Updates part names */
-          pstEventStorage->stPayload.zSenderPartName    = orxBody_GetPartName(orxBODY(poSource->GetUserData()), u32SourcePartIndex);
-          pstEventStorage->stPayload.zRecipientPartName = orxBody_GetPartName(orxBODY(poDestination->GetUserData()), u32DestinationPartIndex);
+          pstEventStorage->stPayload.zSenderPartName    = orxBody_GetPartName(orxBODY(orxPhysics_Box2D_GetUserData(poSource)), u32SourcePartIndex);
+          pstEventStorage->stPayload.zRecipientPartName = orxBody_GetPartName(orxBODY(orxPhysics_Box2D_GetUserData(poDestination)), u32DestinationPartIndex);
         }
       }
     }
@@ -305,12 +597,25 @@ void orxPhysicsContactListener::BeginContact(b2Contact *_poContact)
 
 void orxPhysicsContactListener::EndContact(b2Contact *_poContact)
 {
+  /* Wakes up both bodies (Box2D does it too, not always before notifying us) */
+  orxPhysics_Box2D_WakeUp(_poContact->GetFixtureA()->GetBody());
+  orxPhysics_Box2D_WakeUp(_poContact->GetFixtureB()->GetBody());
+
   /* Sends contact event */
   orxPhysics_Box2D_SendContactEvent(_poContact, orxPHYSICS_EVENT_CONTACT_REMOVE);
 
   return;
 }
 
+void orxPhysicsContactListener::PostSolve(const b2Contact *_poContact, const b2ContactImpulse *_pstImpulse)
+{
+  /* Activates both bodies: solved islands can wake sleeping ones up */
+  orxPhysics_Box2D_Activate(_poContact->GetFixtureA()->GetBody());
+  orxPhysics_Box2D_Activate(_poContact->GetFixtureB()->GetBody());
+
+  return;
+}
+
 void orxPhysicsBoundaryListener::Violation(b2Body *_poBody)
 {
   orxPHYSICS_EVENT_STORAGE *pstEventStorage;
@@ -340,29 +645,35 @@ void orxPhysicsBoundaryListener::Violation(b2Body *_poBody)
 static void orxFASTCALL orxPhysics_Update(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
   orxPHYSICS_EVENT_STORAGE *pstEventStorage;
-  orxBODY                  *pstBody;
+  orxPHYSICS_BODY_NODE     *pstNode;
+  b2Body                   *poBody;
 
   /* Checks */
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstClockInfo != orxNULL);
 
-  /* For all bodies */
-  for(pstBody = orxBODY(orxStructure_GetFirst(orxSTRUCTURE_ID_BODY));
-      pstBody != orxNULL;
-      pstBody = orxBODY(orxStructure_GetNext(pstBody)))
+  /* For all bodies (static and sleeping ones included, as they follow their frames when parented to moving ones) */
+  for(poBody = sstPhysics.poWorld->GetBodyList(); poBody != orxNULL; poBody = poBody->GetNext())
   {
-    orxFRAME *pstFrame;
+    /* Gets its node */
+    pstNode = (orxPHYSICS_BODY_NODE *)poBody->GetUserData();
 
-    /* Gets owner's frame */
-    pstFrame = orxOBJECT_GET_STRUCTURE(orxOBJECT(orxBody_GetOwner(pstBody)), FRAME);
-
-    /* Is dirty? */
-    if(orxFrame_IsDirty(pstFrame) != orxFALSE)
+    /* Not ground? */
+    if(pstNode != orxNULL)
     {
-      orxVECTOR vPos;
+      orxFRAME *pstFrame;
+
+      /* Gets owner's frame */
+      pstFrame = orxOBJECT_GET_STRUCTURE(orxOBJECT(orxBody_GetOwner(orxBODY(pstNode->hUserData))), FRAME);
+
+      /* Is dirty? */
+      if(orxFrame_IsDirty(pstFrame) != orxFALSE)
+      {
+        orxVECTOR vPos;
 
-      /* Updates body's position */
-      orxBody_SetPosition(pstBody, orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vPos));
+        /* Updates body's position */
+        orxBody_SetPosition(orxBODY(pstNode->hUserData), orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vPos));
+      }
     }
   }
 
@@ -372,13 +683,35 @@ static void orxFASTCALL orxPhysics_Update(const orxCLOCK_INFO *_pstClockInfo, vo
     /* Updates world simulation */
     sstPhysics.poWorld->Step(_pstClockInfo->fDT, (orxU32)_pContext, (orxU32)_pContext);
 
-    /* For all bodies */
-    for(pstBody = orxBODY(orxStructure_GetFirst(orxSTRUCTURE_ID_BODY));
-        pstBody != orxNULL;
-        pstBody = orxBODY(orxStructure_GetNext(pstBody)))
+    b2Joint *poJoint;
+
+    /* For all joints */
+    for(poJoint = sstPhysics.poWorld->GetJointList(); poJoint != orxNULL; poJoint = poJoint->GetNext())
     {
-      /* Applies simulation result */
-      orxBody_ApplySimulationResult(pstBody);
+      /* Activates both bodies: islands can wake sleeping ones up through joints */
+      orxPhysics_Box2D_Activate(poJoint->GetBody1());
+      orxPhysics_Box2D_Activate(poJoint->GetBody2());
+    }
+
+    /* For all active bodies (sleeping ones are skipped entirely) */
+    for(pstNode = (orxPHYSICS_BODY_NODE *)orxLinkList_GetFirst(&(sstPhysics.stActiveList));
+        pstNode != orxNULL;)
+    {
+      orxPHYSICS_BODY_NODE *pstCurrentNode;
+
+      /* Gets current node and goes to next one */
+      pstCurrentNode  = pstNode;
+      pstNode         = (orxPHYSICS_BODY_NODE *)orxLinkList_GetNext(&(pstNode->stNode));
+
+      /* Applies simulation result (including the step it fell asleep on) */
+      orxBody_ApplySimulationResult(orxBODY(pstCurrentNode->hUserData));
+
+      /* Fell asleep? */
+      if(pstCurrentNode->poBody->IsSleeping() || pstCurrentNode->poBody->IsStatic())
+      {
+        /* Removes it from the active list until something wakes it up */
+        orxLinkList_Remove(&(pstCurrentNode->stNode));
+      }
     }
 
     /* For all stored events */
@@ -394,7 +727,7 @@ static void orxFASTCALL orxPhysics_Update(const orxCLOCK_INFO *_pstClockInfo, vo
           orxSTRUCTURE *pstOwner;
 
           /* Gets owner */
-          pstOwner = orxBody_GetOwner(orxBODY(pstEventStorage->poSource->GetUserData()));
+          pstOwner = orxBody_GetOwner(orxBODY(orxPhysics_Box2D_GetUserData(pstEventStorage->poSource)));
 
           /* Sends event */
           orxEVENT_SEND(orxEVENT_TYPE_PHYSICS, orxPHYSICS_EVENT_OUT_OF_WORLD, pstOwner, pstOwner, orxNULL);
@@ -437,7 +770,7 @@ static void orxFASTCALL orxPhysics_Update(const orxCLOCK_INFO *_pstClockInfo, vo
           }
 
           /* Sends event */
-          orxEVENT_SEND(orxEVENT_TYPE_PHYSICS, pstEventStorage->eID, orxBody_GetOwner(orxBODY(pstEventStorage->poSource->GetUserData())), orxBody_GetOwner(orxBODY(pstEventStorage->poDestination->GetUserData())), &(pstEventStorage->stPayload));
+          orxEVENT_SEND(orxEVENT_TYPE_PHYSICS, pstEventStorage->eID, orxBody_GetOwner(orxBODY(orxPhysics_Box2D_GetUserData(pstEventStorage->poSource))), orxBody_GetOwner(orxBODY(orxPhysics_Box2D_GetUserData(pstEventStorage->poDestination))), &(pstEventStorage->stPayload));
 
           break;
         }
@@ -459,19 +792,25 @@ static void orxFASTCALL orxPhysics_Update(const orxCLOCK_INFO *_pstClockInfo, vo
 
 extern "C" orxPHYSICS_BODY *orxFASTCALL orxPhysics_Box2D_CreateBody(const orxHANDLE _hUserData, const orxBODY_DEF *_pstBodyDef)
 {
-  b2Body     *poResult = 0;
-  b2BodyDef   stBodyDef;
+  orxPHYSICS_BODY_NODE *pstNode;
+  b2Body               *poResult = 0;
+  b2BodyDef             stBodyDef;
 
   /* Checks */
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_hUserData != orxHANDLE_UNDEFINED);
   orxASSERT(_pstBodyDef != orxNULL);
 
-  /* 2D? */
-  if(orxFLAG_TEST(_pstBodyDef->u32Flags, orxBODY_DEF_KU32_FLAG_2D))
+  /* 2D and got a node? */
+  if((orxFLAG_TEST(_pstBodyDef->u32Flags, orxBODY_DEF_KU32_FLAG_2D))
+  && ((pstNode = (orxPHYSICS_BODY_NODE *)orxBank_Allocate(sstPhysics.pstBodyBank)) != orxNULL))
   {
+    /* Inits node */
+    orxMemory_Zero(pstNode, sizeof(orxPHYSICS_BODY_NODE));
+    pstNode->hUserData          = _hUserData;
+
     /* Inits body definition */
-    stBodyDef.userData          = _hUserData;
+    stBodyDef.userData          = pstNode;
     stBodyDef.angle             = _pstBodyDef->fRotation;
     stBodyDef.linearDamping     = _pstBodyDef->fLinearDamping;
     stBodyDef.angularDamping    = _pstBodyDef->fAngularDamping;
@@ -489,6 +828,13 @@ extern "C" orxPHYSICS_BODY *orxFASTCALL orxPhysics_Box2D_CreateBody(const orxHAN
 
       /* Creates dynamic body */
       poResult = sstPhysics.poWorld->CreateBody(&stBodyDef);
+
+      /* Success? */
+      if(poResult != orxNULL)
+      {
+        /* Activates it */
+        orxPhysics_Box2D_Activate(poResult);
+      }
     }
     else
     {
@@ -499,6 +845,18 @@ extern "C" orxPHYSICS_BODY *orxFASTCALL orxPhysics_Box2D_CreateBody(const orxHAN
       /* Creates static body */
       poResult = sstPhysics.poWorld->CreateBody(&stBodyDef);
     }
+
+    /* Success? */
+    if(poResult != orxNULL)
+    {
+      /* Stores body */
+      pstNode->poBody = poResult;
+    }
+    else
+    {
+      /* Frees node */
+      orxBank_Free(sstPhysics.pstBodyBank, pstNode);
+    }
   }
 
   /* Done! */
@@ -508,6 +866,7 @@ extern "C" orxPHYSICS_BODY *orxFASTCALL orxPhysics_Box2D_CreateBody(const orxHAN
 extern "C" void orxFASTCALL orxPhysics_Box2D_DeleteBody(orxPHYSICS_BODY *_pstBody)
 {
   orxPHYSICS_EVENT_STORAGE *pstEventStorage;
+  orxPHYSICS_BODY_NODE     *pstNode;
 
   /* Checks */
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
@@ -535,9 +894,25 @@ extern "C" void orxFASTCALL orxPhysics_Box2D_DeleteBody(orxPHYSICS_BODY *_pstBod
     }
   }
 
+  /* Gets its node */
+  pstNode = (orxPHYSICS_BODY_NODE *)((b2Body *)_pstBody)->GetUserData();
+
+  /* Active? */
+  if(orxLinkList_GetList(&(pstNode->stNode)) != orxNULL)
+  {
+    /* Removes it from the active list */
+    orxLinkList_Remove(&(pstNode->stNode));
+  }
+
+  /* Detaches it so that contact callbacks ignore it while it's being destroyed */
+  ((b2Body *)_pstBody)->SetUserData(orxNULL);
+
   /* Deletes it */
   sstPhysics.poWorld->DestroyBody((b2Body *)_pstBody);
 
+  /* Frees its node */
+  orxBank_Free(sstPhysics.pstBodyBank, pstNode);
+
   return;
 }
 
@@ -697,7 +1072,7 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_Box2D_SetPosition(orxPHYSICS_BODY *_
   poBody = (b2Body *)_pstBody;
 
   /* Wakes up */
-  poBody->WakeUp();
+  orxPhysics_Box2D_WakeUp(poBody);
 
   /* Sets position vector */
   vPosition.Set(sstPhysics.fDimensionRatio * _pvPosition->fX, sstPhysics.fDimensionRatio * _pvPosition->fY);
@@ -722,7 +1097,7 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_Box2D_SetRotation(orxPHYSICS_BODY *_
   poBody = (b2Body *)_pstBody;
 
   /* Wakes up */
-  poBody->WakeUp();
+  orxPhysics_Box2D_WakeUp(poBody);
 
   /* Updates its rotation */
   eResult = (poBody->SetXForm(poBody->GetPosition(), _fRotation) != false) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
@@ -749,7 +1124,7 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_Box2D_SetSpeed(orxPHYSICS_BODY *_pst
   vSpeed.Set(sstPhysics.fDimensionRatio * _pvSpeed->fX, sstPhysics.fDimensionRatio * _pvSpeed->fY);
 
   /* Wakes up */
-  poBody->WakeUp();
+  orxPhysics_Box2D_WakeUp(poBody);
 
   /* Updates its speed */
   poBody->SetLinearVelocity(vSpeed);
@@ -771,7 +1146,7 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_Box2D_SetAngularVelocity(orxPHYSICS_
   poBody = (b2Body *)_pstBody;
 
   /* Wakes up */
-  poBody->WakeUp();
+  orxPhysics_Box2D_WakeUp(poBody);
 
   /* Updates its angular velocity */
   poBody->SetAngularVelocity(_fVelocity);
@@ -793,7 +1168,7 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_Box2D_SetCustomGravity(orxPHYSICS_BO
   poBody = (b2Body *)_pstBody;
 
   /* Wakes up */
-  poBody->WakeUp();
+  orxPhysics_Box2D_WakeUp(poBody);
 
   /* Has custom gravity */
   if(_pvCustomGravity != orxNULL)
@@ -983,7 +1358,7 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_Box2D_ApplyTorque(orxPHYSICS_BODY *_
   poBody = (b2Body *)_pstBody;
 
   /* Wakes up */
-  poBody->WakeUp();
+  orxPhysics_Box2D_WakeUp(poBody);
 
   /* Applies torque */
   poBody->ApplyTorque(_fTorque);
@@ -1008,7 +1383,7 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_Box2D_ApplyForce(orxPHYSICS_BODY *_p
   poBody = (b2Body *)_pstBody;
 
   /* Wakes up */
-  poBody->WakeUp();
+  orxPhysics_Box2D_WakeUp(poBody);
 
   /* Sets force */
   vForce.Set(_pvForce->fX, _pvForce->fY);
@@ -1039,7 +1414,7 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_Box2D_ApplyImpulse(orxPHYSICS_BODY *
   poBody = (b2Body *)_pstBody;
 
   /* Wakes up */
-  poBody->WakeUp();
+  orxPhysics_Box2D_WakeUp(poBody);
 
   /* Sets impulse */
   vImpulse.Set(_pvImpulse->fX, _pvImpulse->fY);
@@ -1060,7 +1435,7 @@ extern "C" orxHANDLE orxFASTCALL orxPhysics_Box2D_Raycast(const orxVECTOR *_pvSt
   b2Vec2        vNormal;
   b2Fixture    *poRaycastResult;
   b2FilterData  stFilterData;
-  float         fLambda;
+  float32       fLambda;
   orxHANDLE     hResult = orxHANDLE_UNDEFINED;
 
   /* Checks */
@@ -1077,17 +1452,14 @@ extern "C" orxHANDLE orxFASTCALL orxPhysics_Box2D_Raycast(const orxVECTOR *_pvSt
   stFilterData.maskBits     = _u16CheckMask;
   stFilterData.groupIndex   = 0;
 
-  /* Inits raycast fixture */
-  sstPhysics.poRaycastFixture->SetFilterData(stFilterData);
-
   /* Issues Raycast */
-  poRaycastResult = sstPhysics.poWorld->RaycastOne(stSegment, &fLambda, &vNormal, false, sstPhysics.poRaycastFixture);
+  poRaycastResult = orxPhysics_Box2D_CastRay(stSegment, stFilterData, &fLambda, &vNormal);
 
   /* Found? */
   if(poRaycastResult != orxNULL)
   {
     /* Updates result */
-    hResult = (orxHANDLE)poRaycastResult->GetBody()->GetUserData();
+    hResult = orxPhysics_Box2D_GetUserData(poRaycastResult->GetBody());
 
     /* Asked for contact? */
     if(_pvContact != orxNULL)
@@ -1110,6 +1482,171 @@ extern "C" orxHANDLE orxFASTCALL orxPhysics_Box2D_Raycast(const orxVECTOR *_pvSt
   return hResult;
 }
 
+extern "C" orxU32 orxFASTCALL orxPhysics_Box2D_Query(const orxPHYSICS_QUERY *_astQueryList, orxU32 _u32QueryNumber, orxPHYSICS_HIT *_astHitList, orxU32 _u32HitNumber)
+{
+  b2Fixture  *apoFixtureList[orxPhysics::su32QueryFixtureNumber];
+  orxU32      i, u32Result = 0;
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astQueryList != orxNULL) || (_u32QueryNumber == 0));
+  orxASSERT((_astHitList != orxNULL) || (_u32HitNumber == 0));
+
+  /* For all queries, while there's room for hits */
+  for(i = 0; (i < _u32QueryNumber) && (u32Result < _u32HitNumber); i++)
+  {
+    const orxPHYSICS_QUERY *pstQuery;
+    b2FilterData            stFilterData;
+
+    /* Gets query */
+    pstQuery = &_astQueryList[i];
+
+    /* Inits its filter data */
+    stFilterData.categoryBits = pstQuery->u16SelfFlags;
+    stFilterData.maskBits     = pstQuery->u16CheckMask;
+    stFilterData.groupIndex   = 0;
+
+    /* Ray? */
+    if(pstQuery->eType == orxPHYSICS_QUERY_TYPE_RAY)
+    {
+      b2Segment   stSegment;
+      b2Vec2      vNormal;
+      b2Fixture  *poFixture;
+      float32     fLambda;
+
+      /* Gets segment */
+      stSegment.p1.Set(sstPhysics.fDimensionRatio * pstQuery->vStart.fX, sstPhysics.fDimensionRatio * pstQuery->vStart.fY);
+      stSegment.p2.Set(sstPhysics.fDimensionRatio * pstQuery->vEnd.fX, sstPhysics.fDimensionRatio * pstQuery->vEnd.fY);
+
+      /* Issues raycast */
+      poFixture = orxPhysics_Box2D_CastRay(stSegment, stFilterData, &fLambda, &vNormal);
+
+      /* Found? */
+      if(poFixture != orxNULL)
+      {
+        orxPHYSICS_HIT *pstHit;
+
+        /* Gets hit */
+        pstHit = &_astHitList[u32Result++];
+
+        /* Inits it */
+        pstHit->hBody         = orxPhysics_Box2D_GetUserData(poFixture->GetBody());
+        pstHit->hOwner        = orxHANDLE_UNDEFINED;
+        pstHit->u32QueryIndex = i;
+        orxVector_Set(&(pstHit->vContact), ((orxFLOAT_1 - orx2F(fLambda)) * pstQuery->vStart.fX) + (orx2F(fLambda) * pstQuery->vEnd.fX), ((orxFLOAT_1 - orx2F(fLambda)) * pstQuery->vStart.fY) + (orx2F(fLambda) * pstQuery->vEnd.fY), pstQuery->vStart.fZ);
+        orxVector_Set(&(pstHit->vNormal), vNormal.x, vNormal.y, orxFLOAT_0);
+      }
+    }
+    else
+    {
+      b2PolygonShape  oBox;
+      b2AABB          stAABB;
+      b2Vec2          vCenter;
+      float32         fRadius = 0.0f;
+      orxU32          u32FirstHit, u32FixtureNumber, j;
+
+      /* Checks */
+      orxASSERT((pstQuery->eType == orxPHYSICS_QUERY_TYPE_BOX) || (pstQuery->eType == orxPHYSICS_QUERY_TYPE_SPHERE));
+
+      /* Box? */
+      if(pstQuery->eType == orxPHYSICS_QUERY_TYPE_BOX)
+      {
+        /* Gets AABB */
+        stAABB.lowerBound.Set(sstPhysics.fDimensionRatio * orxMIN(pstQuery->vStart.fX, pstQuery->vEnd.fX), sstPhysics.fDimensionRatio * orxMIN(pstQuery->vStart.fY, pstQuery->vEnd.fY));
+        stAABB.upperBound.Set(sstPhysics.fDimensionRatio * orxMAX(pstQuery->vStart.fX, pstQuery->vEnd.fX), sstPhysics.fDimensionRatio * orxMAX(pstQuery->vStart.fY, pstQuery->vEnd.fY));
+
+        /* Gets matching box shape */
+        oBox.SetAsBox(0.5f * (stAABB.upperBound.x - stAABB.lowerBound.x), 0.5f * (stAABB.upperBound.y - stAABB.lowerBound.y), 0.5f * (stAABB.lowerBound + stAABB.upperBound), 0.0f);
+
+        /* Removes its collision skin, only fixtures' one should count */
+        oBox.m_radius = 0.0f;
+      }
+      else
+      {
+        /* Gets sphere */
+        vCenter.Set(sstPhysics.fDimensionRatio * pstQuery->vStart.fX, sstPhysics.fDimensionRatio * pstQuery->vStart.fY);
+        fRadius = sstPhysics.fDimensionRatio * pstQuery->fRadius;
+
+        /* Gets its AABB */
+        stAABB.lowerBound.Set(vCenter.x - fRadius, vCenter.y - fRadius);
+        stAABB.upperBound.Set(vCenter.x + fRadius, vCenter.y + fRadius);
+      }
+
+      /* Gets potential fixtures from broadphase */
+      u32FixtureNumber = (orxU32)sstPhysics.poWorld->Query(stAABB, apoFixtureList, (int32)orxPhysics::su32QueryFixtureNumber);
+
+      /* Stores first hit index */
+      u32FirstHit = u32Result;
+
+      /* For all potential fixtures, while there's room for hits */
+      for(j = 0; (j < u32FixtureNumber) && (u32Result < _u32HitNumber); j++)
+      {
+        b2Fixture  *poFixture;
+        b2Body     *poBody;
+        orxHANDLE   hBody;
+
+        /* Gets fixture & body */
+        poFixture = apoFixtureList[j];
+        poBody    = poFixture->GetBody();
+        hBody     = orxPhysics_Box2D_GetUserData(poBody);
+
+        /* User body that passes filtering? */
+        if((hBody != orxNULL) && (orxPhysics_Box2D_CheckFilter(stFilterData, poFixture->GetFilterData()) != orxFALSE))
+        {
+          orxBOOL bHit;
+
+          /* Box? */
+          if(pstQuery->eType == orxPHYSICS_QUERY_TYPE_BOX)
+          {
+            /* Updates hit status */
+            bHit = orxPhysics_Box2D_TestBox(poFixture, oBox);
+          }
+          else
+          {
+            /* Updates hit status */
+            bHit = orxPhysics_Box2D_TestSphere(poFixture, vCenter, fRadius);
+          }
+
+          /* Hit? */
+          if(bHit != orxFALSE)
+          {
+            orxU32 k;
+
+            /* Checks if body was already reported by this query */
+            for(k = u32FirstHit; (k < u32Result) && (_astHitList[k].hBody != hBody); k++);
+
+            /* New one? */
+            if(k == u32Result)
+            {
+              orxPHYSICS_HIT *pstHit;
+
+              /* Gets hit */
+              pstHit = &_astHitList[u32Result++];
+
+              /* Inits it */
+              pstHit->hBody         = hBody;
+              pstHit->hOwner        = orxHANDLE_UNDEFINED;
+              pstHit->u32QueryIndex = i;
+              orxVector_Set(&(pstHit->vContact), sstPhysics.fRecDimensionRatio * poBody->GetPosition().x, sstPhysics.fRecDimensionRatio * poBody->GetPosition().y, pstQuery->vStart.fZ);
+              orxVector_Copy(&(pstHit->vNormal), &orxVECTOR_0);
+            }
+          }
+        }
+      }
+
+      /* Broadphase overflow? */
+      if(u32FixtureNumber == orxPhysics::su32QueryFixtureNumber)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PHYSICS, "Query #%ld reached the maximum of %ld fixtures, some hits may be missing.", i, orxPhysics::su32QueryFixtureNumber);
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
 extern "C" void orxFASTCALL orxPhysics_Box2D_EnableSimulation(orxBOOL _bEnable)
 {
   /* Checks */
@@ -1267,22 +1804,12 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_Box2D_Init()
         /* Valid? */
         if(eResult != orxSTATUS_FAILURE)
         {
-          b2CircleDef stCircleDef;
-
-          /* Updates Fixture type */
-          stCircleDef.type = b2_circleShape;
-
-          /* Stores its coordinates */
-          stCircleDef.localPosition.Set(0.0f, 0.0f);
-          stCircleDef.radius    = 0.0f;
-          stCircleDef.isSensor  = true;
-
-          /* Creates raycast fixture */
-          sstPhysics.poRaycastFixture = sstPhysics.poWorld->GetGroundBody()->CreateFixture(&stCircleDef);
-
           /* Creates event bank */
           sstPhysics.pstEventBank = orxBank_Create(orxPhysics::su32MessageBankSize, sizeof(orxPHYSICS_EVENT_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+          /* Creates body node bank */
+          sstPhysics.pstBodyBank  = orxBank_Create(orxPhysics::su32BodyBankSize, sizeof(orxPHYSICS_BODY_NODE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
           /* Updates status */
           sstPhysics.u32Flags |= orxPHYSICS_KU32_STATIC_FLAG_READY | orxPHYSICS_KU32_STATIC_FLAG_ENABLED;
         }
@@ -1291,7 +1818,7 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_Box2D_Init()
           /* Deletes listeners */
           delete sstPhysics.poContactListener;
           delete sstPhysics.poBoundaryListener;
-
+  
           /* Deletes world */
           delete sstPhysics.poWorld;
 
@@ -1338,6 +1865,9 @@ extern "C" void orxFASTCALL orxPhysics_Box2D_Exit()
     /* Deletes world */
     delete sstPhysics.poWorld;
 
+    /* Deletes body node bank */
+    orxBank_Delete(sstPhysics.pstBodyBank);
+
     /* Cleans static controller */
     orxMemory_Zero(&sstPhysics, sizeof(orxPHYSICS_STATIC));
   }
@@ -1374,6 +1904,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Box2D_ApplyTorque, PHYSICS, APPLY_TO
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Box2D_ApplyForce, PHYSICS, APPLY_FORCE)
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Box2D_ApplyImpulse, PHYSICS, APPLY_IMPULSE)
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Box2D_Raycast, PHYSICS, RAYCAST)
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Box2D_Query, PHYSICS, QUERY)
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Box2D_EnableSimulation, PHYSICS, ENABLE_SIMULATION)
 orxPLUGIN_USER_CORE_FUNCTION_END();
 
@@ -32,11 +32,52 @@
 #include "orxPluginAPI.h"
 
 
+/** Platform dependent includes & types
+ */
+
+/* Windows */
+#ifdef __orxWINDOWS__
+
+  #define WIN32_LEAN_AND_MEAN
+  #include <windows.h>
+
+  typedef HANDLE                              orxRENDER_THREAD;
+  typedef CRITICAL_SECTION                    orxRENDER_MUTEX;
+  typedef HANDLE                              orxRENDER_SIGNAL;
+
+  #define __orxRENDER_THREAD__
+
+#else /* __orxWINDOWS__ */
+
+  /* Linux / Mac / IPhone */
+  #if defined(__orxLINUX__) || defined(__orxMAC__) || defined(__orxIPHONE__)
+
+    #include <pthread.h>
+
+    typedef pthread_t                         orxRENDER_THREAD;
+    typedef pthread_mutex_t                   orxRENDER_MUTEX;
+    typedef pthread_cond_t                    orxRENDER_SIGNAL;
+
+    #define __orxRENDER_THREAD__
+
+  #else /* __orxLINUX__ || __orxMAC__ || __orxIPHONE__ */
+
+    #undef __orxRENDER_THREAD__
+
+  #endif /* __orxLINUX__ || __orxMAC__ || __orxIPHONE__ */
+
+#endif /* __orxWINDOWS__ */
+
+
 /** Module flags
  */
 #define orxRENDER_KU32_STATIC_FLAG_NONE       0x00000000 /**< No flags */
 
 #define orxRENDER_KU32_STATIC_FLAG_READY      0x00000001 /**< Ready flag */
+#define orxRENDER_KU32_STATIC_FLAG_THREADED   0x00000002 /**< Command lists are executed by the render thread */
+#define orxRENDER_KU32_STATIC_FLAG_REQUESTED  0x00000004 /**< Render thread has been requested by config */
+#define orxRENDER_KU32_STATIC_FLAG_ACQUIRED   0x00000008 /**< Display context has been acquired from main thread during current frame */
+#define orxRENDER_KU32_STATIC_FLAG_RENDERING  0x00000010 /**< Viewports are being rendered, visibility lists may exist */
 
 #define orxRENDER_KU32_STATIC_MASK_ALL        0xFFFFFFFF /**< All mask */
 
@@ -44,7 +85,12 @@
 /** Defines
  */
 #define orxRENDER_KF_TICK_SIZE                orx2F(1.0f / 60.0f)
-#define orxRENDER_KU32_ORDER_BANK_SIZE        128
+#define orxRENDER_KU32_VISIBILITY_BANK_SIZE   8
+#define orxRENDER_KU32_COMMAND_LIST_SIZE      256
+#define orxRENDER_KU32_FPS_TEXT_SIZE          16
+#define orxRENDER_KU32_CAPTURE_LIST_SIZE      8
+#define orxRENDER_KU32_SIGNATURE_SEED         0x811C9DC5
+#define orxRENDER_KU32_SIGNATURE_PRIME        0x01000193
 #define orxRENDER_KST_DEFAULT_COLOR           orx2RGBA(255, 0, 0, 255)
 #define orxRENDER_KZ_FPS_FORMAT               "FPS: %ld"
 
@@ -53,39 +99,1281 @@
  * Structure declaration                                                   *
  ***************************************************************************/
 
-typedef struct __orxRENDER_RENDER_NODE_t
-{
-  orxLINKLIST_NODE  stNode;                       /**< Linklist node : 12 */
-  orxOBJECT        *pstObject;                    /**< Object pointer : 16 */
-  orxVECTOR         vPosition;                    /**< Object position : 32 */
-  orxFLOAT          fDepthCoef;                   /**< Depth coef : 36 */
+/** Command type enum
+ */
+typedef enum __orxRENDER_COMMAND_TYPE_t
+{
+  orxRENDER_COMMAND_TYPE_CLIP = 0,                /**< Sets destination clipping */
+  orxRENDER_COMMAND_TYPE_CLEAR,                   /**< Clears destination */
+  orxRENDER_COMMAND_TYPE_BLIT,                    /**< Blits source bitmap */
+  orxRENDER_COMMAND_TYPE_TRANSFORM,               /**< Transforms source bitmap */
+  orxRENDER_COMMAND_TYPE_TEXT,                    /**< Transforms text */
+  orxRENDER_COMMAND_TYPE_CAPTURE,                 /**< Blits source bitmap into a viewport static cache */
+
+  orxRENDER_COMMAND_TYPE_NUMBER,
+
+  orxRENDER_COMMAND_TYPE_NONE = orxENUM_NONE
+
+} orxRENDER_COMMAND_TYPE;
+
+/** Render command: snapshot of everything needed to issue a single display call
+ */
+typedef struct __orxRENDER_COMMAND_t
+{
+  orxRENDER_COMMAND_TYPE  eType;                  /**< Command type : 4 */
+  orxBITMAP              *pstDst;                 /**< Destination bitmap : 8 */
+  orxBITMAP              *pstSrc;                 /**< Source bitmap : 12 */
+  const orxDISPLAY_TEXT  *pstText;                /**< Display text : 16 */
+  orxU32                  u32ClipTLX;             /**< Clipping top left corner, X : 20 */
+  orxU32                  u32ClipTLY;             /**< Clipping top left corner, Y : 24 */
+  orxU32                  u32ClipBRX;             /**< Clipping bottom right corner, X : 28 */
+  orxU32                  u32ClipBRY;             /**< Clipping bottom right corner, Y : 32 */
+  orxRGBA                 stColor;                /**< Source / clear / text color : 36 */
+  orxBOOL                 bColor;                 /**< Source color has to be applied : 40 */
+  orxDISPLAY_TRANSFORM    stTransform;            /**< Transform (blits only use destination) : 68 */
+  orxDISPLAY_SMOOTHING    eSmoothing;             /**< Smoothing : 72 */
+  orxDISPLAY_BLEND_MODE   eBlendMode;             /**< Blend mode : 76 */
+  orxVIEWPORT            *pstViewport;            /**< Viewport whose static cache is captured : 80 */
+  orxU32                  u32Signature;           /**< Signature of the captured static cache : 84 */
+
+} orxRENDER_COMMAND;
+
+/** Static cache capture, reported by command execution and applied from main thread
+ */
+typedef struct __orxRENDER_CAPTURE_t
+{
+  orxVIEWPORT            *pstViewport;            /**< Viewport : 4 */
+  const orxBITMAP        *pstCache;               /**< Captured static cache : 8 */
+  orxU32                  u32Signature;           /**< Signature of the captured content : 12 */
+
+} orxRENDER_CAPTURE;
+
+/** Command list: all the display calls of a frame
+ */
+typedef struct __orxRENDER_COMMAND_LIST_t
+{
+  orxRENDER_COMMAND  *astCommandList;             /**< Commands : 4 */
+  orxU32              u32Size;                    /**< Allocated size : 8 */
+  orxU32              u32Counter;                 /**< Command counter : 12 */
+  orxBOOL             bShowFPS;                   /**< Should print FPS text before presenting : 16 */
+  orxCHAR             acFPSText[orxRENDER_KU32_FPS_TEXT_SIZE]; /**< FPS text : 32 */
+  orxRENDER_CAPTURE   astCaptureList[orxRENDER_KU32_CAPTURE_LIST_SIZE]; /**< Successful static cache captures : 128 */
+  orxU32              u32CaptureCounter;          /**< Capture counter : 132 */
+
+} orxRENDER_COMMAND_LIST;
+
+typedef struct __orxRENDER_RENDER_NODE_t
+{
+  orxLINKLIST_NODE  stNode;                       /**< Linklist node : 12 */
+  orxOBJECT        *pstObject;                    /**< Object pointer : 16 */
+  orxVECTOR         vPosition;                    /**< Object position : 32 */
+  orxFLOAT          fDepthCoef;                   /**< Depth coef : 36 */
+
+} orxRENDER_NODE;
+
+typedef struct __orxRENDER_VISIBILITY_t
+{
+  orxLINKLIST       stRenderList;                 /**< Sorted render nodes : 12 */
+  const orxCAMERA  *pstCamera;                    /**< Camera pointer : 16 */
+  orxAABOX          stFrustum;                    /**< Camera frustum : 40 */
+  orxVECTOR         vCameraPosition;              /**< Camera position : 52 */
+  orxFLOAT          fZoom;                        /**< Camera zoom : 56 */
+
+} orxRENDER_VISIBILITY;
+
+/** Static structure
+ */
+typedef struct __orxRENDER_STATIC_t
+{
+  orxU32        u32Flags;                         /**< Control flags : 4 */
+  orxCLOCK     *pstClock;                         /**< Rendering clock pointer : 8 */
+  orxBANK      *pstVisibilityBank;                /**< Per camera visibility lists of the current frame : 12 */
+  orxFRAME     *pstFrame;                         /**< Rendering frame : 16 */
+  orxU32        u32CullingSize;                   /**< Culling buffer size : 20 */
+  orxOBJECT   **apstCullingObject;                /**< Culling objects : 24 */
+  orxVECTOR    *avCullingPosition;                /**< Culling positions : 28 */
+  orxFLOAT     *afCullingDepthCoef;               /**< Culling depth coefs : 32 */
+  orxFLOAT     *afCullingDistX;                   /**< Culling distances to camera, X : 36 */
+  orxFLOAT     *afCullingDistY;                   /**< Culling distances to camera, Y : 40 */
+  orxFLOAT     *afCullingRadius;                  /**< Culling bounding radii : 44 */
+  orxU8        *au8CullingResult;                 /**< Culling results : 48 */
+  orxRENDER_COMMAND_LIST astCommandList[2];       /**< Double-buffered command lists : 112 */
+  orxU32        u32WriteIndex;                    /**< Index of the list being extracted : 116 */
+
+#ifdef __orxRENDER_THREAD__
+
+  orxRENDER_THREAD  hThread;                      /**< Render thread */
+  orxRENDER_MUTEX   stMutex;                      /**< Mutex protecting hand-over states */
+  orxRENDER_SIGNAL  stFrameSignal;                /**< Signaled when a command list is handed over */
+  orxRENDER_SIGNAL  stDoneSignal;                 /**< Signaled when render thread is idle again */
+  orxSTATUS         eContextStatus;               /**< Render thread display context status */
+  orxBOOL           bBusy;                        /**< Render thread is working */
+  orxBOOL           bStopThread;                  /**< Render thread stop request */
+
+#endif /* __orxRENDER_THREAD__ */
+
+} orxRENDER_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxRENDER_STATIC sstRender;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Makes sure culling buffers can hold a given number of objects
+ * @param[in]   _u32Number    Number of objects
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxRender_ReserveCulling(orxU32 _u32Number)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Too small? */
+  if(_u32Number > sstRender.u32CullingSize)
+  {
+    orxU32  u32Size;
+    orxU8  *pu8Buffer;
+
+    /* Gets new size */
+    u32Size = orxMAX(_u32Number, sstRender.u32CullingSize << 1);
+
+    /* Allocates all buffers at once (pointers first for alignment) */
+    pu8Buffer = (orxU8 *)orxMemory_Allocate(u32Size * (sizeof(orxOBJECT *) + sizeof(orxVECTOR) + (4 * sizeof(orxFLOAT)) + sizeof(orxU8)), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(pu8Buffer != orxNULL)
+    {
+      /* Frees previous buffers */
+      if(sstRender.apstCullingObject != orxNULL)
+      {
+        orxMemory_Free(sstRender.apstCullingObject);
+      }
+
+      /* Stores them */
+      sstRender.u32CullingSize      = u32Size;
+      sstRender.apstCullingObject   = (orxOBJECT **)pu8Buffer;
+      sstRender.avCullingPosition   = (orxVECTOR *)(sstRender.apstCullingObject + u32Size);
+      sstRender.afCullingDepthCoef  = (orxFLOAT *)(sstRender.avCullingPosition + u32Size);
+      sstRender.afCullingDistX      = sstRender.afCullingDepthCoef + u32Size;
+      sstRender.afCullingDistY      = sstRender.afCullingDistX + u32Size;
+      sstRender.afCullingRadius     = sstRender.afCullingDistY + u32Size;
+      sstRender.au8CullingResult    = (orxU8 *)(sstRender.afCullingRadius + u32Size);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Failed to allocate culling buffers for %ld objects.", _u32Number);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds a command to the list being extracted
+ * @param[in]   _pstCommand     Command to add (copied)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxRender_AddCommand(const orxRENDER_COMMAND *_pstCommand)
+{
+  orxRENDER_COMMAND_LIST *pstList;
+  orxSTATUS               eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstCommand != orxNULL);
+
+  /* Gets current list */
+  pstList = &(sstRender.astCommandList[sstRender.u32WriteIndex]);
+
+  /* Full? */
+  if(pstList->u32Counter == pstList->u32Size)
+  {
+    orxRENDER_COMMAND  *astCommandList;
+    orxU32              u32Size;
+
+    /* Gets new size */
+    u32Size = (pstList->u32Size != 0) ? pstList->u32Size << 1 : orxRENDER_KU32_COMMAND_LIST_SIZE;
+
+    /* Grows list */
+    astCommandList = (orxRENDER_COMMAND *)orxMemory_Reallocate(pstList->astCommandList, u32Size * sizeof(orxRENDER_COMMAND));
+
+    /* Success? */
+    if(astCommandList != orxNULL)
+    {
+      /* Stores it */
+      pstList->astCommandList = astCommandList;
+      pstList->u32Size        = u32Size;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Failed to allocate render command list for %ld commands.", u32Size);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Stores command */
+    orxMemory_Copy(&(pstList->astCommandList[pstList->u32Counter++]), _pstCommand, sizeof(orxRENDER_COMMAND));
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Executes all the commands of a list and empties it
+ * @param[in]   _pstList        Command list to execute
+ */
+static void orxFASTCALL orxRender_ExecuteCommandList(orxRENDER_COMMAND_LIST *_pstList)
+{
+  orxU32 i;
+
+  /* Checks */
+  orxASSERT(_pstList != orxNULL);
+
+  /* For all commands */
+  for(i = 0; i < _pstList->u32Counter; i++)
+  {
+    const orxRENDER_COMMAND  *pstCommand;
+    orxSTATUS                 eResult = orxSTATUS_SUCCESS;
+
+    /* Gets it */
+    pstCommand = &(_pstList->astCommandList[i]);
+
+    /* Depending on type */
+    switch(pstCommand->eType)
+    {
+      case orxRENDER_COMMAND_TYPE_CLIP:
+      {
+        /* Sets destination clipping */
+        orxDisplay_SetBitmapClipping(pstCommand->pstDst, pstCommand->u32ClipTLX, pstCommand->u32ClipTLY, pstCommand->u32ClipBRX, pstCommand->u32ClipBRY);
+
+        break;
+      }
+
+      case orxRENDER_COMMAND_TYPE_CLEAR:
+      {
+        /* Clears destination */
+        eResult = orxDisplay_ClearBitmap(pstCommand->pstDst, pstCommand->stColor);
+
+        break;
+      }
+
+      case orxRENDER_COMMAND_TYPE_BLIT:
+      case orxRENDER_COMMAND_TYPE_CAPTURE:
+      case orxRENDER_COMMAND_TYPE_TRANSFORM:
+      {
+        orxRGBA stBackupColor = 0;
+
+        /* Updates source clipping */
+        orxDisplay_SetBitmapClipping(pstCommand->pstSrc, pstCommand->u32ClipTLX, pstCommand->u32ClipTLY, pstCommand->u32ClipBRX, pstCommand->u32ClipBRY);
+
+        /* Has color? */
+        if(pstCommand->bColor != orxFALSE)
+        {
+          /* Backups previous color */
+          stBackupColor = orxDisplay_GetBitmapColor(pstCommand->pstSrc);
+
+          /* Updates display color */
+          orxDisplay_SetBitmapColor(pstCommand->pstSrc, pstCommand->stColor);
+        }
+
+        /* Blit? */
+        if(pstCommand->eType == orxRENDER_COMMAND_TYPE_BLIT)
+        {
+          /* Blits bitmap */
+          eResult = orxDisplay_BlitBitmap(pstCommand->pstDst, pstCommand->pstSrc, pstCommand->stTransform.fDstX, pstCommand->stTransform.fDstY, pstCommand->eBlendMode);
+        }
+        /* Capture? */
+        else if(pstCommand->eType == orxRENDER_COMMAND_TYPE_CAPTURE)
+        {
+          /* Blits bitmap */
+          eResult = orxDisplay_BlitBitmap(pstCommand->pstDst, pstCommand->pstSrc, pstCommand->stTransform.fDstX, pstCommand->stTransform.fDstY, pstCommand->eBlendMode);
+
+          /* Success and can be reported? */
+          if((eResult != orxSTATUS_FAILURE) && (_pstList->u32CaptureCounter < orxRENDER_KU32_CAPTURE_LIST_SIZE))
+          {
+            orxRENDER_CAPTURE *pstCapture;
+
+            /* Reports it, cache will be validated from main thread */
+            pstCapture                = &(_pstList->astCaptureList[_pstList->u32CaptureCounter++]);
+            pstCapture->pstViewport   = pstCommand->pstViewport;
+            pstCapture->pstCache      = pstCommand->pstDst;
+            pstCapture->u32Signature  = pstCommand->u32Signature;
+          }
+        }
+        else
+        {
+          /* Transforms bitmap */
+          eResult = orxDisplay_TransformBitmap(pstCommand->pstDst, pstCommand->pstSrc, &(pstCommand->stTransform), pstCommand->eSmoothing, pstCommand->eBlendMode);
+        }
+
+        /* Has color? */
+        if(pstCommand->bColor != orxFALSE)
+        {
+          /* Restores its original color */
+          orxDisplay_SetBitmapColor(pstCommand->pstSrc, stBackupColor);
+        }
+
+        break;
+      }
+
+      case orxRENDER_COMMAND_TYPE_TEXT:
+      {
+        /* Draws text */
+        eResult = orxDisplay_TransformText(pstCommand->pstDst, pstCommand->pstText, &(pstCommand->stTransform), pstCommand->stColor, pstCommand->eBlendMode);
+
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+
+    /* Failure? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "[orxBITMAP %p] Render command #%ld (type %ld) couldn't be executed.", pstCommand->pstDst, i, pstCommand->eType);
+    }
+  }
+
+  /* Empties list */
+  _pstList->u32Counter = 0;
+
+  return;
+}
+
+/** Validates the static caches that have been successfully captured by a command list, has to be called from main thread
+ * @param[in]   _pstList        Executed command list
+ */
+static void orxFASTCALL orxRender_ApplyCaptures(orxRENDER_COMMAND_LIST *_pstList)
+{
+  orxU32 i;
+
+  /* For all captures */
+  for(i = 0; i < _pstList->u32CaptureCounter; i++)
+  {
+    orxVIEWPORT *pstViewport;
+
+    /* Finds its viewport (it might have been deleted since) */
+    for(pstViewport = orxVIEWPORT(orxStructure_GetFirst(orxSTRUCTURE_ID_VIEWPORT));
+        (pstViewport != orxNULL) && (pstViewport != _pstList->astCaptureList[i].pstViewport);
+        pstViewport = orxVIEWPORT(orxStructure_GetNext(pstViewport)));
+
+    /* Found? */
+    if(pstViewport != orxNULL)
+    {
+      /* Validates its static cache */
+      orxViewport_ValidateStaticCache(pstViewport, _pstList->astCaptureList[i].pstCache, _pstList->astCaptureList[i].u32Signature);
+    }
+  }
+
+  /* Clears captures */
+  _pstList->u32CaptureCounter = 0;
+
+  return;
+}
+
+/** Executes a command list, prints its FPS text and presents the result
+ * @param[in]   _pstList        Command list to present
+ */
+static void orxFASTCALL orxRender_PresentCommandList(orxRENDER_COMMAND_LIST *_pstList)
+{
+  /* Executes all commands */
+  orxRender_ExecuteCommandList(_pstList);
+
+  /* Should display FPS? */
+  if(_pstList->bShowFPS != orxFALSE)
+  {
+    orxDISPLAY_TRANSFORM stTextTransform;
+
+    /* Clears text transform */
+    orxMemory_Zero(&stTextTransform, sizeof(orxDISPLAY_TRANSFORM));
+
+    /* Inits it */
+    stTextTransform.fScaleX = stTextTransform.fScaleY = orx2F(0.8f);
+    stTextTransform.fDstX = stTextTransform.fDstY = orx2F(10.0f);
+
+    /* Display FPS */
+    orxDisplay_PrintString(orxDisplay_GetScreenBitmap(), _pstList->acFPSText, &stTextTransform, orxRENDER_KST_DEFAULT_COLOR);
+
+    /* Clears status */
+    _pstList->bShowFPS = orxFALSE;
+  }
+
+  /* Swap buffers */
+  orxDisplay_Swap();
+
+  return;
+}
+
+/** Flushes pending commands when not threaded, so that render event handlers can draw in order
+ */
+static orxINLINE void orxRender_Flush()
+{
+  /* Not threaded? */
+  if(!(sstRender.u32Flags & orxRENDER_KU32_STATIC_FLAG_THREADED))
+  {
+    /* Executes pending commands */
+    orxRender_ExecuteCommandList(&(sstRender.astCommandList[sstRender.u32WriteIndex]));
+  }
+
+  return;
+}
+
+#ifdef __orxRENDER_THREAD__
+
+/** Locks hand-over states
+ */
+static orxINLINE void orxRender_Lock()
+{
+#ifdef __orxWINDOWS__
+  EnterCriticalSection(&(sstRender.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_mutex_lock(&(sstRender.stMutex));
+#endif /* __orxWINDOWS__ */
+}
+
+/** Unlocks hand-over states
+ */
+static orxINLINE void orxRender_Unlock()
+{
+#ifdef __orxWINDOWS__
+  LeaveCriticalSection(&(sstRender.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_mutex_unlock(&(sstRender.stMutex));
+#endif /* __orxWINDOWS__ */
+}
+
+/** Waits for a signal, states have to be locked and will be locked again upon return
+ * @param[in]   _pstSignal      Signal to wait for
+ */
+static orxINLINE void orxRender_Wait(orxRENDER_SIGNAL *_pstSignal)
+{
+#ifdef __orxWINDOWS__
+  /* Auto-reset events: as there's a single waiter per signal, a signal sent while unlocked won't be lost */
+  LeaveCriticalSection(&(sstRender.stMutex));
+  WaitForSingleObject(*_pstSignal, INFINITE);
+  EnterCriticalSection(&(sstRender.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_cond_wait(_pstSignal, &(sstRender.stMutex));
+#endif /* __orxWINDOWS__ */
+}
+
+/** Sends a signal
+ * @param[in]   _pstSignal      Signal to send
+ */
+static orxINLINE void orxRender_Signal(orxRENDER_SIGNAL *_pstSignal)
+{
+#ifdef __orxWINDOWS__
+  SetEvent(*_pstSignal);
+#else /* __orxWINDOWS__ */
+  pthread_cond_signal(_pstSignal);
+#endif /* __orxWINDOWS__ */
+}
+
+/** Waits till render thread is idle, states have to be locked
+ */
+static orxINLINE void orxRender_WaitIdle()
+{
+  /* While busy */
+  while(sstRender.bBusy != orxFALSE)
+  {
+    /* Waits for it */
+    orxRender_Wait(&(sstRender.stDoneSignal));
+  }
+}
+
+/** Render thread loop: presents handed over command lists till a stop is requested
+ */
+static void orxFASTCALL orxRender_Run()
+{
+  /* Locks states */
+  orxRender_Lock();
+
+  /* Acquires display context */
+  sstRender.eContextStatus = orxDisplay_EnableContext(orxTRUE);
+
+  /* Notifies main thread */
+  sstRender.bBusy = orxFALSE;
+  orxRender_Signal(&(sstRender.stDoneSignal));
+
+  /* Valid? */
+  if(sstRender.eContextStatus != orxSTATUS_FAILURE)
+  {
+    for(;;)
+    {
+      orxRENDER_COMMAND_LIST *pstList;
+
+      /* Waits for a frame */
+      while((sstRender.bBusy == orxFALSE) && (sstRender.bStopThread == orxFALSE))
+      {
+        orxRender_Wait(&(sstRender.stFrameSignal));
+      }
+
+      /* Nothing left to do? */
+      if(sstRender.bBusy == orxFALSE)
+      {
+        break;
+      }
+
+      /* Gets the list that isn't being extracted */
+      pstList = &(sstRender.astCommandList[sstRender.u32WriteIndex ^ 1]);
+
+      /* Presents it, unlocked */
+      orxRender_Unlock();
+      orxRender_PresentCommandList(pstList);
+      orxRender_Lock();
+
+      /* Updates status */
+      sstRender.bBusy = orxFALSE;
+
+      /* Notifies main thread */
+      orxRender_Signal(&(sstRender.stDoneSignal));
+    }
+
+    /* Releases display context */
+    orxDisplay_EnableContext(orxFALSE);
+  }
+
+  /* Unlocks states */
+  orxRender_Unlock();
+}
+
+#ifdef __orxWINDOWS__
+
+/** Render thread entry point
+ */
+static DWORD WINAPI orxRender_ThreadMain(LPVOID _pContext)
+{
+  /* Runs render loop */
+  orxRender_Run();
+
+  /* Done! */
+  return 0;
+}
+
+#else /* __orxWINDOWS__ */
+
+/** Render thread entry point
+ */
+static void *orxRender_ThreadMain(void *_pContext)
+{
+  /* Runs render loop */
+  orxRender_Run();
+
+  /* Done! */
+  return orxNULL;
+}
+
+#endif /* __orxWINDOWS__ */
+
+/** Stops render thread, after the handed over command list has been presented
+ */
+static void orxFASTCALL orxRender_StopThread()
+{
+  /* Requests stop */
+  orxRender_Lock();
+  sstRender.bStopThread = orxTRUE;
+  orxRender_Signal(&(sstRender.stFrameSignal));
+  orxRender_Unlock();
+
+#ifdef __orxWINDOWS__
+
+  /* Waits for thread */
+  WaitForSingleObject(sstRender.hThread, INFINITE);
+
+  /* Deletes thread & synchronization objects */
+  CloseHandle(sstRender.hThread);
+  CloseHandle(sstRender.stDoneSignal);
+  CloseHandle(sstRender.stFrameSignal);
+  DeleteCriticalSection(&(sstRender.stMutex));
+
+#else /* __orxWINDOWS__ */
+
+  /* Waits for thread */
+  pthread_join(sstRender.hThread, NULL);
+
+  /* Deletes synchronization objects */
+  pthread_cond_destroy(&(sstRender.stDoneSignal));
+  pthread_cond_destroy(&(sstRender.stFrameSignal));
+  pthread_mutex_destroy(&(sstRender.stMutex));
+
+#endif /* __orxWINDOWS__ */
+
+  /* Gets display context back */
+  orxDisplay_EnableContext(orxTRUE);
+
+  /* Applies captures of the last presented list */
+  orxRender_ApplyCaptures(&(sstRender.astCommandList[sstRender.u32WriteIndex ^ 1]));
+}
+
+/** Starts render thread, which takes over the display context
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxRender_StartThread()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Releases display context */
+  if(orxDisplay_EnableContext(orxFALSE) != orxSTATUS_FAILURE)
+  {
+    /* Clears states */
+    sstRender.bStopThread     = orxFALSE;
+    sstRender.bBusy           = orxTRUE;
+    sstRender.eContextStatus  = orxSTATUS_FAILURE;
+
+#ifdef __orxWINDOWS__
+
+    /* Creates synchronization objects */
+    InitializeCriticalSection(&(sstRender.stMutex));
+    sstRender.stFrameSignal = CreateEvent(NULL, FALSE, FALSE, NULL);
+    sstRender.stDoneSignal  = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+    /* Valid? */
+    if((sstRender.stFrameSignal != NULL) && (sstRender.stDoneSignal != NULL))
+    {
+      /* Creates thread */
+      sstRender.hThread = CreateThread(NULL, 0, orxRender_ThreadMain, orxNULL, 0, NULL);
+
+      /* Success? */
+      if(sstRender.hThread != NULL)
+      {
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+    }
+
+    /* Failure? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Deletes synchronization objects */
+      if(sstRender.stFrameSignal != NULL)
+      {
+        CloseHandle(sstRender.stFrameSignal);
+      }
+      if(sstRender.stDoneSignal != NULL)
+      {
+        CloseHandle(sstRender.stDoneSignal);
+      }
+      DeleteCriticalSection(&(sstRender.stMutex));
+    }
+
+#else /* __orxWINDOWS__ */
+
+    /* Creates synchronization objects */
+    pthread_mutex_init(&(sstRender.stMutex), NULL);
+    pthread_cond_init(&(sstRender.stFrameSignal), NULL);
+    pthread_cond_init(&(sstRender.stDoneSignal), NULL);
+
+    /* Creates thread */
+    if(pthread_create(&(sstRender.hThread), NULL, orxRender_ThreadMain, orxNULL) == 0)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Deletes synchronization objects */
+      pthread_cond_destroy(&(sstRender.stDoneSignal));
+      pthread_cond_destroy(&(sstRender.stFrameSignal));
+      pthread_mutex_destroy(&(sstRender.stMutex));
+    }
+
+#endif /* __orxWINDOWS__ */
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Waits for render thread to acquire display context */
+      orxRender_Lock();
+      orxRender_WaitIdle();
+      orxRender_Unlock();
+
+      /* Failure? */
+      if(sstRender.eContextStatus == orxSTATUS_FAILURE)
+      {
+        /* Stops thread (gets display context back) */
+        orxRender_StopThread();
+
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+    else
+    {
+      /* Gets display context back */
+      orxDisplay_EnableContext(orxTRUE);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Hands the extracted command list over to render thread and starts extracting in the other one
+ */
+static orxINLINE void orxRender_HandOver()
+{
+  /* Locks states */
+  orxRender_Lock();
+
+  /* Waits for previous frame to be presented */
+  orxRender_WaitIdle();
+
+  /* Applies its captures */
+  orxRender_ApplyCaptures(&(sstRender.astCommandList[sstRender.u32WriteIndex ^ 1]));
+
+  /* Swaps lists */
+  sstRender.u32WriteIndex ^= 1;
+
+  /* Notifies render thread */
+  sstRender.bBusy = orxTRUE;
+  orxRender_Signal(&(sstRender.stFrameSignal));
+
+  /* Unlocks states */
+  orxRender_Unlock();
+
+  return;
+}
+
+/** Event handler: waits for render thread before a bitmap or a text referenced by a command list gets modified,
+ * suspends it when display context is needed from main thread
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxRender_EventHandler(const orxEVENT *_pstEvent)
+{
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_DISPLAY);
+
+  /* Context requested? */
+  if(_pstEvent->eID == orxDISPLAY_EVENT_ACQUIRE_CONTEXT)
+  {
+    /* Threaded? */
+    if(sstRender.u32Flags & orxRENDER_KU32_STATIC_FLAG_THREADED)
+    {
+      /* Stops render thread (presents pending frame and gets display context back) */
+      orxRender_StopThread();
+
+      /* Updates flags */
+      sstRender.u32Flags &= ~orxRENDER_KU32_STATIC_FLAG_THREADED;
+
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Display context needed from main thread, suspending render thread.");
+    }
+
+    /* Updates flags */
+    sstRender.u32Flags |= orxRENDER_KU32_STATIC_FLAG_ACQUIRED;
+  }
+  /* Threaded? */
+  else if(sstRender.u32Flags & orxRENDER_KU32_STATIC_FLAG_THREADED)
+  {
+    /* Waits for render thread */
+    orxRender_Lock();
+    orxRender_WaitIdle();
+    orxRender_Unlock();
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+#endif /* __orxRENDER_THREAD__ */
+
+/** Event handler: forgets visibility lists computed during current frame when an object gets deleted
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxRender_ObjectEventHandler(const orxEVENT *_pstEvent)
+{
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_OBJECT);
+
+  /* Rendering and deleted? */
+  if((sstRender.u32Flags & orxRENDER_KU32_STATIC_FLAG_RENDERING)
+  && (_pstEvent->eID == orxOBJECT_EVENT_DELETE))
+  {
+    orxRENDER_VISIBILITY *pstVisibility;
+
+    /* For all visibility lists */
+    for(pstVisibility = (orxRENDER_VISIBILITY *)orxBank_GetNext(sstRender.pstVisibilityBank, orxNULL);
+        pstVisibility != orxNULL;
+        pstVisibility = (orxRENDER_VISIBILITY *)orxBank_GetNext(sstRender.pstVisibilityBank, pstVisibility))
+    {
+      /* Prevents its reuse, nodes will be freed at the end of the frame */
+      pstVisibility->pstCamera = orxNULL;
+    }
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Continues a signature with raw data (FNV-1a)
+ * @param[in]   _pData            Data to add
+ * @param[in]   _u32Size          Size of data, in bytes
+ * @param[in]   _u32Signature     Base signature
+ * @return      Resulting signature
+ */
+static orxINLINE orxU32 orxRender_ContinueSignature(const void *_pData, orxU32 _u32Size, orxU32 _u32Signature)
+{
+  const orxU8  *pu8Data;
+  orxU32        i, u32Result;
+
+  /* For all bytes */
+  for(i = 0, pu8Data = (const orxU8 *)_pData, u32Result = _u32Signature; i < _u32Size; i++)
+  {
+    /* Updates signature */
+    u32Result = (u32Result ^ (orxU32)pu8Data[i]) * orxRENDER_KU32_SIGNATURE_PRIME;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Continues a signature with the render state of a static object
+ * @param[in]   _pstRenderNode    Render node of the object
+ * @param[in]   _u32Signature     Base signature
+ * @return      Resulting signature
+ */
+static orxINLINE orxU32 orxRender_ContinueStaticSignature(const orxRENDER_NODE *_pstRenderNode, orxU32 _u32Signature)
+{
+  const orxOBJECT      *pstObject;
+  orxFRAME             *pstFrame;
+  orxANIMPOINTER       *pstAnimPointer;
+  const orxGRAPHIC     *pstGraphic;
+  orxCOLOR              stColor;
+  orxRGBA               stRGBA = 0;
+  orxVECTOR             vScale, vPivot, vOrigin, vSize;
+  orxFLOAT              fRotation, fRepeatX, fRepeatY, fGraphicRepeatX = orxFLOAT_1, fGraphicRepeatY = orxFLOAT_1;
+  orxBOOL               bFlipX, bFlipY, bGraphicFlipX = orxFALSE, bGraphicFlipY = orxFALSE;
+  orxDISPLAY_BLEND_MODE eBlendMode;
+  orxDISPLAY_SMOOTHING  eSmoothing;
+  orxU32                u32Result;
+
+  /* Gets object */
+  pstObject = _pstRenderNode->pstObject;
+
+  /* Gets its frame */
+  pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
+
+  /* Gets its graphic */
+  pstGraphic = orxOBJECT_GET_STRUCTURE(pstObject, GRAPHIC);
+
+  /* Gets its animation pointer */
+  pstAnimPointer = orxOBJECT_GET_STRUCTURE(pstObject, ANIMPOINTER);
+
+  /* Has animation? */
+  if(pstAnimPointer != orxNULL)
+  {
+    const orxGRAPHIC *pstAnimGraphic;
+
+    /* Gets current animation graphic */
+    pstAnimGraphic = orxGRAPHIC(orxAnimPointer_GetCurrentAnimData(pstAnimPointer));
+
+    /* Valid? */
+    if(pstAnimGraphic != orxNULL)
+    {
+      /* Uses it */
+      pstGraphic = pstAnimGraphic;
+    }
+  }
+
+  /* Gets object blend mode & smoothing */
+  eBlendMode = orxObject_GetBlendMode(pstObject);
+  eSmoothing = orxObject_GetSmoothing(pstObject);
+
+  /* Clears graphic geometry */
+  orxVector_Copy(&vPivot, &orxVECTOR_0);
+  orxVector_Copy(&vOrigin, &orxVECTOR_0);
+  orxVector_Copy(&vSize, &orxVECTOR_0);
+
+  /* Has graphic? */
+  if(pstGraphic != orxNULL)
+  {
+    /* Gets its pivot, sub-rectangle, flip & repeat */
+    orxGraphic_GetPivot(pstGraphic, &vPivot);
+    orxGraphic_GetOrigin(pstGraphic, &vOrigin);
+    orxGraphic_GetSize(pstGraphic, &vSize);
+    orxGraphic_GetFlip(pstGraphic, &bGraphicFlipX, &bGraphicFlipY);
+    orxGraphic_GetRepeat(pstGraphic, &fGraphicRepeatX, &fGraphicRepeatY);
+
+    /* Has graphic color? */
+    if(orxGraphic_HasColor(pstGraphic) != orxFALSE)
+    {
+      /* Gets it */
+      stRGBA = orxColor_ToRGBA(orxGraphic_GetColor(pstGraphic, &stColor));
+    }
+
+    /* Has graphic blend mode? (overrides object's one when rendering) */
+    if(orxGraphic_GetBlendMode(pstGraphic) != orxDISPLAY_BLEND_MODE_NONE)
+    {
+      /* Uses it */
+      eBlendMode = orxGraphic_GetBlendMode(pstGraphic);
+    }
+
+    /* Has graphic smoothing? (overrides object's one when rendering) */
+    if(orxGraphic_GetSmoothing(pstGraphic) != orxDISPLAY_SMOOTHING_DEFAULT)
+    {
+      /* Uses it */
+      eSmoothing = orxGraphic_GetSmoothing(pstGraphic);
+    }
+  }
+
+  /* Has color? */
+  if(orxObject_HasColor(pstObject) != orxFALSE)
+  {
+    /* Gets it */
+    stRGBA = orxColor_ToRGBA(orxObject_GetColor(pstObject, &stColor));
+  }
+
+  /* Gets global transformation */
+  fRotation = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
+  orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vScale);
+
+  /* Gets flip & repeat */
+  orxObject_GetFlip(pstObject, &bFlipX, &bFlipY);
+  orxObject_GetRepeat(pstObject, &fRepeatX, &fRepeatY);
+
+  /* Updates signature */
+  u32Result = orxRender_ContinueSignature(&pstObject, sizeof(const orxOBJECT *), _u32Signature);
+  u32Result = orxRender_ContinueSignature(&pstGraphic, sizeof(const orxGRAPHIC *), u32Result);
+  u32Result = orxRender_ContinueSignature(&vPivot, sizeof(orxVECTOR), u32Result);
+  u32Result = orxRender_ContinueSignature(&vOrigin, sizeof(orxVECTOR), u32Result);
+  u32Result = orxRender_ContinueSignature(&vSize, sizeof(orxVECTOR), u32Result);
+  u32Result = orxRender_ContinueSignature(&(_pstRenderNode->vPosition), sizeof(orxVECTOR), u32Result);
+  u32Result = orxRender_ContinueSignature(&(_pstRenderNode->fDepthCoef), sizeof(orxFLOAT), u32Result);
+  u32Result = orxRender_ContinueSignature(&fRotation, sizeof(orxFLOAT), u32Result);
+  u32Result = orxRender_ContinueSignature(&vScale, sizeof(orxVECTOR), u32Result);
+  u32Result = orxRender_ContinueSignature(&stRGBA, sizeof(orxRGBA), u32Result);
+  u32Result = orxRender_ContinueSignature(&bFlipX, sizeof(orxBOOL), u32Result);
+  u32Result = orxRender_ContinueSignature(&bFlipY, sizeof(orxBOOL), u32Result);
+  u32Result = orxRender_ContinueSignature(&fRepeatX, sizeof(orxFLOAT), u32Result);
+  u32Result = orxRender_ContinueSignature(&fRepeatY, sizeof(orxFLOAT), u32Result);
+  u32Result = orxRender_ContinueSignature(&bGraphicFlipX, sizeof(orxBOOL), u32Result);
+  u32Result = orxRender_ContinueSignature(&bGraphicFlipY, sizeof(orxBOOL), u32Result);
+  u32Result = orxRender_ContinueSignature(&fGraphicRepeatX, sizeof(orxFLOAT), u32Result);
+  u32Result = orxRender_ContinueSignature(&fGraphicRepeatY, sizeof(orxFLOAT), u32Result);
+  u32Result = orxRender_ContinueSignature(&eBlendMode, sizeof(orxDISPLAY_BLEND_MODE), u32Result);
+  u32Result = orxRender_ContinueSignature(&eSmoothing, sizeof(orxDISPLAY_SMOOTHING), u32Result);
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets the sorted list of objects visible by a camera, culling them only once per frame for all the viewports sharing this camera
+ * @param[in]   _pstCamera        Concerned camera
+ * @param[in]   _pstFrustum       Camera frustum
+ * @param[in]   _pvCameraPosition Camera global position
+ * @param[in]   _fZoom            Camera zoom
+ * @return      orxRENDER_VISIBILITY / orxNULL
+ */
+static orxRENDER_VISIBILITY *orxFASTCALL orxRender_GetVisibility(const orxCAMERA *_pstCamera, const orxAABOX *_pstFrustum, const orxVECTOR *_pvCameraPosition, orxFLOAT _fZoom)
+{
+  orxRENDER_VISIBILITY *pstResult;
+
+  /* Checks */
+  orxASSERT(sstRender.u32Flags & orxRENDER_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstCamera);
+  orxASSERT(_pstFrustum != orxNULL);
+  orxASSERT(_pvCameraPosition != orxNULL);
+
+  /* For all visibility lists computed during this frame */
+  for(pstResult = (orxRENDER_VISIBILITY *)orxBank_GetNext(sstRender.pstVisibilityBank, orxNULL);
+      pstResult != orxNULL;
+      pstResult = (orxRENDER_VISIBILITY *)orxBank_GetNext(sstRender.pstVisibilityBank, pstResult))
+  {
+    /* Same camera and unchanged? */
+    if((pstResult->pstCamera == _pstCamera)
+    && (pstResult->fZoom == _fZoom)
+    && (orxVector_AreEqual(&(pstResult->stFrustum.vTL), &(_pstFrustum->vTL)) != orxFALSE)
+    && (orxVector_AreEqual(&(pstResult->stFrustum.vBR), &(_pstFrustum->vBR)) != orxFALSE)
+    && (orxVector_AreEqual(&(pstResult->vCameraPosition), _pvCameraPosition) != orxFALSE))
+    {
+      break;
+    }
+  }
+
+  /* Not found? */
+  if(pstResult == orxNULL)
+  {
+    orxBOOL bFirstCulling;
+
+    /* Is first culling of this frame? */
+    bFirstCulling = (orxBank_GetCounter(sstRender.pstVisibilityBank) == 0) ? orxTRUE : orxFALSE;
+
+    /* Allocates visibility list */
+    pstResult = (orxRENDER_VISIBILITY *)orxBank_Allocate(sstRender.pstVisibilityBank);
+
+    /* Valid? */
+    if(pstResult != orxNULL)
+    {
+      orxSTRUCTURE *const  *apstObjectList;
+      orxOBJECT      *pstObject;
+      orxRENDER_NODE *pstRenderNode;
+      orxU32          u32CullingCounter = 0, u32ObjectNumber, i;
+      orxVECTOR       vCameraCenter;
+      orxFLOAT        fCameraWidth, fCameraHeight, fCameraDepth, fCameraBoundingRadius;
+
+      /* Inits it */
+      orxMemory_Zero(pstResult, sizeof(orxRENDER_VISIBILITY));
+      pstResult->pstCamera  = _pstCamera;
+      pstResult->fZoom      = _fZoom;
+      orxVector_Copy(&(pstResult->stFrustum.vTL), &(_pstFrustum->vTL));
+      orxVector_Copy(&(pstResult->stFrustum.vBR), &(_pstFrustum->vBR));
+      orxVector_Copy(&(pstResult->vCameraPosition), _pvCameraPosition);
+
+      /* Gets camera size */
+      fCameraWidth  = _pstFrustum->vBR.fX - _pstFrustum->vTL.fX;
+      fCameraHeight = _pstFrustum->vBR.fY - _pstFrustum->vTL.fY;
+
+      /* Gets camera center */
+      orxVector_Add(&vCameraCenter, &(_pstFrustum->vTL), &(_pstFrustum->vBR));
+      orxVector_Mulf(&vCameraCenter, &vCameraCenter, orx2F(0.5f));
+
+      /* Gets camera depth */
+      fCameraDepth = _pstFrustum->vBR.fZ - _pvCameraPosition->fZ;
+
+      /* Gets camera square bounding radius */
+      fCameraBoundingRadius = orx2F(0.5f) * orxMath_Sqrt((fCameraWidth * fCameraWidth) + (fCameraHeight * fCameraHeight)) / _fZoom;
+
+      /* Gets all objects */
+      apstObjectList = orxStructure_GetArray(orxSTRUCTURE_ID_OBJECT, &u32ObjectNumber);
+
+      /* Reserves culling buffers */
+      orxRender_ReserveCulling(u32ObjectNumber);
+
+      /* For all objects */
+      for(i = 0; (i < u32ObjectNumber) && (u32CullingCounter < sstRender.u32CullingSize); i++)
+      {
+        /* Gets object */
+        pstObject = (orxOBJECT *)apstObjectList[i];
+
+        /* First culling of this frame? */
+        if(bFirstCulling != orxFALSE)
+        {
+          /* Updates its render status */
+          orxObject_SetRendered(pstObject, orxFALSE);
+        }
+
+        /* Is object enabled? */
+        if(orxObject_IsEnabled(pstObject) != orxFALSE)
+        {
+          orxGRAPHIC *pstGraphic;
+
+          /* Gets object's graphic */
+          pstGraphic = orxOBJECT_GET_STRUCTURE(pstObject, GRAPHIC);
+
+          /* Valid 2D graphic? */
+          if((pstGraphic != orxNULL)
+          && (orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_2D | orxGRAPHIC_KU32_FLAG_TEXT) != orxFALSE))
+          {
+            orxFRAME     *pstFrame;
+            orxSTRUCTURE *pstData;
+
+            /* Gets object's frame */
+            pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
+
+            /* Gets graphic data */
+            pstData = orxGraphic_GetData(pstGraphic);
+
+            /* Valid and has text/texture data? */
+            if((pstFrame != orxNULL)
+            && ((orxTEXTURE(pstData) != orxNULL)
+             || (orxTEXT(pstData) != orxNULL)))
+            {
+              orxVECTOR vObjectPos;
+
+              /* Gets its position */
+              orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectPos);
+
+              /* Is object in Z frustum? */
+              if((vObjectPos.fZ > _pvCameraPosition->fZ) && (vObjectPos.fZ >= _pstFrustum->vTL.fZ) && (vObjectPos.fZ <= _pstFrustum->vBR.fZ))
+              {
+                orxFLOAT  fDepthCoef;
+                orxVECTOR vSize, vObjectScale, vDist;
+
+                /* Gets its size */
+                orxGraphic_GetSize(pstGraphic, &vSize);
+
+                /* Gets object's scales */
+                orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectScale);
+
+                /* Updates it with object scale */
+                vSize.fX *= vObjectScale.fX;
+                vSize.fY *= vObjectScale.fY;
+
+                /* Gets real 2D distance vector */
+                orxVector_Sub(&vDist, &vObjectPos, &vCameraCenter);
+                vDist.fZ = orxFLOAT_0;
+
+                /* Uses differential scrolling or depth scaling? */
+                if((orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH) != orxFALSE)
+                || (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE))
+                {
+                  orxFLOAT fObjectRelativeDepth;
+
+                  /* Gets objects relative depth */
+                  fObjectRelativeDepth = vObjectPos.fZ - _pvCameraPosition->fZ;
+
+                  /* Near space? */
+                  if(fObjectRelativeDepth < (orx2F(0.5f) * fCameraDepth))
+                  {
+                    /* Gets depth scale coef */
+                    fDepthCoef = (orx2F(0.5f) * fCameraDepth) / fObjectRelativeDepth;
+                  }
+                  /* Far space */
+                  else
+                  {
+                    /* Gets depth scale coef */
+                    fDepthCoef = (fCameraDepth - fObjectRelativeDepth) / (orx2F(0.5f) * fCameraDepth);
+                  }
+
+                  /* X-axis scroll? */
+                  if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_X) != orxFALSE)
+                  {
+                    /* Updates base distance vector */
+                    vDist.fX *= fDepthCoef;
+                  }
+
+                  /* Y-axis scroll? */
+                  if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_Y) != orxFALSE)
+                  {
+                    /* Updates base distance vector */
+                    vDist.fY *= fDepthCoef;
+                  }
+
+                  /* Depth scale? */
+                  if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE)
+                  {
+                    /* Updates size */
+                    vSize.fX *= fDepthCoef;
+                    vSize.fY *= fDepthCoef;
+                  }
+                }
+                else
+                {
+                  /* Clears depth coef */
+                  fDepthCoef = orxFLOAT_1;
+                }
+
+                /* Stores object for culling */
+                sstRender.apstCullingObject[u32CullingCounter]  = pstObject;
+                orxVector_Copy(&(sstRender.avCullingPosition[u32CullingCounter]), &vObjectPos);
+                sstRender.afCullingDepthCoef[u32CullingCounter] = fDepthCoef;
+                sstRender.afCullingDistX[u32CullingCounter]     = vDist.fX;
+                sstRender.afCullingDistY[u32CullingCounter]     = vDist.fY;
+
+                /* Stores its bounding radius */
+                sstRender.afCullingRadius[u32CullingCounter]    = orxMath_Sqrt((vSize.fX * vSize.fX) + (vSize.fY * vSize.fY));
+
+                /* Updates counter */
+                u32CullingCounter++;
+              }
+            }
+          }
+        }
+      }
+
+      /* Circle tests between objects & camera */
+      orxBatch_2DTestCircleIntersection(sstRender.afCullingDistX, sstRender.afCullingDistY, sstRender.afCullingRadius, u32CullingCounter, &orxVECTOR_0, fCameraBoundingRadius, sstRender.au8CullingResult);
+
+      /* For all culled objects */
+      for(i = 0; i < u32CullingCounter; i++)
+      {
+        /* Is visible? */
+        if(sstRender.au8CullingResult[i] != 0)
+        {
+          orxLINKLIST_NODE *pstNode;
+          orxVECTOR        *pvObjectPos;
+
+          /* Gets its position */
+          pvObjectPos = &(sstRender.avCullingPosition[i]);
 
-} orxRENDER_NODE;
+          /* Creates a render node (frame memory) */
+          pstRenderNode = (orxRENDER_NODE *)orxMemory_AllocateFrame(sizeof(orxRENDER_NODE));
 
-/** Static structure
- */
-typedef struct __orxRENDER_STATIC_t
-{
-  orxU32        u32Flags;                         /**< Control flags : 4 */
-  orxCLOCK     *pstClock;                         /**< Rendering clock pointer : 8 */
-  orxBANK      *pstRenderBank;                    /**< Rendering bank : 12 */
-  orxLINKLIST   stRenderList;                     /**< Rendering list : 16 */
+          /* Valid? */
+          if(pstRenderNode != orxNULL)
+          {
+            /* Cleans its internal node */
+            orxMemory_Zero(pstRenderNode, sizeof(orxLINKLIST_NODE));
 
-} orxRENDER_STATIC;
+            /* Stores object */
+            pstRenderNode->pstObject = sstRender.apstCullingObject[i];
 
+            /* Stores its position */
+            orxVector_Copy(&(pstRenderNode->vPosition), pvObjectPos);
 
-/***************************************************************************
- * Static variables                                                        *
- ***************************************************************************/
+            /* Stores its depth coef */
+            pstRenderNode->fDepthCoef = sstRender.afCullingDepthCoef[i];
 
-/** Static data
- */
-static orxRENDER_STATIC sstRender;
+            /* Empty list? */
+            if(orxLinkList_GetCounter(&(pstResult->stRenderList)) == 0)
+            {
+              /* Adds node at beginning */
+              orxLinkList_AddStart(&(pstResult->stRenderList), (orxLINKLIST_NODE *)pstRenderNode);
+            }
+            else
+            {
+              /* Finds correct node */
+              for(pstNode = orxLinkList_GetFirst(&(pstResult->stRenderList));
+                  (pstNode != orxNULL);
+                  pstNode = orxLinkList_GetNext(pstNode))
+              {
+                /* Is current object further? */
+                if(pvObjectPos->fZ > ((orxRENDER_NODE *)pstNode)->vPosition.fZ)
+                {
+                  break;
+                }
+              }
 
+              /* End of list reached? */
+              if(pstNode == orxNULL)
+              {
+                /* Adds it at end */
+                orxLinkList_AddEnd(&(pstResult->stRenderList), (orxLINKLIST_NODE *)pstRenderNode);
+              }
+              else
+              {
+                /* Adds it before found node */
+                orxLinkList_AddBefore(pstNode, (orxLINKLIST_NODE *)pstRenderNode);
+              }
+            }
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Failed to allocate render node, skipping remaining objects.");
+            break;
+          }
+        }
+      }
+    }
+  }
 
-/***************************************************************************
- * Private functions                                                       *
- ***************************************************************************/
+  /* Done! */
+  return pstResult;
+}
 
 /** Renders a viewport
  * @param[in]   _pstObject        Object to render
@@ -116,9 +1404,14 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
     orxFLOAT                        fRotation;
     orxEVENT                        stEvent;
     orxRENDER_EVENT_OBJECT_PAYLOAD  stPayload;
+    orxRENDER_COMMAND               stCommand;
 
-    /* Cleans event payload */
+    /* Cleans event payload & command */
     orxMemory_Zero(&stPayload, sizeof(orxRENDER_EVENT_OBJECT_PAYLOAD));
+    orxMemory_Zero(&stCommand, sizeof(orxRENDER_COMMAND));
+
+    /* Inits command */
+    stCommand.pstDst = _pstRenderBitmap;
 
     /* Inits it */
     stPayload.pstRenderBitmap = _pstRenderBitmap;
@@ -127,6 +1420,9 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
     /* Inits event */
     orxEVENT_INIT(stEvent, orxEVENT_TYPE_RENDER, orxRENDER_EVENT_OBJECT_START, (orxHANDLE)_pstObject, (orxHANDLE)_pstObject, &stPayload);
 
+    /* Flushes pending commands */
+    orxRender_Flush();
+
     /* Sends start event */
     if(orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
     {
@@ -136,7 +1432,6 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
         orxBITMAP      *pstBitmap;
         orxTEXTURE     *pstTexture;
         orxANIMPOINTER *pstAnimPointer;
-        orxRGBA         stBackupColor = 0;
         orxBOOL         bGraphicFlipX, bGraphicFlipY, bObjectFlipX, bObjectFlipY, bFlipX, bFlipY;
         orxVECTOR       vClipTL, vClipBR;
         orxFLOAT        fRepeatX, fRepeatY;
@@ -179,8 +1474,12 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
         orxGraphic_GetSize(pstGraphic, &vSize);
         orxVector_Add(&vClipBR, &vClipTL, &vSize);
 
-        /* Updates its clipping */
-        orxDisplay_SetBitmapClipping(pstBitmap, orxF2U(vClipTL.fX), orxF2U(vClipTL.fY), orxF2U(vClipBR.fX), orxF2U(vClipBR.fY));
+        /* Stores it with source bitmap */
+        stCommand.pstSrc      = pstBitmap;
+        stCommand.u32ClipTLX  = orxF2U(vClipTL.fX);
+        stCommand.u32ClipTLY  = orxF2U(vClipTL.fY);
+        stCommand.u32ClipBRX  = orxF2U(vClipBR.fX);
+        stCommand.u32ClipBRY  = orxF2U(vClipBR.fY);
 
         /* Gets object & graphic flipping */
         orxObject_GetFlip(_pstObject, &bObjectFlipX, &bObjectFlipY);
@@ -211,22 +1510,18 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
         {
           orxCOLOR stColor;
 
-          /* Backups previous color */
-          stBackupColor = orxDisplay_GetBitmapColor(pstBitmap);
-
-          /* Updates display color */
-          orxDisplay_SetBitmapColor(pstBitmap, orxColor_ToRGBA(orxObject_GetColor(_pstObject, &stColor)));
+          /* Stores it */
+          stCommand.stColor = orxColor_ToRGBA(orxObject_GetColor(_pstObject, &stColor));
+          stCommand.bColor  = orxTRUE;
         }
         /* Has graphic color? */
         else if(orxGraphic_HasColor(pstGraphic) != orxFALSE)
         {
           orxCOLOR stColor;
 
-          /* Backups previous color */
-          stBackupColor = orxDisplay_GetBitmapColor(pstBitmap);
-
-          /* Updates display color */
-          orxDisplay_SetBitmapColor(pstBitmap, orxColor_ToRGBA(orxGraphic_GetColor(pstGraphic, &stColor)));
+          /* Stores it */
+          stCommand.stColor = orxColor_ToRGBA(orxGraphic_GetColor(pstGraphic, &stColor));
+          stCommand.bColor  = orxTRUE;
         }
 
         /* Gets object repeat values */
@@ -258,14 +1553,21 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
           /* Gets object blend mode */
           eBlendMode = orxObject_GetBlendMode(_pstObject);
         }
+
+        /* Stores it */
+        stCommand.eBlendMode = eBlendMode;
+
         /* No scale nor rotation nor repeat? */
         if((bFlipX == orxFALSE) && (bFlipY == orxFALSE) && (fRotation == orxFLOAT_0) && (vScale.fX == orxFLOAT_1) && (vScale.fY == orxFLOAT_1) && (fRepeatX == orxFLOAT_1) && (fRepeatY == orxFLOAT_1))
         {
           /* Updates position with pivot */
           orxVector_Sub(&vPosition, &vPosition, &vPivot);
 
-          /* Blits bitmap */
-          eResult = orxDisplay_BlitBitmap(_pstRenderBitmap, pstBitmap, vPosition.fX, vPosition.fY, eBlendMode);
+          /* Adds blit command */
+          stCommand.eType             = orxRENDER_COMMAND_TYPE_BLIT;
+          stCommand.stTransform.fDstX = vPosition.fX;
+          stCommand.stTransform.fDstY = vPosition.fY;
+          eResult                     = orxRender_AddCommand(&stCommand);
         }
         else
         {
@@ -285,6 +1587,10 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
               eSmoothing = orxObject_GetSmoothing(_pstObject);
             }
 
+            /* Stores it */
+            stCommand.eType       = orxRENDER_COMMAND_TYPE_TRANSFORM;
+            stCommand.eSmoothing  = eSmoothing;
+
             /* No repeat? */
             if((fRepeatX == orxFLOAT_1)  && (fRepeatY == orxFLOAT_1))
             {
@@ -297,8 +1603,9 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
               stTransform.fScaleY   = vScale.fY;
               stTransform.fRotation = fRotation;
 
-              /* Blits bitmap */
-              eResult = orxDisplay_TransformBitmap(_pstRenderBitmap, pstBitmap, &stTransform, eSmoothing, eBlendMode);
+              /* Adds transform command */
+              orxMemory_Copy(&(stCommand.stTransform), &stTransform, sizeof(orxDISPLAY_TRANSFORM));
+              eResult = orxRender_AddCommand(&stCommand);
             }
             else
             {
@@ -438,7 +1745,8 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
                   orxFLOAT fOffsetX, fOffsetY, fPosX = fX;
 
                   /* Updates clipping */
-                  orxDisplay_SetBitmapClipping(pstBitmap, orxF2U(vClipTL.fX), orxF2U(vClipTL.fY), orxF2U(vClipTL.fX + orxMIN(vSize.fX, fRemainderX)), orxF2U(vClipTL.fY + orxMIN(vSize.fY, fRemainderY)));
+                  stCommand.u32ClipBRX = orxF2U(vClipTL.fX + orxMIN(vSize.fX, fRemainderX));
+                  stCommand.u32ClipBRY = orxF2U(vClipTL.fY + orxMIN(vSize.fY, fRemainderY));
 
                   /* Positive scale on X? */
                   if(vScale.fX > orxFLOAT_0)
@@ -495,8 +1803,9 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
                   stTransform.fScaleY   = vScale.fY;
                   stTransform.fRotation = fRotation;
 
-                  /* Blits bitmap */
-                  eResult = orxDisplay_TransformBitmap(_pstRenderBitmap, pstBitmap, &stTransform, eSmoothing, eBlendMode);
+                  /* Adds transform command */
+                  orxMemory_Copy(&(stCommand.stTransform), &stTransform, sizeof(orxDISPLAY_TRANSFORM));
+                  eResult = orxRender_AddCommand(&stCommand);
                 }
               }
             }
@@ -510,14 +1819,6 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
             eResult = orxSTATUS_SUCCESS;
           }
         }
-
-        /* Has object or graphic color? */
-        if((orxObject_HasColor(_pstObject) != orxFALSE)
-        || (orxGraphic_HasColor(pstGraphic) != orxFALSE))
-        {
-          /* Restores its original color */
-          orxDisplay_SetBitmapColor(pstBitmap, stBackupColor);
-        }
       }
       else
       {
@@ -593,22 +1894,105 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
           eBlendMode = orxObject_GetBlendMode(_pstObject);
         }
 
+        /* Stores blend mode & color */
+        stCommand.eBlendMode  = eBlendMode;
+        stCommand.stColor     = stRGBA;
+
         /* Valid scale? */
         if((vScale.fX != orxFLOAT_0) && (vScale.fY != orxFLOAT_0))
         {
-          orxDISPLAY_TRANSFORM stTransform;
-
-          /* Sets transformation values */
-          stTransform.fSrcX     = ((vScale.fX < orxFLOAT_0) ^ (bFlipX != orxFALSE)) ? vSize.fX - vPivot.fX : vPivot.fX;
-          stTransform.fSrcY     = ((vScale.fY < orxFLOAT_0) ^ (bFlipY != orxFALSE)) ? vSize.fY - vPivot.fY : vPivot.fY;
-          stTransform.fDstX     = vPosition.fX;
-          stTransform.fDstY     = vPosition.fY;
-          stTransform.fScaleX   = vScale.fX;
-          stTransform.fScaleY   = vScale.fY;
-          stTransform.fRotation = fRotation;
-
-          /* Draws text */
-          eResult = orxDisplay_TransformText(_pstRenderBitmap, orxText_GetData(pstText), &stTransform, stRGBA, eBlendMode);
+          orxDISPLAY_TRANSFORM  stTransform;
+          const orxTEXT_GLYPH  *astGlyphList;
+          orxVECTOR             vCharacterSize;
+          orxU32                u32GlyphNumber;
+
+          /* Uses a bitmap font? */
+          if(orxText_GetGlyphList(pstText, &astGlyphList, &u32GlyphNumber, &vCharacterSize) != orxSTATUS_FAILURE)
+          {
+            orxDISPLAY_SMOOTHING  eSmoothing;
+            orxBOOL               bTransform, bMirrorX, bMirrorY;
+            orxU32                i;
+
+            /* Gets graphic smoothing */
+            eSmoothing = orxGraphic_GetSmoothing(pstGraphic);
+
+            /* Default? */
+            if(eSmoothing == orxDISPLAY_SMOOTHING_DEFAULT)
+            {
+              /* Gets object smoothing */
+              eSmoothing = orxObject_GetSmoothing(_pstObject);
+            }
+
+            /* Needs transformation? */
+            bTransform  = ((bFlipX != orxFALSE) || (bFlipY != orxFALSE) || (fRotation != orxFLOAT_0) || (vScale.fX != orxFLOAT_1) || (vScale.fY != orxFLOAT_1)) ? orxTRUE : orxFALSE;
+            bMirrorX    = (vScale.fX < orxFLOAT_0) ^ (bFlipX != orxFALSE);
+            bMirrorY    = (vScale.fY < orxFLOAT_0) ^ (bFlipY != orxFALSE);
+
+            /* Inits glyph commands */
+            stCommand.eType       = (bTransform != orxFALSE) ? orxRENDER_COMMAND_TYPE_TRANSFORM : orxRENDER_COMMAND_TYPE_BLIT;
+            stCommand.eSmoothing  = eSmoothing;
+            stCommand.bColor      = orxTRUE;
+
+            /* Sets common transformation values */
+            stTransform.fDstX     = vPosition.fX;
+            stTransform.fDstY     = vPosition.fY;
+            stTransform.fScaleX   = vScale.fX;
+            stTransform.fScaleY   = vScale.fY;
+            stTransform.fRotation = fRotation;
+
+            /* For all glyphs */
+            for(i = 0, eResult = orxSTATUS_SUCCESS; (i < u32GlyphNumber) && (eResult != orxSTATUS_FAILURE); i++)
+            {
+              const orxTEXT_GLYPH *pstGlyph;
+
+              /* Gets it */
+              pstGlyph = &astGlyphList[i];
+
+              /* Updates glyph page & clipping */
+              stCommand.pstSrc      = pstGlyph->pstBitmap;
+              stCommand.u32ClipTLX  = orxF2U(pstGlyph->fU);
+              stCommand.u32ClipTLY  = orxF2U(pstGlyph->fV);
+              stCommand.u32ClipBRX  = orxF2U(pstGlyph->fU + vCharacterSize.fX);
+              stCommand.u32ClipBRY  = orxF2U(pstGlyph->fV + vCharacterSize.fY);
+
+              /* Needs transformation? */
+              if(bTransform != orxFALSE)
+              {
+                /* Uses text pivot relatively to glyph */
+                stTransform.fSrcX = (bMirrorX != orxFALSE) ? vCharacterSize.fX - (vPivot.fX - pstGlyph->fX) : vPivot.fX - pstGlyph->fX;
+                stTransform.fSrcY = (bMirrorY != orxFALSE) ? vCharacterSize.fY - (vPivot.fY - pstGlyph->fY) : vPivot.fY - pstGlyph->fY;
+
+                /* Stores transform */
+                orxMemory_Copy(&(stCommand.stTransform), &stTransform, sizeof(orxDISPLAY_TRANSFORM));
+              }
+              else
+              {
+                /* Stores glyph position */
+                stCommand.stTransform.fDstX = vPosition.fX - vPivot.fX + pstGlyph->fX;
+                stCommand.stTransform.fDstY = vPosition.fY - vPivot.fY + pstGlyph->fY;
+              }
+
+              /* Adds glyph command */
+              eResult = orxRender_AddCommand(&stCommand);
+            }
+          }
+          else
+          {
+            /* Sets transformation values */
+            stTransform.fSrcX     = ((vScale.fX < orxFLOAT_0) ^ (bFlipX != orxFALSE)) ? vSize.fX - vPivot.fX : vPivot.fX;
+            stTransform.fSrcY     = ((vScale.fY < orxFLOAT_0) ^ (bFlipY != orxFALSE)) ? vSize.fY - vPivot.fY : vPivot.fY;
+            stTransform.fDstX     = vPosition.fX;
+            stTransform.fDstY     = vPosition.fY;
+            stTransform.fScaleX   = vScale.fX;
+            stTransform.fScaleY   = vScale.fY;
+            stTransform.fRotation = fRotation;
+
+            /* Adds text command */
+            stCommand.eType   = orxRENDER_COMMAND_TYPE_TEXT;
+            stCommand.pstText = orxText_GetData(pstText);
+            orxMemory_Copy(&(stCommand.stTransform), &stTransform, sizeof(orxDISPLAY_TRANSFORM));
+            eResult           = orxRender_AddCommand(&stCommand);
+          }
         }
         else
         {
@@ -621,6 +2005,9 @@ static orxSTATUS orxFASTCALL orxRender_RenderObject(const orxOBJECT *_pstObject,
       }
     }
 
+    /* Flushes pending commands */
+    orxRender_Flush();
+
     /* Sends stop event */
     orxEVENT_SEND(orxEVENT_TYPE_RENDER, orxRENDER_EVENT_OBJECT_STOP, (orxHANDLE)_pstObject, (orxHANDLE)_pstObject, &stPayload);
   }
@@ -687,8 +2074,8 @@ static orxINLINE void orxRender_RenderViewport(const orxVIEWPORT *_pstViewport)
         {
           orxFRAME *pstRenderFrame;
 
-          /* Creates rendering frame */
-          pstRenderFrame = orxFrame_Create(orxFRAME_KU32_FLAG_NONE);
+          /* Gets rendering frame */
+          pstRenderFrame = sstRender.pstFrame;
 
           /* Valid? */
           if(pstRenderFrame != orxNULL)
@@ -720,7 +2107,8 @@ static orxINLINE void orxRender_RenderViewport(const orxVIEWPORT *_pstViewport)
             /* Does it intersect with texture */
             if(orxAABox_Test2DIntersection(&stTextureBox, &stViewportBox) != orxFALSE)
             {
-              orxFLOAT fCorrectionRatio;
+              orxRENDER_COMMAND stCommand;
+              orxFLOAT          fCorrectionRatio;
 
               /* Gets current correction ratio */
               fCorrectionRatio = orxViewport_GetCorrectionRatio(_pstViewport);
@@ -754,9 +2142,18 @@ static orxINLINE void orxRender_RenderViewport(const orxVIEWPORT *_pstViewport)
                 }
               }
 
-              /* Sets bitmap clipping */
-              orxDisplay_SetBitmapClipping(pstBitmap, orxF2U(stViewportBox.vTL.fX), orxF2U(stViewportBox.vTL.fY), orxF2U(stViewportBox.vBR.fX), orxF2U(stViewportBox.vBR.fY));
-              
+              /* Inits command */
+              orxMemory_Zero(&stCommand, sizeof(orxRENDER_COMMAND));
+              stCommand.pstDst = pstBitmap;
+
+              /* Adds bitmap clipping command */
+              stCommand.eType       = orxRENDER_COMMAND_TYPE_CLIP;
+              stCommand.u32ClipTLX  = orxF2U(stViewportBox.vTL.fX);
+              stCommand.u32ClipTLY  = orxF2U(stViewportBox.vTL.fY);
+              stCommand.u32ClipBRX  = orxF2U(stViewportBox.vBR.fX);
+              stCommand.u32ClipBRY  = orxF2U(stViewportBox.vBR.fY);
+              orxRender_AddCommand(&stCommand);
+
               /* Should clear bitmap? */
               if(orxViewport_IsBackgroundClearingEnabled(_pstViewport) != orxFALSE)
               {
@@ -765,19 +2162,25 @@ static orxINLINE void orxRender_RenderViewport(const orxVIEWPORT *_pstViewport)
                 /* Gets viewport color */
                 orxViewport_GetBackgroundColor(_pstViewport, &stColor);
 
-                /* Clears it */
-                orxDisplay_ClearBitmap(pstBitmap, orxColor_ToRGBA(&stColor));
+                /* Adds clear command */
+                stCommand.eType   = orxRENDER_COMMAND_TYPE_CLEAR;
+                stCommand.stColor = orxColor_ToRGBA(&stColor);
+                orxRender_AddCommand(&stCommand);
               }
 
               /* Valid? */
               if((fCameraWidth > orxFLOAT_0)
               && (fCameraHeight > orxFLOAT_0))
               {
-                orxOBJECT      *pstObject;
-                orxFRAME       *pstCameraFrame;
-                orxRENDER_NODE *pstRenderNode;
-                orxVECTOR       vCameraCenter, vCameraPosition;
-                orxFLOAT        fCameraDepth, fRenderScaleX, fRenderScaleY, fZoom, fRenderRotation, fCameraBoundingRadius;
+                orxOBJECT            *pstObject;
+                orxFRAME             *pstCameraFrame;
+                orxRENDER_NODE       *pstRenderNode;
+                orxRENDER_VISIBILITY *pstVisibility;
+                orxBITMAP            *pstStaticCache = orxNULL;
+                orxBOOL               bStaticCacheValid = orxFALSE;
+                orxU32                u32Pass, u32Signature = 0;
+                orxVECTOR             vCameraCenter, vCameraPosition;
+                orxFLOAT              fRenderScaleX, fRenderScaleY, fZoom, fRenderRotation;
 
                 /* Gets camera zoom */
                 fZoom = orxCamera_GetZoom(pstCamera);
@@ -792,12 +2195,6 @@ static orxINLINE void orxRender_RenderViewport(const orxVIEWPORT *_pstViewport)
                 /* Gets camera position */
                 orxFrame_GetPosition(pstCameraFrame, orxFRAME_SPACE_GLOBAL, &vCameraPosition);
 
-                /* Gets camera depth */
-                fCameraDepth = stFrustum.vBR.fZ - vCameraPosition.fZ;
-
-                /* Gets camera square bounding radius */
-                fCameraBoundingRadius = orx2F(0.5f) * orxMath_Sqrt((fCameraWidth * fCameraWidth) + (fCameraHeight * fCameraHeight)) / fZoom;
-
                 /* Gets rendering scales */
                 fRenderScaleX = fZoom * (stViewportBox.vBR.fX - stViewportBox.vTL.fX) / fCameraWidth;
                 fRenderScaleY = fZoom * (stViewportBox.vBR.fY - stViewportBox.vTL.fY) / fCameraHeight;
@@ -805,279 +2202,195 @@ static orxINLINE void orxRender_RenderViewport(const orxVIEWPORT *_pstViewport)
                 /* Gets camera rotation */
                 fRenderRotation = orxFrame_GetRotation(pstCameraFrame, orxFRAME_SPACE_GLOBAL);
 
-                /* For all objects */
-                for(pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
-                    pstObject != orxNULL;
-                    pstObject = orxOBJECT(orxStructure_GetNext(pstObject)))
-                {
-                  /* Updates its render status */
-                  orxObject_SetRendered(pstObject, orxFALSE);
+                /* Gets visible objects */
+                pstVisibility = orxRender_GetVisibility(pstCamera, &stFrustum, &vCameraPosition, fZoom);
 
-                  /* Is object enabled? */
-                  if(orxObject_IsEnabled(pstObject) != orxFALSE)
+                /* Valid? */
+                if(pstVisibility != orxNULL)
+                {
+                  /* Uses static cache on screen? */
+                  if((orxViewport_IsStaticCacheEnabled(_pstViewport) != orxFALSE)
+                  && (pstBitmap == orxDisplay_GetScreenBitmap()))
                   {
-                    orxGRAPHIC *pstGraphic;
+                    /* Gets it */
+                    pstStaticCache = orxViewport_GetStaticCache((orxVIEWPORT *)_pstViewport, stCommand.u32ClipBRX - stCommand.u32ClipTLX, stCommand.u32ClipBRY - stCommand.u32ClipTLY);
 
-                    /* Gets object's graphic */
-                    pstGraphic = orxOBJECT_GET_STRUCTURE(pstObject, GRAPHIC);
-
-                    /* Valid 2D graphic? */
-                    if((pstGraphic != orxNULL)
-                    && (orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_2D | orxGRAPHIC_KU32_FLAG_TEXT) != orxFALSE))
+                    /* Valid? */
+                    if(pstStaticCache != orxNULL)
                     {
-                      orxFRAME     *pstFrame;
-                      orxSTRUCTURE *pstData;
-
-                      /* Gets object's frame */
-                      pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
+                      /* Inits signature with viewport & camera states */
+                      u32Signature = orxRender_ContinueSignature(&stViewportBox, sizeof(orxAABOX), orxRENDER_KU32_SIGNATURE_SEED);
+                      u32Signature = orxRender_ContinueSignature(&vCameraCenter, sizeof(orxVECTOR), u32Signature);
+                      u32Signature = orxRender_ContinueSignature(&fRenderScaleX, sizeof(orxFLOAT), u32Signature);
+                      u32Signature = orxRender_ContinueSignature(&fRenderScaleY, sizeof(orxFLOAT), u32Signature);
+                      u32Signature = orxRender_ContinueSignature(&fRenderRotation, sizeof(orxFLOAT), u32Signature);
+                      u32Signature = orxRender_ContinueSignature(&(stCommand.stColor), sizeof(orxRGBA), u32Signature);
+
+                      /* For all render nodes */
+                      for(pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(pstVisibility->stRenderList));
+                          pstRenderNode != orxNULL;
+                          pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetNext((orxLINKLIST_NODE *)pstRenderNode))
+                      {
+                        /* Is static? */
+                        if(orxObject_IsStatic(pstRenderNode->pstObject) != orxFALSE)
+                        {
+                          /* Updates signature */
+                          u32Signature = orxRender_ContinueStaticSignature(pstRenderNode, u32Signature);
+                        }
+                      }
 
-                      /* Gets graphic data */
-                      pstData = orxGraphic_GetData(pstGraphic);
+                      /* Is cache still valid? */
+                      if(orxViewport_IsStaticCacheValid(_pstViewport, u32Signature) != orxFALSE)
+                      {
+                        /* Adds static layer blit command */
+                        stCommand.eType                 = orxRENDER_COMMAND_TYPE_BLIT;
+                        stCommand.pstSrc                = pstStaticCache;
+                        stCommand.stTransform.fDstX     = orxU2F(stCommand.u32ClipTLX);
+                        stCommand.stTransform.fDstY     = orxU2F(stCommand.u32ClipTLY);
+                        stCommand.eBlendMode            = orxDISPLAY_BLEND_MODE_NONE;
+                        stCommand.u32ClipBRX           -= stCommand.u32ClipTLX;
+                        stCommand.u32ClipBRY           -= stCommand.u32ClipTLY;
+                        stCommand.u32ClipTLX            = 0;
+                        stCommand.u32ClipTLY            = 0;
+                        orxRender_AddCommand(&stCommand);
+
+                        /* Updates status */
+                        bStaticCacheValid = orxTRUE;
+                      }
+                    }
+                  }
 
-                      /* Valid and has text/texture data? */
-                      if((pstFrame != orxNULL)
-                      && ((orxTEXTURE(pstData) != orxNULL)
-                       || (orxTEXT(pstData) != orxNULL)))
+                  /* For all passes: static objects first, when their cache needs to be refreshed, then all the other ones */
+                  for(u32Pass = ((pstStaticCache != orxNULL) && (bStaticCacheValid == orxFALSE)) ? 0 : 1; u32Pass < 2; u32Pass++)
+                  {
+                    /* Static pass over? */
+                    if(u32Pass == 1)
+                    {
+                      /* Should refresh static cache? */
+                      if((pstStaticCache != orxNULL) && (bStaticCacheValid == orxFALSE))
                       {
-                        orxVECTOR vObjectPos;
+                        /* Adds static layer capture command, cache will be validated once it has been executed */
+                        stCommand.eType                 = orxRENDER_COMMAND_TYPE_CAPTURE;
+                        stCommand.pstViewport           = (orxVIEWPORT *)_pstViewport;
+                        stCommand.u32Signature          = u32Signature;
+                        stCommand.pstDst                = pstStaticCache;
+                        stCommand.pstSrc                = pstBitmap;
+                        stCommand.stTransform.fDstX     = orxFLOAT_0;
+                        stCommand.stTransform.fDstY     = orxFLOAT_0;
+                        stCommand.eBlendMode            = orxDISPLAY_BLEND_MODE_NONE;
+                        orxRender_AddCommand(&stCommand);
+                      }
+                    }
 
-                        /* Gets its position */
-                        orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectPos);
+                    /* For all render nodes */
+                    for(pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(pstVisibility->stRenderList));
+                        pstRenderNode != orxNULL;
+                        pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetNext((orxLINKLIST_NODE *)pstRenderNode))
+                    {
+                      orxFRAME *pstFrame;
+                      orxVECTOR vObjectPos, vRenderPos, vObjectScale;
+                      orxFLOAT  fObjectRotation, fObjectScaleX, fObjectScaleY;
+                      orxBOOL   bStatic;
+
+                      /* Gets object */
+                      pstObject = pstRenderNode->pstObject;
 
-                        /* Is object in Z frustum? */
-                        if((vObjectPos.fZ > vCameraPosition.fZ) && (vObjectPos.fZ >= stFrustum.vTL.fZ) && (vObjectPos.fZ <= stFrustum.vBR.fZ))
+                      /* Gets its layer */
+                      bStatic = ((pstStaticCache != orxNULL) && (orxObject_IsStatic(pstObject) != orxFALSE)) ? orxTRUE : orxFALSE;
+
+                      /* Not part of current pass? */
+                      if(bStatic != ((u32Pass == 0) ? orxTRUE : orxFALSE))
+                      {
+                        /* Drawn from valid static cache? */
+                        if((bStatic != orxFALSE) && (bStaticCacheValid != orxFALSE))
                         {
-                          orxFLOAT  fObjectBoundingRadius, fSqrDist, fDepthCoef;
-                          orxVECTOR vSize, vObjectScale, vDist;
+                          /* Updates its render status */
+                          orxObject_SetRendered(pstObject, orxTRUE);
+                        }
+                      }
+                      else
+                      {
+                        /* Gets object's position */
+                        orxVector_Copy(&vObjectPos, &(pstRenderNode->vPosition));
 
-                          /* Gets its size */
-                          orxGraphic_GetSize(pstGraphic, &vSize);
+                        /* Gets object's frame */
+                        pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
 
-                          /* Gets object's scales */
-                          orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectScale);
+                        /* Gets object's scales */
+                        orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectScale);
 
-                          /* Updates it with object scale */
-                          vSize.fX *= vObjectScale.fX;
-                          vSize.fY *= vObjectScale.fY;
+                        /* Gets object's rotation */
+                        fObjectRotation = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
 
-                          /* Gets real 2D distance vector */
-                          orxVector_Sub(&vDist, &vObjectPos, &vCameraCenter);
-                          vDist.fZ = orxFLOAT_0;
+                        /* Gets object scale */
+                        fObjectScaleX = fRenderScaleX;
+                        fObjectScaleY = fRenderScaleY;
 
-                          /* Uses differential scrolling or depth scaling? */
-                          if((orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH) != orxFALSE)
-                          || (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE))
+                        /* Gets position in camera space */
+                        orxVector_Sub(&vRenderPos, &vObjectPos, &vCameraCenter);
+                        vRenderPos.fX  *= fObjectScaleX;
+                        vRenderPos.fY  *= fObjectScaleY;
+
+                        /* Uses differential scrolling or depth scaling? */
+                        if((orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH) != orxFALSE)
+                        || (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE))
+                        {
+                          /* X-axis scroll? */
+                          if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_X) != orxFALSE)
                           {
-                            orxFLOAT fObjectRelativeDepth;
-
-                            /* Gets objects relative depth */
-                            fObjectRelativeDepth = vObjectPos.fZ - vCameraPosition.fZ;
-
-                            /* Near space? */
-                            if(fObjectRelativeDepth < (orx2F(0.5f) * fCameraDepth))
-                            {
-                              /* Gets depth scale coef */
-                              fDepthCoef = (orx2F(0.5f) * fCameraDepth) / fObjectRelativeDepth;
-                            }
-                            /* Far space */
-                            else
-                            {
-                              /* Gets depth scale coef */
-                              fDepthCoef = (fCameraDepth - fObjectRelativeDepth) / (orx2F(0.5f) * fCameraDepth);
-                            }
-
-                            /* X-axis scroll? */
-                            if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_X) != orxFALSE)
-                            {
-                              /* Updates base distance vector */
-                              vDist.fX *= fDepthCoef;
-                            }
-
-                            /* Y-axis scroll? */
-                            if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_Y) != orxFALSE)
-                            {
-                              /* Updates base distance vector */
-                              vDist.fY *= fDepthCoef;
-                            }
-
-                            /* Depth scale? */
-                            if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE)
-                            {
-                              /* Updates size */
-                              vSize.fX *= fDepthCoef;
-                              vSize.fY *= fDepthCoef;
-                            }
+                            /* Updates render position */
+                            vRenderPos.fX *= pstRenderNode->fDepthCoef;
                           }
-                          else
+
+                          /* Y-axis scroll? */
+                          if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_Y) != orxFALSE)
                           {
-                            /* Clears depth coef */
-                            fDepthCoef = orxFLOAT_1;
+                            /* Updates render position */
+                            vRenderPos.fY *= pstRenderNode->fDepthCoef;
                           }
 
-                          /* Gets object square bounding radius */
-                          fObjectBoundingRadius = orxMath_Sqrt((vSize.fX * vSize.fX) + (vSize.fY * vSize.fY));
-
-                          /* Gets 2D square distance to camera */
-                          fSqrDist = orxVector_GetSquareSize(&vDist);
-
-                          /* Circle test between object & camera */
-                          if(fSqrDist <= (fCameraBoundingRadius + fObjectBoundingRadius) * (fCameraBoundingRadius + fObjectBoundingRadius))
+                          /* Depth scale? */
+                          if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE)
                           {
-                            orxLINKLIST_NODE *pstNode;
-
-                            /* Creates a render node */
-                            pstRenderNode = (orxRENDER_NODE *)orxBank_Allocate(sstRender.pstRenderBank);
-
-                            /* Cleans its internal node */
-                            orxMemory_Zero(pstRenderNode, sizeof(orxLINKLIST_NODE));
-
-                            /* Stores object */
-                            pstRenderNode->pstObject = pstObject;
-
-                            /* Stores its position */
-                            orxVector_Copy(&(pstRenderNode->vPosition), &vObjectPos);
-
-                            /* Stores its depth coef */
-                            pstRenderNode->fDepthCoef = fDepthCoef;
-
-                            /* Empty list? */
-                            if(orxLinkList_GetCounter(&(sstRender.stRenderList)) == 0)
-                            {
-                              /* Adds node at beginning */
-                              orxLinkList_AddStart(&(sstRender.stRenderList), (orxLINKLIST_NODE *)pstRenderNode);
-                            }
-                            else
-                            {
-                              /* Finds correct node */
-                              for(pstNode = orxLinkList_GetFirst(&(sstRender.stRenderList));
-                                  (pstNode != orxNULL);
-                                  pstNode = orxLinkList_GetNext(pstNode))
-                              {
-                                /* Is current object further? */
-                                if(vObjectPos.fZ > ((orxRENDER_NODE *)pstNode)->vPosition.fZ)
-                                {
-                                  break;
-                                }
-                              }
-
-                              /* End of list reached? */
-                              if(pstNode == orxNULL)
-                              {
-                                /* Adds it at end */
-                                orxLinkList_AddEnd(&(sstRender.stRenderList), (orxLINKLIST_NODE *)pstRenderNode);
-                              }
-                              else
-                              {
-                                /* Adds it before found node */
-                                orxLinkList_AddBefore(pstNode, (orxLINKLIST_NODE *)pstRenderNode);
-                              }
-                            }
+                            /* Updates object scales */
+                            vObjectScale.fX *= pstRenderNode->fDepthCoef;
+                            vObjectScale.fY *= pstRenderNode->fDepthCoef;
                           }
                         }
-                      }
-                    }
-                  }
-                }
-
-                /* For all render nodes */
-                for(pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                    pstRenderNode != orxNULL;
-                    pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetNext((orxLINKLIST_NODE *)pstRenderNode))
-                {
-                  orxFRAME *pstFrame;
-                  orxVECTOR vObjectPos, vRenderPos, vObjectScale;
-                  orxFLOAT  fObjectRotation, fObjectScaleX, fObjectScaleY;
-
-                  /* Gets object */
-                  pstObject = pstRenderNode->pstObject;
-
-                  /* Gets object's position */
-                  orxVector_Copy(&vObjectPos, &(pstRenderNode->vPosition));
-
-                  /* Gets object's frame */
-                  pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
-
-                  /* Gets object's scales */
-                  orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectScale);
-
-                  /* Gets object's rotation */
-                  fObjectRotation = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
 
-                  /* Gets object scale */
-                  fObjectScaleX = fRenderScaleX;
-                  fObjectScaleY = fRenderScaleY;
-
-                  /* Gets position in camera space */
-                  orxVector_Sub(&vRenderPos, &vObjectPos, &vCameraCenter);
-                  vRenderPos.fX  *= fObjectScaleX;
-                  vRenderPos.fY  *= fObjectScaleY;
+                        /* Has camera rotation? */
+                        if(fRenderRotation != orxFLOAT_0)
+                        {
+                          /* Rotates it */
+                          orxVector_2DRotate(&vRenderPos, &vRenderPos, -fRenderRotation);
+                        }
 
-                  /* Uses differential scrolling or depth scaling? */
-                  if((orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH) != orxFALSE)
-                  || (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE))
-                  {
-                    /* X-axis scroll? */
-                    if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_X) != orxFALSE)
-                    {
-                      /* Updates render position */
-                      vRenderPos.fX *= pstRenderNode->fDepthCoef;
-                    }
+                        /* Gets position in screen space */
+                        orxVector_Add(&vRenderPos, &vRenderPos, &vViewportCenter);
+                        orxVector_Add(&vRenderPos, &vRenderPos, &(stTextureBox.vTL));
 
-                    /* Y-axis scroll? */
-                    if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_Y) != orxFALSE)
-                    {
-                      /* Updates render position */
-                      vRenderPos.fY *= pstRenderNode->fDepthCoef;
-                    }
+                        /* Updates render frame */
+                        orxFrame_SetPosition(pstRenderFrame, orxFRAME_SPACE_LOCAL, &vRenderPos);
+                        orxFrame_SetRotation(pstRenderFrame, orxFRAME_SPACE_LOCAL, fObjectRotation - fRenderRotation);
+                        vObjectScale.fX *= fObjectScaleX;
+                        vObjectScale.fY *= fObjectScaleY;
+                        orxFrame_SetScale(pstRenderFrame, orxFRAME_SPACE_LOCAL, &vObjectScale);
 
-                    /* Depth scale? */
-                    if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE)
-                    {
-                      /* Updates object scales */
-                      vObjectScale.fX *= pstRenderNode->fDepthCoef;
-                      vObjectScale.fY *= pstRenderNode->fDepthCoef;
+                        /* Renders it */
+                        if(orxRender_RenderObject(pstObject, pstBitmap, pstRenderFrame) != orxSTATUS_FAILURE)
+                        {
+                          /* Updates its render status */
+                          orxObject_SetRendered(pstObject, orxTRUE);
+                        }
+                        else
+                        {
+                          /* Prints error message */
+                          orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "[orxOBJECT %p/%s -> orxBITMAP %p] couldn't be rendered.", pstObject, orxObject_GetName(pstObject), pstBitmap);
+                        }
+                      }
                     }
                   }
-
-                  /* Has camera rotation? */
-                  if(fRenderRotation != orxFLOAT_0)
-                  {
-                    /* Rotates it */
-                    orxVector_2DRotate(&vRenderPos, &vRenderPos, -fRenderRotation);
-                  }
-
-                  /* Gets position in screen space */
-                  orxVector_Add(&vRenderPos, &vRenderPos, &vViewportCenter);
-                  orxVector_Add(&vRenderPos, &vRenderPos, &(stTextureBox.vTL));
-
-                  /* Updates render frame */
-                  orxFrame_SetPosition(pstRenderFrame, orxFRAME_SPACE_LOCAL, &vRenderPos);
-                  orxFrame_SetRotation(pstRenderFrame, orxFRAME_SPACE_LOCAL, fObjectRotation - fRenderRotation);
-                  vObjectScale.fX *= fObjectScaleX;
-                  vObjectScale.fY *= fObjectScaleY;
-                  orxFrame_SetScale(pstRenderFrame, orxFRAME_SPACE_LOCAL, &vObjectScale);
-
-                  /* Renders it */
-                  if(orxRender_RenderObject(pstObject, pstBitmap, pstRenderFrame) != orxSTATUS_FAILURE)
-                  {
-                    /* Updates its render status */
-                    orxObject_SetRendered(pstObject, orxTRUE);
-                  }
-                  else
-                  {
-                    /* Prints error message */
-                    orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "[orxOBJECT %p/%s -> orxBITMAP %p] couldn't be rendered.", pstObject, orxObject_GetName(pstObject), pstBitmap);
-                  }
                 }
-
-                /* Cleans rendering bank */
-                orxBank_Clear(sstRender.pstRenderBank);
-
-                /* Cleans rendering list */
-                orxMemory_Zero(&(sstRender.stRenderList), sizeof(orxLINKLIST));
-
-                /* Deletes rendering frame */
-                orxFrame_Delete(pstRenderFrame);
               }
               else
               {
@@ -1094,10 +2407,13 @@ static orxINLINE void orxRender_RenderViewport(const orxVIEWPORT *_pstViewport)
           else
           {
             /* Logs message */
-            orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Could not create rendering frame.");
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "No rendering frame available.");
           }
         }
 
+        /* Flushes pending commands */
+        orxRender_Flush();
+
         /* Sends stop event */
         orxEVENT_SEND(orxEVENT_TYPE_RENDER, orxRENDER_EVENT_VIEWPORT_STOP, (orxHANDLE)_pstViewport, (orxHANDLE)_pstViewport, orxNULL);
       }
@@ -1135,12 +2451,44 @@ static void orxFASTCALL orxRender_RenderAll(const orxCLOCK_INFO *_pstClockInfo,
   orxASSERT(sstRender.u32Flags & orxRENDER_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstClockInfo != orxNULL);
 
+#ifdef __orxRENDER_THREAD__
+
+  /* Render thread suspended and display context not needed from main thread anymore? */
+  if((sstRender.u32Flags & (orxRENDER_KU32_STATIC_FLAG_REQUESTED | orxRENDER_KU32_STATIC_FLAG_THREADED | orxRENDER_KU32_STATIC_FLAG_ACQUIRED)) == orxRENDER_KU32_STATIC_FLAG_REQUESTED)
+  {
+    /* Resumes render thread */
+    if(orxRender_StartThread() != orxSTATUS_FAILURE)
+    {
+      /* Updates flags */
+      sstRender.u32Flags |= orxRENDER_KU32_STATIC_FLAG_THREADED;
+    }
+    else
+    {
+      /* Updates flags */
+      sstRender.u32Flags &= ~orxRENDER_KU32_STATIC_FLAG_REQUESTED;
+
+      /* Unregisters display event handler */
+      orxEvent_RemoveHandler(orxEVENT_TYPE_DISPLAY, orxRender_EventHandler);
+
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Couldn't resume render thread, rendering from main thread.");
+    }
+  }
+
+  /* Clears context status, render event handlers will acquire it again if needed */
+  sstRender.u32Flags &= ~orxRENDER_KU32_STATIC_FLAG_ACQUIRED;
+
+#endif /* __orxRENDER_THREAD__ */
+
   /* Sends render start event */
   bRender = (orxEvent_SendShort(orxEVENT_TYPE_RENDER, orxRENDER_EVENT_START) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
 
   /* Should render? */
   if(bRender != orxFALSE)
   {
+    /* Updates flags */
+    sstRender.u32Flags |= orxRENDER_KU32_STATIC_FLAG_RENDERING;
+
     /* For all viewports */
     for(pstViewport = orxVIEWPORT(orxStructure_GetLast(orxSTRUCTURE_ID_VIEWPORT));
         pstViewport != orxNULL;
@@ -1149,8 +2497,17 @@ static void orxFASTCALL orxRender_RenderAll(const orxCLOCK_INFO *_pstClockInfo,
       /* Renders it */
       orxRender_RenderViewport(pstViewport);
     }
+
+    /* Cleans visibility lists (their render nodes are released with the frame memory) */
+    orxBank_Clear(sstRender.pstVisibilityBank);
+
+    /* Updates flags */
+    sstRender.u32Flags &= ~orxRENDER_KU32_STATIC_FLAG_RENDERING;
   }
 
+  /* Flushes pending commands */
+  orxRender_Flush();
+
   /* Sends render stop event */
   orxEvent_SendShort(orxEVENT_TYPE_RENDER, orxRENDER_EVENT_STOP);
 
@@ -1166,29 +2523,41 @@ static void orxFASTCALL orxRender_RenderAll(const orxCLOCK_INFO *_pstClockInfo,
     /* Should display FPS? */
     if(orxConfig_GetBool(orxRENDER_KZ_CONFIG_SHOW_FPS) != orxFALSE)
     {
-      orxDISPLAY_TRANSFORM stTextTransform;
-      orxCHAR             acText[16];
-
-      /* Clears text transform */
-      orxMemory_Zero(&stTextTransform, sizeof(orxDISPLAY_TRANSFORM));
+      orxRENDER_COMMAND_LIST *pstList;
 
-      /* Inits it */
-      stTextTransform.fScaleX = stTextTransform.fScaleY = orx2F(0.8f);
-      stTextTransform.fDstX = stTextTransform.fDstY = orx2F(10.0f);
+      /* Gets current list */
+      pstList = &(sstRender.astCommandList[sstRender.u32WriteIndex]);
 
       /* Writes text */
-      orxString_NPrint(acText, 16, orxRENDER_KZ_FPS_FORMAT, orxFPS_GetFPS());
+      orxString_NPrint(pstList->acFPSText, orxRENDER_KU32_FPS_TEXT_SIZE, orxRENDER_KZ_FPS_FORMAT, orxFPS_GetFPS());
 
-      /* Display FPS */
-      orxDisplay_PrintString(orxDisplay_GetScreenBitmap(), acText, &stTextTransform, orxRENDER_KST_DEFAULT_COLOR);
+      /* Updates status */
+      pstList->bShowFPS = orxTRUE;
     }
 
     /* Pops previous section */
     orxConfig_PopSection();
   }
 
-  /* Swap buffers */
-  orxDisplay_Swap();
+#ifdef __orxRENDER_THREAD__
+
+  /* Threaded? */
+  if(sstRender.u32Flags & orxRENDER_KU32_STATIC_FLAG_THREADED)
+  {
+    /* Hands extracted list over to render thread */
+    orxRender_HandOver();
+  }
+  else
+
+#endif /* __orxRENDER_THREAD__ */
+
+  {
+    /* Presents extracted list */
+    orxRender_PresentCommandList(&(sstRender.astCommandList[sstRender.u32WriteIndex]));
+
+    /* Applies its captures */
+    orxRender_ApplyCaptures(&(sstRender.astCommandList[sstRender.u32WriteIndex]));
+  }
 
   return;
 }
@@ -1331,11 +2700,14 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
     /* Cleans static controller */
     orxMemory_Zero(&sstRender, sizeof(orxRENDER_STATIC));
 
-    /* Creates rendering bank */
-    sstRender.pstRenderBank = orxBank_Create(orxRENDER_KU32_ORDER_BANK_SIZE, sizeof(orxRENDER_NODE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    /* Creates visibility bank */
+    sstRender.pstVisibilityBank = orxBank_Create(orxRENDER_KU32_VISIBILITY_BANK_SIZE, sizeof(orxRENDER_VISIBILITY), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Creates rendering frame, reused for all viewports */
+    sstRender.pstFrame = orxFrame_Create(orxFRAME_KU32_FLAG_NONE);
 
     /* Valid? */
-    if(sstRender.pstRenderBank != orxNULL)
+    if((sstRender.pstVisibilityBank != orxNULL) && (sstRender.pstFrame != orxNULL))
     {
       /* Creates rendering clock */
       orxConfig_PushSection(orxRENDER_KZ_CONFIG_SECTION);
@@ -1348,11 +2720,19 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
       {
         /* Registers rendering function */
         eResult = orxClock_Register(sstRender.pstClock, orxRender_RenderAll, orxNULL, orxMODULE_ID_RENDER, orxCLOCK_PRIORITY_LOWEST);
+
+        /* Success? */
+        if(eResult != orxSTATUS_FAILURE)
+        {
+          /* Registers object event handler */
+          eResult = orxEvent_AddHandler(orxEVENT_TYPE_OBJECT, orxRender_ObjectEventHandler);
+        }
       }
       else
       {
-        /* Deletes bank */
-        orxBank_Delete(sstRender.pstRenderBank);
+        /* Deletes bank & frame */
+        orxBank_Delete(sstRender.pstVisibilityBank);
+        orxFrame_Delete(sstRender.pstFrame);
 
         /* Updates result */
         eResult = orxSTATUS_FAILURE;
@@ -1360,6 +2740,18 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
     }
     else
     {
+      /* Deletes bank */
+      if(sstRender.pstVisibilityBank != orxNULL)
+      {
+        orxBank_Delete(sstRender.pstVisibilityBank);
+      }
+
+      /* Deletes frame */
+      if(sstRender.pstFrame != orxNULL)
+      {
+        orxFrame_Delete(sstRender.pstFrame);
+      }
+
       /* Updates result */
       eResult = orxSTATUS_FAILURE;
     }
@@ -1378,6 +2770,39 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
   {
     /* Inits Flags */
     sstRender.u32Flags = orxRENDER_KU32_STATIC_FLAG_READY;
+
+#ifdef __orxRENDER_THREAD__
+
+    /* Pushes render config section */
+    orxConfig_PushSection(orxRENDER_KZ_CONFIG_SECTION);
+
+    /* Threaded? */
+    if(orxConfig_GetBool(orxRENDER_KZ_CONFIG_THREADED) != orxFALSE)
+    {
+      /* Registers display event handler */
+      if(orxEvent_AddHandler(orxEVENT_TYPE_DISPLAY, orxRender_EventHandler) != orxSTATUS_FAILURE)
+      {
+        /* Starts render thread */
+        if(orxRender_StartThread() != orxSTATUS_FAILURE)
+        {
+          /* Updates flags */
+          sstRender.u32Flags |= orxRENDER_KU32_STATIC_FLAG_REQUESTED | orxRENDER_KU32_STATIC_FLAG_THREADED;
+        }
+        else
+        {
+          /* Unregisters display event handler */
+          orxEvent_RemoveHandler(orxEVENT_TYPE_DISPLAY, orxRender_EventHandler);
+
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Display can't be used from a render thread, rendering from main thread.");
+        }
+      }
+    }
+
+    /* Pops previous section */
+    orxConfig_PopSection();
+
+#endif /* __orxRENDER_THREAD__ */
   }
   else
   {
@@ -1396,14 +2821,63 @@ void orxFASTCALL orxRender_Home_Exit()
   /* Initialized? */
   if(sstRender.u32Flags & orxRENDER_KU32_STATIC_FLAG_READY)
   {
+    orxU32 i;
+
     /* Unregisters rendering function */
     orxClock_Unregister(sstRender.pstClock, orxRender_RenderAll);
 
-    /* Deletes rendering bank */
-    orxBank_Delete(sstRender.pstRenderBank);
+#ifdef __orxRENDER_THREAD__
+
+    /* Threaded? */
+    if(sstRender.u32Flags & orxRENDER_KU32_STATIC_FLAG_THREADED)
+    {
+      /* Stops render thread */
+      orxRender_StopThread();
+    }
+
+    /* Was thread requested? */
+    if(sstRender.u32Flags & orxRENDER_KU32_STATIC_FLAG_REQUESTED)
+    {
+      /* Unregisters display event handler */
+      orxEvent_RemoveHandler(orxEVENT_TYPE_DISPLAY, orxRender_EventHandler);
+    }
+
+#endif /* __orxRENDER_THREAD__ */
+
+    /* For all command lists */
+    for(i = 0; i < 2; i++)
+    {
+      /* Has commands? */
+      if(sstRender.astCommandList[i].astCommandList != orxNULL)
+      {
+        /* Frees them */
+        orxMemory_Free(sstRender.astCommandList[i].astCommandList);
+      }
+    }
+
+    /* Cleans command lists */
+    orxMemory_Zero(sstRender.astCommandList, 2 * sizeof(orxRENDER_COMMAND_LIST));
+
+    /* Unregisters object event handler */
+    orxEvent_RemoveHandler(orxEVENT_TYPE_OBJECT, orxRender_ObjectEventHandler);
+
+    /* Deletes visibility bank */
+    orxBank_Delete(sstRender.pstVisibilityBank);
+
+    /* Deletes rendering frame */
+    orxFrame_Delete(sstRender.pstFrame);
+
+    /* Has culling buffers? */
+    if(sstRender.apstCullingObject != orxNULL)
+    {
+      /* Frees them */
+      orxMemory_Free(sstRender.apstCullingObject);
+      sstRender.apstCullingObject = orxNULL;
+      sstRender.u32CullingSize    = 0;
+    }
 
     /* Updates flags */
-    sstRender.u32Flags &= ~orxRENDER_KU32_STATIC_FLAG_READY;
+    sstRender.u32Flags = orxRENDER_KU32_STATIC_FLAG_NONE;
   }
   else
   {
@@ -219,6 +219,7 @@ void orxFASTCALL orxSoundSystem_SDL_Exit()
 
 orxSOUNDSYSTEM_SAMPLE *orxFASTCALL orxSoundSystem_SDL_LoadSample(const orxSTRING _zFilename)
 {
+  orxFILE_VIEW           stView;
   orxSOUNDSYSTEM_SAMPLE *pstResult;
   Mix_Chunk             *pstSample;
 
@@ -226,8 +227,9 @@ orxSOUNDSYSTEM_SAMPLE *orxFASTCALL orxSoundSystem_SDL_LoadSample(const orxSTRING
   orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_zFilename != orxNULL);
 
-  /* Loads it from file */
-  if((pstSample = Mix_LoadWAV(_zFilename)) != orxNULL)
+  /* Loads it from memory (samples are decoded when loading) */
+  if((orxFile_Map(_zFilename, orxFILE_KU32_FLAG_MAP_SEQUENTIAL, &stView) != orxSTATUS_FAILURE)
+  && ((pstSample = Mix_LoadWAV_RW(SDL_RWFromConstMem(stView.pcData, (int)stView.u32Size), 1)) != orxNULL))
   {
     /* Updates result */
     pstResult = (orxSOUNDSYSTEM_SAMPLE *)pstSample;
@@ -238,6 +240,9 @@ orxSOUNDSYSTEM_SAMPLE *orxFASTCALL orxSoundSystem_SDL_LoadSample(const orxSTRING
     pstResult = (orxSOUNDSYSTEM_SAMPLE *)orxNULL;
   }
 
+  /* Unmaps file */
+  orxFile_Unmap(&stView);
+
   /* Done! */
   return pstResult;
 }
@@ -260,6 +265,16 @@ orxSTATUS orxFASTCALL orxSoundSystem_SDL_UnloadSample(orxSOUNDSYSTEM_SAMPLE *_ps
   return orxSTATUS_SUCCESS;
 }
 
+orxU32 orxFASTCALL orxSoundSystem_SDL_GetSampleSize(const orxSOUNDSYSTEM_SAMPLE *_pstSample)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSample != orxNULL);
+
+  /* Done! */
+  return (orxU32)((const Mix_Chunk *)_pstSample)->alen;
+}
+
 orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_SDL_CreateFromSample(const orxSOUNDSYSTEM_SAMPLE *_pstSample)
 {
   orxSOUNDSYSTEM_SOUND *pstResult = 0;
@@ -773,6 +788,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SDL_Init, SOUNDSYSTEM, INIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SDL_Exit, SOUNDSYSTEM, EXIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SDL_LoadSample, SOUNDSYSTEM, LOAD_SAMPLE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SDL_UnloadSample, SOUNDSYSTEM, UNLOAD_SAMPLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SDL_GetSampleSize, SOUNDSYSTEM, GET_SAMPLE_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SDL_CreateFromSample, SOUNDSYSTEM, CREATE_FROM_SAMPLE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SDL_CreateStreamFromFile, SOUNDSYSTEM, CREATE_STREAM_FROM_FILE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SDL_Delete, SOUNDSYSTEM, DELETE);
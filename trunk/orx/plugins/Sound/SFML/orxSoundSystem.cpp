@@ -61,7 +61,8 @@ struct __orxSOUNDSYSTEM_SOUND_t
     sf::Sound *poSound;
     sf::Music *poMusic;
   };
-  bool  bIsMusic;
+  bool          bIsMusic;
+  orxFILE_VIEW  stView;                 /**< Music file content, streamed from memory */
 };
 
 /** Static structure
@@ -157,6 +158,7 @@ extern "C" void orxFASTCALL orxSoundSystem_SFML_Exit()
 
 extern "C" orxSOUNDSYSTEM_SAMPLE *orxFASTCALL orxSoundSystem_SFML_LoadSample(const orxSTRING _zFilename)
 {
+  orxFILE_VIEW           stView;
   orxSOUNDSYSTEM_SAMPLE *pstResult;
   sf::SoundBuffer       *poBuffer;
 
@@ -167,8 +169,9 @@ extern "C" orxSOUNDSYSTEM_SAMPLE *orxFASTCALL orxSoundSystem_SFML_LoadSample(con
   /* Creates empty sound buffer */
   poBuffer = new sf::SoundBuffer();
 
-  /* Loads it from file */
-  if(poBuffer->LoadFromFile(_zFilename) != false)
+  /* Loads it from memory */
+  if((orxFile_Map(_zFilename, orxFILE_KU32_FLAG_MAP_SEQUENTIAL, &stView) != orxSTATUS_FAILURE)
+  && (poBuffer->LoadFromMemory(stView.pcData, stView.u32Size) != false))
   {
     /* Updates result */
     pstResult = (orxSOUNDSYSTEM_SAMPLE *)poBuffer;
@@ -182,6 +185,9 @@ extern "C" orxSOUNDSYSTEM_SAMPLE *orxFASTCALL orxSoundSystem_SFML_LoadSample(con
     pstResult = (orxSOUNDSYSTEM_SAMPLE *)orxNULL;
   }
 
+  /* Unmaps file */
+  orxFile_Unmap(&stView);
+
   /* Done! */
   return pstResult;
 }
@@ -204,6 +210,21 @@ extern "C" orxSTATUS orxFASTCALL orxSoundSystem_SFML_UnloadSample(orxSOUNDSYSTEM
   return orxSTATUS_SUCCESS;
 }
 
+extern "C" orxU32 orxFASTCALL orxSoundSystem_SFML_GetSampleSize(const orxSOUNDSYSTEM_SAMPLE *_pstSample)
+{
+  const sf::SoundBuffer *poBuffer;
+
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSample != orxNULL);
+
+  /* Gets sound buffer */
+  poBuffer = (const sf::SoundBuffer *)_pstSample;
+
+  /* Done! */
+  return (orxU32)(poBuffer->GetSamplesCount() * sizeof(sf::Int16));
+}
+
 extern "C" orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_SFML_CreateFromSample(const orxSOUNDSYSTEM_SAMPLE *_pstSample)
 {
   orxSOUNDSYSTEM_SOUND *pstResult;
@@ -231,6 +252,7 @@ extern "C" orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_SFML_CreateFromSampl
 
 extern "C" orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_SFML_CreateStreamFromFile(const orxSTRING _zFilename)
 {
+  orxFILE_VIEW          stView;
   orxSOUNDSYSTEM_SOUND *pstResult;
   sf::Music            *poMusic;
 
@@ -241,8 +263,9 @@ extern "C" orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_SFML_CreateStreamFro
   /* Creates empty music */
   poMusic = new sf::Music();
 
-  /* Loads it from file */
-  if(poMusic->OpenFromFile(_zFilename) != false)
+  /* Opens it from memory */
+  if((orxFile_Map(_zFilename, orxFILE_KU32_FLAG_MAP_SEQUENTIAL, &stView) != orxSTATUS_FAILURE)
+  && (poMusic->OpenFromMemory(stView.pcData, stView.u32Size) != false))
   {
     /* Creates result */
     pstResult = new orxSOUNDSYSTEM_SOUND();
@@ -252,12 +275,18 @@ extern "C" orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_SFML_CreateStreamFro
     
     /* Updates its status */
     pstResult->bIsMusic = true;
+
+    /* Keeps its content for streaming */
+    pstResult->stView = stView;
   }
   else
   {
     /* Deletes music */
     delete poMusic;
 
+    /* Unmaps file */
+    orxFile_Unmap(&stView);
+
     /* Updates result */
     pstResult = (orxSOUNDSYSTEM_SOUND *)orxNULL;
   }
@@ -277,6 +306,9 @@ extern "C" orxSTATUS orxFASTCALL orxSoundSystem_SFML_Delete(orxSOUNDSYSTEM_SOUND
   {
     /* Deletes its music */
     delete _pstSound->poMusic;
+
+    /* Unmaps its content */
+    orxFile_Unmap(&(_pstSound->stView));
   }
   else
   {
@@ -830,6 +862,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SFML_Init, SOUNDSYSTEM, INIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SFML_Exit, SOUNDSYSTEM, EXIT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SFML_LoadSample, SOUNDSYSTEM, LOAD_SAMPLE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SFML_UnloadSample, SOUNDSYSTEM, UNLOAD_SAMPLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SFML_GetSampleSize, SOUNDSYSTEM, GET_SAMPLE_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SFML_CreateFromSample, SOUNDSYSTEM, CREATE_FROM_SAMPLE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SFML_CreateStreamFromFile, SOUNDSYSTEM, CREATE_STREAM_FROM_FILE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_SFML_Delete, SOUNDSYSTEM, DELETE);
@@ -0,0 +1,2187 @@
+/* Orx - Portable Game Engine
+ *
+ * Orx is the legal property of its developers, whose names
+ * are listed in the COPYRIGHT file distributed
+ * with this source distribution.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file orxSoundSystem.c
+ * @date 19/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * Software sound system plugin implementation
+ *
+ * All sounds are mixed by a dedicated thread into a fixed pool of voices: each block,
+ * the loudest playing sounds get a voice, the others keep running silently (virtual voices).
+ * Mixed blocks are sent to ALSA, written to a WAV file or simply dropped (null output),
+ * which allows to run orx on machines without any audio device.
+ * Only WAV (PCM 8/16/24/32 bits & float) files are supported.
+ *
+ */
+
+
+#include "orxPluginAPI.h"
+
+#include <stdio.h>
+
+
+/** Platform dependent includes & types
+ */
+
+/* Windows */
+#ifdef __orxWINDOWS__
+
+  #define WIN32_LEAN_AND_MEAN
+  #include <windows.h>
+
+  typedef HANDLE                                        orxSOUNDSYSTEM_THREAD;
+  typedef CRITICAL_SECTION                              orxSOUNDSYSTEM_MUTEX;
+
+#else /* __orxWINDOWS__ */
+
+  #include <pthread.h>
+  #include <time.h>
+
+  typedef pthread_t                                     orxSOUNDSYSTEM_THREAD;
+  typedef pthread_mutex_t                               orxSOUNDSYSTEM_MUTEX;
+
+  /* Linux */
+  #ifdef __orxLINUX__
+
+    #include <dlfcn.h>
+
+    /* ALSA is loaded at runtime: the plugin doesn't depend on it when using null or WAV outputs */
+    #define __orxSOUNDSYSTEM_ALSA__
+
+    #define orxSOUNDSYSTEM_KZ_ALSA_LIBRARY              "libasound.so.2"
+    #define orxSOUNDSYSTEM_KS32_ALSA_STREAM_PLAYBACK    0           /**< SND_PCM_STREAM_PLAYBACK */
+    #define orxSOUNDSYSTEM_KS32_ALSA_FORMAT_S16_LE      2           /**< SND_PCM_FORMAT_S16_LE */
+    #define orxSOUNDSYSTEM_KS32_ALSA_ACCESS_INTERLEAVED 3           /**< SND_PCM_ACCESS_RW_INTERLEAVED */
+
+    typedef int   (*orxSOUNDSYSTEM_ALSA_OPEN)(void **, const char *, int, int);
+    typedef int   (*orxSOUNDSYSTEM_ALSA_SET_PARAMS)(void *, int, int, unsigned int, unsigned int, int, unsigned int);
+    typedef long  (*orxSOUNDSYSTEM_ALSA_WRITE)(void *, const void *, unsigned long);
+    typedef int   (*orxSOUNDSYSTEM_ALSA_RECOVER)(void *, int, int);
+    typedef int   (*orxSOUNDSYSTEM_ALSA_CLOSE)(void *);
+
+  #endif /* __orxLINUX__ */
+
+#endif /* __orxWINDOWS__ */
+
+
+/** Instruction set selection: mixing kernels run on orxSOUNDSYSTEM_KU32_WIDTH floats at once
+ * Blocks are always a multiple of the widest width, hence no scalar tail loop is needed
+ */
+#if defined(__AVX__)
+
+  #include <immintrin.h>
+
+  #define orxSOUNDSYSTEM_KZ_INSTRUCTION_SET             "avx"
+  #define orxSOUNDSYSTEM_KU32_WIDTH                     8
+
+  typedef __m256                                        orxSOUNDSYSTEM_VEC;
+
+  #define orxSOUNDSYSTEM_LOAD(P)                        _mm256_loadu_ps(P)
+  #define orxSOUNDSYSTEM_STORE(P, V)                    _mm256_storeu_ps(P, V)
+  #define orxSOUNDSYSTEM_SET(F)                         _mm256_set1_ps(F)
+  #define orxSOUNDSYSTEM_ADD(A, B)                      _mm256_add_ps(A, B)
+  #define orxSOUNDSYSTEM_SUB(A, B)                      _mm256_sub_ps(A, B)
+  #define orxSOUNDSYSTEM_MUL(A, B)                      _mm256_mul_ps(A, B)
+  #define orxSOUNDSYSTEM_MIN(A, B)                      _mm256_min_ps(A, B)
+  #define orxSOUNDSYSTEM_MAX(A, B)                      _mm256_max_ps(A, B)
+
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+
+  #include <xmmintrin.h>
+
+  #define orxSOUNDSYSTEM_KZ_INSTRUCTION_SET             "sse"
+  #define orxSOUNDSYSTEM_KU32_WIDTH                     4
+
+  typedef __m128                                        orxSOUNDSYSTEM_VEC;
+
+  #define orxSOUNDSYSTEM_LOAD(P)                        _mm_loadu_ps(P)
+  #define orxSOUNDSYSTEM_STORE(P, V)                    _mm_storeu_ps(P, V)
+  #define orxSOUNDSYSTEM_SET(F)                         _mm_set1_ps(F)
+  #define orxSOUNDSYSTEM_ADD(A, B)                      _mm_add_ps(A, B)
+  #define orxSOUNDSYSTEM_SUB(A, B)                      _mm_sub_ps(A, B)
+  #define orxSOUNDSYSTEM_MUL(A, B)                      _mm_mul_ps(A, B)
+  #define orxSOUNDSYSTEM_MIN(A, B)                      _mm_min_ps(A, B)
+  #define orxSOUNDSYSTEM_MAX(A, B)                      _mm_max_ps(A, B)
+
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+  #include <arm_neon.h>
+
+  #define orxSOUNDSYSTEM_KZ_INSTRUCTION_SET             "neon"
+  #define orxSOUNDSYSTEM_KU32_WIDTH                     4
+
+  typedef float32x4_t                                   orxSOUNDSYSTEM_VEC;
+
+  #define orxSOUNDSYSTEM_LOAD(P)                        vld1q_f32(P)
+  #define orxSOUNDSYSTEM_STORE(P, V)                    vst1q_f32(P, V)
+  #define orxSOUNDSYSTEM_SET(F)                         vdupq_n_f32(F)
+  #define orxSOUNDSYSTEM_ADD(A, B)                      vaddq_f32(A, B)
+  #define orxSOUNDSYSTEM_SUB(A, B)                      vsubq_f32(A, B)
+  #define orxSOUNDSYSTEM_MUL(A, B)                      vmulq_f32(A, B)
+  #define orxSOUNDSYSTEM_MIN(A, B)                      vminq_f32(A, B)
+  #define orxSOUNDSYSTEM_MAX(A, B)                      vmaxq_f32(A, B)
+
+#else
+
+  #define orxSOUNDSYSTEM_KZ_INSTRUCTION_SET             "scalar"
+  #define orxSOUNDSYSTEM_KU32_WIDTH                     1
+
+#endif
+
+
+/** Module flags
+ */
+#define orxSOUNDSYSTEM_KU32_STATIC_FLAG_NONE            0x00000000 /**< No flags */
+
+#define orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY           0x00000001 /**< Ready flag */
+#define orxSOUNDSYSTEM_KU32_STATIC_FLAG_STOP            0x00000002 /**< Mixer thread stop request */
+
+#define orxSOUNDSYSTEM_KU32_STATIC_MASK_ALL             0xFFFFFFFF /**< All mask */
+
+
+/** Sound flags
+ */
+#define orxSOUNDSYSTEM_KU32_SOUND_FLAG_NONE             0x00000000 /**< No flags */
+
+#define orxSOUNDSYSTEM_KU32_SOUND_FLAG_LOOP             0x00000001 /**< Loop flag */
+#define orxSOUNDSYSTEM_KU32_SOUND_FLAG_PLAY             0x00000002 /**< Play flag: sound is in the play list */
+#define orxSOUNDSYSTEM_KU32_SOUND_FLAG_PAUSE            0x00000004 /**< Pause flag */
+#define orxSOUNDSYSTEM_KU32_SOUND_FLAG_STREAM           0x00000008 /**< Stream flag: sound owns its sample */
+#define orxSOUNDSYSTEM_KU32_SOUND_FLAG_VOICE            0x00000010 /**< Voice flag: sound is mixed in the current block */
+
+#define orxSOUNDSYSTEM_KU32_SOUND_MASK_ALL              0xFFFFFFFF /**< All mask */
+
+
+/** Misc defines
+ */
+#define orxSOUNDSYSTEM_KU32_BANK_SIZE                   128
+#define orxSOUNDSYSTEM_KF_DEFAULT_DIMENSION_RATIO       orx2F(0.01f)
+#define orxSOUNDSYSTEM_KU32_DEFAULT_FREQUENCY           44100
+#define orxSOUNDSYSTEM_KU32_DEFAULT_BLOCK_SIZE          512         /**< Frames mixed at once */
+#define orxSOUNDSYSTEM_KU32_DEFAULT_VOICE_NUMBER        32
+#define orxSOUNDSYSTEM_KF_DEFAULT_CULLING_THRESHOLD     orx2F(0.001f)/**< -60dB */
+#define orxSOUNDSYSTEM_KZ_DEFAULT_OUTPUT_FILE           "orxsound.wav"
+#define orxSOUNDSYSTEM_KZ_DEFAULT_DEVICE                "default"
+
+#define orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER              2           /**< Output is always stereo */
+#define orxSOUNDSYSTEM_KU32_BLOCK_ALIGNMENT             8           /**< Block sizes are multiple of it, for all instruction sets */
+#define orxSOUNDSYSTEM_KU32_ALSA_LATENCY_BLOCK          4           /**< ALSA buffer size, in blocks */
+#define orxSOUNDSYSTEM_KU32_MAX_LATE_BLOCK              4           /**< Paced outputs resync when this late */
+#define orxSOUNDSYSTEM_KF_STREAM_PRIORITY               orx2F(1000000.0f) /**< Priority bonus of streams, which always get a voice first */
+#define orxSOUNDSYSTEM_KU32_CURSOR_SHIFT                32          /**< Cursors are 32.32 fixed point frame indices */
+#define orxSOUNDSYSTEM_KF_CURSOR_FRACTION               orx2F(1.0f / 4294967296.0f)
+
+#define orxSOUNDSYSTEM_KZ_CONFIG_OUTPUT                 "Output"
+#define orxSOUNDSYSTEM_KZ_CONFIG_OUTPUT_FILE            "OutputFile"
+#define orxSOUNDSYSTEM_KZ_CONFIG_DEVICE                 "Device"
+#define orxSOUNDSYSTEM_KZ_CONFIG_FREQUENCY              "Frequency"
+#define orxSOUNDSYSTEM_KZ_CONFIG_BUFFER_SIZE            "BufferSize"
+#define orxSOUNDSYSTEM_KZ_CONFIG_VOICE_NUMBER           "VoiceNumber"
+#define orxSOUNDSYSTEM_KZ_CONFIG_CULLING_THRESHOLD      "CullingThreshold"
+
+#define orxSOUNDSYSTEM_KZ_OUTPUT_NULL                   "null"
+#define orxSOUNDSYSTEM_KZ_OUTPUT_WAV                    "wav"
+#define orxSOUNDSYSTEM_KZ_OUTPUT_ALSA                   "alsa"
+
+#define orxSOUNDSYSTEM_KU32_WAV_HEADER_SIZE             44
+#define orxSOUNDSYSTEM_KU32_WAV_FORMAT_PCM              0x0001
+#define orxSOUNDSYSTEM_KU32_WAV_FORMAT_FLOAT            0x0003
+#define orxSOUNDSYSTEM_KU32_WAV_FORMAT_EXTENSIBLE       0xFFFE
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Output enum
+ */
+typedef enum __orxSOUNDSYSTEM_OUTPUT_t
+{
+  orxSOUNDSYSTEM_OUTPUT_NULL = 0,
+  orxSOUNDSYSTEM_OUTPUT_WAV,
+  orxSOUNDSYSTEM_OUTPUT_ALSA,
+
+  orxSOUNDSYSTEM_OUTPUT_NUMBER,
+
+  orxSOUNDSYSTEM_OUTPUT_NONE = orxENUM_NONE
+
+} orxSOUNDSYSTEM_OUTPUT;
+
+/** Internal sample structure
+ */
+struct __orxSOUNDSYSTEM_SAMPLE_t
+{
+  const orxS16     *as16Data;                   /**< Interleaved 16-bit frames : 4 */
+  orxU32            u32FrameNumber;             /**< Number of frames : 8 */
+  orxU32            u32ChannelNumber;           /**< Number of channels (1 or 2) : 12 */
+  orxU32            u32Frequency;               /**< Sample rate : 16 */
+  orxFILE_VIEW      stView;                     /**< Mapped file, when frames are read in place : 28 */
+  orxBOOL           bMapped;                    /**< Frames are read in place? : 32 */
+};
+
+/** Internal sound structure
+ */
+struct __orxSOUNDSYSTEM_SOUND_t
+{
+  orxLINKLIST_NODE  stNode;                     /**< Play list node : 12 */
+  const orxSOUNDSYSTEM_SAMPLE *pstSample;       /**< Played sample : 16 */
+  orxU64            u64Cursor;                  /**< Play cursor (32.32 fixed point frame index) : 24 */
+  orxVECTOR         vPosition;                  /**< Position (scaled by the dimension ratio) : 36 */
+  orxFLOAT          fVolume;                    /**< Volume : 40 */
+  orxFLOAT          fPitch;                     /**< Pitch : 44 */
+  orxFLOAT          fAttenuation;               /**< Distance attenuation : 48 */
+  orxFLOAT          fReferenceDistance;         /**< Reference distance : 52 */
+  orxU32            u32Flags;                   /**< Flags : 56 */
+};
+
+/** Voice structure
+ */
+typedef struct __orxSOUNDSYSTEM_VOICE_t
+{
+  orxSOUNDSYSTEM_SOUND *pstSound;               /**< Mixed sound : 4 */
+  orxFLOAT              fPriority;              /**< Priority, voices with the lowest one get stolen first : 8 */
+  orxFLOAT              fLeftGain;              /**< Left gain : 12 */
+  orxFLOAT              fRightGain;             /**< Right gain : 16 */
+
+} orxSOUNDSYSTEM_VOICE;
+
+/** Static structure
+ */
+typedef struct __orxSOUNDSYSTEM_STATIC_t
+{
+  orxBANK                  *pstSoundBank;       /**< Sound bank */
+  orxLINKLIST               stPlayList;         /**< Playing sounds */
+  orxSOUNDSYSTEM_VOICE     *astVoiceList;       /**< Voice pool */
+  orxFLOAT                 *afMixBuffer;        /**< Mix buffer (interleaved stereo) */
+  orxFLOAT                 *afSourceBuffer;     /**< Resampling buffer: current frames */
+  orxFLOAT                 *afNextBuffer;       /**< Resampling buffer: next frames */
+  orxFLOAT                 *afFractionBuffer;   /**< Resampling buffer: interpolation factors */
+  orxS16                   *as16OutputBuffer;   /**< Output buffer */
+  orxVECTOR                 vListenerPosition;  /**< Listener position */
+  orxFLOAT                  fDimensionRatio;    /**< Dimension ratio */
+  orxFLOAT                  fRecDimensionRatio; /**< Reciprocal dimension ratio */
+  orxFLOAT                  fGlobalVolume;      /**< Global volume */
+  orxFLOAT                  fCullingThreshold;  /**< Gain under which sounds aren't mixed */
+  orxU32                    u32Frequency;       /**< Output frequency */
+  orxU32                    u32BlockSize;       /**< Block size, in frames */
+  orxU32                    u32VoiceNumber;     /**< Voice pool size */
+  orxSOUNDSYSTEM_OUTPUT     eOutput;            /**< Output */
+  FILE                     *pstWAVFile;         /**< WAV output file */
+  orxU32                    u32WAVDataSize;     /**< WAV output data size */
+
+#ifdef __orxSOUNDSYSTEM_ALSA__
+
+  void                     *hALSALibrary;       /**< ALSA library */
+  void                     *pstPCM;             /**< ALSA PCM device */
+  orxSOUNDSYSTEM_ALSA_WRITE pfnALSAWrite;       /**< snd_pcm_writei */
+  orxSOUNDSYSTEM_ALSA_RECOVER pfnALSARecover;   /**< snd_pcm_recover */
+  orxSOUNDSYSTEM_ALSA_CLOSE pfnALSAClose;       /**< snd_pcm_close */
+
+#endif /* __orxSOUNDSYSTEM_ALSA__ */
+
+  orxU32                    u32BlockCounter;    /**< Number of mixed blocks */
+  orxU32                    u32VoiceCounter;    /**< Number of mixed voices, for all blocks */
+  orxU32                    u32VirtualCounter;  /**< Number of sounds without a voice, for all blocks */
+  orxU32                    u32CulledCounter;   /**< Number of culled sounds, for all blocks */
+  orxU32                    u32PeakVoiceCounter;/**< Peak number of mixed voices in a block */
+  orxDOUBLE                 dMixTime;           /**< Time spent mixing voices */
+  orxSOUNDSYSTEM_THREAD     hThread;            /**< Mixer thread */
+  orxSOUNDSYSTEM_MUTEX      stMutex;            /**< Mutex protecting sounds & play list */
+  orxU32                    u32Flags;           /**< Control flags */
+
+} orxSOUNDSYSTEM_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxSOUNDSYSTEM_STATIC sstSoundSystem;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Locks the play list
+ */
+static orxINLINE void orxSoundSystem_Software_Lock()
+{
+#ifdef __orxWINDOWS__
+  EnterCriticalSection(&(sstSoundSystem.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_mutex_lock(&(sstSoundSystem.stMutex));
+#endif /* __orxWINDOWS__ */
+}
+
+/** Unlocks the play list
+ */
+static orxINLINE void orxSoundSystem_Software_Unlock()
+{
+#ifdef __orxWINDOWS__
+  LeaveCriticalSection(&(sstSoundSystem.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_mutex_unlock(&(sstSoundSystem.stMutex));
+#endif /* __orxWINDOWS__ */
+}
+
+/** Gets a high resolution time, used for pacing & profiling the mixer thread
+ * @return Time in seconds
+ */
+static orxINLINE orxDOUBLE orxSoundSystem_Software_GetTime()
+{
+#ifdef __orxWINDOWS__
+
+  LARGE_INTEGER stCounter, stFrequency;
+
+  /* Gets counter */
+  QueryPerformanceCounter(&stCounter);
+  QueryPerformanceFrequency(&stFrequency);
+
+  /* Done! */
+  return (orxDOUBLE)stCounter.QuadPart / (orxDOUBLE)stFrequency.QuadPart;
+
+#else /* __orxWINDOWS__ */
+
+  struct timespec stTime;
+
+  /* Gets time */
+  clock_gettime(CLOCK_MONOTONIC, &stTime);
+
+  /* Done! */
+  return (orxDOUBLE)stTime.tv_sec + ((orxDOUBLE)stTime.tv_nsec * 0.000000001);
+
+#endif /* __orxWINDOWS__ */
+}
+
+/** Reads a little endian 16-bit value
+ */
+static orxINLINE orxU32 orxSoundSystem_Software_ReadU16(const orxU8 *_pu8Data)
+{
+  /* Done! */
+  return (orxU32)_pu8Data[0] | ((orxU32)_pu8Data[1] << 8);
+}
+
+/** Reads a little endian 32-bit value
+ */
+static orxINLINE orxU32 orxSoundSystem_Software_ReadU32(const orxU8 *_pu8Data)
+{
+  /* Done! */
+  return (orxU32)_pu8Data[0] | ((orxU32)_pu8Data[1] << 8) | ((orxU32)_pu8Data[2] << 16) | ((orxU32)_pu8Data[3] << 24);
+}
+
+/** Writes a little endian 16-bit value
+ */
+static orxINLINE void orxSoundSystem_Software_WriteU16(orxU8 *_pu8Data, orxU32 _u32Value)
+{
+  _pu8Data[0] = (orxU8)(_u32Value & 0xFF);
+  _pu8Data[1] = (orxU8)((_u32Value >> 8) & 0xFF);
+}
+
+/** Writes a little endian 32-bit value
+ */
+static orxINLINE void orxSoundSystem_Software_WriteU32(orxU8 *_pu8Data, orxU32 _u32Value)
+{
+  _pu8Data[0] = (orxU8)(_u32Value & 0xFF);
+  _pu8Data[1] = (orxU8)((_u32Value >> 8) & 0xFF);
+  _pu8Data[2] = (orxU8)((_u32Value >> 16) & 0xFF);
+  _pu8Data[3] = (orxU8)((_u32Value >> 24) & 0xFF);
+}
+
+/** Is host little endian?
+ */
+static orxINLINE orxBOOL orxSoundSystem_Software_IsLittleEndian()
+{
+  orxU16 u16Test = 0x0001;
+
+  /* Done! */
+  return (*((orxU8 *)&u16Test) == 0x01) ? orxTRUE : orxFALSE;
+}
+
+/** Decodes a WAV sample
+ * @param[in]   _pu8Data          Encoded frames
+ * @param[out]  _as16Data         Decoded 16-bit frames
+ * @param[in]   _u32FrameNumber   Number of frames to decode
+ * @param[in]   _u32Format        WAV format tag
+ * @param[in]   _u32Bits          Bits per sample
+ * @param[in]   _u32SourceChannel Number of source channels
+ * @param[in]   _u32ChannelNumber Number of kept channels
+ */
+static void orxFASTCALL orxSoundSystem_Software_Decode(const orxU8 *_pu8Data, orxS16 *_as16Data, orxU32 _u32FrameNumber, orxU32 _u32Format, orxU32 _u32Bits, orxU32 _u32SourceChannel, orxU32 _u32ChannelNumber)
+{
+  orxU32 u32BytesPerSample, i, j;
+
+  /* Gets bytes per sample */
+  u32BytesPerSample = _u32Bits >> 3;
+
+  /* For all frames */
+  for(i = 0; i < _u32FrameNumber; i++, _pu8Data += u32BytesPerSample * _u32SourceChannel)
+  {
+    /* For all kept channels */
+    for(j = 0; j < _u32ChannelNumber; j++)
+    {
+      const orxU8  *pu8Sample;
+      orxS32        s32Value;
+
+      /* Gets sample */
+      pu8Sample = _pu8Data + j * u32BytesPerSample;
+
+      /* Float? */
+      if(_u32Format == orxSOUNDSYSTEM_KU32_WAV_FORMAT_FLOAT)
+      {
+        orxU32    u32Bits;
+        orxFLOAT  fValue;
+
+        /* Gets its value */
+        u32Bits = orxSoundSystem_Software_ReadU32(pu8Sample);
+        orxMemory_Copy(&fValue, &u32Bits, sizeof(orxFLOAT));
+        s32Value = (orxS32)(orxCLAMP(fValue, orx2F(-1.0f), orxFLOAT_1) * orx2F(32767.0f));
+      }
+      else
+      {
+        /* Depending on size */
+        switch(_u32Bits)
+        {
+          case 8:
+          {
+            /* Unsigned */
+            s32Value = ((orxS32)pu8Sample[0] - 128) << 8;
+            break;
+          }
+
+          case 16:
+          {
+            s32Value = (orxS32)(orxS16)orxSoundSystem_Software_ReadU16(pu8Sample);
+            break;
+          }
+
+          default:
+          {
+            /* Keeps the two most significant bytes */
+            s32Value = (orxS32)(orxS16)orxSoundSystem_Software_ReadU16(pu8Sample + u32BytesPerSample - 2);
+            break;
+          }
+        }
+      }
+
+      /* Stores it */
+      *_as16Data++ = (orxS16)s32Value;
+    }
+  }
+
+  return;
+}
+
+/** Loads a WAV file
+ * @param[in]   _zFilename        Name of the file to load
+ * @param[in]   _bInPlace         Reads 16-bit frames directly from the mapped file when possible
+ * @return orxSOUNDSYSTEM_SAMPLE / orxNULL
+ */
+static orxSOUNDSYSTEM_SAMPLE *orxFASTCALL orxSoundSystem_Software_LoadWAV(const orxSTRING _zFilename, orxBOOL _bInPlace)
+{
+  orxFILE_VIEW            stView;
+  orxSOUNDSYSTEM_SAMPLE  *pstResult = orxNULL;
+
+  /* Maps file */
+  if(orxFile_Map(_zFilename, orxFILE_KU32_FLAG_MAP_SEQUENTIAL, &stView) != orxSTATUS_FAILURE)
+  {
+    const orxU8  *pu8File, *pu8Data = orxNULL;
+    orxU32        u32Offset, u32DataSize = 0, u32Format = 0, u32SourceChannel = 0, u32Frequency = 0, u32Bits = 0;
+
+    /* Gets content */
+    pu8File = (const orxU8 *)stView.pcData;
+
+    /* Is a RIFF WAVE file? */
+    if((stView.u32Size >= 12)
+    && (orxMemory_Compare(pu8File, "RIFF", 4) == 0)
+    && (orxMemory_Compare(pu8File + 8, "WAVE", 4) == 0))
+    {
+      /* For all chunks */
+      for(u32Offset = 12; u32Offset + 8 <= stView.u32Size;)
+      {
+        orxU32 u32ChunkSize;
+
+        /* Gets chunk size */
+        u32ChunkSize = orxMIN(orxSoundSystem_Software_ReadU32(pu8File + u32Offset + 4), stView.u32Size - u32Offset - 8);
+
+        /* Format? */
+        if((orxMemory_Compare(pu8File + u32Offset, "fmt ", 4) == 0) && (u32ChunkSize >= 16))
+        {
+          /* Gets format */
+          u32Format         = orxSoundSystem_Software_ReadU16(pu8File + u32Offset + 8);
+          u32SourceChannel  = orxSoundSystem_Software_ReadU16(pu8File + u32Offset + 10);
+          u32Frequency      = orxSoundSystem_Software_ReadU32(pu8File + u32Offset + 12);
+          u32Bits           = orxSoundSystem_Software_ReadU16(pu8File + u32Offset + 22);
+
+          /* Extensible? */
+          if((u32Format == orxSOUNDSYSTEM_KU32_WAV_FORMAT_EXTENSIBLE) && (u32ChunkSize >= 26))
+          {
+            /* Gets sub format */
+            u32Format = orxSoundSystem_Software_ReadU16(pu8File + u32Offset + 32);
+          }
+        }
+        /* Data? */
+        else if(orxMemory_Compare(pu8File + u32Offset, "data", 4) == 0)
+        {
+          /* Stores it */
+          pu8Data     = pu8File + u32Offset + 8;
+          u32DataSize = u32ChunkSize;
+        }
+
+        /* Next chunk (chunks are word aligned) */
+        u32Offset += 8 + u32ChunkSize + (u32ChunkSize & 1);
+      }
+    }
+
+    /* Supported format? */
+    if((pu8Data != orxNULL)
+    && (u32SourceChannel > 0)
+    && (u32Frequency > 0)
+    && (((u32Format == orxSOUNDSYSTEM_KU32_WAV_FORMAT_PCM) && ((u32Bits == 8) || (u32Bits == 16) || (u32Bits == 24) || (u32Bits == 32)))
+     || ((u32Format == orxSOUNDSYSTEM_KU32_WAV_FORMAT_FLOAT) && (u32Bits == 32))))
+    {
+      orxU32 u32FrameNumber, u32ChannelNumber;
+
+      /* Gets frame & kept channel numbers (only the first two channels are mixed) */
+      u32FrameNumber    = u32DataSize / ((u32Bits >> 3) * u32SourceChannel);
+      u32ChannelNumber  = orxMIN(u32SourceChannel, orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER);
+
+      /* Can be read in place? */
+      if((_bInPlace != orxFALSE)
+      && (u32Format == orxSOUNDSYSTEM_KU32_WAV_FORMAT_PCM)
+      && (u32Bits == 16)
+      && (u32SourceChannel <= orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER)
+      && (orxSoundSystem_Software_IsLittleEndian() != orxFALSE))
+      {
+        /* Allocates sample */
+        pstResult = (orxSOUNDSYSTEM_SAMPLE *)orxMemory_Allocate(sizeof(orxSOUNDSYSTEM_SAMPLE), orxMEMORY_TYPE_MAIN);
+
+        /* Success? */
+        if(pstResult != orxNULL)
+        {
+          /* Keeps mapping */
+          orxMemory_Copy(&(pstResult->stView), &stView, sizeof(orxFILE_VIEW));
+          pstResult->bMapped  = orxTRUE;
+          pstResult->as16Data = (const orxS16 *)pu8Data;
+        }
+      }
+      else
+      {
+        orxU32 u32HeaderSize;
+
+        /* Gets aligned header size */
+        u32HeaderSize = orxMemory_GetAlign(sizeof(orxSOUNDSYSTEM_SAMPLE), 16);
+
+        /* Allocates sample with its frames */
+        pstResult = (orxSOUNDSYSTEM_SAMPLE *)orxMemory_Allocate(u32HeaderSize + u32FrameNumber * u32ChannelNumber * sizeof(orxS16), orxMEMORY_TYPE_MAIN);
+
+        /* Success? */
+        if(pstResult != orxNULL)
+        {
+          /* Decodes frames */
+          orxSoundSystem_Software_Decode(pu8Data, (orxS16 *)((orxU8 *)pstResult + u32HeaderSize), u32FrameNumber, u32Format, u32Bits, u32SourceChannel, u32ChannelNumber);
+
+          /* Stores them */
+          orxMemory_Zero(&(pstResult->stView), sizeof(orxFILE_VIEW));
+          pstResult->bMapped  = orxFALSE;
+          pstResult->as16Data = (const orxS16 *)((orxU8 *)pstResult + u32HeaderSize);
+        }
+      }
+
+      /* Success? */
+      if(pstResult != orxNULL)
+      {
+        /* Stores format */
+        pstResult->u32FrameNumber   = u32FrameNumber;
+        pstResult->u32ChannelNumber = u32ChannelNumber;
+        pstResult->u32Frequency     = u32Frequency;
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Can't load <%s>: only WAV files (PCM 8/16/24/32 bits or 32-bit float) are supported.", _zFilename);
+    }
+
+    /* Not kept? */
+    if((pstResult == orxNULL) || (pstResult->bMapped == orxFALSE))
+    {
+      /* Unmaps file */
+      orxFile_Unmap(&stView);
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Deletes a sample
+ * @param[in]   _pstSample        Sample to delete
+ */
+static orxINLINE void orxSoundSystem_Software_DeleteSample(orxSOUNDSYSTEM_SAMPLE *_pstSample)
+{
+  /* Mapped? */
+  if(_pstSample->bMapped != orxFALSE)
+  {
+    /* Unmaps file */
+    orxFile_Unmap(&(_pstSample->stView));
+  }
+
+  /* Deletes it */
+  orxMemory_Free(_pstSample);
+
+  return;
+}
+
+/** Gets a sound playback step
+ * @param[in]   _pstSound         Concerned sound
+ * @return Step in 32.32 fixed point frames
+ */
+static orxINLINE orxU64 orxSoundSystem_Software_GetStep(const orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  orxFLOAT fStep;
+
+  /* Gets step */
+  fStep = _pstSound->fPitch * orxU2F(_pstSound->pstSample->u32Frequency) / orxU2F(sstSoundSystem.u32Frequency);
+
+  /* Done! */
+  return (fStep > orxFLOAT_0) ? (orxU64)((orxDOUBLE)fStep * 4294967296.0) : 0;
+}
+
+/** Advances a sound cursor
+ * @param[in]   _pstSound         Concerned sound
+ * @param[in]   _u64Offset        Offset to apply, in 32.32 fixed point frames
+ * @return orxFALSE if the sound has ended, orxTRUE otherwise
+ */
+static orxINLINE orxBOOL orxSoundSystem_Software_Advance(orxSOUNDSYSTEM_SOUND *_pstSound, orxU64 _u64Offset)
+{
+  orxU64  u64End;
+  orxBOOL bResult = orxTRUE;
+
+  /* Gets end */
+  u64End = (orxU64)_pstSound->pstSample->u32FrameNumber << orxSOUNDSYSTEM_KU32_CURSOR_SHIFT;
+
+  /* Updates cursor */
+  _pstSound->u64Cursor += _u64Offset;
+
+  /* Reached end? */
+  if(_pstSound->u64Cursor >= u64End)
+  {
+    /* Loop? */
+    if((orxFLAG_TEST(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_LOOP)) && (u64End != 0))
+    {
+      /* Wraps cursor */
+      _pstSound->u64Cursor %= u64End;
+    }
+    else
+    {
+      /* Updates result */
+      bResult = orxFALSE;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Computes a sound gains
+ * @param[in]   _pstSound         Concerned sound
+ * @param[out]  _pfLeftGain       Left gain
+ * @param[out]  _pfRightGain      Right gain
+ * @return Audible gain
+ */
+static orxINLINE orxFLOAT orxSoundSystem_Software_ComputeGain(const orxSOUNDSYSTEM_SOUND *_pstSound, orxFLOAT *_pfLeftGain, orxFLOAT *_pfRightGain)
+{
+  orxVECTOR vRelative;
+  orxFLOAT  fDistance, fPan, fResult;
+
+  /* Gets base gain */
+  fResult = _pstSound->fVolume * sstSoundSystem.fGlobalVolume;
+
+  /* Gets distance to listener */
+  fDistance = orxVector_GetSize(orxVector_Sub(&vRelative, &(_pstSound->vPosition), &(sstSoundSystem.vListenerPosition)));
+
+  /* Further than reference distance? */
+  if((fDistance > _pstSound->fReferenceDistance) && (_pstSound->fReferenceDistance > orxFLOAT_0))
+  {
+    /* Applies inverse distance attenuation */
+    fResult *= _pstSound->fReferenceDistance / (_pstSound->fReferenceDistance + _pstSound->fAttenuation * (fDistance - _pstSound->fReferenceDistance));
+  }
+
+  /* Gets panning from horizontal offset */
+  fPan = (fDistance > orxMATH_KF_EPSILON) ? vRelative.fX / fDistance : orxFLOAT_0;
+
+  /* Stores gains */
+  *_pfLeftGain  = fResult * orxMIN(orxFLOAT_1, orxFLOAT_1 - fPan);
+  *_pfRightGain = fResult * orxMIN(orxFLOAT_1, orxFLOAT_1 + fPan);
+
+  /* Done! */
+  return fResult;
+}
+
+/** Mixes a voice into the mix buffer
+ * @param[in]   _pstVoice         Voice to mix
+ * @return orxFALSE if the sound has ended, orxTRUE otherwise
+ */
+static orxBOOL orxFASTCALL orxSoundSystem_Software_MixVoice(const orxSOUNDSYSTEM_VOICE *_pstVoice)
+{
+  orxSOUNDSYSTEM_SOUND         *pstSound;
+  const orxSOUNDSYSTEM_SAMPLE  *pstSample;
+  orxU64                        u64Step, u64Cursor;
+  orxU32                        u32SampleNumber, u32Frame, i;
+  orxFLOAT                     *afSource, *afNext, *afFraction;
+  orxBOOL                       bInterpolate, bResult = orxTRUE;
+  orxFLOAT                      afGain[orxSOUNDSYSTEM_KU32_BLOCK_ALIGNMENT];
+
+  /* Gets sound, sample & buffers */
+  pstSound    = _pstVoice->pstSound;
+  pstSample   = pstSound->pstSample;
+  afSource    = sstSoundSystem.afSourceBuffer;
+  afNext      = sstSoundSystem.afNextBuffer;
+  afFraction  = sstSoundSystem.afFractionBuffer;
+
+  /* Gets step & cursor */
+  u64Step   = orxSoundSystem_Software_GetStep(pstSound);
+  u64Cursor = pstSound->u64Cursor;
+
+  /* Only needs interpolation when not playing frames at their own rate */
+  bInterpolate = ((u64Step != ((orxU64)1 << orxSOUNDSYSTEM_KU32_CURSOR_SHIFT)) || ((u64Cursor & 0xFFFFFFFF) != 0)) ? orxTRUE : orxFALSE;
+
+  /* For all frames */
+  for(u32Frame = 0, u32SampleNumber = 0; u32Frame < sstSoundSystem.u32BlockSize; u32Frame++, u32SampleNumber += orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER)
+  {
+    orxU32 u32Index, u32NextIndex;
+
+    /* Gets frame index */
+    u32Index = (orxU32)(u64Cursor >> orxSOUNDSYSTEM_KU32_CURSOR_SHIFT);
+
+    /* Out of sample? */
+    if(u32Index >= pstSample->u32FrameNumber)
+    {
+      /* Loops? */
+      if((orxFLAG_TEST(pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_LOOP)) && (pstSample->u32FrameNumber != 0))
+      {
+        /* Wraps cursor */
+        u64Cursor  %= (orxU64)pstSample->u32FrameNumber << orxSOUNDSYSTEM_KU32_CURSOR_SHIFT;
+        u32Index    = (orxU32)(u64Cursor >> orxSOUNDSYSTEM_KU32_CURSOR_SHIFT);
+      }
+      else
+      {
+        /* Updates result */
+        bResult = orxFALSE;
+
+        break;
+      }
+    }
+
+    /* Mono? */
+    if(pstSample->u32ChannelNumber == 1)
+    {
+      /* Stores frame on both channels */
+      afSource[u32SampleNumber] = afSource[u32SampleNumber + 1] = orxS2F(pstSample->as16Data[u32Index]);
+    }
+    else
+    {
+      /* Stores frame */
+      afSource[u32SampleNumber]     = orxS2F(pstSample->as16Data[2 * u32Index]);
+      afSource[u32SampleNumber + 1] = orxS2F(pstSample->as16Data[2 * u32Index + 1]);
+    }
+
+    /* Interpolates? */
+    if(bInterpolate != orxFALSE)
+    {
+      /* Gets next frame index */
+      u32NextIndex = u32Index + 1;
+      if(u32NextIndex >= pstSample->u32FrameNumber)
+      {
+        u32NextIndex = (orxFLAG_TEST(pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_LOOP)) ? 0 : u32Index;
+      }
+
+      /* Mono? */
+      if(pstSample->u32ChannelNumber == 1)
+      {
+        /* Stores next frame on both channels */
+        afNext[u32SampleNumber] = afNext[u32SampleNumber + 1] = orxS2F(pstSample->as16Data[u32NextIndex]);
+      }
+      else
+      {
+        /* Stores next frame */
+        afNext[u32SampleNumber]     = orxS2F(pstSample->as16Data[2 * u32NextIndex]);
+        afNext[u32SampleNumber + 1] = orxS2F(pstSample->as16Data[2 * u32NextIndex + 1]);
+      }
+
+      /* Stores interpolation factor */
+      afFraction[u32SampleNumber] = afFraction[u32SampleNumber + 1] = orxU2F((orxU32)(u64Cursor & 0xFFFFFFFF)) * orxSOUNDSYSTEM_KF_CURSOR_FRACTION;
+    }
+
+    /* Next frame */
+    u64Cursor += u64Step;
+  }
+
+  /* Stores cursor */
+  pstSound->u64Cursor = u64Cursor;
+
+  /* Clears remaining frames */
+  for(i = u32SampleNumber; i < orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER * sstSoundSystem.u32BlockSize; i++)
+  {
+    afSource[i] = afNext[i] = afFraction[i] = orxFLOAT_0;
+  }
+
+  /* Gets interleaved gains */
+  for(i = 0; i < orxSOUNDSYSTEM_KU32_BLOCK_ALIGNMENT; i += orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER)
+  {
+    afGain[i]     = _pstVoice->fLeftGain;
+    afGain[i + 1] = _pstVoice->fRightGain;
+  }
+
+#if (orxSOUNDSYSTEM_KU32_WIDTH > 1)
+
+  {
+    orxSOUNDSYSTEM_VEC vGain;
+
+    /* Loads gains */
+    vGain = orxSOUNDSYSTEM_LOAD(afGain);
+
+    /* Interpolates? */
+    if(bInterpolate != orxFALSE)
+    {
+      /* For all samples */
+      for(i = 0; i < orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER * sstSoundSystem.u32BlockSize; i += orxSOUNDSYSTEM_KU32_WIDTH)
+      {
+        orxSOUNDSYSTEM_VEC vSource;
+
+        /* Mix += (Source + (Next - Source) * Fraction) * Gain */
+        vSource = orxSOUNDSYSTEM_LOAD(afSource + i);
+        vSource = orxSOUNDSYSTEM_ADD(vSource, orxSOUNDSYSTEM_MUL(orxSOUNDSYSTEM_SUB(orxSOUNDSYSTEM_LOAD(afNext + i), vSource), orxSOUNDSYSTEM_LOAD(afFraction + i)));
+        orxSOUNDSYSTEM_STORE(sstSoundSystem.afMixBuffer + i, orxSOUNDSYSTEM_ADD(orxSOUNDSYSTEM_LOAD(sstSoundSystem.afMixBuffer + i), orxSOUNDSYSTEM_MUL(vSource, vGain)));
+      }
+    }
+    else
+    {
+      /* For all samples */
+      for(i = 0; i < orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER * sstSoundSystem.u32BlockSize; i += orxSOUNDSYSTEM_KU32_WIDTH)
+      {
+        /* Mix += Source * Gain */
+        orxSOUNDSYSTEM_STORE(sstSoundSystem.afMixBuffer + i, orxSOUNDSYSTEM_ADD(orxSOUNDSYSTEM_LOAD(sstSoundSystem.afMixBuffer + i), orxSOUNDSYSTEM_MUL(orxSOUNDSYSTEM_LOAD(afSource + i), vGain)));
+      }
+    }
+  }
+
+#else /* orxSOUNDSYSTEM_KU32_WIDTH > 1 */
+
+  /* For all samples */
+  for(i = 0; i < orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER * sstSoundSystem.u32BlockSize; i++)
+  {
+    orxFLOAT fSource;
+
+    /* Gets interpolated source */
+    fSource = (bInterpolate != orxFALSE) ? afSource[i] + (afNext[i] - afSource[i]) * afFraction[i] : afSource[i];
+
+    /* Mixes it */
+    sstSoundSystem.afMixBuffer[i] += fSource * afGain[i & (orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER - 1)];
+  }
+
+#endif /* orxSOUNDSYSTEM_KU32_WIDTH > 1 */
+
+  /* Done! */
+  return bResult;
+}
+
+/** Mixes a block of all playing sounds into the output buffer, play list has to be locked
+ */
+static void orxFASTCALL orxSoundSystem_Software_MixBlock()
+{
+  orxLINKLIST_NODE *pstNode;
+  orxU32            u32VoiceCounter = 0, u32CulledCounter = 0, u32SilentCounter = 0, u32MinVoice = 0, u32SampleNumber, i;
+  orxDOUBLE         dStartTime;
+
+  /* Gets sample number */
+  u32SampleNumber = orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER * sstSoundSystem.u32BlockSize;
+
+  /* Clears mix buffer */
+  orxMemory_Zero(sstSoundSystem.afMixBuffer, u32SampleNumber * sizeof(orxFLOAT));
+
+  /* For all playing sounds */
+  for(pstNode = orxLinkList_GetFirst(&(sstSoundSystem.stPlayList));
+      pstNode != orxNULL;
+      pstNode = orxLinkList_GetNext(pstNode))
+  {
+    orxSOUNDSYSTEM_SOUND *pstSound;
+    orxFLOAT              fGain, fLeftGain, fRightGain, fPriority;
+
+    /* Gets sound */
+    pstSound = (orxSOUNDSYSTEM_SOUND *)pstNode;
+
+    /* Gets its gains */
+    fGain = orxSoundSystem_Software_ComputeGain(pstSound, &fLeftGain, &fRightGain);
+
+    /* Inaudible? */
+    if(fGain < sstSoundSystem.fCullingThreshold)
+    {
+      /* Updates counter */
+      u32CulledCounter++;
+
+      continue;
+    }
+
+    /* Gets its priority */
+    fPriority = (orxFLAG_TEST(pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_STREAM)) ? fGain + orxSOUNDSYSTEM_KF_STREAM_PRIORITY : fGain;
+
+    /* Free voice? */
+    if(u32VoiceCounter < sstSoundSystem.u32VoiceNumber)
+    {
+      /* Uses it */
+      i = u32VoiceCounter++;
+    }
+    /* Higher priority than the weakest voice? */
+    else if(fPriority > sstSoundSystem.astVoiceList[u32MinVoice].fPriority)
+    {
+      /* Steals it */
+      i = u32MinVoice;
+      orxFLAG_SET(sstSoundSystem.astVoiceList[i].pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_NONE, orxSOUNDSYSTEM_KU32_SOUND_FLAG_VOICE);
+    }
+    else
+    {
+      /* Stays virtual */
+      continue;
+    }
+
+    /* Stores voice */
+    sstSoundSystem.astVoiceList[i].pstSound   = pstSound;
+    sstSoundSystem.astVoiceList[i].fPriority  = fPriority;
+    sstSoundSystem.astVoiceList[i].fLeftGain  = fLeftGain;
+    sstSoundSystem.astVoiceList[i].fRightGain = fRightGain;
+    orxFLAG_SET(pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_VOICE, orxSOUNDSYSTEM_KU32_SOUND_FLAG_NONE);
+
+    /* Pool is full? */
+    if(u32VoiceCounter == sstSoundSystem.u32VoiceNumber)
+    {
+      orxU32 j;
+
+      /* Finds weakest voice */
+      for(j = 1, u32MinVoice = 0; j < u32VoiceCounter; j++)
+      {
+        if(sstSoundSystem.astVoiceList[j].fPriority < sstSoundSystem.astVoiceList[u32MinVoice].fPriority)
+        {
+          u32MinVoice = j;
+        }
+      }
+    }
+  }
+
+  /* Gets mixing start time */
+  dStartTime = orxSoundSystem_Software_GetTime();
+
+  /* For all voices */
+  for(i = 0; i < u32VoiceCounter; i++)
+  {
+    orxSOUNDSYSTEM_SOUND *pstSound;
+
+    /* Gets sound */
+    pstSound = sstSoundSystem.astVoiceList[i].pstSound;
+
+    /* Mixes it & clears its voice */
+    if(orxSoundSystem_Software_MixVoice(&(sstSoundSystem.astVoiceList[i])) != orxFALSE)
+    {
+      orxFLAG_SET(pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_NONE, orxSOUNDSYSTEM_KU32_SOUND_FLAG_VOICE);
+    }
+    else
+    {
+      /* Stops it */
+      orxLinkList_Remove(&(pstSound->stNode));
+      orxFLAG_SET(pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_NONE, orxSOUNDSYSTEM_KU32_SOUND_FLAG_VOICE | orxSOUNDSYSTEM_KU32_SOUND_FLAG_PLAY);
+      pstSound->u64Cursor = 0;
+    }
+  }
+
+  /* Updates mixing stats */
+  sstSoundSystem.dMixTime            += orxSoundSystem_Software_GetTime() - dStartTime;
+  sstSoundSystem.u32VoiceCounter     += u32VoiceCounter;
+  sstSoundSystem.u32PeakVoiceCounter  = orxMAX(sstSoundSystem.u32PeakVoiceCounter, u32VoiceCounter);
+  sstSoundSystem.u32BlockCounter++;
+
+  /* For all remaining sounds (virtual or culled) */
+  for(pstNode = orxLinkList_GetFirst(&(sstSoundSystem.stPlayList)); pstNode != orxNULL;)
+  {
+    orxSOUNDSYSTEM_SOUND *pstSound;
+
+    /* Gets sound & next node */
+    pstSound  = (orxSOUNDSYSTEM_SOUND *)pstNode;
+    pstNode   = orxLinkList_GetNext(pstNode);
+
+    /* Not mixed in this block? */
+    if(!orxFLAG_TEST(pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_VOICE))
+    {
+      /* Updates counter */
+      u32SilentCounter++;
+
+      /* Advances it */
+      if(orxSoundSystem_Software_Advance(pstSound, orxSoundSystem_Software_GetStep(pstSound) * (orxU64)sstSoundSystem.u32BlockSize) == orxFALSE)
+      {
+        /* Stops it */
+        orxLinkList_Remove(&(pstSound->stNode));
+        orxFLAG_SET(pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_NONE, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PLAY);
+        pstSound->u64Cursor = 0;
+      }
+    }
+  }
+
+  /* Updates culling stats */
+  sstSoundSystem.u32CulledCounter  += u32CulledCounter;
+  sstSoundSystem.u32VirtualCounter += u32SilentCounter - u32CulledCounter;
+
+#if (orxSOUNDSYSTEM_KU32_WIDTH > 1)
+
+  {
+    orxSOUNDSYSTEM_VEC vMin, vMax;
+
+    /* Gets limits */
+    vMin = orxSOUNDSYSTEM_SET(orx2F(-32768.0f));
+    vMax = orxSOUNDSYSTEM_SET(orx2F(32767.0f));
+
+    /* Clamps mix */
+    for(i = 0; i < u32SampleNumber; i += orxSOUNDSYSTEM_KU32_WIDTH)
+    {
+      orxSOUNDSYSTEM_STORE(sstSoundSystem.afMixBuffer + i, orxSOUNDSYSTEM_MIN(orxSOUNDSYSTEM_MAX(orxSOUNDSYSTEM_LOAD(sstSoundSystem.afMixBuffer + i), vMin), vMax));
+    }
+  }
+
+#else /* orxSOUNDSYSTEM_KU32_WIDTH > 1 */
+
+  /* Clamps mix */
+  for(i = 0; i < u32SampleNumber; i++)
+  {
+    sstSoundSystem.afMixBuffer[i] = orxCLAMP(sstSoundSystem.afMixBuffer[i], orx2F(-32768.0f), orx2F(32767.0f));
+  }
+
+#endif /* orxSOUNDSYSTEM_KU32_WIDTH > 1 */
+
+  /* Converts it */
+  for(i = 0; i < u32SampleNumber; i++)
+  {
+    sstSoundSystem.as16OutputBuffer[i] = (orxS16)sstSoundSystem.afMixBuffer[i];
+  }
+
+  return;
+}
+
+/** Writes a WAV header
+ * @param[in]   _u32DataSize      Size of the data chunk
+ */
+static void orxFASTCALL orxSoundSystem_Software_WriteWAVHeader(orxU32 _u32DataSize)
+{
+  orxU8 au8Header[orxSOUNDSYSTEM_KU32_WAV_HEADER_SIZE];
+
+  /* Fills header */
+  orxMemory_Copy(au8Header, "RIFF", 4);
+  orxSoundSystem_Software_WriteU32(au8Header + 4, orxSOUNDSYSTEM_KU32_WAV_HEADER_SIZE - 8 + _u32DataSize);
+  orxMemory_Copy(au8Header + 8, "WAVEfmt ", 8);
+  orxSoundSystem_Software_WriteU32(au8Header + 16, 16);
+  orxSoundSystem_Software_WriteU16(au8Header + 20, orxSOUNDSYSTEM_KU32_WAV_FORMAT_PCM);
+  orxSoundSystem_Software_WriteU16(au8Header + 22, orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER);
+  orxSoundSystem_Software_WriteU32(au8Header + 24, sstSoundSystem.u32Frequency);
+  orxSoundSystem_Software_WriteU32(au8Header + 28, sstSoundSystem.u32Frequency * orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER * sizeof(orxS16));
+  orxSoundSystem_Software_WriteU16(au8Header + 32, orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER * sizeof(orxS16));
+  orxSoundSystem_Software_WriteU16(au8Header + 34, 16);
+  orxMemory_Copy(au8Header + 36, "data", 4);
+  orxSoundSystem_Software_WriteU32(au8Header + 40, _u32DataSize);
+
+  /* Writes it */
+  fseek(sstSoundSystem.pstWAVFile, 0, SEEK_SET);
+  fwrite(au8Header, 1, orxSOUNDSYSTEM_KU32_WAV_HEADER_SIZE, sstSoundSystem.pstWAVFile);
+
+  return;
+}
+
+/** Opens output
+ * @param[in]   _zOutput          Output name, orxNULL for default
+ * @param[in]   _zOutputFile      WAV output file name
+ * @param[in]   _zDevice          ALSA device name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxSoundSystem_Software_OpenOutput(const orxSTRING _zOutput, const orxSTRING _zOutputFile, const orxSTRING _zDevice)
+{
+  orxCHAR   acOutput[8];
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Gets lower case output name */
+  orxString_NCopy(acOutput, (_zOutput != orxNULL) ? _zOutput : orxSTRING_EMPTY, 7);
+  acOutput[7] = orxCHAR_NULL;
+  orxString_LowerCase(acOutput);
+
+  /* WAV? */
+  if((_zOutput != orxNULL) && (orxString_Compare(acOutput, orxSOUNDSYSTEM_KZ_OUTPUT_WAV) == 0))
+  {
+    /* Opens file */
+    sstSoundSystem.pstWAVFile = fopen(_zOutputFile, "wb");
+
+    /* Success? */
+    if(sstSoundSystem.pstWAVFile != orxNULL)
+    {
+      /* Writes temporary header */
+      orxSoundSystem_Software_WriteWAVHeader(0);
+
+      /* Updates status */
+      sstSoundSystem.eOutput        = orxSOUNDSYSTEM_OUTPUT_WAV;
+      sstSoundSystem.u32WAVDataSize = 0;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Can't open WAV output <%s>.", _zOutputFile);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  /* Null? */
+  else if((_zOutput != orxNULL) && (orxString_Compare(acOutput, orxSOUNDSYSTEM_KZ_OUTPUT_NULL) == 0))
+  {
+    /* Updates status */
+    sstSoundSystem.eOutput = orxSOUNDSYSTEM_OUTPUT_NULL;
+  }
+  else
+  {
+#ifdef __orxSOUNDSYSTEM_ALSA__
+
+    /* Loads ALSA */
+    sstSoundSystem.hALSALibrary = dlopen(orxSOUNDSYSTEM_KZ_ALSA_LIBRARY, RTLD_NOW | RTLD_LOCAL);
+
+    /* Success? */
+    if(sstSoundSystem.hALSALibrary != orxNULL)
+    {
+      orxSOUNDSYSTEM_ALSA_OPEN        pfnOpen;
+      orxSOUNDSYSTEM_ALSA_SET_PARAMS  pfnSetParams;
+
+      /* Gets functions */
+      pfnOpen                       = (orxSOUNDSYSTEM_ALSA_OPEN)dlsym(sstSoundSystem.hALSALibrary, "snd_pcm_open");
+      pfnSetParams                  = (orxSOUNDSYSTEM_ALSA_SET_PARAMS)dlsym(sstSoundSystem.hALSALibrary, "snd_pcm_set_params");
+      sstSoundSystem.pfnALSAWrite   = (orxSOUNDSYSTEM_ALSA_WRITE)dlsym(sstSoundSystem.hALSALibrary, "snd_pcm_writei");
+      sstSoundSystem.pfnALSARecover = (orxSOUNDSYSTEM_ALSA_RECOVER)dlsym(sstSoundSystem.hALSALibrary, "snd_pcm_recover");
+      sstSoundSystem.pfnALSAClose   = (orxSOUNDSYSTEM_ALSA_CLOSE)dlsym(sstSoundSystem.hALSALibrary, "snd_pcm_close");
+
+      /* Opens & setups device */
+      if((pfnOpen != orxNULL)
+      && (pfnSetParams != orxNULL)
+      && (sstSoundSystem.pfnALSAWrite != orxNULL)
+      && (sstSoundSystem.pfnALSARecover != orxNULL)
+      && (sstSoundSystem.pfnALSAClose != orxNULL)
+      && (pfnOpen(&(sstSoundSystem.pstPCM), _zDevice, orxSOUNDSYSTEM_KS32_ALSA_STREAM_PLAYBACK, 0) == 0))
+      {
+        /* Setups device */
+        if(pfnSetParams(sstSoundSystem.pstPCM, orxSOUNDSYSTEM_KS32_ALSA_FORMAT_S16_LE, orxSOUNDSYSTEM_KS32_ALSA_ACCESS_INTERLEAVED, orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER, (unsigned int)sstSoundSystem.u32Frequency, 1, (unsigned int)((orxU64)orxSOUNDSYSTEM_KU32_ALSA_LATENCY_BLOCK * sstSoundSystem.u32BlockSize * 1000000 / sstSoundSystem.u32Frequency)) == 0)
+        {
+          /* Updates status */
+          sstSoundSystem.eOutput = orxSOUNDSYSTEM_OUTPUT_ALSA;
+        }
+        else
+        {
+          /* Closes device */
+          sstSoundSystem.pfnALSAClose(sstSoundSystem.pstPCM);
+          sstSoundSystem.pstPCM = orxNULL;
+        }
+      }
+
+      /* Failure? */
+      if(sstSoundSystem.eOutput != orxSOUNDSYSTEM_OUTPUT_ALSA)
+      {
+        /* Unloads ALSA */
+        dlclose(sstSoundSystem.hALSALibrary);
+        sstSoundSystem.hALSALibrary = orxNULL;
+      }
+    }
+
+#endif /* __orxSOUNDSYSTEM_ALSA__ */
+
+    /* No audio device? */
+    if(sstSoundSystem.eOutput != orxSOUNDSYSTEM_OUTPUT_ALSA)
+    {
+      /* Explicitly requested? */
+      if(_zOutput != orxNULL)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Can't open audio output <%s> on device <%s>, using null output.", _zOutput, _zDevice);
+      }
+
+      /* Falls back to null output */
+      sstSoundSystem.eOutput = orxSOUNDSYSTEM_OUTPUT_NULL;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Closes output
+ */
+static void orxFASTCALL orxSoundSystem_Software_CloseOutput()
+{
+  /* Depending on output */
+  switch(sstSoundSystem.eOutput)
+  {
+    case orxSOUNDSYSTEM_OUTPUT_WAV:
+    {
+      /* Updates header */
+      orxSoundSystem_Software_WriteWAVHeader(sstSoundSystem.u32WAVDataSize);
+
+      /* Closes file */
+      fclose(sstSoundSystem.pstWAVFile);
+      sstSoundSystem.pstWAVFile = orxNULL;
+
+      break;
+    }
+
+#ifdef __orxSOUNDSYSTEM_ALSA__
+
+    case orxSOUNDSYSTEM_OUTPUT_ALSA:
+    {
+      /* Closes device */
+      sstSoundSystem.pfnALSAClose(sstSoundSystem.pstPCM);
+      sstSoundSystem.pstPCM = orxNULL;
+
+      /* Unloads ALSA */
+      dlclose(sstSoundSystem.hALSALibrary);
+      sstSoundSystem.hALSALibrary = orxNULL;
+
+      break;
+    }
+
+#endif /* __orxSOUNDSYSTEM_ALSA__ */
+
+    default:
+    {
+      break;
+    }
+  }
+
+  /* Updates status */
+  sstSoundSystem.eOutput = orxSOUNDSYSTEM_OUTPUT_NONE;
+
+  return;
+}
+
+/** Sends the output buffer to the output
+ * @return orxTRUE if the output is paced by a device, orxFALSE if the mixer thread has to pace itself
+ */
+static orxBOOL orxFASTCALL orxSoundSystem_Software_WriteOutput()
+{
+  orxBOOL bResult = orxFALSE;
+
+  /* Depending on output */
+  switch(sstSoundSystem.eOutput)
+  {
+    case orxSOUNDSYSTEM_OUTPUT_WAV:
+    {
+      /* Writes block */
+      sstSoundSystem.u32WAVDataSize += (orxU32)fwrite(sstSoundSystem.as16OutputBuffer, orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER * sizeof(orxS16), sstSoundSystem.u32BlockSize, sstSoundSystem.pstWAVFile) * orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER * sizeof(orxS16);
+
+      break;
+    }
+
+#ifdef __orxSOUNDSYSTEM_ALSA__
+
+    case orxSOUNDSYSTEM_OUTPUT_ALSA:
+    {
+      long lResult;
+
+      /* Writes block (blocks till the device can take it) */
+      lResult = sstSoundSystem.pfnALSAWrite(sstSoundSystem.pstPCM, sstSoundSystem.as16OutputBuffer, (unsigned long)sstSoundSystem.u32BlockSize);
+
+      /* Underrun or suspended? */
+      if(lResult < 0)
+      {
+        /* Recovers & retries once */
+        if(sstSoundSystem.pfnALSARecover(sstSoundSystem.pstPCM, (int)lResult, 1) == 0)
+        {
+          sstSoundSystem.pfnALSAWrite(sstSoundSystem.pstPCM, sstSoundSystem.as16OutputBuffer, (unsigned long)sstSoundSystem.u32BlockSize);
+        }
+      }
+
+      /* Updates result */
+      bResult = orxTRUE;
+
+      break;
+    }
+
+#endif /* __orxSOUNDSYSTEM_ALSA__ */
+
+    default:
+    {
+      break;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Runs mixer, till stop is requested
+ */
+static void orxFASTCALL orxSoundSystem_Software_Run()
+{
+  orxDOUBLE dBlockDuration, dNextTime;
+
+  /* Gets block duration */
+  dBlockDuration = (orxDOUBLE)sstSoundSystem.u32BlockSize / (orxDOUBLE)sstSoundSystem.u32Frequency;
+
+  /* Gets first deadline */
+  dNextTime = orxSoundSystem_Software_GetTime();
+
+  /* Locks play list */
+  orxSoundSystem_Software_Lock();
+
+  /* While not requested to stop */
+  while(!orxFLAG_TEST(sstSoundSystem.u32Flags, orxSOUNDSYSTEM_KU32_STATIC_FLAG_STOP))
+  {
+    /* Mixes a block */
+    orxSoundSystem_Software_MixBlock();
+
+    /* Unlocks play list */
+    orxSoundSystem_Software_Unlock();
+
+    /* Not paced by its output? */
+    if(orxSoundSystem_Software_WriteOutput() == orxFALSE)
+    {
+      orxDOUBLE dDelay;
+
+      /* Gets delay till next block */
+      dNextTime  += dBlockDuration;
+      dDelay      = dNextTime - orxSoundSystem_Software_GetTime();
+
+      /* Early? */
+      if(dDelay > 0.0)
+      {
+        /* Waits */
+        orxSystem_Delay((orxFLOAT)dDelay);
+      }
+      /* Too late? */
+      else if(dDelay < -(orxDOUBLE)orxSOUNDSYSTEM_KU32_MAX_LATE_BLOCK * dBlockDuration)
+      {
+        /* Resyncs instead of catching up with a burst of blocks */
+        dNextTime = orxSoundSystem_Software_GetTime();
+      }
+    }
+
+    /* Locks play list */
+    orxSoundSystem_Software_Lock();
+  }
+
+  /* Unlocks play list */
+  orxSoundSystem_Software_Unlock();
+
+  return;
+}
+
+#ifdef __orxWINDOWS__
+
+/** Mixer thread entry point
+ */
+static DWORD WINAPI orxSoundSystem_Software_ThreadMain(LPVOID _pContext)
+{
+  /* Runs mixer */
+  orxSoundSystem_Software_Run();
+
+  /* Done! */
+  return 0;
+}
+
+#else /* __orxWINDOWS__ */
+
+/** Mixer thread entry point
+ */
+static void *orxSoundSystem_Software_ThreadMain(void *_pContext)
+{
+  /* Runs mixer */
+  orxSoundSystem_Software_Run();
+
+  /* Done! */
+  return orxNULL;
+}
+
+#endif /* __orxWINDOWS__ */
+
+/** Starts mixer thread
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxSoundSystem_Software_StartThread()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+#ifdef __orxWINDOWS__
+
+  /* Creates mutex */
+  InitializeCriticalSection(&(sstSoundSystem.stMutex));
+
+  /* Creates thread */
+  sstSoundSystem.hThread = CreateThread(NULL, 0, orxSoundSystem_Software_ThreadMain, orxNULL, 0, NULL);
+
+  /* Success? */
+  if(sstSoundSystem.hThread != NULL)
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Deletes mutex */
+    DeleteCriticalSection(&(sstSoundSystem.stMutex));
+  }
+
+#else /* __orxWINDOWS__ */
+
+  /* Creates mutex */
+  pthread_mutex_init(&(sstSoundSystem.stMutex), NULL);
+
+  /* Creates thread */
+  if(pthread_create(&(sstSoundSystem.hThread), NULL, orxSoundSystem_Software_ThreadMain, orxNULL) == 0)
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Deletes mutex */
+    pthread_mutex_destroy(&(sstSoundSystem.stMutex));
+  }
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops mixer thread
+ */
+static void orxFASTCALL orxSoundSystem_Software_StopThread()
+{
+  /* Requests stop */
+  orxSoundSystem_Software_Lock();
+  orxFLAG_SET(sstSoundSystem.u32Flags, orxSOUNDSYSTEM_KU32_STATIC_FLAG_STOP, orxSOUNDSYSTEM_KU32_STATIC_FLAG_NONE);
+  orxSoundSystem_Software_Unlock();
+
+#ifdef __orxWINDOWS__
+
+  /* Waits for thread */
+  WaitForSingleObject(sstSoundSystem.hThread, INFINITE);
+
+  /* Deletes thread & mutex */
+  CloseHandle(sstSoundSystem.hThread);
+  DeleteCriticalSection(&(sstSoundSystem.stMutex));
+
+#else /* __orxWINDOWS__ */
+
+  /* Waits for thread */
+  pthread_join(sstSoundSystem.hThread, NULL);
+
+  /* Deletes mutex */
+  pthread_mutex_destroy(&(sstSoundSystem.stMutex));
+
+#endif /* __orxWINDOWS__ */
+
+  return;
+}
+
+/** Deletes mixing buffers
+ */
+static void orxFASTCALL orxSoundSystem_Software_DeleteBuffers()
+{
+  /* Deletes all buffers */
+  if(sstSoundSystem.astVoiceList != orxNULL)
+  {
+    orxMemory_Free(sstSoundSystem.astVoiceList);
+    sstSoundSystem.astVoiceList = orxNULL;
+  }
+  if(sstSoundSystem.afMixBuffer != orxNULL)
+  {
+    orxMemory_Free(sstSoundSystem.afMixBuffer);
+    sstSoundSystem.afMixBuffer = orxNULL;
+  }
+  if(sstSoundSystem.as16OutputBuffer != orxNULL)
+  {
+    orxMemory_Free(sstSoundSystem.as16OutputBuffer);
+    sstSoundSystem.as16OutputBuffer = orxNULL;
+  }
+
+  /* Resampling buffers were allocated along with the mix one */
+  sstSoundSystem.afSourceBuffer   = orxNULL;
+  sstSoundSystem.afNextBuffer     = orxNULL;
+  sstSoundSystem.afFractionBuffer = orxNULL;
+
+  return;
+}
+
+
+/***************************************************************************
+ * Plugin functions                                                        *
+ ***************************************************************************/
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_Init()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Was already initialized. */
+  if(!(sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY))
+  {
+    orxSTRING zOutput, zOutputFile, zDevice;
+    orxFLOAT  fRatio;
+    orxU32    u32SampleNumber;
+
+    /* Cleans static controller */
+    orxMemory_Zero(&sstSoundSystem, sizeof(orxSOUNDSYSTEM_STATIC));
+
+    /* Pushes config section */
+    orxConfig_PushSection(orxSOUNDSYSTEM_KZ_CONFIG_SECTION);
+
+    /* Gets dimension ratio */
+    fRatio = orxConfig_GetFloat(orxSOUNDSYSTEM_KZ_CONFIG_RATIO);
+
+    /* Valid? */
+    if(fRatio > orxFLOAT_0)
+    {
+      /* Stores it */
+      sstSoundSystem.fDimensionRatio = fRatio;
+    }
+    else
+    {
+      /* Stores default one */
+      sstSoundSystem.fDimensionRatio = orxSOUNDSYSTEM_KF_DEFAULT_DIMENSION_RATIO;
+    }
+
+    /* Stores reciprocal dimenstion ratio */
+    sstSoundSystem.fRecDimensionRatio = orxFLOAT_1 / sstSoundSystem.fDimensionRatio;
+
+    /* Gets mixer settings */
+    sstSoundSystem.u32Frequency       = (orxConfig_HasValue(orxSOUNDSYSTEM_KZ_CONFIG_FREQUENCY) != orxFALSE) ? orxConfig_GetU32(orxSOUNDSYSTEM_KZ_CONFIG_FREQUENCY) : orxSOUNDSYSTEM_KU32_DEFAULT_FREQUENCY;
+    sstSoundSystem.u32BlockSize       = (orxConfig_HasValue(orxSOUNDSYSTEM_KZ_CONFIG_BUFFER_SIZE) != orxFALSE) ? orxConfig_GetU32(orxSOUNDSYSTEM_KZ_CONFIG_BUFFER_SIZE) : orxSOUNDSYSTEM_KU32_DEFAULT_BLOCK_SIZE;
+    sstSoundSystem.u32VoiceNumber     = (orxConfig_HasValue(orxSOUNDSYSTEM_KZ_CONFIG_VOICE_NUMBER) != orxFALSE) ? orxConfig_GetU32(orxSOUNDSYSTEM_KZ_CONFIG_VOICE_NUMBER) : orxSOUNDSYSTEM_KU32_DEFAULT_VOICE_NUMBER;
+    sstSoundSystem.fCullingThreshold  = (orxConfig_HasValue(orxSOUNDSYSTEM_KZ_CONFIG_CULLING_THRESHOLD) != orxFALSE) ? orxConfig_GetFloat(orxSOUNDSYSTEM_KZ_CONFIG_CULLING_THRESHOLD) : orxSOUNDSYSTEM_KF_DEFAULT_CULLING_THRESHOLD;
+    zOutput                           = (orxConfig_HasValue(orxSOUNDSYSTEM_KZ_CONFIG_OUTPUT) != orxFALSE) ? orxConfig_GetString(orxSOUNDSYSTEM_KZ_CONFIG_OUTPUT) : orxNULL;
+    zOutputFile                       = (orxConfig_HasValue(orxSOUNDSYSTEM_KZ_CONFIG_OUTPUT_FILE) != orxFALSE) ? orxConfig_GetString(orxSOUNDSYSTEM_KZ_CONFIG_OUTPUT_FILE) : orxSOUNDSYSTEM_KZ_DEFAULT_OUTPUT_FILE;
+    zDevice                           = (orxConfig_HasValue(orxSOUNDSYSTEM_KZ_CONFIG_DEVICE) != orxFALSE) ? orxConfig_GetString(orxSOUNDSYSTEM_KZ_CONFIG_DEVICE) : orxSOUNDSYSTEM_KZ_DEFAULT_DEVICE;
+
+    /* Validates them */
+    sstSoundSystem.u32Frequency       = orxCLAMP(sstSoundSystem.u32Frequency, 8000, 192000);
+    sstSoundSystem.u32BlockSize       = orxMemory_GetAlign(orxCLAMP(sstSoundSystem.u32BlockSize, orxSOUNDSYSTEM_KU32_BLOCK_ALIGNMENT, 16384), orxSOUNDSYSTEM_KU32_BLOCK_ALIGNMENT);
+    sstSoundSystem.u32VoiceNumber     = orxMAX(sstSoundSystem.u32VoiceNumber, 1);
+    sstSoundSystem.fGlobalVolume      = orxFLOAT_1;
+
+    /* Gets sample number */
+    u32SampleNumber = orxSOUNDSYSTEM_KU32_CHANNEL_NUMBER * sstSoundSystem.u32BlockSize;
+
+    /* Creates sound bank, voice pool & buffers (resampling buffers share the mix one's allocation) */
+    sstSoundSystem.pstSoundBank     = orxBank_Create(orxSOUNDSYSTEM_KU32_BANK_SIZE, sizeof(orxSOUNDSYSTEM_SOUND), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstSoundSystem.astVoiceList     = (orxSOUNDSYSTEM_VOICE *)orxMemory_Allocate(sstSoundSystem.u32VoiceNumber * sizeof(orxSOUNDSYSTEM_VOICE), orxMEMORY_TYPE_MAIN);
+    sstSoundSystem.afMixBuffer      = (orxFLOAT *)orxMemory_Allocate(4 * u32SampleNumber * sizeof(orxFLOAT), orxMEMORY_TYPE_MAIN);
+    sstSoundSystem.as16OutputBuffer = (orxS16 *)orxMemory_Allocate(u32SampleNumber * sizeof(orxS16), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if((sstSoundSystem.pstSoundBank != orxNULL)
+    && (sstSoundSystem.astVoiceList != orxNULL)
+    && (sstSoundSystem.afMixBuffer != orxNULL)
+    && (sstSoundSystem.as16OutputBuffer != orxNULL))
+    {
+      /* Stores resampling buffers */
+      sstSoundSystem.afSourceBuffer   = sstSoundSystem.afMixBuffer + u32SampleNumber;
+      sstSoundSystem.afNextBuffer     = sstSoundSystem.afSourceBuffer + u32SampleNumber;
+      sstSoundSystem.afFractionBuffer = sstSoundSystem.afNextBuffer + u32SampleNumber;
+
+      /* Clears output buffer */
+      orxMemory_Zero(sstSoundSystem.as16OutputBuffer, u32SampleNumber * sizeof(orxS16));
+
+      /* Opens output */
+      if(orxSoundSystem_Software_OpenOutput(zOutput, zOutputFile, zDevice) != orxSTATUS_FAILURE)
+      {
+        /* Updates status (before the mixer thread reads its flags) */
+        orxFLAG_SET(sstSoundSystem.u32Flags, orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY, orxSOUNDSYSTEM_KU32_STATIC_MASK_ALL);
+
+        /* Starts mixer */
+        eResult = orxSoundSystem_Software_StartThread();
+
+        /* Failure? */
+        if(eResult == orxSTATUS_FAILURE)
+        {
+          /* Updates status */
+          orxFLAG_SET(sstSoundSystem.u32Flags, orxSOUNDSYSTEM_KU32_STATIC_FLAG_NONE, orxSOUNDSYSTEM_KU32_STATIC_MASK_ALL);
+
+          /* Closes output */
+          orxSoundSystem_Software_CloseOutput();
+        }
+      }
+    }
+
+    /* Failure? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Failed to start software mixer.");
+
+      /* Deletes buffers & bank */
+      orxSoundSystem_Software_DeleteBuffers();
+      if(sstSoundSystem.pstSoundBank != orxNULL)
+      {
+        orxBank_Delete(sstSoundSystem.pstSoundBank);
+        sstSoundSystem.pstSoundBank = orxNULL;
+      }
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+void orxFASTCALL orxSoundSystem_Software_Exit()
+{
+  /* Was initialized? */
+  if(sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY)
+  {
+    static const orxSTRING sazOutputName[orxSOUNDSYSTEM_OUTPUT_NUMBER] = {orxSOUNDSYSTEM_KZ_OUTPUT_NULL, orxSOUNDSYSTEM_KZ_OUTPUT_WAV, orxSOUNDSYSTEM_KZ_OUTPUT_ALSA};
+
+    /* Stops mixer */
+    orxSoundSystem_Software_StopThread();
+
+    /* Logs mixing cost */
+    orxLOG("Software mixer <%s/%s, %lu Hz, %lu voices>: %lu blocks, %lu voices mixed (peak %lu) at %gus per voice per block, %lu virtual, %lu culled.",
+           sazOutputName[sstSoundSystem.eOutput],
+           orxSOUNDSYSTEM_KZ_INSTRUCTION_SET,
+           sstSoundSystem.u32Frequency,
+           sstSoundSystem.u32VoiceNumber,
+           sstSoundSystem.u32BlockCounter,
+           sstSoundSystem.u32VoiceCounter,
+           sstSoundSystem.u32PeakVoiceCounter,
+           (sstSoundSystem.u32VoiceCounter > 0) ? (orxFLOAT)(sstSoundSystem.dMixTime * 1000000.0 / (orxDOUBLE)sstSoundSystem.u32VoiceCounter) : orxFLOAT_0,
+           sstSoundSystem.u32VirtualCounter,
+           sstSoundSystem.u32CulledCounter);
+
+    /* Closes output */
+    orxSoundSystem_Software_CloseOutput();
+
+    /* Deletes buffers & bank */
+    orxSoundSystem_Software_DeleteBuffers();
+    orxBank_Delete(sstSoundSystem.pstSoundBank);
+
+    /* Cleans static controller */
+    orxMemory_Zero(&sstSoundSystem, sizeof(orxSOUNDSYSTEM_STATIC));
+  }
+
+  return;
+}
+
+orxSOUNDSYSTEM_SAMPLE *orxFASTCALL orxSoundSystem_Software_LoadSample(const orxSTRING _zFilename)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zFilename != orxNULL);
+
+  /* Done! */
+  return orxSoundSystem_Software_LoadWAV(_zFilename, orxFALSE);
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_UnloadSample(orxSOUNDSYSTEM_SAMPLE *_pstSample)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSample != orxNULL);
+
+  /* Deletes it */
+  orxSoundSystem_Software_DeleteSample(_pstSample);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxU32 orxFASTCALL orxSoundSystem_Software_GetSampleSize(const orxSOUNDSYSTEM_SAMPLE *_pstSample)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSample != orxNULL);
+
+  /* Done! */
+  return _pstSample->u32FrameNumber * _pstSample->u32ChannelNumber * sizeof(orxS16);
+}
+
+/** Creates a sound
+ * @param[in]   _pstSample        Played sample
+ * @param[in]   _u32Flags         Sound flags
+ * @return orxSOUNDSYSTEM_SOUND / orxNULL
+ */
+static orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_Software_CreateSound(const orxSOUNDSYSTEM_SAMPLE *_pstSample, orxU32 _u32Flags)
+{
+  orxSOUNDSYSTEM_SOUND *pstResult;
+
+  /* Creates result */
+  pstResult = (orxSOUNDSYSTEM_SOUND *)orxBank_Allocate(sstSoundSystem.pstSoundBank);
+
+  /* Valid? */
+  if(pstResult != orxNULL)
+  {
+    /* Inits it */
+    orxMemory_Zero(pstResult, sizeof(orxSOUNDSYSTEM_SOUND));
+    pstResult->pstSample          = _pstSample;
+    pstResult->fVolume            = orxFLOAT_1;
+    pstResult->fPitch             = orxFLOAT_1;
+    pstResult->fAttenuation       = orxFLOAT_1;
+    pstResult->fReferenceDistance = orxFLOAT_1;
+    pstResult->u32Flags           = _u32Flags;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_Software_CreateFromSample(const orxSOUNDSYSTEM_SAMPLE *_pstSample)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSample != orxNULL);
+
+  /* Done! */
+  return orxSoundSystem_Software_CreateSound(_pstSample, orxSOUNDSYSTEM_KU32_SOUND_FLAG_NONE);
+}
+
+orxSOUNDSYSTEM_SOUND *orxFASTCALL orxSoundSystem_Software_CreateStreamFromFile(const orxSTRING _zFilename)
+{
+  orxSOUNDSYSTEM_SAMPLE  *pstSample;
+  orxSOUNDSYSTEM_SOUND   *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zFilename != orxNULL);
+
+  /* Loads it, reading frames in place when possible: pages get streamed in by the OS when they're played */
+  pstSample = orxSoundSystem_Software_LoadWAV(_zFilename, orxTRUE);
+
+  /* Success? */
+  if(pstSample != orxNULL)
+  {
+    /* Creates sound */
+    pstResult = orxSoundSystem_Software_CreateSound(pstSample, orxSOUNDSYSTEM_KU32_SOUND_FLAG_STREAM);
+
+    /* Failure? */
+    if(pstResult == orxNULL)
+    {
+      /* Deletes sample */
+      orxSoundSystem_Software_DeleteSample(pstSample);
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_Delete(orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Removes it from the play list */
+  orxSoundSystem_Software_Lock();
+  if(orxFLAG_TEST(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PLAY))
+  {
+    orxLinkList_Remove(&(_pstSound->stNode));
+  }
+  orxSoundSystem_Software_Unlock();
+
+  /* Is a stream? */
+  if(orxFLAG_TEST(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_STREAM))
+  {
+    /* Deletes its sample */
+    orxSoundSystem_Software_DeleteSample((orxSOUNDSYSTEM_SAMPLE *)_pstSound->pstSample);
+  }
+
+  /* Deletes it */
+  orxBank_Free(sstSoundSystem.pstSoundBank, _pstSound);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_Play(orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Locks play list */
+  orxSoundSystem_Software_Lock();
+
+  /* Not playing? */
+  if(!orxFLAG_TEST(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PLAY))
+  {
+    /* Adds it to the play list */
+    orxLinkList_AddEnd(&(sstSoundSystem.stPlayList), &(_pstSound->stNode));
+    orxFLAG_SET(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PLAY, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PAUSE);
+  }
+
+  /* Unlocks play list */
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_Pause(orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Locks play list */
+  orxSoundSystem_Software_Lock();
+
+  /* Playing? */
+  if(orxFLAG_TEST(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PLAY))
+  {
+    /* Removes it from the play list, keeping its cursor */
+    orxLinkList_Remove(&(_pstSound->stNode));
+    orxFLAG_SET(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PAUSE, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PLAY);
+  }
+
+  /* Unlocks play list */
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_Stop(orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Locks play list */
+  orxSoundSystem_Software_Lock();
+
+  /* Playing? */
+  if(orxFLAG_TEST(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PLAY))
+  {
+    /* Removes it from the play list */
+    orxLinkList_Remove(&(_pstSound->stNode));
+  }
+
+  /* Rewinds it */
+  orxFLAG_SET(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_NONE, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PLAY | orxSOUNDSYSTEM_KU32_SOUND_FLAG_PAUSE);
+  _pstSound->u64Cursor = 0;
+
+  /* Unlocks play list */
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_SetVolume(orxSOUNDSYSTEM_SOUND *_pstSound, orxFLOAT _fVolume)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Stores it */
+  orxSoundSystem_Software_Lock();
+  _pstSound->fVolume = orxMAX(_fVolume, orxFLOAT_0);
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_SetPitch(orxSOUNDSYSTEM_SOUND *_pstSound, orxFLOAT _fPitch)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Stores it */
+  orxSoundSystem_Software_Lock();
+  _pstSound->fPitch = orxMAX(_fPitch, orxFLOAT_0);
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_SetPosition(orxSOUNDSYSTEM_SOUND *_pstSound, const orxVECTOR *_pvPosition)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+  orxASSERT(_pvPosition != orxNULL);
+
+  /* Stores it */
+  orxSoundSystem_Software_Lock();
+  orxVector_Mulf(&(_pstSound->vPosition), _pvPosition, sstSoundSystem.fDimensionRatio);
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_SetAttenuation(orxSOUNDSYSTEM_SOUND *_pstSound, orxFLOAT _fAttenuation)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Stores it */
+  orxSoundSystem_Software_Lock();
+  _pstSound->fAttenuation = orxMAX(_fAttenuation, orxFLOAT_0);
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_SetReferenceDistance(orxSOUNDSYSTEM_SOUND *_pstSound, orxFLOAT _fDistance)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Stores it */
+  orxSoundSystem_Software_Lock();
+  _pstSound->fReferenceDistance = orxMAX(_fDistance, orxFLOAT_0);
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_Loop(orxSOUNDSYSTEM_SOUND *_pstSound, orxBOOL _bLoop)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Updates status */
+  orxSoundSystem_Software_Lock();
+  if(_bLoop != orxFALSE)
+  {
+    orxFLAG_SET(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_LOOP, orxSOUNDSYSTEM_KU32_SOUND_FLAG_NONE);
+  }
+  else
+  {
+    orxFLAG_SET(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_NONE, orxSOUNDSYSTEM_KU32_SOUND_FLAG_LOOP);
+  }
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxFLOAT orxFASTCALL orxSoundSystem_Software_GetVolume(const orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Done! */
+  return _pstSound->fVolume;
+}
+
+orxFLOAT orxFASTCALL orxSoundSystem_Software_GetPitch(const orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Done! */
+  return _pstSound->fPitch;
+}
+
+orxVECTOR *orxFASTCALL orxSoundSystem_Software_GetPosition(const orxSOUNDSYSTEM_SOUND *_pstSound, orxVECTOR *_pvPosition)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+  orxASSERT(_pvPosition != orxNULL);
+
+  /* Done! */
+  return orxVector_Mulf(_pvPosition, &(_pstSound->vPosition), sstSoundSystem.fRecDimensionRatio);
+}
+
+orxFLOAT orxFASTCALL orxSoundSystem_Software_GetAttenuation(const orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Done! */
+  return _pstSound->fAttenuation;
+}
+
+orxFLOAT orxFASTCALL orxSoundSystem_Software_GetReferenceDistance(const orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Done! */
+  return _pstSound->fReferenceDistance;
+}
+
+orxBOOL orxFASTCALL orxSoundSystem_Software_IsLooping(const orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Done! */
+  return orxFLAG_TEST(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_LOOP) ? orxTRUE : orxFALSE;
+}
+
+orxFLOAT orxFASTCALL orxSoundSystem_Software_GetDuration(const orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Done! */
+  return orxU2F(_pstSound->pstSample->u32FrameNumber) / orxU2F(_pstSound->pstSample->u32Frequency);
+}
+
+orxSOUNDSYSTEM_STATUS orxFASTCALL orxSoundSystem_Software_GetStatus(const orxSOUNDSYSTEM_SOUND *_pstSound)
+{
+  orxSOUNDSYSTEM_STATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSound != orxNULL);
+
+  /* Locks play list (sounds get stopped by the mixer thread when they end) */
+  orxSoundSystem_Software_Lock();
+
+  /* Playing? */
+  if(orxFLAG_TEST(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PLAY))
+  {
+    /* Updates result */
+    eResult = orxSOUNDSYSTEM_STATUS_PLAY;
+  }
+  /* Paused? */
+  else if(orxFLAG_TEST(_pstSound->u32Flags, orxSOUNDSYSTEM_KU32_SOUND_FLAG_PAUSE))
+  {
+    /* Updates result */
+    eResult = orxSOUNDSYSTEM_STATUS_PAUSE;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSOUNDSYSTEM_STATUS_STOP;
+  }
+
+  /* Unlocks play list */
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_SetGlobalVolume(orxFLOAT _fVolume)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+
+  /* Stores it */
+  orxSoundSystem_Software_Lock();
+  sstSoundSystem.fGlobalVolume = orxMAX(_fVolume, orxFLOAT_0);
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxFLOAT orxFASTCALL orxSoundSystem_Software_GetGlobalVolume()
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstSoundSystem.fGlobalVolume;
+}
+
+orxSTATUS orxFASTCALL orxSoundSystem_Software_SetListenerPosition(const orxVECTOR *_pvPosition)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvPosition != orxNULL);
+
+  /* Stores it */
+  orxSoundSystem_Software_Lock();
+  orxVector_Mulf(&(sstSoundSystem.vListenerPosition), _pvPosition, sstSoundSystem.fDimensionRatio);
+  orxSoundSystem_Software_Unlock();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxVECTOR *orxFASTCALL orxSoundSystem_Software_GetListenerPosition(orxVECTOR *_pvPosition)
+{
+  /* Checks */
+  orxASSERT((sstSoundSystem.u32Flags & orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY) == orxSOUNDSYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvPosition != orxNULL);
+
+  /* Done! */
+  return orxVector_Mulf(_pvPosition, &(sstSoundSystem.vListenerPosition), sstSoundSystem.fRecDimensionRatio);
+}
+
+
+/***************************************************************************
+ * Plugin related                                                          *
+ ***************************************************************************/
+
+orxPLUGIN_USER_CORE_FUNCTION_START(SOUNDSYSTEM);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_Init, SOUNDSYSTEM, INIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_Exit, SOUNDSYSTEM, EXIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_LoadSample, SOUNDSYSTEM, LOAD_SAMPLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_UnloadSample, SOUNDSYSTEM, UNLOAD_SAMPLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_GetSampleSize, SOUNDSYSTEM, GET_SAMPLE_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_CreateFromSample, SOUNDSYSTEM, CREATE_FROM_SAMPLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_CreateStreamFromFile, SOUNDSYSTEM, CREATE_STREAM_FROM_FILE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_Delete, SOUNDSYSTEM, DELETE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_Play, SOUNDSYSTEM, PLAY);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_Pause, SOUNDSYSTEM, PAUSE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_Stop, SOUNDSYSTEM, STOP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_SetVolume, SOUNDSYSTEM, SET_VOLUME);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_SetPitch, SOUNDSYSTEM, SET_PITCH);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_SetPosition, SOUNDSYSTEM, SET_POSITION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_SetAttenuation, SOUNDSYSTEM, SET_ATTENUATION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_SetReferenceDistance, SOUNDSYSTEM, SET_REFERENCE_DISTANCE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_Loop, SOUNDSYSTEM, LOOP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_GetVolume, SOUNDSYSTEM, GET_VOLUME);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_GetPitch, SOUNDSYSTEM, GET_PITCH);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_GetPosition, SOUNDSYSTEM, GET_POSITION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_GetAttenuation, SOUNDSYSTEM, GET_ATTENUATION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_GetReferenceDistance, SOUNDSYSTEM, GET_REFERENCE_DISTANCE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_IsLooping, SOUNDSYSTEM, IS_LOOPING);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_GetDuration, SOUNDSYSTEM, GET_DURATION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_GetStatus, SOUNDSYSTEM, GET_STATUS);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_SetGlobalVolume, SOUNDSYSTEM, SET_GLOBAL_VOLUME);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_GetGlobalVolume, SOUNDSYSTEM, GET_GLOBAL_VOLUME);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_SetListenerPosition, SOUNDSYSTEM, SET_LISTENER_POSITION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxSoundSystem_Software_GetListenerPosition, SOUNDSYSTEM, GET_LISTENER_POSITION);
+orxPLUGIN_USER_CORE_FUNCTION_END();
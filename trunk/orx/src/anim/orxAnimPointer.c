@@ -58,7 +58,7 @@
 
 #define orxANIMPOINTER_KU32_FLAG_HAS_CURRENT_ANIM     0x00000001  /**< Has current animation flag */
 #define orxANIMPOINTER_KU32_FLAG_ANIMSET              0x00000010  /**< Has animset flag */
-#define orxANIMPOINTER_KU32_FLAG_LINK_TABLE           0x00000020  /**< Has link table flag */
+#define orxANIMPOINTER_KU32_FLAG_LOOP_OVERLAY         0x00000020  /**< Has loop overlay flag */
 #define orxANIMPOINTER_KU32_FLAG_PAUSED               0x00000040  /**< Pause flag */
 #define orxANIMPOINTER_KU32_FLAG_INTERNAL             0x10000000  /**< Internal structure handling flag  */
 
@@ -82,7 +82,7 @@ struct __orxANIMPOINTER_t
 {
   orxSTRUCTURE            stStructure;                /**< Public structure, first structure member : 16 */
   orxANIMSET             *pstAnimSet;                 /**< Referenced AnimationSet : 20 */
-  orxANIMSET_LINK_TABLE  *pstLinkTable;               /**< Link table pointer : 24 */
+  orxANIMSET_LOOP_OVERLAY *pstLoopOverlay;            /**< Loop overlay pointer : 24 */
   orxHANDLE               hCurrentAnim;               /**< Current animation ID : 28 */
   orxHANDLE               hTargetAnim;                /**< Target animation ID : 32 */
   orxFLOAT                fCurrentAnimTime;           /**< Current Time (Relative to current animation) : 26 */
@@ -208,7 +208,7 @@ static orxINLINE orxSTATUS orxAnimPointer_Compute(orxANIMPOINTER *_pstAnimPointe
       fTimeBackup = _pstAnimPointer->fCurrentAnimTime;
 
       /* Computes & updates anim*/
-      hNewAnim = orxAnimSet_ComputeAnim(_pstAnimPointer->pstAnimSet, _pstAnimPointer->hCurrentAnim, _pstAnimPointer->hTargetAnim, &(_pstAnimPointer->fCurrentAnimTime), _pstAnimPointer->pstLinkTable, &bCut, &bClearTarget);
+      hNewAnim = orxAnimSet_ComputeAnim(_pstAnimPointer->pstAnimSet, _pstAnimPointer->hCurrentAnim, _pstAnimPointer->hTargetAnim, &(_pstAnimPointer->fCurrentAnimTime), _pstAnimPointer->pstLoopOverlay, &bCut, &bClearTarget);
 
       /* Change happened? */
       if(hNewAnim != _pstAnimPointer->hCurrentAnim)
@@ -477,11 +477,15 @@ orxANIMPOINTER *orxFASTCALL orxAnimPointer_Create(const orxSTRUCTURE *_pstOwner,
     /* Is animset link table non-static? */
     if(orxStructure_TestFlags(_pstAnimSet, orxANIMSET_KU32_FLAG_LINK_STATIC) == orxFALSE)
     {
-      /* Stores link table */
-      pstAnimPointer->pstLinkTable = orxAnimSet_CloneLinkTable(_pstAnimSet);
+      /* Creates loop overlay */
+      pstAnimPointer->pstLoopOverlay = orxAnimSet_CreateLoopOverlay(_pstAnimSet);
 
-      /* Updates flags */
-      orxStructure_SetFlags(pstAnimPointer, orxANIMPOINTER_KU32_FLAG_LINK_TABLE, orxANIMPOINTER_KU32_FLAG_NONE);
+      /* Success? */
+      if(pstAnimPointer->pstLoopOverlay != orxNULL)
+      {
+        /* Updates flags */
+        orxStructure_SetFlags(pstAnimPointer, orxANIMPOINTER_KU32_FLAG_LOOP_OVERLAY, orxANIMPOINTER_KU32_FLAG_NONE);
+      }
     }
   }
   else
@@ -611,11 +615,11 @@ orxSTATUS orxFASTCALL orxAnimPointer_Delete(orxANIMPOINTER *_pstAnimPointer)
       }
     }
 
-    /* Has a link table? */
-    if(orxStructure_TestFlags(_pstAnimPointer, orxANIMPOINTER_KU32_FLAG_LINK_TABLE) != orxFALSE)
+    /* Has a loop overlay? */
+    if(orxStructure_TestFlags(_pstAnimPointer, orxANIMPOINTER_KU32_FLAG_LOOP_OVERLAY) != orxFALSE)
     {
       /* Deletes it */
-      orxAnimSet_DeleteLinkTable(_pstAnimPointer->pstLinkTable);
+      orxAnimSet_DeleteLoopOverlay(_pstAnimPointer->pstLoopOverlay);
     }
 
     /* Deletes structure */
@@ -30,6 +30,7 @@
 #include "anim/orxAnimSet.h"
 
 #include "core/orxConfig.h"
+#include "core/orxEvent.h"
 #include "debug/orxDebug.h"
 #include "memory/orxMemory.h"
 #include "utils/orxHashTable.h"
@@ -84,6 +85,8 @@
 #define orxANIMSET_KU32_LINK_SHIFT_LENGTH             8           /**< Link shift for length */
 #define orxANIMSET_KU32_LINK_SHIFT_PRIORITY           16          /**< Link shift for priority */
 
+#define orxANIMSET_KU32_LINK_MAX_PRIORITY             (orxANIMSET_KU32_LINK_MASK_PRIORITY >> orxANIMSET_KU32_LINK_SHIFT_PRIORITY) /**< Link max priority */
+
 #define orxANIMSET_KU32_LINK_DEFAULT_NONE             0x00000000  /**< Link default : none */
 
 #define orxANIMSET_KU32_LINK_DEFAULT_PRIORITY         0x00000008  /**< Link default priority */
@@ -114,6 +117,8 @@
 #define orxANIMSET_KU32_ID_TABLE_SIZE                 32          /**< ID table size */
 #define orxANIMSET_KU32_REFERENCE_TABLE_SIZE          32          /**< Reference table size */
 
+#define orxANIMSET_KU8_ROUTE_NONE                     0xFF        /**< No route found yet (route search) */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -137,9 +142,25 @@ struct __orxANIMSET_LINK_TABLE_t
 {
   orxU32                 *au32LinkArray;              /**< Link array : 4 */
   orxU8                  *au8LoopArray;               /**< Loop array : 8 */
-  orxU16                  u16LinkCounter;             /**< Link counter : 10 */
-  orxU16                  u16TableSize;               /**< Table size : 12 */
-  orxU32                  u32Flags;                   /**< Flags : 16 */
+  orxU32                 *au32LoopLinkArray;          /**< Sorted indices of links using a loop counter : 12 */
+  orxU16                  u16LinkCounter;             /**< Link counter : 14 */
+  orxU16                  u16TableSize;               /**< Table size : 16 */
+  orxU16                  u16LoopLinkCounter;         /**< Number of links using a loop counter : 18 */
+  orxU32                  u32Flags;                   /**< Flags : 22 */
+  orxU32                  u32Revision;                /**< Incremented each time links are recomputed : 26 */
+};
+
+/** Internal Animation Set Loop overlay structure: per animation pointer loop counters over the shared link table
+ */
+struct __orxANIMSET_LOOP_OVERLAY_t
+{
+  orxU32                 *au32LoopLinkArray;          /**< Sorted indices of counted links (copied from the link table at creation) : 4 */
+  orxU8                  *au8LoopArray;               /**< Remaining loops, one per counted link : 8 */
+  orxU16                  u16LoopLinkCounter;         /**< Number of counted links : 10 */
+  orxU16                  u16BlockedCounter;          /**< Number of links blocked by an exhausted counter : 12 */
+  orxU32                  u32RouteIndex;              /**< Last searched route (source * size + destination) / orxU32_UNDEFINED : 16 */
+  orxU32                  u32RouteAnim;               /**< Last searched route next anim / orxU32_UNDEFINED : 20 */
+  orxU32                  u32Revision;                /**< Link table revision of the last searched route : 24 */
 };
 
 /** AnimSet structure
@@ -151,6 +172,8 @@ struct __orxANIMSET_t
   orxANIMSET_LINK_TABLE  *pstLinkTable;               /**< Link table pointer : 24 */
   orxHASHTABLE           *pstIDTable;                 /**< ID hash table : 28 */
   orxSTRING               zReference;                 /**< Reference : 32 */
+  orxU32                 *au32SectionIDList;          /**< IDs of the config sections it was built from (own, anims & links) : 36 */
+  orxU32                  u32SectionIDCounter;        /**< Number of config section IDs : 40 */
 };
 
 
@@ -921,28 +944,102 @@ static orxANIMSET_LINK_TABLE *orxFASTCALL orxAnimSet_CreateLinkTable(orxU32 _u32
   return pstLinkTable;
 }
 
-/** Copies an AnimSet LinkTable into another one
- * @param[in]   _pstDstLinkTable	            Destination LinkTable
- * @param[in]   _pstSrcLinkTable							Source LinkTable
+/** Deletes a LinkTable
+ * @param[in]   _pstLinkTable	                LinkTable to delete
  */
-static orxINLINE void orxAnimSet_CopyLinkTable(orxANIMSET_LINK_TABLE *_pstDstLinkTable, const orxANIMSET_LINK_TABLE *_pstSrcLinkTable)
+static orxINLINE void orxAnimSet_DeleteLinkTable(orxANIMSET_LINK_TABLE *_pstLinkTable)
 {
   /* Checks */
-  orxASSERT(_pstSrcLinkTable != orxNULL);
-  orxASSERT(_pstDstLinkTable != orxNULL);
+  orxASSERT(_pstLinkTable != orxNULL);
 
-  /* Copies all */
-  _pstDstLinkTable->u32Flags       = _pstSrcLinkTable->u32Flags;
-  _pstDstLinkTable->u16LinkCounter = _pstSrcLinkTable->u16LinkCounter;
-  _pstDstLinkTable->u16TableSize   = _pstSrcLinkTable->u16TableSize;
+  /* Has loop link array? */
+  if(_pstLinkTable->au32LoopLinkArray != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(_pstLinkTable->au32LoopLinkArray);
+  }
 
-  /* Copies tables */
-  orxMemory_Copy(_pstDstLinkTable->au32LinkArray, _pstSrcLinkTable->au32LinkArray, (orxU32)(_pstSrcLinkTable->u16TableSize) * (orxU32)(_pstSrcLinkTable->u16TableSize) * sizeof(orxU32));
-  orxMemory_Copy(_pstDstLinkTable->au8LoopArray, _pstSrcLinkTable->au8LoopArray, (orxU32)(_pstSrcLinkTable->u16TableSize) * (orxU32)(_pstSrcLinkTable->u16TableSize) * sizeof(orxU8));
+  /* Frees memory*/
+  orxMemory_Free(_pstLinkTable->au32LinkArray);
+  orxMemory_Free(_pstLinkTable->au8LoopArray);
+  orxMemory_Free(_pstLinkTable);
 
   return;
 }
 
+/** Updates the sorted list of links using a loop counter
+ * @param[in]   _pstLinkTable	                Concerned LinkTable
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxAnimSet_UpdateLoopLinkList(orxANIMSET_LINK_TABLE *_pstLinkTable)
+{
+  orxU32    u32Size, u32Counter, i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstLinkTable != orxNULL);
+
+  /* Had a list? */
+  if(_pstLinkTable->au32LoopLinkArray != orxNULL)
+  {
+    /* Deletes it */
+    orxMemory_Free(_pstLinkTable->au32LoopLinkArray);
+    _pstLinkTable->au32LoopLinkArray = orxNULL;
+  }
+
+  /* Gets storage size */
+  u32Size = (orxU32)(_pstLinkTable->u16TableSize * _pstLinkTable->u16TableSize);
+
+  /* Counts links using a loop counter */
+  for(i = 0, u32Counter = 0; i < u32Size; i++)
+  {
+    if((_pstLinkTable->au32LinkArray[i] & (orxANIMSET_KU32_LINK_FLAG_LINK | orxANIMSET_KU32_LINK_FLAG_LOOP_COUNTER)) == (orxANIMSET_KU32_LINK_FLAG_LINK | orxANIMSET_KU32_LINK_FLAG_LOOP_COUNTER))
+    {
+      u32Counter++;
+    }
+  }
+
+  /* Any? */
+  if(u32Counter > 0)
+  {
+    /* Allocates list */
+    _pstLinkTable->au32LoopLinkArray = (orxU32 *)orxMemory_Allocate(u32Counter * sizeof(orxU32), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(_pstLinkTable->au32LoopLinkArray != orxNULL)
+    {
+      /* Stores all indices, in order */
+      for(i = 0, u32Counter = 0; i < u32Size; i++)
+      {
+        if((_pstLinkTable->au32LinkArray[i] & (orxANIMSET_KU32_LINK_FLAG_LINK | orxANIMSET_KU32_LINK_FLAG_LOOP_COUNTER)) == (orxANIMSET_KU32_LINK_FLAG_LINK | orxANIMSET_KU32_LINK_FLAG_LOOP_COUNTER))
+        {
+          _pstLinkTable->au32LoopLinkArray[u32Counter++] = i;
+        }
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_ANIM, "Loop link list failed to allocate.");
+
+      /* Clears counter */
+      u32Counter = 0;
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Stores counter */
+  _pstLinkTable->u16LoopLinkCounter = (orxU16)u32Counter;
+
+  /* Updates revision (invalidates routes searched by loop overlays) */
+  _pstLinkTable->u32Revision++;
+
+  /* Done! */
+  return eResult;
+}
+
 /** Sets an AnimSet storage size
  * @param[in]   _pstAnimSet										Concerned AnimSet
  * @param[in]   _u32Size											Desired size
@@ -1034,14 +1131,321 @@ static orxINLINE void orxAnimSet_DeleteAll()
   return;
 }
 
-/** Computes next Animation, updating LinkTable link status
+/** Event handler
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxAnimSet_EventHandler(const orxEVENT *_pstEvent)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_CONFIG);
+
+  /* Section update? */
+  if(_pstEvent->eID == orxCONFIG_EVENT_SECTION_UPDATE)
+  {
+    orxCONFIG_EVENT_PAYLOAD  *pstPayload;
+    orxANIMSET               *pstAnimSet;
+    orxU32                    u32ID;
+
+    /* Gets payload */
+    pstPayload = (orxCONFIG_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+
+    /* Gets section ID */
+    u32ID = orxString_ToCRC(pstPayload->zSectionName);
+
+    /* For all anim sets */
+    for(pstAnimSet = orxANIMSET(orxStructure_GetFirst(orxSTRUCTURE_ID_ANIMSET));
+        pstAnimSet != orxNULL;
+        pstAnimSet = orxANIMSET(orxStructure_GetNext(pstAnimSet)))
+    {
+      /* Referenced? */
+      if(orxStructure_TestFlags(pstAnimSet, orxANIMSET_KU32_FLAG_REFERENCED) != orxFALSE)
+      {
+        orxU32 i;
+
+        /* For all the sections it was built from */
+        for(i = 0; i < pstAnimSet->u32SectionIDCounter; i++)
+        {
+          /* Updated? */
+          if(pstAnimSet->au32SectionIDList[i] == u32ID)
+          {
+            /* Removes it from reference table: current users keep it, new ones will get the updated version */
+            orxHashTable_Remove(sstAnimSet.pstReferenceTable, orxString_ToCRC(pstAnimSet->zReference));
+
+            /* Updates flags */
+            orxStructure_SetFlags(pstAnimSet, orxANIMSET_KU32_FLAG_NONE, orxANIMSET_KU32_FLAG_REFERENCED);
+
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets the remaining loops of a link in a loop overlay
+ * @param[in]   _pstLoopOverlay               Concerned LoopOverlay / orxNULL
+ * @param[in]   _u32LinkIndex                 Link index
+ * @return      Pointer to the remaining loops / orxNULL if the link doesn't use a loop counter
+ */
+static orxINLINE orxU8 *orxAnimSet_GetOverlayLoop(orxANIMSET_LOOP_OVERLAY *_pstLoopOverlay, orxU32 _u32LinkIndex)
+{
+  orxU8 *pu8Result = orxNULL;
+
+  /* Has counted links? */
+  if((_pstLoopOverlay != orxNULL) && (_pstLoopOverlay->u16LoopLinkCounter > 0))
+  {
+    orxU32 u32Min, u32Max;
+
+    /* Binary search on sorted link indices */
+    for(u32Min = 0, u32Max = (orxU32)_pstLoopOverlay->u16LoopLinkCounter; u32Min < u32Max;)
+    {
+      orxU32 u32Middle;
+
+      /* Gets middle */
+      u32Middle = (u32Min + u32Max) >> 1;
+
+      /* Found? */
+      if(_pstLoopOverlay->au32LoopLinkArray[u32Middle] == _u32LinkIndex)
+      {
+        /* Updates result */
+        pu8Result = &(_pstLoopOverlay->au8LoopArray[u32Middle]);
+
+        break;
+      }
+      else if(_pstLoopOverlay->au32LoopLinkArray[u32Middle] < _u32LinkIndex)
+      {
+        u32Min = u32Middle + 1;
+      }
+      else
+      {
+        u32Max = u32Middle;
+      }
+    }
+  }
+
+  /* Done! */
+  return pu8Result;
+}
+
+/** Is a link blocked by an exhausted loop counter?
+ * @param[in]   _pstLoopOverlay               Concerned LoopOverlay / orxNULL
+ * @param[in]   _u32LinkIndex                 Link index
+ * @return      orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxAnimSet_IsLinkBlocked(orxANIMSET_LOOP_OVERLAY *_pstLoopOverlay, orxU32 _u32LinkIndex)
+{
+  orxBOOL bResult = orxFALSE;
+
+  /* Has blocked links? */
+  if((_pstLoopOverlay != orxNULL) && (_pstLoopOverlay->u16BlockedCounter > 0))
+  {
+    orxU8 *pu8Loop;
+
+    /* Gets its loop counter */
+    pu8Loop = orxAnimSet_GetOverlayLoop(_pstLoopOverlay, _u32LinkIndex);
+
+    /* Updates result */
+    bResult = ((pu8Loop != orxNULL) && (*pu8Loop == 0)) ? orxTRUE : orxFALSE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Searches a route avoiding blocked links: shortest one, ties going to the highest priority first link
+ * @param[in]   _pstLinkTable                 Concerned LinkTable
+ * @param[in]   _pstLoopOverlay               Concerned LoopOverlay
+ * @param[in]   _u32SrcAnim                   Source Anim index
+ * @param[in]   _u32DstAnim                   Destination Anim index
+ * @return      Next Anim index / orxU32_UNDEFINED
+ */
+static orxU32 orxFASTCALL orxAnimSet_SearchRoute(orxANIMSET_LINK_TABLE *_pstLinkTable, orxANIMSET_LOOP_OVERLAY *_pstLoopOverlay, orxU32 _u32SrcAnim, orxU32 _u32DstAnim)
+{
+  orxU8   au8FirstAnim[orxANIMSET_KU32_MAX_ANIM_NUMBER], au8Queue[orxANIMSET_KU32_MAX_ANIM_NUMBER];
+  orxU32  u32Size, u32Head, u32Tail, u32Priority, i;
+  orxU32  u32Result = orxU32_UNDEFINED;
+
+  /* Checks */
+  orxASSERT(_pstLinkTable != orxNULL);
+  orxASSERT(_pstLinkTable->u16TableSize <= orxANIMSET_KU32_MAX_ANIM_NUMBER);
+
+  /* Gets animation storage size */
+  u32Size = (orxU32)(_pstLinkTable->u16TableSize);
+
+  /* Clears visited anims */
+  orxMemory_Set(au8FirstAnim, orxANIMSET_KU8_ROUTE_NONE, u32Size * sizeof(orxU8));
+
+  /* For all priorities, highest first */
+  for(u32Priority = orxANIMSET_KU32_LINK_MAX_PRIORITY + 1, u32Tail = 0; (u32Priority > 0) && (u32Result == orxU32_UNDEFINED); u32Priority--)
+  {
+    /* For all source links */
+    for(i = 0; i < u32Size; i++)
+    {
+      orxU32 u32LinkIndex;
+
+      /* Gets link index */
+      u32LinkIndex = (_u32SrcAnim * u32Size) + i;
+
+      /* Usable link of current priority to a new anim? */
+      if((_pstLinkTable->au32LinkArray[u32LinkIndex] & orxANIMSET_KU32_LINK_FLAG_LINK)
+      && (au8FirstAnim[i] == orxANIMSET_KU8_ROUTE_NONE)
+      && (orxAnimSet_GetLinkTableLinkProperty(_pstLinkTable, u32LinkIndex, orxANIMSET_KU32_LINK_FLAG_PRIORITY) == u32Priority - 1)
+      && (orxAnimSet_IsLinkBlocked(_pstLoopOverlay, u32LinkIndex) == orxFALSE))
+      {
+        /* Queues it */
+        au8FirstAnim[i]     = (orxU8)i;
+        au8Queue[u32Tail++] = (orxU8)i;
+
+        /* Destination reached? */
+        if(i == _u32DstAnim)
+        {
+          /* Updates result */
+          u32Result = i;
+
+          break;
+        }
+      }
+    }
+  }
+
+  /* Breadth first search, each anim being visited at most once */
+  for(u32Head = 0; (u32Head < u32Tail) && (u32Result == orxU32_UNDEFINED); u32Head++)
+  {
+    orxU32 u32Anim;
+
+    /* Gets anim */
+    u32Anim = (orxU32)au8Queue[u32Head];
+
+    /* For all its links */
+    for(i = 0; i < u32Size; i++)
+    {
+      orxU32 u32LinkIndex;
+
+      /* Gets link index */
+      u32LinkIndex = (u32Anim * u32Size) + i;
+
+      /* Usable link to a new anim? */
+      if((_pstLinkTable->au32LinkArray[u32LinkIndex] & orxANIMSET_KU32_LINK_FLAG_LINK)
+      && (au8FirstAnim[i] == orxANIMSET_KU8_ROUTE_NONE)
+      && (orxAnimSet_IsLinkBlocked(_pstLoopOverlay, u32LinkIndex) == orxFALSE))
+      {
+        /* Queues it, inheriting first anim */
+        au8FirstAnim[i]     = au8FirstAnim[u32Anim];
+        au8Queue[u32Tail++] = (orxU8)i;
+
+        /* Destination reached? */
+        if(i == _u32DstAnim)
+        {
+          /* Updates result */
+          u32Result = (orxU32)au8FirstAnim[i];
+
+          break;
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Computes routing Anim toward a destination, using the shared LinkTable routes unless a loop counter blocks them
+ * @param[in]   _pstLinkTable                 Concerned LinkTable
+ * @param[in]   _pstLoopOverlay               Concerned LoopOverlay / orxNULL
+ * @param[in]   _u32SrcAnim                   Source Anim index
+ * @param[in]   _u32DstAnim                   Destination Anim index
+ * @return      Next Anim index / orxU32_UNDEFINED
+ */
+static orxU32 orxFASTCALL orxAnimSet_ComputeRoute(orxANIMSET_LINK_TABLE *_pstLinkTable, orxANIMSET_LOOP_OVERLAY *_pstLoopOverlay, orxU32 _u32SrcAnim, orxU32 _u32DstAnim)
+{
+  orxU32 u32Size, u32Link, u32RouteIndex;
+  orxU32 u32Result = orxU32_UNDEFINED;
+
+  /* Gets animation storage size */
+  u32Size = (orxU32)(_pstLinkTable->u16TableSize);
+
+  /* Gets route index */
+  u32RouteIndex = (_u32SrcAnim * u32Size) + _u32DstAnim;
+
+  /* Gets shared route */
+  u32Link = _pstLinkTable->au32LinkArray[u32RouteIndex];
+
+  /* Is there a path? (blocked links can only remove some) */
+  if(u32Link & orxANIMSET_KU32_LINK_FLAG_PATH)
+  {
+    /* Gets anim index */
+    u32Result = (u32Link & orxANIMSET_KU32_LINK_MASK_ANIM) >> orxANIMSET_KU32_LINK_SHIFT_ANIM;
+
+    /* Has blocked links? */
+    if((_pstLoopOverlay != orxNULL) && (_pstLoopOverlay->u16BlockedCounter > 0))
+    {
+      /* Link table was recomputed since last search? */
+      if(_pstLoopOverlay->u32Revision != _pstLinkTable->u32Revision)
+      {
+        /* Clears last searched route */
+        _pstLoopOverlay->u32RouteIndex  = orxU32_UNDEFINED;
+        _pstLoopOverlay->u32Revision    = _pstLinkTable->u32Revision;
+      }
+
+      /* Already searched? */
+      if(_pstLoopOverlay->u32RouteIndex == u32RouteIndex)
+      {
+        /* Updates result */
+        u32Result = _pstLoopOverlay->u32RouteAnim;
+      }
+      else
+      {
+        orxU32  u32Anim, u32Next, i;
+        orxBOOL bValid;
+
+        /* Follows shared route, checking all its links */
+        for(u32Anim = _u32SrcAnim, i = 0, bValid = orxTRUE;
+            (bValid != orxFALSE) && ((i == 0) || (u32Anim != _u32DstAnim));
+            u32Anim = u32Next, i++)
+        {
+          /* Gets next anim */
+          u32Link = _pstLinkTable->au32LinkArray[(u32Anim * u32Size) + _u32DstAnim];
+          u32Next = (u32Link & orxANIMSET_KU32_LINK_MASK_ANIM) >> orxANIMSET_KU32_LINK_SHIFT_ANIM;
+
+          /* Updates status */
+          bValid = ((i < u32Size)
+                 && (u32Link & orxANIMSET_KU32_LINK_FLAG_PATH)
+                 && (orxAnimSet_IsLinkBlocked(_pstLoopOverlay, (u32Anim * u32Size) + u32Next) == orxFALSE)) ? orxTRUE : orxFALSE;
+        }
+
+        /* Blocked? */
+        if(bValid == orxFALSE)
+        {
+          /* Searches for a new route */
+          u32Result = orxAnimSet_SearchRoute(_pstLinkTable, _pstLoopOverlay, _u32SrcAnim, _u32DstAnim);
+        }
+
+        /* Stores it */
+        _pstLoopOverlay->u32RouteIndex  = u32RouteIndex;
+        _pstLoopOverlay->u32RouteAnim   = u32Result;
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Computes next Animation, updating LoopOverlay loop counters
  * @param[in]   _pstLinkTable									Concerned LinkTable
+ * @param[in]   _pstLoopOverlay               Concerned LoopOverlay / orxNULL
  * @param[in]   _u32SrcAnim										Source Anim index
  * @param[in]   _u32DstAnim										Destination Anim index / orxU32_UNDEFINED
- * @param[in]   _bSimulate                    Simulation mode, no update will be made on the link table
+ * @param[in]   _bSimulate                    Simulation mode, no update will be made on the loop overlay
  * @return 			Next Anim index / orxU32_UNDEFINED
  */
-static orxU32 orxFASTCALL orxAnimSet_ComputeNextAnim(orxANIMSET_LINK_TABLE *_pstLinkTable, orxU32 _u32SrcAnim, orxU32 _u32DstAnim, orxBOOL _bSimulate)
+static orxU32 orxFASTCALL orxAnimSet_ComputeNextAnim(orxANIMSET_LINK_TABLE *_pstLinkTable, orxANIMSET_LOOP_OVERLAY *_pstLoopOverlay, orxU32 _u32SrcAnim, orxU32 _u32DstAnim, orxBOOL _bSimulate)
 {
   orxU32 u32BaseIndex, u32Size;
   orxU32 u32Result = orxU32_UNDEFINED;
@@ -1058,17 +1462,8 @@ static orxU32 orxFASTCALL orxAnimSet_ComputeNextAnim(orxANIMSET_LINK_TABLE *_pst
   /* Has a destination anim? */
   if(_u32DstAnim != orxU32_UNDEFINED)
   {
-    orxU32 u32Link;
-
-    /* Gets link value */
-    u32Link = _pstLinkTable->au32LinkArray[u32BaseIndex + _u32DstAnim];
-
-    /* Is there a path? */
-    if(u32Link & orxANIMSET_KU32_LINK_FLAG_PATH)
-    {
-      /* Gets anim index */
-      u32Result = (u32Link & orxANIMSET_KU32_LINK_MASK_ANIM) >> orxANIMSET_KU32_LINK_SHIFT_ANIM;
-    }
+    /* Gets routing anim */
+    u32Result = orxAnimSet_ComputeRoute(_pstLinkTable, _pstLoopOverlay, _u32SrcAnim, _u32DstAnim);
   }
   /* No destination anim */
   else
@@ -1079,36 +1474,23 @@ static orxU32 orxFASTCALL orxAnimSet_ComputeNextAnim(orxANIMSET_LINK_TABLE *_pst
     /* For all possible links */
     for(i = u32BaseIndex, u32Result = orxU32_UNDEFINED, s32ResultPriority = -1; i < u32BaseIndex + u32Size; i++)
     {
-      orxU32 u32Link;
-
-      /* Gets value */
-      u32Link = _pstLinkTable->au32LinkArray[i];
-
-      /* Link found? */
-      if(u32Link & orxANIMSET_KU32_LINK_FLAG_LINK)
+      /* Link found and not blocked by its loop counter? */
+      if((_pstLinkTable->au32LinkArray[i] & orxANIMSET_KU32_LINK_FLAG_LINK)
+      && (orxAnimSet_IsLinkBlocked(_pstLoopOverlay, i) == orxFALSE))
       {
-        orxU32 u32Loop;
+        orxS32 s32LinkPriority;
 
-        /* Gets link loop counter */
-        u32Loop = orxAnimSet_GetLinkTableLinkProperty(_pstLinkTable, i, orxANIMSET_KU32_LINK_FLAG_LOOP_COUNTER);
+        /* Gets path priority */
+        s32LinkPriority = (orxS32)orxAnimSet_GetLinkTableLinkProperty(_pstLinkTable, i, orxANIMSET_KU32_LINK_FLAG_PRIORITY);
 
-        /* Has no empty loop counter (if no loop, value is orxU32_UNDEFINED)? */
-        if(u32Loop != 0)
+        /* Higher priority or self looping and same priority? */
+        if((s32LinkPriority > s32ResultPriority)
+        || ((i == u32BaseIndex + _u32SrcAnim)
+         && (s32LinkPriority == s32ResultPriority)))
         {
-          orxS32 s32LinkPriority;
-
-          /* Gets path priority */
-          s32LinkPriority = (orxS32)orxAnimSet_GetLinkTableLinkProperty(_pstLinkTable, i, orxANIMSET_KU32_LINK_FLAG_PRIORITY);
-
-          /* Higher priority or self looping and same priority? */
-          if((s32LinkPriority > s32ResultPriority)
-          || ((i == u32BaseIndex + _u32SrcAnim)
-           && (s32LinkPriority == s32ResultPriority)))
-          {
-            /* Stores new link info */
-            u32Result         = i;
-            s32ResultPriority = s32LinkPriority;
-          }
+          /* Stores new link info */
+          u32Result         = i;
+          s32ResultPriority = s32LinkPriority;
         }
       }
     }
@@ -1121,35 +1503,28 @@ static orxU32 orxFASTCALL orxAnimSet_ComputeNextAnim(orxANIMSET_LINK_TABLE *_pst
     }
   }
 
-  /* Animation found? */
-  if(u32Result != orxU32_UNDEFINED)
+  /* Animation found & not in simulation mode? */
+  if((u32Result != orxU32_UNDEFINED) && (_bSimulate == orxFALSE))
   {
-    /* Not in simulation mode? */
-    if(_bSimulate == orxFALSE)
-    {
-      orxU32 u32Link, u32LinkIndex, u32Loop;
-
-      /* Gets direct link id */
-      u32LinkIndex = u32BaseIndex + u32Result;
+    orxU8 *pu8Loop;
 
-      /* Gets direct link */
-      u32Link = _pstLinkTable->au32LinkArray[u32LinkIndex];
+    /* Gets direct link loop counter */
+    pu8Loop = orxAnimSet_GetOverlayLoop(_pstLoopOverlay, u32BaseIndex + u32Result);
 
-      /* Gets current loop counter */
-      u32Loop = orxAnimSet_GetLinkTableLinkProperty(_pstLinkTable, u32LinkIndex, orxANIMSET_KU32_LINK_FLAG_LOOP_COUNTER);
+    /* Is loop counter used? */
+    if((pu8Loop != orxNULL) && (*pu8Loop != 0))
+    {
+      /* Updates it */
+      (*pu8Loop)--;
 
-      /* Is loop counter used? */
-      if(u32Loop != orxU32_UNDEFINED)
+      /* Link is now blocked? */
+      if(*pu8Loop == 0)
       {
-        /* Updates loop counter */
-        orxAnimSet_SetLinkTableLinkProperty(_pstLinkTable, u32LinkIndex, orxANIMSET_KU32_LINK_FLAG_LOOP_COUNTER, u32Loop - 1);
+        /* Updates blocked counter */
+        _pstLoopOverlay->u16BlockedCounter++;
 
-        /* Is link table dirty again? */
-        if(u32Loop <= 1)
-        {
-          /* Updates flags */
-          orxAnimSet_SetLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
-        }
+        /* Clears last searched route */
+        _pstLoopOverlay->u32RouteIndex = orxU32_UNDEFINED;
       }
     }
   }
@@ -1213,11 +1588,18 @@ static orxSTATUS orxFASTCALL orxAnimSet_ComputeLinkTable(orxANIMSET_LINK_TABLE *
           }
         }
 
-        /* Updates flags */
-        orxAnimSet_SetLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY);
-
         /* Deletes the link update info */
         orxAnimSet_DeleteLinkUpdateInfo(pstUpdateInfo);
+
+        /* Updates list of links using a loop counter */
+        eResult = orxAnimSet_UpdateLoopLinkList(_pstLinkTable);
+
+        /* Success? */
+        if(eResult != orxSTATUS_FAILURE)
+        {
+          /* Updates flags */
+          orxAnimSet_SetLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY);
+        }
       }
       else
       {
@@ -1256,6 +1638,7 @@ void orxFASTCALL orxAnimSet_Setup()
   orxModule_AddDependency(orxMODULE_ID_ANIMSET, orxMODULE_ID_CONFIG);
   orxModule_AddDependency(orxMODULE_ID_ANIMSET, orxMODULE_ID_BANK);
   orxModule_AddDependency(orxMODULE_ID_ANIMSET, orxMODULE_ID_ANIM);
+  orxModule_AddDependency(orxMODULE_ID_ANIMSET, orxMODULE_ID_EVENT);
 
   return;
 }
@@ -1281,6 +1664,13 @@ orxSTATUS orxFASTCALL orxAnimSet_Init()
     {
       /* Registers structure type */
       eResult = orxSTRUCTURE_REGISTER(ANIMSET, orxSTRUCTURE_STORAGE_TYPE_LINKLIST, orxMEMORY_TYPE_MAIN, orxNULL);
+
+      /* Success? */
+      if(eResult != orxSTATUS_FAILURE)
+      {
+        /* Registers config event handler */
+        eResult = orxEvent_AddHandler(orxEVENT_TYPE_CONFIG, orxAnimSet_EventHandler);
+      }
     }
   }
   else
@@ -1315,6 +1705,9 @@ void orxFASTCALL orxAnimSet_Exit()
   /* Initialized? */
   if(sstAnimSet.u32Flags & orxANIMSET_KU32_STATIC_FLAG_READY)
   {
+    /* Removes config event handler */
+    orxEvent_RemoveHandler(orxEVENT_TYPE_CONFIG, orxAnimSet_EventHandler);
+
     /* Deletes anim list */
     orxAnimSet_DeleteAll();
 
@@ -1433,10 +1826,11 @@ orxANIMSET *orxFASTCALL orxAnimSet_CreateFromConfig(const orxSTRING _zConfigID)
     if((orxConfig_HasSection(_zConfigID) != orxFALSE)
     && (orxConfig_PushSection(_zConfigID) != orxSTATUS_FAILURE))
     {
-      orxU32  u32AnimCounter;
+      orxU32  u32AnimCounter, u32LinkCounter;
 
-      /* Gets animation counter */
+      /* Gets animation & link counters */
       u32AnimCounter = orxConfig_GetListCounter(orxANIMSET_KZ_CONFIG_ANIM_LIST);
+      u32LinkCounter = orxConfig_GetListCounter(orxANIMSET_KZ_CONFIG_LINK_LIST);
 
       /* Creates animation set */
       pstResult = orxAnimSet_Create(u32AnimCounter);
@@ -1445,7 +1839,7 @@ orxANIMSET *orxFASTCALL orxAnimSet_CreateFromConfig(const orxSTRING _zConfigID)
       if((pstResult != orxNULL)
       && ((pstResult->pstIDTable = orxHashTable_Create(orxANIMSET_KU32_ID_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN)) != orxNULL))
       {
-        orxU32 i, u32LinkCounter;
+        orxU32 i;
 
         /* Updates status flags */
         orxStructure_SetFlags(pstResult, orxANIMSET_KU32_FLAG_ID_TABLE, orxANIMSET_KU32_FLAG_NONE);
@@ -1456,6 +1850,17 @@ orxANIMSET *orxFASTCALL orxAnimSet_CreateFromConfig(const orxSTRING _zConfigID)
         /* Protects it */
         orxConfig_ProtectSection(pstResult->zReference, orxTRUE);
 
+        /* Allocates list of the sections it's built from */
+        pstResult->au32SectionIDList = (orxU32 *)orxMemory_Allocate((1 + u32AnimCounter + u32LinkCounter) * sizeof(orxU32), orxMEMORY_TYPE_MAIN);
+
+        /* Success? */
+        if(pstResult->au32SectionIDList != orxNULL)
+        {
+          /* Stores its own section */
+          pstResult->au32SectionIDList[0]   = orxString_ToCRC(pstResult->zReference);
+          pstResult->u32SectionIDCounter    = 1;
+        }
+
         /* For all animations */
         for(i = 0; i < u32AnimCounter; i++)
         {
@@ -1470,6 +1875,13 @@ orxANIMSET *orxFASTCALL orxAnimSet_CreateFromConfig(const orxSTRING _zConfigID)
             orxANIM  *pstAnim;
             orxHANDLE hAnimHandle;
 
+            /* Has section list? */
+            if(pstResult->au32SectionIDList != orxNULL)
+            {
+              /* Stores anim section */
+              pstResult->au32SectionIDList[pstResult->u32SectionIDCounter++] = orxString_ToCRC(zAnimName);
+            }
+
             /* Creates it */
             pstAnim = orxAnim_CreateFromConfig(zAnimName);
 
@@ -1486,7 +1898,7 @@ orxANIMSET *orxFASTCALL orxAnimSet_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* For all links */
-        for(i = 0, u32LinkCounter = orxConfig_GetListCounter(orxANIMSET_KZ_CONFIG_LINK_LIST); i < u32LinkCounter; i++)
+        for(i = 0; i < u32LinkCounter; i++)
         {
           orxSTRING zLinkName;
 
@@ -1500,6 +1912,13 @@ orxANIMSET *orxFASTCALL orxAnimSet_CreateFromConfig(const orxSTRING _zConfigID)
             orxSTRING zSrcAnim, zDstAnim;
             orxHANDLE hSrcAnim, hDstAnim, hLink;
 
+            /* Has section list? */
+            if(pstResult->au32SectionIDList != orxNULL)
+            {
+              /* Stores link section */
+              pstResult->au32SectionIDList[pstResult->u32SectionIDCounter++] = orxString_ToCRC(zLinkName);
+            }
+
             /* Selects corresponding section */
             orxConfig_SelectSection(zLinkName);
 
@@ -1618,6 +2037,13 @@ orxSTATUS orxFASTCALL orxAnimSet_Delete(orxANIMSET *_pstAnimSet)
       orxConfig_ProtectSection(_pstAnimSet->zReference, orxFALSE);
     }
 
+    /* Has section list? */
+    if(_pstAnimSet->au32SectionIDList != orxNULL)
+    {
+      /* Deletes it */
+      orxMemory_Free(_pstAnimSet->au32SectionIDList);
+    }
+
     /* Deletes structure */
     orxStructure_Delete(_pstAnimSet);
   }
@@ -1671,53 +2097,76 @@ void orxFASTCALL    orxAnimSet_RemoveReference(orxANIMSET *_pstAnimSet)
   return;
 }
 
-/** Clones an AnimSet Link Table
- * @param[in]		_pstAnimSet													AnimSet to clone
- * @return An internally allocated clone of the AnimSet
+/** Creates a loop overlay for an AnimSet: per animation pointer loop counters, sharing the AnimSet link table and its routes
+ * @param[in]		_pstAnimSet													Concerned AnimSet
+ * @return An internally allocated loop overlay / orxNULL
  */
-orxANIMSET_LINK_TABLE *orxFASTCALL orxAnimSet_CloneLinkTable(const orxANIMSET *_pstAnimSet)
+orxANIMSET_LOOP_OVERLAY *orxFASTCALL orxAnimSet_CreateLoopOverlay(orxANIMSET *_pstAnimSet)
 {
-  orxANIMSET_LINK_TABLE *pstLinkTable = orxNULL;
+  orxANIMSET_LOOP_OVERLAY *pstLoopOverlay = orxNULL;
 
   /* Checks */
   orxASSERT(sstAnimSet.u32Flags & orxANIMSET_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstAnimSet);
 
-  /* Creates a new link table */
-  pstLinkTable = orxAnimSet_CreateLinkTable((orxU32)(_pstAnimSet->pstLinkTable->u16TableSize));
-
-  /* Was allocated? */
-  if(pstLinkTable != orxNULL)
+  /* Updates shared link table (and its loop link list) if needed */
+  if(orxAnimSet_ComputeLinkTable(_pstAnimSet->pstLinkTable) != orxSTATUS_FAILURE)
   {
-    /* Copies it */
-    orxAnimSet_CopyLinkTable(pstLinkTable, _pstAnimSet->pstLinkTable);
-  }
-  else
-  {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_ANIM, "Failed to create link table.");
+    orxANIMSET_LINK_TABLE  *pstLinkTable;
+    orxU32                  u32Counter;
 
-    /* Can't process */
-    pstLinkTable = orxNULL;
+    /* Gets link table */
+    pstLinkTable  = _pstAnimSet->pstLinkTable;
+
+    /* Gets number of counted links */
+    u32Counter    = (orxU32)pstLinkTable->u16LoopLinkCounter;
+
+    /* Allocates overlay, its own copy of the counted link indices & its loop array */
+    pstLoopOverlay = (orxANIMSET_LOOP_OVERLAY *)orxMemory_Allocate(sizeof(orxANIMSET_LOOP_OVERLAY) + (u32Counter * (sizeof(orxU32) + sizeof(orxU8))), orxMEMORY_TYPE_MAIN);
+
+    /* Was allocated? */
+    if(pstLoopOverlay != orxNULL)
+    {
+      orxU32 i;
+
+      /* Inits it */
+      pstLoopOverlay->au32LoopLinkArray   = (orxU32 *)(pstLoopOverlay + 1);
+      pstLoopOverlay->au8LoopArray        = (orxU8 *)(pstLoopOverlay->au32LoopLinkArray + u32Counter);
+      pstLoopOverlay->u16LoopLinkCounter  = (orxU16)u32Counter;
+      pstLoopOverlay->u16BlockedCounter   = 0;
+      pstLoopOverlay->u32RouteIndex       = orxU32_UNDEFINED;
+      pstLoopOverlay->u32RouteAnim        = orxU32_UNDEFINED;
+      pstLoopOverlay->u32Revision         = pstLinkTable->u32Revision;
+
+      /* Copies counted link indices & their initial loop counters (the link table's list is reallocated when recomputed) */
+      for(i = 0; i < u32Counter; i++)
+      {
+        pstLoopOverlay->au32LoopLinkArray[i]  = pstLinkTable->au32LoopLinkArray[i];
+        pstLoopOverlay->au8LoopArray[i]       = pstLinkTable->au8LoopArray[pstLinkTable->au32LoopLinkArray[i]];
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_ANIM, "Failed to create loop overlay.");
+    }
   }
 
   /* Done! */
-  return pstLinkTable;
+  return pstLoopOverlay;
 }
 
-/** Deletes a Link Table
- * @param[in]		_pstAnimSet													AnimSet to delete (should have been created using the clone function)
+/** Deletes a loop overlay
+ * @param[in]		_pstLoopOverlay											Loop overlay to delete (should have been created using the create function)
  */
-void orxFASTCALL    orxAnimSet_DeleteLinkTable(orxANIMSET_LINK_TABLE *_pstLinkTable)
+void orxFASTCALL    orxAnimSet_DeleteLoopOverlay(orxANIMSET_LOOP_OVERLAY *_pstLoopOverlay)
 {
   /* Checks */
   orxASSERT(sstAnimSet.u32Flags & orxANIMSET_KU32_STATIC_FLAG_READY);
-  orxASSERT(_pstLinkTable != orxNULL);
+  orxASSERT(_pstLoopOverlay != orxNULL);
 
-  /* Frees memory*/
-  orxMemory_Free(_pstLinkTable->au32LinkArray);
-  orxMemory_Free(_pstLinkTable->au8LoopArray);
-  orxMemory_Free(_pstLinkTable);
+  /* Frees memory */
+  orxMemory_Free(_pstLoopOverlay);
 
   return;
 }
@@ -2150,15 +2599,16 @@ orxU32 orxFASTCALL orxAnimSet_GetLinkProperty(const orxANIMSET *_pstAnimSet, orx
  * @param[in]   _hSrcAnim                           Source (current) Anim handle
  * @param[in]   _hDstAnim                           Destination Anim handle, if none (auto mode) set it to orxHANDLE_UNDEFINED
  * @param[in,out] _pfTime                           Pointer to the current timestamp relative to the source Anim (time elapsed since the beginning of this anim)
- * @param[in,out] _pstLinkTable                     Anim Pointer link table (updated if AnimSet link table isn't static, when using loop counters for example)
+ * @param[in,out] _pstLoopOverlay                   Anim Pointer loop overlay (updated if AnimSet link table isn't static, ie. when using loop counters), exhausted counters block their links
  * @param[out] _pbCut                               Animation has been cut
  * @param[out] _pbClearTarget                       Animation has requested a target clearing
  * @return Current Anim handle. If it's not the source one, _pu32Time will contain the new timestamp, relative to the new Anim
 */
-orxHANDLE orxFASTCALL orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxHANDLE _hSrcAnim, orxHANDLE _hDstAnim, orxFLOAT *_pfTime, orxANIMSET_LINK_TABLE *_pstLinkTable, orxBOOL *_pbCut, orxBOOL *_pbClearTarget)
+orxHANDLE orxFASTCALL orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxHANDLE _hSrcAnim, orxHANDLE _hDstAnim, orxFLOAT *_pfTime, orxANIMSET_LOOP_OVERLAY *_pstLoopOverlay, orxBOOL *_pbCut, orxBOOL *_pbClearTarget)
 {
-  orxANIMSET_LINK_TABLE  *pstWorkTable;
-  orxHANDLE               hResult = _hSrcAnim;
+  orxANIMSET_LINK_TABLE    *pstWorkTable;
+  orxANIMSET_LOOP_OVERLAY  *pstLoopOverlay;
+  orxHANDLE                 hResult = _hSrcAnim;
 
   /* Checks */
   orxASSERT(sstAnimSet.u32Flags & orxANIMSET_KU32_STATIC_FLAG_READY);
@@ -2169,17 +2619,11 @@ orxHANDLE orxFASTCALL orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxHANDLE
   orxASSERT((orxU32)_hSrcAnim < orxAnimSet_GetAnimCounter(_pstAnimSet));
   orxASSERT(((orxU32)_hDstAnim < orxAnimSet_GetAnimCounter(_pstAnimSet)) || (_hDstAnim == orxHANDLE_UNDEFINED));
 
-  /* Gets Link Table */
-  if(orxStructure_TestFlags(_pstAnimSet, orxANIMSET_KU32_FLAG_LINK_STATIC) == orxFALSE)
-  {
-    /* Use animation pointer local one */
-    pstWorkTable = _pstLinkTable;
-  }
-  else
-  {
-    /* Uses common static one */
-    pstWorkTable = _pstAnimSet->pstLinkTable;
-  }
+  /* Gets shared Link Table */
+  pstWorkTable    = _pstAnimSet->pstLinkTable;
+
+  /* Gets loop overlay (only used when link table isn't static) */
+  pstLoopOverlay  = (orxStructure_TestFlags(_pstAnimSet, orxANIMSET_KU32_FLAG_LINK_STATIC) == orxFALSE) ? _pstLoopOverlay : orxNULL;
 
   /* Checks working link table */
   orxASSERT(pstWorkTable != orxNULL);
@@ -2196,7 +2640,7 @@ orxHANDLE orxFASTCALL orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxHANDLE
     u32Anim = (orxU32)_hSrcAnim;
 
     /* Gets routing animation in simulation mode */
-    u32RoutingAnim = orxAnimSet_ComputeNextAnim(pstWorkTable, u32Anim, (_hDstAnim != orxHANDLE_UNDEFINED) ? (orxU32)_hDstAnim : orxU32_UNDEFINED, orxTRUE);
+    u32RoutingAnim = orxAnimSet_ComputeNextAnim(pstWorkTable, pstLoopOverlay, u32Anim, (_hDstAnim != orxHANDLE_UNDEFINED) ? (orxU32)_hDstAnim : orxU32_UNDEFINED, orxTRUE);
 
     /* Valid? */
     if(u32RoutingAnim != orxU32_UNDEFINED)
@@ -2215,7 +2659,7 @@ orxHANDLE orxFASTCALL orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxHANDLE
     if(*_pbCut != orxFALSE)
     {
       /* Get next animation according to destination aim */
-      u32TargetAnim = orxAnimSet_ComputeNextAnim(pstWorkTable, u32Anim, (_hDstAnim != orxHANDLE_UNDEFINED) ? (orxU32)_hDstAnim : orxU32_UNDEFINED, orxFALSE);
+      u32TargetAnim = orxAnimSet_ComputeNextAnim(pstWorkTable, pstLoopOverlay, u32Anim, (_hDstAnim != orxHANDLE_UNDEFINED) ? (orxU32)_hDstAnim : orxU32_UNDEFINED, orxFALSE);
 
       /* Resets time stamp */
       *_pfTime = orxFLOAT_0;
@@ -2246,7 +2690,7 @@ orxHANDLE orxFASTCALL orxAnimSet_ComputeAnim(orxANIMSET *_pstAnimSet, orxHANDLE
       if(*_pfTime > fLength)
       {
         /* Get next animation */
-        u32TargetAnim = orxAnimSet_ComputeNextAnim(pstWorkTable, u32Anim, (_hDstAnim != orxHANDLE_UNDEFINED) ? (orxU32)_hDstAnim : orxU32_UNDEFINED, orxFALSE);
+        u32TargetAnim = orxAnimSet_ComputeNextAnim(pstWorkTable, pstLoopOverlay, u32Anim, (_hDstAnim != orxHANDLE_UNDEFINED) ? (orxU32)_hDstAnim : orxU32_UNDEFINED, orxFALSE);
 
         /* Updates timestamp */
         *_pfTime -= fLength;
@@ -100,9 +100,16 @@ void orxFASTCALL orxModule_RegisterAll()
 
 #define orxMODULE_KU32_STATUS_FLAG_REGISTERED   0x00000001
 #define orxMODULE_KU32_STATUS_FLAG_INITIALIZED  0x00000002
+#define orxMODULE_KU32_STATUS_FLAG_DEFERRED     0x00000004
 #define orxMODULE_KU32_STATUS_FLAG_TEMP         0x00010000
 
 
+/** Misc defines
+ */
+#define orxMODULE_KZ_CONFIG_SECTION             "Module"
+#define orxMODULE_KZ_CONFIG_DEFERRED_LIST       "DeferredList"
+
+
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
@@ -117,6 +124,7 @@ typedef struct __orxMODULE_INFO_t
   orxMODULE_INIT_FUNCTION   pfnInit;                        /**< Init function : 24 */
   orxMODULE_EXIT_FUNCTION   pfnExit;                        /**< Exit function : 28 */
   orxU32                    u32StatusFlags;                 /**< Status flags : 32 */
+  orxFLOAT                  fInitTime;                      /**< Init time : 36 */
 
 } orxMODULE_INFO;
 
@@ -125,6 +133,8 @@ typedef struct __orxMODULE_INFO_t
 typedef struct __orxMODULE_STATIC_t
 {
   orxMODULE_INFO astModuleInfo[orxMODULE_ID_NUMBER];
+  orxMODULE_ID aeInitOrder[orxMODULE_ID_NUMBER];
+  orxU32 u32InitOrderCounter;
   orxU32 u32InitLoopCounter;
   orxU32 u32Flags;
 
@@ -139,11 +149,62 @@ typedef struct __orxMODULE_STATIC_t
  */
 static orxMODULE_STATIC sstModule;
 
+/** Module names, used for logs & config (! Needs to be updated for all new modules !)
+ */
+static const orxSTRING sazModuleName[orxMODULE_ID_NUMBER] =
+{
+  "Anim", "AnimPointer", "AnimSet", "Bank", "Body", "Camera", "Clock", "Config", "Display", "Event",
+  "File", "FileSystem", "FPS", "Frame", "FX", "FXPointer", "Graphic", "Input", "Joystick", "Keyboard",
+  "Locale", "Main", "Memory", "Mouse", "Object", "Param", "Physics", "Plugin", "Render", "Screenshot",
+  "Shader", "ShaderPointer", "Sound", "SoundPointer", "SoundSystem", "Spawner", "Structure", "System", "Text", "Texture",
+  "Viewport"
+};
+
 
 /***************************************************************************
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Loads the list of modules whose init is deferred till their first use
+ */
+static void orxFASTCALL orxModule_LoadDeferredList()
+{
+  orxS32 s32Counter, i;
+
+  /* Pushes module section */
+  orxConfig_PushSection(orxMODULE_KZ_CONFIG_SECTION);
+
+  /* For all listed modules */
+  for(i = 0, s32Counter = orxConfig_GetListCounter(orxMODULE_KZ_CONFIG_DEFERRED_LIST); i < s32Counter; i++)
+  {
+    orxSTRING zName;
+    orxU32    u32Index;
+
+    /* Gets its name */
+    zName = orxConfig_GetListString(orxMODULE_KZ_CONFIG_DEFERRED_LIST, i);
+
+    /* Finds its ID */
+    for(u32Index = 0; (u32Index < orxMODULE_ID_NUMBER) && (orxString_Compare(zName, sazModuleName[u32Index]) != 0); u32Index++);
+
+    /* Found? */
+    if(u32Index < orxMODULE_ID_NUMBER)
+    {
+      /* Updates its status */
+      sstModule.astModuleInfo[u32Index].u32StatusFlags |= orxMODULE_KU32_STATUS_FLAG_DEFERRED;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't defer init of module <%s>: unknown module.", zName);
+    }
+  }
+
+  /* Pops section */
+  orxConfig_PopSection();
+
+  return;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -203,7 +264,70 @@ void orxFASTCALL orxModule_AddOptionalDependency(orxMODULE_ID _eModuleID, orxMOD
  */
 void orxFASTCALL orxModule_UpdateDependencies()
 {
-  /* !!! TODO !!! */
+  orxU64 u64Registered, u64Ordered;
+  orxU32 u32Index;
+
+  /* For all modules */
+  for(u32Index = 0, u64Registered = 0; u32Index < orxMODULE_ID_NUMBER; u32Index++)
+  {
+    /* Is registered? */
+    if(sstModule.astModuleInfo[u32Index].u32StatusFlags & orxMODULE_KU32_STATUS_FLAG_REGISTERED)
+    {
+      /* Updates registered flags */
+      u64Registered |= (orxU64)1 << u32Index;
+    }
+  }
+
+  /* Clears init order */
+  sstModule.u32InitOrderCounter = 0;
+
+  /* While there are modules to order */
+  for(u64Ordered = 0; u64Ordered != u64Registered;)
+  {
+    orxU64 u64Level;
+
+    /* For all remaining modules */
+    for(u32Index = 0, u64Level = 0; u32Index < orxMODULE_ID_NUMBER; u32Index++)
+    {
+      orxU64 u64Flag;
+
+      /* Gets its flag */
+      u64Flag = (orxU64)1 << u32Index;
+
+      /* Not ordered yet and all its registered dependencies are? */
+      if(((u64Registered & ~u64Ordered) & u64Flag)
+      && (((sstModule.astModuleInfo[u32Index].u64DependFlags | sstModule.astModuleInfo[u32Index].u64OptionalDependFlags) & u64Registered & ~u64Ordered & ~u64Flag) == 0))
+      {
+        /* Adds it to current level: modules of a same level don't depend on each other */
+        u64Level |= u64Flag;
+        sstModule.aeInitOrder[sstModule.u32InitOrderCounter++] = (orxMODULE_ID)u32Index;
+      }
+    }
+
+    /* No progress? */
+    if(u64Level == 0)
+    {
+      /* For all remaining modules */
+      for(u32Index = 0; u32Index < orxMODULE_ID_NUMBER; u32Index++)
+      {
+        /* Not ordered? */
+        if((u64Registered & ~u64Ordered) & ((orxU64)1 << u32Index))
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Module <%s> is part of a dependency cycle.", sazModuleName[u32Index]);
+
+          /* Adds it, in ID order */
+          sstModule.aeInitOrder[sstModule.u32InitOrderCounter++] = (orxMODULE_ID)u32Index;
+        }
+      }
+
+      /* Stops */
+      break;
+    }
+
+    /* Updates ordered modules */
+    u64Ordered |= u64Level;
+  }
 
   return;
 }
@@ -243,6 +367,9 @@ void orxFASTCALL orxModule_SetupAll()
     orxModule_Setup((orxMODULE_ID)eID);
   }
 
+  /* Computes init order */
+  orxModule_UpdateDependencies();
+
   return;
 }
 
@@ -258,6 +385,15 @@ orxSTATUS orxFASTCALL orxModule_Init(orxMODULE_ID _eModuleID)
   orxASSERT(orxMODULE_ID_NUMBER <= orxMODULE_ID_MAX_NUMBER);
   orxASSERT(_eModuleID < orxMODULE_ID_NUMBER);
 
+  /* External call while system module isn't initialized yet? */
+  if((sstModule.u32InitLoopCounter == 0)
+  && (_eModuleID != orxMODULE_ID_SYSTEM)
+  && ((sstModule.astModuleInfo[orxMODULE_ID_SYSTEM].u32StatusFlags & (orxMODULE_KU32_STATUS_FLAG_REGISTERED|orxMODULE_KU32_STATUS_FLAG_INITIALIZED)) == orxMODULE_KU32_STATUS_FLAG_REGISTERED))
+  {
+    /* Inits it first, so as to time all other inits */
+    orxModule_Init(orxMODULE_ID_SYSTEM);
+  }
+
   /* Increases loop counter */
   sstModule.u32InitLoopCounter++;
 
@@ -299,8 +435,8 @@ orxSTATUS orxFASTCALL orxModule_Init(orxMODULE_ID _eModuleID)
         /* Depends? */
         if(u64Depend & (orxU64)1)
         {
-          /* Not already initialized */
-          if(!(sstModule.astModuleInfo[u32Index].u32StatusFlags & orxMODULE_KU32_STATUS_FLAG_INITIALIZED))
+          /* Not already initialized nor deferred? */
+          if(!(sstModule.astModuleInfo[u32Index].u32StatusFlags & (orxMODULE_KU32_STATUS_FLAG_INITIALIZED|orxMODULE_KU32_STATUS_FLAG_DEFERRED)))
           {
             /* Inits it */
             orxModule_Init((orxMODULE_ID)u32Index);
@@ -314,9 +450,19 @@ orxSTATUS orxFASTCALL orxModule_Init(orxMODULE_ID _eModuleID)
         /* Not already initialized */
         if(!(sstModule.astModuleInfo[_eModuleID].u32StatusFlags & orxMODULE_KU32_STATUS_FLAG_INITIALIZED))
         {
+          orxBOOL   bTimed;
+          orxFLOAT  fStartTime = orxFLOAT_0;
+
           /* Updates temp flag */
           sstModule.astModuleInfo[_eModuleID].u32StatusFlags |= orxMODULE_KU32_STATUS_FLAG_TEMP;
 
+          /* Can be timed? */
+          if((bTimed = orxModule_IsInitialized(orxMODULE_ID_SYSTEM)) != orxFALSE)
+          {
+            /* Gets start time */
+            fStartTime = orxSystem_GetTime();
+          }
+
           /* Calls module init function */
           eResult = sstModule.astModuleInfo[_eModuleID].pfnInit();
 
@@ -325,6 +471,19 @@ orxSTATUS orxFASTCALL orxModule_Init(orxMODULE_ID _eModuleID)
           {
             /* Updates initialized flag */
             sstModule.astModuleInfo[_eModuleID].u32StatusFlags |= orxMODULE_KU32_STATUS_FLAG_INITIALIZED;
+
+            /* Stores init time */
+            sstModule.astModuleInfo[_eModuleID].fInitTime = (bTimed != orxFALSE) ? orxSystem_GetTime() - fStartTime : orxFLOAT_0;
+
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Module <%s> initialized in %gs.", sazModuleName[_eModuleID], sstModule.astModuleInfo[_eModuleID].fInitTime);
+
+            /* Is config module? */
+            if(_eModuleID == orxMODULE_ID_CONFIG)
+            {
+              /* Loads deferred modules */
+              orxModule_LoadDeferredList();
+            }
           }
           else
           {
@@ -381,12 +540,29 @@ orxSTATUS orxFASTCALL orxModule_Init(orxMODULE_ID _eModuleID)
  */
 orxSTATUS orxFASTCALL orxModule_InitAll()
 {
-  orxU32    eID, u32InitCounter;
+  orxU32    i, eID, u32InitCounter;
   orxSTATUS eResult = orxSTATUS_SUCCESS;
 
-  /* For all modules */
-  for(eID = 0, u32InitCounter = 0; eID < orxMODULE_ID_NUMBER; eID++)
+  /* No init order? */
+  if(sstModule.u32InitOrderCounter == 0)
+  {
+    /* Computes it */
+    orxModule_UpdateDependencies();
+  }
+
+  /* For all modules, dependencies first */
+  for(i = 0, u32InitCounter = 0; i < sstModule.u32InitOrderCounter; i++)
   {
+    /* Gets its ID */
+    eID = sstModule.aeInitOrder[i];
+
+    /* Deferred? */
+    if(sstModule.astModuleInfo[eID].u32StatusFlags & orxMODULE_KU32_STATUS_FLAG_DEFERRED)
+    {
+      /* Skips it */
+      continue;
+    }
+
     /* Calls module init */
     eResult = orxModule_Init((orxMODULE_ID)eID);
 
@@ -399,7 +575,7 @@ orxSTATUS orxFASTCALL orxModule_InitAll()
     else
     {
       /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Failed to initialized module ID (%ld).", eID);
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Failed to initialize module <%s>.", sazModuleName[eID]);
     }
   }
 
@@ -465,6 +641,9 @@ void orxFASTCALL orxModule_Exit(orxMODULE_ID _eModuleID)
 
     /* Calls module exit function */
     sstModule.astModuleInfo[_eModuleID].pfnExit();
+
+    /* Clears init time */
+    sstModule.astModuleInfo[_eModuleID].fInitTime = orxFLOAT_0;
   }
 
   return;
@@ -474,9 +653,16 @@ void orxFASTCALL orxModule_Exit(orxMODULE_ID _eModuleID)
  */
 void orxFASTCALL orxModule_ExitAll()
 {
-  orxU32 eID;
+  orxU32 i, eID;
 
-  /* For all modules */
+  /* For all ordered modules, dependent ones first */
+  for(i = sstModule.u32InitOrderCounter; i > 0; i--)
+  {
+    /* Calls module exit */
+    orxModule_Exit(sstModule.aeInitOrder[i - 1]);
+  }
+
+  /* For all remaining modules */
   for(eID = 0; eID < orxMODULE_ID_NUMBER; eID++)
   {
     /* Calls module exit */
@@ -504,3 +690,16 @@ orxBOOL orxFASTCALL orxModule_IsInitialized(orxMODULE_ID _eModuleID)
   /* Done! */
   return bResult;
 }
+
+/** Gets the time spent in a module init function, its dependencies excluded
+ * @param[in] _eModuleID        Concerned module ID
+ * @return Init time in seconds, orxFLOAT_0 if not initialized or if initialized before the system module
+ */
+orxFLOAT orxFASTCALL orxModule_GetInitTime(orxMODULE_ID _eModuleID)
+{
+  /* Checks */
+  orxASSERT(_eModuleID < orxMODULE_ID_NUMBER);
+
+  /* Done! */
+  return sstModule.astModuleInfo[_eModuleID].fInitTime;
+}
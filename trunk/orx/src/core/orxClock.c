@@ -45,6 +45,7 @@
 #define orxCLOCK_KU32_STATIC_FLAG_NONE          0x00000000  /**< No flags */
 
 #define orxCLOCK_KU32_STATIC_FLAG_READY         0x00000001  /**< Ready flag */
+#define orxCLOCK_KU32_STATIC_FLAG_PROFILER      0x00000002  /**< Profiler flag */
 
 #define orxCLOCK_KU32_STATIC_FLAG_UPDATE_LOCK   0x10000000  /**< Lock update flag */
 
@@ -131,6 +132,7 @@ typedef struct __orxCLOCK_STATIC_t
   orxFLOAT          fTime;                      /**< Current time : 16 */
   orxHASHTABLE     *pstReferenceTable;          /**< Table to avoid clock duplication when creating through config file : 20 */
   orxU32            u32Flags;                   /**< Control flags : 24 */
+  orxFLOAT          afProfilerTime[orxMODULE_ID_NUMBER]; /**< Time spent in callbacks, per module */
 
 } orxCLOCK_STATIC;
 
@@ -280,6 +282,78 @@ static orxINLINE orxFLOAT orxClock_ComputeDT(orxFLOAT _fDT, const orxCLOCK_INFO
   return fResult;
 }
 
+/** Gets a modifier from config (current section)
+ * @param[out]  _peModType                            Modifier type
+ * @param[out]  _pfModValue                           Modifier value
+ * @return      orxSTATUS_SUCCESS if a valid modifier was found / orxSTATUS_FAILURE otherwise
+ */
+static orxINLINE orxSTATUS orxClock_GetConfigModifier(orxCLOCK_MOD_TYPE *_peModType, orxFLOAT *_pfModValue)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(_peModType != orxNULL);
+  orxASSERT(_pfModValue != orxNULL);
+
+  /* Has a modifier? */
+  if(orxConfig_HasValue(orxCLOCK_KZ_CONFIG_MODIFIER_TYPE) != orxFALSE)
+  {
+    orxFLOAT fModifierValue;
+
+    /* Gets its value */
+    fModifierValue = orxConfig_GetFloat(orxCLOCK_KZ_CONFIG_MODIFIER_VALUE);
+
+    /* Valid? */
+    if(fModifierValue > orxFLOAT_0)
+    {
+      orxSTRING zModifierType;
+
+      /* Gets modifier type */
+      zModifierType = orxString_LowerCase(orxConfig_GetString(orxCLOCK_KZ_CONFIG_MODIFIER_TYPE));
+
+      /* Capped? */
+      if(orxString_Compare(zModifierType, orxCLOCK_KZ_MODIFIER_CAPPED) == 0)
+      {
+        /* Updates modifier value */
+        fModifierValue = orxFLOAT_1 / fModifierValue;
+
+        /* Updates modifier type */
+        *_peModType = orxCLOCK_MOD_TYPE_MAXED;
+      }
+      /* Fixed? */
+      else if(orxString_Compare(zModifierType, orxCLOCK_KZ_MODIFIER_FIXED) == 0)
+      {
+        /* Updates modifier value */
+        fModifierValue = orxFLOAT_1 / fModifierValue;
+
+        /* Updates modifier type */
+        *_peModType = orxCLOCK_MOD_TYPE_FIXED;
+      }
+      /* Multiply? */
+      else if(orxString_Compare(zModifierType, orxCLOCK_KZ_MODIFIER_MULTIPLY) == 0)
+      {
+        /* Updates modifier type */
+        *_peModType = orxCLOCK_MOD_TYPE_MULTIPLY;
+      }
+      /* None */
+      else
+      {
+        /* Updates modifier type */
+        *_peModType = orxCLOCK_MOD_TYPE_NONE;
+      }
+
+      /* Stores value */
+      *_pfModValue = fModifierValue;
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Deletes all the clocks
  */
 static orxINLINE void orxClock_DeleteAll()
@@ -364,6 +438,14 @@ orxSTATUS orxFASTCALL orxClock_Init()
 
           /* Creates default full speed core clock */
           orxConfig_PushSection(orxCLOCK_KZ_CONFIG_SECTION);
+
+          /* Has a global modifier? */
+          if(orxClock_GetConfigModifier(&(sstClock.eModType), &(sstClock.fModValue)) != orxSTATUS_FAILURE)
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_CLOCK, "Using global clock modifier <%s> (%g).", orxConfig_GetString(orxCLOCK_KZ_CONFIG_MODIFIER_TYPE), sstClock.fModValue);
+          }
+
           eResult = (orxClock_Create((orxConfig_HasValue(orxCLOCK_KZ_CONFIG_MAIN_CLOCK_FREQUENCY) && orxConfig_GetFloat(orxCLOCK_KZ_CONFIG_MAIN_CLOCK_FREQUENCY) > orxFLOAT_0) ? (orxFLOAT_1 / orxConfig_GetFloat(orxCLOCK_KZ_CONFIG_MAIN_CLOCK_FREQUENCY)) : orxFLOAT_0, orxCLOCK_TYPE_CORE) != orxNULL) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
           orxConfig_PopSection();
         }
@@ -539,8 +621,25 @@ orxSTATUS orxFASTCALL orxClock_Update()
               pstFunctionStorage != orxNULL;
               pstFunctionStorage = (orxCLOCK_FUNCTION_STORAGE *)orxLinkList_GetNext(&(pstFunctionStorage->stNode)))
           {
-            /* Calls it */
-            pstFunctionStorage->pfnCallback(&(pstClock->stClockInfo), pstFunctionStorage->pContext);
+            /* Is profiler enabled? */
+            if((sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_PROFILER) && (pstFunctionStorage->eModuleID < orxMODULE_ID_NUMBER))
+            {
+              orxFLOAT fStartTime;
+
+              /* Gets start time */
+              fStartTime = orxSystem_GetTime();
+
+              /* Calls it */
+              pstFunctionStorage->pfnCallback(&(pstClock->stClockInfo), pstFunctionStorage->pContext);
+
+              /* Updates module time */
+              sstClock.afProfilerTime[pstFunctionStorage->eModuleID] += orxSystem_GetTime() - fStartTime;
+            }
+            else
+            {
+              /* Calls it */
+              pstFunctionStorage->pfnCallback(&(pstClock->stClockInfo), pstFunctionStorage->pContext);
+            }
           }
 
           /* Updates partial DT */
@@ -552,6 +651,9 @@ orxSTATUS orxFASTCALL orxClock_Update()
     /* Unlocks clocks */
     sstClock.u32Flags &= ~orxCLOCK_KU32_STATIC_FLAG_UPDATE_LOCK;
 
+    /* Releases this frame's memory */
+    orxMemory_ResetFrameArena();
+
     /* Waits for next time slice */
     orxSystem_Delay(orxFLOAT_0);
   }
@@ -645,57 +747,14 @@ orxCLOCK *orxFASTCALL orxClock_CreateFromConfig(const orxSTRING _zConfigID)
       /* Valid? */
       if(pstResult != orxNULL)
       {
+        orxCLOCK_MOD_TYPE eModifierType;
+        orxFLOAT          fModifierValue;
+
         /* Has a modifier? */
-        if(orxConfig_HasValue(orxCLOCK_KZ_CONFIG_MODIFIER_TYPE) != orxFALSE)
+        if(orxClock_GetConfigModifier(&eModifierType, &fModifierValue) != orxSTATUS_FAILURE)
         {
-          orxFLOAT fModifierValue;
-
-          /* Gets its value */
-          fModifierValue = orxConfig_GetFloat(orxCLOCK_KZ_CONFIG_MODIFIER_VALUE);
-
-          /* Valid? */
-          if(fModifierValue > orxFLOAT_0)
-          {
-            orxSTRING         zModifierType;
-            orxCLOCK_MOD_TYPE eModifierType;
-
-            /* Gets modifier type */
-            zModifierType = orxString_LowerCase(orxConfig_GetString(orxCLOCK_KZ_CONFIG_MODIFIER_TYPE));
-
-            /* Capped? */
-            if(orxString_Compare(zModifierType, orxCLOCK_KZ_MODIFIER_CAPPED) == 0)
-            {
-              /* Updates modifier value */
-              fModifierValue = orxFLOAT_1 / fModifierValue;
-
-              /* Updates modifier type */
-              eModifierType = orxCLOCK_MOD_TYPE_MAXED;
-            }
-            /* Fixed? */
-            else if(orxString_Compare(zModifierType, orxCLOCK_KZ_MODIFIER_FIXED) == 0)
-            {
-              /* Updates modifier value */
-              fModifierValue = orxFLOAT_1 / fModifierValue;
-
-              /* Updates modifier type */
-              eModifierType = orxCLOCK_MOD_TYPE_FIXED;
-            }
-            /* Multiply? */
-            else if(orxString_Compare(zModifierType, orxCLOCK_KZ_MODIFIER_MULTIPLY) == 0)
-            {
-              /* Updates modifier type */
-              eModifierType = orxCLOCK_MOD_TYPE_MULTIPLY;
-            }
-            /* None */
-            else
-            {
-              /* Updates modifier type */
-              eModifierType = orxCLOCK_MOD_TYPE_NONE;
-            }
-
-            /* Updates clock */
-            orxClock_SetModifier(pstResult, eModifierType, fModifierValue);
-          }
+          /* Updates clock */
+          orxClock_SetModifier(pstResult, eModifierType, fModifierValue);
         }
 
         /* Stores its reference key */
@@ -979,7 +1038,7 @@ orxSTATUS orxFASTCALL orxClock_SetModifier(orxCLOCK *_pstClock, orxCLOCK_MOD_TYP
   /* Checks */
   orxASSERT(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstClock);
-  orxASSERT(_eModType < orxCLOCK_MOD_TYPE_NUMBER);
+  orxASSERT((_eModType < orxCLOCK_MOD_TYPE_NUMBER) || (_eModType == orxCLOCK_MOD_TYPE_NONE));
 
   /* Valid modifier value? */
   if(_fModValue >= orxFLOAT_0)
@@ -1447,3 +1506,53 @@ orxSTATUS orxFASTCALL orxClock_RemoveGlobalTimer(const orxCLOCK_FUNCTION _pfnCal
   /* Done! */
   return eResult;
 }
+
+/** Enables/disables the clock profiler
+ * @param[in]   _bEnable                              Enable / disable
+ */
+void orxFASTCALL orxClock_EnableProfiler(orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates flags */
+    sstClock.u32Flags |= orxCLOCK_KU32_STATIC_FLAG_PROFILER;
+  }
+  else
+  {
+    /* Updates flags */
+    sstClock.u32Flags &= ~orxCLOCK_KU32_STATIC_FLAG_PROFILER;
+  }
+
+  return;
+}
+
+/** Resets all the profiler times
+ */
+void orxFASTCALL orxClock_ResetProfiler()
+{
+  /* Checks */
+  orxASSERT(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY);
+
+  /* Clears all times */
+  orxMemory_Zero(sstClock.afProfilerTime, orxMODULE_ID_NUMBER * sizeof(orxFLOAT));
+
+  return;
+}
+
+/** Gets the time spent in a module's clock callbacks since last profiler reset
+ * @param[in]   _eModuleID                            Concerned module ID
+ * @return      Time spent in the module's callbacks (in seconds)
+ */
+orxFLOAT orxFASTCALL orxClock_GetProfilerTime(orxMODULE_ID _eModuleID)
+{
+  /* Checks */
+  orxASSERT(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eModuleID < orxMODULE_ID_NUMBER);
+
+  /* Done! */
+  return sstClock.afProfilerTime[_eModuleID];
+}
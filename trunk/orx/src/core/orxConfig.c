@@ -30,10 +30,12 @@
 #include "orxInclude.h"
 
 #include "core/orxConfig.h"
+#include "core/orxEvent.h"
 #include "debug/orxDebug.h"
 #include "memory/orxBank.h"
 #include "math/orxMath.h"
 #include "io/orxFile.h"
+#include "io/orxFileSystem.h"
 #include "utils/orxLinkList.h"
 #include "utils/orxHashTable.h"
 #include "utils/orxString.h"
@@ -44,6 +46,30 @@
 
 #endif /* __orxMAC__ */
 
+#ifdef __orxLINUX__
+
+  #include <sys/inotify.h>
+  #include <unistd.h>
+
+#endif /* __orxLINUX__ */
+
+
+/** Encryption block selection: full blocks are XORed with the pre-expanded key stream at once
+ */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+
+  #include <emmintrin.h>
+
+  #define orxCONFIG_CRYPT_BLOCK(DATA, KEY)        _mm_storeu_si128((__m128i *)(DATA), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(DATA)), _mm_loadu_si128((const __m128i *)(KEY))))
+
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+  #include <arm_neon.h>
+
+  #define orxCONFIG_CRYPT_BLOCK(DATA, KEY)        vst1q_u8((DATA), veorq_u8(vld1q_u8(DATA), vld1q_u8(KEY)))
+
+#endif /* No SIMD: see orxConfig_CryptBlock() */
+
 
 /** Module flags
  */
@@ -51,6 +77,8 @@
 
 #define orxCONFIG_KU32_STATIC_FLAG_READY          0x00000001  /**< Ready flag */
 #define orxCONFIG_KU32_STATIC_FLAG_HISTORY        0x00000002  /**< Keep history flag */
+#define orxCONFIG_KU32_STATIC_FLAG_WATCH          0x00000004  /**< Watch history flag */
+#define orxCONFIG_KU32_STATIC_FLAG_RELOAD         0x00000008  /**< Incremental reload flag */
 
 #define orxCONFIG_KU32_STATIC_MASK_ALL            0xFFFFFFFF  /**< All mask */
 
@@ -62,18 +90,28 @@
 #define orxCONFIG_VALUE_KU16_FLAG_RANDOM          0x0002      /**< Random flag */
 #define orxCONFIG_VALUE_KU16_FLAG_INHERITANCE     0x0004      /**< Inheritance flag */
 #define orxCONFIG_VALUE_KU16_FLAG_BLOCK_MODE      0x0008      /**< Block mode flag */
+#define orxCONFIG_VALUE_KU16_FLAG_STALE           0x0010      /**< Stale flag (not found yet during an incremental reload) */
 
 #define orxCONFIG_VALUE_KU16_MASK_ALL             0xFFFF      /**< All mask */
 
+
+#define orxCONFIG_SECTION_KU32_FLAG_NONE          0x00000000  /**< No flags */
+
+#define orxCONFIG_SECTION_KU32_FLAG_UPDATED       0x00000001  /**< Updated flag (incremental reload) */
+
 /** Defines
  */
 #define orxCONFIG_KU32_SECTION_BANK_SIZE          32          /**< Default section bank size */
 #define orxCONFIG_KU32_STACK_BANK_SIZE            8           /**< Default stack bank size */
 #define orxCONFIG_KU32_ENTRY_BANK_SIZE            8           /**< Default entry bank size */
 #define orxCONFIG_KU32_HISTORY_BANK_SIZE          4           /**< Default history bank size */
+#define orxCONFIG_KU32_WATCH_BANK_SIZE            8           /**< Default watch bank size */
 #define orxCONFIG_KU32_BASE_FILENAME_LENGTH       256         /**< Base file name length */
 
 #define orxCONFIG_KU32_BUFFER_SIZE                4096        /**< Buffer size */
+#define orxCONFIG_KU32_NOTIFY_BUFFER_SIZE         4096        /**< Notification buffer size */
+
+#define orxCONFIG_KU32_ORIGIN_RUNTIME             0xFFFFFFFF  /**< Origin of values set at runtime */
 
 #define orxCONFIG_KC_SECTION_START                '['         /**< Section start character */
 #define orxCONFIG_KC_SECTION_END                  ']'         /**< Section end character */
@@ -87,10 +125,13 @@
 
 #define orxCONFIG_KZ_CONFIG_SECTION               "Config"    /**< Config section name */
 #define orxCONFIG_KZ_CONFIG_HISTORY               "History"   /**< History config entry name */
+#define orxCONFIG_KZ_CONFIG_WATCH                 "Watch"     /**< Watch config entry name */
+#define orxCONFIG_KZ_CONFIG_PACK_LIST             "PackList"  /**< Pack list config entry name */
 
 #define orxCONFIG_KZ_DEFAULT_ENCRYPTION_KEY       "Orx Default Encryption Key =)" /**< Orx default encryption key */
 #define orxCONFIG_KZ_ENCRYPTION_TAG               "OECF"      /**< Encryption file tag */
 #define orxCONFIG_KU32_ENCRYPTION_TAG_LENGTH      4           /**< Encryption file tag length */
+#define orxCONFIG_KU32_ENCRYPTION_BLOCK_SIZE      16          /**< Encryption block size */
 
 #ifdef __orxDEBUG__
 
@@ -161,10 +202,11 @@ typedef struct __orxCONFIG_ENTRY_t
   orxLINKLIST_NODE  stNode;                 /**< List node : 12 */
   orxSTRING         zKey;                   /**< Entry key : 16 */
   orxU32            u32ID;                  /**< Key ID (CRC) : 20 */
+  orxU32            u32Origin;              /**< Origin (load index) : 24 */
 
-  orxCONFIG_VALUE   stValue;                /**< Entry value : 56 */
+  orxCONFIG_VALUE   stValue;                /**< Entry value : 60 */
 
-  orxPAD(56)
+  orxPAD(60)
 
 } orxCONFIG_ENTRY;
 
@@ -178,9 +220,10 @@ typedef struct __orxCONFIG_SECTION_t
   orxU32            u32ID;                  /**< Section CRC : 24 */
   orxU32            u32ParentID;            /**< Parent ID (CRC) : 28 */
   orxS32            s32ProtectionCounter;   /**< Protection counter : 32 */
-  orxLINKLIST       stEntryList;            /**< Entry list : 44 */
+  orxU32            u32Flags;               /**< Flags : 36 */
+  orxLINKLIST       stEntryList;            /**< Entry list : 48 */
 
-  orxPAD(44)
+  orxPAD(48)
 
 } orxCONFIG_SECTION;
 
@@ -193,6 +236,18 @@ typedef struct __orxCONFIG_STACK_ENTRY_t
 
 } orxCONFIG_STACK_ENTRY;
 
+/** Config watch structure
+ */
+typedef struct __orxCONFIG_WATCH_t
+{
+  orxSTRING           zFileName;            /**< File name : 4 */
+  orxU32              u32Origin;            /**< Origin (load index) : 8 */
+  orxU32              u32TimeStamp;         /**< Last known time stamp : 12 */
+  orxS32              s32Descriptor;        /**< Notification descriptor : 16 */
+  orxBOOL             bModified;            /**< Modified status : 20 */
+
+} orxCONFIG_WATCH;
+
 /** Static structure
  */
 typedef struct __orxCONFIG_STATIC_t
@@ -204,9 +259,15 @@ typedef struct __orxCONFIG_STATIC_t
   orxLINKLIST         stStackList;          /**< Stack list */
   orxU32              u32Flags;             /**< Control flags */
   orxU32              u32LoadCounter;       /**< Load counter */
+  orxU32              u32Origin;            /**< Origin (load index) of the values being loaded */
+  orxBANK            *pstWatchBank;         /**< Watch bank */
+  orxCONFIG_WATCH    *pstWatchCursor;       /**< Watch polling cursor */
+  orxS32              s32NotifyDescriptor;  /**< Notification descriptor */
   orxSTRING           zEncryptionKey;       /**< Encryption key */
   orxU32              u32EncryptionKeySize; /**< Encryption key size */
-  orxCHAR            *pcEncryptionChar;     /**< Current encryption char */
+  orxU8              *au8EncryptionStream;  /**< Encryption key stream: key repeated over a period + one extra block */
+  orxU32              u32EncryptionPeriod;  /**< Encryption key stream period (multiple of key size) */
+  orxU32              u32EncryptionOffset;  /**< Current encryption key stream offset */
   orxLINKLIST         stSectionList;        /**< Section list */
   orxHASHTABLE       *pstSectionTable;      /**< Section table */
   orxCHAR             zBaseFile[orxCONFIG_KU32_BASE_FILENAME_LENGTH]; /**< Base file name */
@@ -421,37 +482,165 @@ static orxINLINE orxSTRING orxConfig_GetListValue(orxCONFIG_VALUE *_pstValue, or
   return zResult;
 }
 
-/** En/De-crypts a buffer using global encryption key
+#ifndef orxCONFIG_CRYPT_BLOCK
+
+/** En/De-crypts a block, a word at a time
+ * @param[in,out] _pu8Data      Data to en/de-crypt
+ * @param[in] _pu8Key           Matching key stream
+ */
+static orxINLINE void orxConfig_CryptBlock(orxU8 *_pu8Data, const orxU8 *_pu8Key)
+{
+  orxU64 au64Data[2], au64Key[2];
+
+  /* Gets words */
+  memcpy(au64Data, _pu8Data, sizeof(au64Data));
+  memcpy(au64Key, _pu8Key, sizeof(au64Key));
+
+  /* En/De-crypts them */
+  au64Data[0] ^= au64Key[0];
+  au64Data[1] ^= au64Key[1];
+
+  /* Stores them */
+  memcpy(_pu8Data, au64Data, sizeof(au64Data));
+
+  return;
+}
+
+#define orxCONFIG_CRYPT_BLOCK(DATA, KEY)          orxConfig_CryptBlock(DATA, KEY)
+
+#endif /* !orxCONFIG_CRYPT_BLOCK */
+
+/** Expands current encryption key to its stream
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxINLINE orxSTATUS orxConfig_ExpandEncryptionKey()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Had a stream? */
+  if(sstConfig.au8EncryptionStream != orxNULL)
+  {
+    /* Deletes it */
+    orxMemory_Free(sstConfig.au8EncryptionStream);
+    sstConfig.au8EncryptionStream = orxNULL;
+  }
+
+  /* Has key? */
+  if(sstConfig.zEncryptionKey != orxNULL)
+  {
+    /* Gets period: smallest multiple of key size that holds a full block */
+    sstConfig.u32EncryptionPeriod = ((orxCONFIG_KU32_ENCRYPTION_BLOCK_SIZE + sstConfig.u32EncryptionKeySize - 1) / sstConfig.u32EncryptionKeySize) * sstConfig.u32EncryptionKeySize;
+
+    /* Allocates stream: a block can start anywhere in the period */
+    sstConfig.au8EncryptionStream = (orxU8 *)orxMemory_Allocate(sstConfig.u32EncryptionPeriod + orxCONFIG_KU32_ENCRYPTION_BLOCK_SIZE, orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(sstConfig.au8EncryptionStream != orxNULL)
+    {
+      orxU32 i;
+
+      /* Repeats key over the whole stream */
+      for(i = 0; i < sstConfig.u32EncryptionPeriod + orxCONFIG_KU32_ENCRYPTION_BLOCK_SIZE; i++)
+      {
+        sstConfig.au8EncryptionStream[i] = (orxU8)sstConfig.zEncryptionKey[i % sstConfig.u32EncryptionKeySize];
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't allocate encryption key stream.");
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Clears period if no stream */
+  if(sstConfig.au8EncryptionStream == orxNULL)
+  {
+    sstConfig.u32EncryptionPeriod = 0;
+  }
+
+  /* Resets offset */
+  sstConfig.u32EncryptionOffset = 0;
+
+  /* Done! */
+  return eResult;
+}
+
+/** En/De-crypts a buffer using global encryption key stream, a block at a time
  * @param[in] _acBuffer         Buffer to en/de-crypt
  * @param[in] _u32BufferSize    Buffer size
  */
 static orxINLINE void orxConfig_CryptBuffer(orxCHAR *_acBuffer, orxU32 _u32BufferSize)
 {
-  orxCHAR *pc, *pcKey, *pcEndKey, *pcStartKey;
+  orxU8  *pu8, *pu8End;
+  orxU32  u32Offset;
 
-  orxASSERT(sstConfig.zEncryptionKey != orxNULL);
+  orxASSERT(sstConfig.au8EncryptionStream != orxNULL);
 
-  /* Gets current, first and last encryption character */
-  pcKey       = sstConfig.pcEncryptionChar;
-  pcStartKey  = sstConfig.zEncryptionKey;
-  pcEndKey    = sstConfig.zEncryptionKey + sstConfig.u32EncryptionKeySize - 1;
+  /* Gets current stream offset */
+  u32Offset = sstConfig.u32EncryptionOffset;
 
-  /* For all characters */
-  for(pc = _acBuffer; pc < _acBuffer + _u32BufferSize; pc++)
+  /* For all full blocks */
+  for(pu8 = (orxU8 *)_acBuffer, pu8End = pu8 + (_u32BufferSize & ~(orxCONFIG_KU32_ENCRYPTION_BLOCK_SIZE - 1));
+      pu8 < pu8End;
+      pu8 += orxCONFIG_KU32_ENCRYPTION_BLOCK_SIZE)
+  {
+    /* En/De-crypts block */
+    orxCONFIG_CRYPT_BLOCK(pu8, sstConfig.au8EncryptionStream + u32Offset);
+
+    /* Updates stream offset */
+    u32Offset += orxCONFIG_KU32_ENCRYPTION_BLOCK_SIZE;
+    if(u32Offset >= sstConfig.u32EncryptionPeriod)
+    {
+      u32Offset -= sstConfig.u32EncryptionPeriod;
+    }
+  }
+
+  /* For all remaining characters */
+  for(pu8End = (orxU8 *)_acBuffer + _u32BufferSize; pu8 < pu8End; pu8++)
   {
     /* En/De-crypts character */
-    *pc ^= *pcKey;
+    *pu8 ^= sstConfig.au8EncryptionStream[u32Offset];
 
-    /* Updates key pointer */
-    pcKey = (pcKey == pcEndKey) ? sstConfig.zEncryptionKey : pcKey + 1;
+    /* Updates stream offset */
+    if(++u32Offset == sstConfig.u32EncryptionPeriod)
+    {
+      u32Offset = 0;
+    }
   }
 
-  /* Updates global current encryption character */
-  sstConfig.pcEncryptionChar = pcKey;
+  /* Updates global stream offset */
+  sstConfig.u32EncryptionOffset = u32Offset;
 
   return;
 }
 
+/** Copies next chunk of a file view to a buffer
+ * @param[in] _pstView          File view
+ * @param[in,out] _pu32Position Current position in view, will be updated
+ * @param[out] _acBuffer        Destination buffer
+ * @param[in] _u32BufferSize    Destination buffer size
+ * @return                      Number of copied characters
+ */
+static orxINLINE orxU32 orxConfig_ReadView(const orxFILE_VIEW *_pstView, orxU32 *_pu32Position, orxCHAR *_acBuffer, orxU32 _u32BufferSize)
+{
+  orxU32 u32Result;
+
+  /* Gets chunk size */
+  u32Result = orxMIN(_u32BufferSize, _pstView->u32Size - *_pu32Position);
+
+  /* Copies it */
+  orxMemory_Copy(_acBuffer, _pstView->pcData + *_pu32Position, u32Result);
+
+  /* Updates position */
+  *_pu32Position += u32Result;
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Gets an entry from the current section
  * @param[in] _u32KeyID         Entry key ID
  * @return                      orxCONFIG_ENTRY / orxNULL
@@ -663,6 +852,9 @@ static orxINLINE orxSTATUS orxConfig_AddEntry(const orxSTRING _zKey, const orxST
           /* Sets its ID */
           pstEntry->u32ID = orxString_ToCRC(pstEntry->zKey);
 
+          /* Sets its origin */
+          pstEntry->u32Origin = (sstConfig.u32LoadCounter != 0) ? sstConfig.u32Origin : orxCONFIG_KU32_ORIGIN_RUNTIME;
+
           /* Inits its type */
           pstEntry->stValue.eType = orxCONFIG_VALUE_TYPE_STRING;
 
@@ -777,6 +969,9 @@ static orxINLINE orxCONFIG_SECTION *orxConfig_CreateSection(const orxSTRING _zSe
 
           /* Clears its protection counter */
           pstSection->s32ProtectionCounter = 0;
+
+          /* Clears its flags */
+          pstSection->u32Flags = orxCONFIG_SECTION_KU32_FLAG_NONE;
         }
         else
         {
@@ -884,6 +1079,295 @@ static orxINLINE void orxConfig_DeleteSection(orxCONFIG_SECTION *_pstSection)
   return;
 }
 
+/** Sends a config event
+ * @param[in] _eEventID         Event ID
+ * @param[in] _zFileName        Concerned file name, orxNULL for the whole history
+ * @param[in] _zSectionName     Concerned section name, orxNULL for none
+ */
+static orxINLINE void orxConfig_SendEvent(orxCONFIG_EVENT _eEventID, const orxSTRING _zFileName, const orxSTRING _zSectionName)
+{
+  /* Is event module initialized? */
+  if(orxModule_IsInitialized(orxMODULE_ID_EVENT) != orxFALSE)
+  {
+    orxCONFIG_EVENT_PAYLOAD stPayload;
+
+    /* Inits payload */
+    stPayload.zFileName     = (orxSTRING)_zFileName;
+    stPayload.zSectionName  = (orxSTRING)_zSectionName;
+
+    /* Sends it */
+    orxEVENT_SEND(orxEVENT_TYPE_CONFIG, _eEventID, orxNULL, orxNULL, &stPayload);
+  }
+
+  return;
+}
+
+/** Refreshes an already defined entry during an incremental reload
+ * @param[in] _pstEntry         Concerned entry
+ * @param[in] _zValue           New literal value
+ * @param[in] _bBlockMode       Block mode (ie. ignore special characters)?
+ * @return                      orxTRUE if the entry has been kept, orxFALSE if it has to be replaced
+ */
+static orxINLINE orxBOOL orxConfig_RefreshEntry(orxCONFIG_ENTRY *_pstEntry, const orxSTRING _zValue, orxBOOL _bBlockMode)
+{
+  orxBOOL bResult = orxFALSE;
+
+  /* Checks */
+  orxASSERT(_pstEntry != orxNULL);
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_RELOAD));
+
+  /* Overridden by a file loaded afterwards or at runtime? */
+  if(_pstEntry->u32Origin > sstConfig.u32Origin)
+  {
+    /* Keeps it */
+    bResult = orxTRUE;
+  }
+  /* Same mode? */
+  else if(orxFLAG_TEST(_pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_BLOCK_MODE) == _bBlockMode)
+  {
+    orxSTRING zValue;
+
+    /* Gets new value as it'd be stored */
+    zValue = orxConfig_DuplicateValue(_zValue, _bBlockMode);
+
+    /* Valid? */
+    if(zValue != orxNULL)
+    {
+      /* Not in block mode? */
+      if(_bBlockMode == orxFALSE)
+      {
+        /* Restores literal value */
+        orxConfig_RestoreLiteralValue(&(_pstEntry->stValue));
+      }
+
+      /* Unchanged? */
+      if(orxString_Compare(zValue, _pstEntry->stValue.zValue) == 0)
+      {
+        /* Not in block mode? */
+        if(_bBlockMode == orxFALSE)
+        {
+          /* Computes working value */
+          orxConfig_ComputeWorkingValue(&(_pstEntry->stValue));
+        }
+        else
+        {
+          /* Updates flags */
+          _pstEntry->stValue.u16Flags &= ~orxCONFIG_VALUE_KU16_FLAG_STALE;
+        }
+
+        /* Updates its origin */
+        _pstEntry->u32Origin = sstConfig.u32Origin;
+
+        /* Keeps it */
+        bResult = orxTRUE;
+      }
+
+      /* Deletes new value */
+      orxString_Delete(zValue);
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Gets the name of the file that has been loaded with the given origin
+ * @param[in] _u32Origin        Concerned origin (load index)
+ * @return                      File name / orxNULL
+ */
+static orxINLINE orxSTRING orxConfig_GetOriginFileName(orxU32 _u32Origin)
+{
+  orxSTRING zResult = orxNULL;
+
+  /* Base file? */
+  if(_u32Origin == 0)
+  {
+    /* Updates result */
+    zResult = sstConfig.zBaseFile;
+  }
+  /* Has history? */
+  else if(sstConfig.pstHistoryBank != orxNULL)
+  {
+    orxSTRING  *pzHistoryEntry;
+    orxU32      i;
+
+    /* Finds corresponding history entry */
+    for(pzHistoryEntry = (orxSTRING *)orxBank_GetNext(sstConfig.pstHistoryBank, orxNULL), i = 1;
+        (pzHistoryEntry != orxNULL) && (i < _u32Origin);
+        pzHistoryEntry = (orxSTRING *)orxBank_GetNext(sstConfig.pstHistoryBank, pzHistoryEntry), i++);
+
+    /* Found? */
+    if(pzHistoryEntry != orxNULL)
+    {
+      /* Updates result */
+      zResult = *pzHistoryEntry;
+    }
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+/** Starts watching a config file
+ * @param[in] _pstWatch         Concerned watch
+ */
+static orxINLINE void orxConfig_ArmWatch(orxCONFIG_WATCH *_pstWatch)
+{
+  orxFILESYSTEM_INFO stInfo;
+
+  /* Checks */
+  orxASSERT(_pstWatch != orxNULL);
+
+#ifdef __orxLINUX__
+
+  /* Uses notifications? */
+  if(sstConfig.s32NotifyDescriptor >= 0)
+  {
+    /* Adds watch descriptor */
+    _pstWatch->s32Descriptor = inotify_add_watch(sstConfig.s32NotifyDescriptor, _pstWatch->zFileName, IN_CLOSE_WRITE | IN_MOVE_SELF | IN_DELETE_SELF);
+  }
+
+#endif /* __orxLINUX__ */
+
+  /* Stores its time stamp */
+  _pstWatch->u32TimeStamp = (orxFileSystem_Info(_pstWatch->zFileName, &stInfo) != orxSTATUS_FAILURE) ? stInfo.u32TimeStamp : 0;
+
+  return;
+}
+
+/** Adds a file to the watch list
+ * @param[in] _zFileName        Concerned file name
+ */
+static orxINLINE void orxConfig_AddWatch(const orxSTRING _zFileName)
+{
+  orxCONFIG_WATCH *pstWatch;
+
+  /* Checks */
+  orxASSERT(sstConfig.pstWatchBank != orxNULL);
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Finds it */
+  for(pstWatch = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, orxNULL);
+      (pstWatch != orxNULL) && (orxString_Compare(pstWatch->zFileName, _zFileName) != 0);
+      pstWatch = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, pstWatch));
+
+  /* Found? */
+  if(pstWatch != orxNULL)
+  {
+    /* Updates its origin */
+    pstWatch->u32Origin = sstConfig.u32Origin;
+  }
+  /* Not packed? */
+  else if(orxFile_GetPackedInfo(_zFileName, orxNULL, orxNULL) == orxFALSE)
+  {
+    /* Allocates watch */
+    pstWatch = (orxCONFIG_WATCH *)orxBank_Allocate(sstConfig.pstWatchBank);
+
+    /* Valid? */
+    if(pstWatch != orxNULL)
+    {
+      /* Inits it */
+      pstWatch->zFileName     = orxString_Duplicate(_zFileName);
+      pstWatch->u32Origin     = sstConfig.u32Origin;
+      pstWatch->s32Descriptor = -1;
+      pstWatch->bModified     = orxFALSE;
+
+      /* Starts watching it */
+      orxConfig_ArmWatch(pstWatch);
+    }
+  }
+
+  return;
+}
+
+/** Deletes all watches
+ */
+static orxINLINE void orxConfig_DeleteWatches()
+{
+  orxCONFIG_WATCH *pstWatch;
+
+  /* Checks */
+  orxASSERT(sstConfig.pstWatchBank != orxNULL);
+
+  /* For all watches */
+  for(pstWatch = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, orxNULL);
+      pstWatch != orxNULL;
+      pstWatch = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, pstWatch))
+  {
+    /* Deletes its name */
+    orxString_Delete(pstWatch->zFileName);
+  }
+
+#ifdef __orxLINUX__
+
+  /* Uses notifications? */
+  if(sstConfig.s32NotifyDescriptor >= 0)
+  {
+    /* Closes it, removing all watch descriptors */
+    close(sstConfig.s32NotifyDescriptor);
+    sstConfig.s32NotifyDescriptor = -1;
+  }
+
+#endif /* __orxLINUX__ */
+
+  /* Deletes bank */
+  orxBank_Delete(sstConfig.pstWatchBank);
+  sstConfig.pstWatchBank    = orxNULL;
+  sstConfig.pstWatchCursor  = orxNULL;
+
+  return;
+}
+
+/** Gets the next modified watched file that can be reloaded, clearing the modified status of all the files sharing its origin
+ * @return                      orxCONFIG_WATCH / orxNULL
+ */
+static orxINLINE orxCONFIG_WATCH *orxConfig_GetModifiedWatch()
+{
+  orxCONFIG_WATCH *pstResult, *pstWatch;
+
+  /* Checks */
+  orxASSERT(sstConfig.pstWatchBank != orxNULL);
+
+  /* Finds first modified watch with an existing file */
+  for(pstResult = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, orxNULL);
+      (pstResult != orxNULL) && ((pstResult->bModified == orxFALSE) || (orxFileSystem_Exists(pstResult->zFileName) == orxFALSE));
+      pstResult = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, pstResult));
+
+  /* Found? */
+  if(pstResult != orxNULL)
+  {
+    /* For all watches */
+    for(pstWatch = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, orxNULL);
+        pstWatch != orxNULL;
+        pstWatch = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, pstWatch))
+    {
+      /* Same origin? */
+      if(pstWatch->u32Origin == pstResult->u32Origin)
+      {
+        /* Isn't watched anymore? */
+        if(pstWatch->s32Descriptor < 0)
+        {
+          /* Watches it again (file was replaced) */
+          orxConfig_ArmWatch(pstWatch);
+        }
+        else
+        {
+          orxFILESYSTEM_INFO stInfo;
+
+          /* Updates its time stamp */
+          pstWatch->u32TimeStamp = (orxFileSystem_Info(pstWatch->zFileName, &stInfo) != orxSTATUS_FAILURE) ? stInfo.u32TimeStamp : 0;
+        }
+
+        /* Updates status */
+        pstWatch->bModified = orxFALSE;
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Reads a signed integer value from config value
  * @param[in]   _pstValue         Concerned config value
  * @param[in]   _s32ListIndex      List index
@@ -1479,6 +1963,9 @@ void orxFASTCALL orxConfig_Setup()
   orxModule_AddDependency(orxMODULE_ID_CONFIG, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_CONFIG, orxMODULE_ID_BANK);
   orxModule_AddDependency(orxMODULE_ID_CONFIG, orxMODULE_ID_FILE);
+  orxModule_AddDependency(orxMODULE_ID_CONFIG, orxMODULE_ID_FILESYSTEM);
+
+  orxModule_AddOptionalDependency(orxMODULE_ID_CONFIG, orxMODULE_ID_EVENT);
 
   return;
 }
@@ -1495,16 +1982,23 @@ orxSTATUS orxFASTCALL orxConfig_Init()
   {
     orxCHAR   zBackupBaseFile[orxCONFIG_KU32_BASE_FILENAME_LENGTH];
     orxSTRING zBackupEncryptionKey;
+    orxU8    *au8BackupEncryptionStream;
+    orxU32    u32BackupEncryptionPeriod;
 
     /* Backups base file name */
     orxMemory_Copy(zBackupBaseFile, sstConfig.zBaseFile, orxCONFIG_KU32_BASE_FILENAME_LENGTH);
 
-    /* Backups encryption key */
-    zBackupEncryptionKey = sstConfig.zEncryptionKey;
+    /* Backups encryption key & stream */
+    zBackupEncryptionKey      = sstConfig.zEncryptionKey;
+    au8BackupEncryptionStream = sstConfig.au8EncryptionStream;
+    u32BackupEncryptionPeriod = sstConfig.u32EncryptionPeriod;
 
     /* Cleans control structure */
     orxMemory_Zero(&sstConfig, sizeof(orxCONFIG_STATIC));
 
+    /* Clears notification descriptor */
+    sstConfig.s32NotifyDescriptor = -1;
+
     /* Valid base file name? */
     if(*zBackupBaseFile != orxCHAR_NULL)
     {
@@ -1523,7 +2017,8 @@ orxSTATUS orxFASTCALL orxConfig_Init()
       /* Restores it */
       sstConfig.zEncryptionKey        = zBackupEncryptionKey;
       sstConfig.u32EncryptionKeySize  = orxString_GetLength(zBackupEncryptionKey);
-      sstConfig.pcEncryptionChar      = sstConfig.zEncryptionKey;
+      sstConfig.au8EncryptionStream   = au8BackupEncryptionStream;
+      sstConfig.u32EncryptionPeriod   = u32BackupEncryptionPeriod;
     }
     else
     {
@@ -1551,6 +2046,19 @@ orxSTATUS orxFASTCALL orxConfig_Init()
       /* Pushes config section */
       orxConfig_PushSection(orxCONFIG_KZ_CONFIG_SECTION);
 
+      /* Has packs? */
+      if(orxConfig_HasValue(orxCONFIG_KZ_CONFIG_PACK_LIST) != orxFALSE)
+      {
+        orxS32 i, s32Number;
+
+        /* For all packs */
+        for(i = 0, s32Number = orxConfig_GetListCounter(orxCONFIG_KZ_CONFIG_PACK_LIST); i < s32Number; i++)
+        {
+          /* Mounts it */
+          orxFile_Mount(orxConfig_GetListString(orxCONFIG_KZ_CONFIG_PACK_LIST, i));
+        }
+      }
+
       /* Should keep history? */
       if(orxConfig_GetBool(orxCONFIG_KZ_CONFIG_HISTORY) != orxFALSE)
       {
@@ -1562,6 +2070,35 @@ orxSTATUS orxFASTCALL orxConfig_Init()
         {
           /* Updates flags */
           orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_HISTORY, orxCONFIG_KU32_STATIC_FLAG_NONE);
+
+          /* Should watch history? */
+          if(orxConfig_GetBool(orxCONFIG_KZ_CONFIG_WATCH) != orxFALSE)
+          {
+            /* Creates watch bank */
+            sstConfig.pstWatchBank = orxBank_Create(orxCONFIG_KU32_WATCH_BANK_SIZE, sizeof(orxCONFIG_WATCH), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_CONFIG);
+
+            /* Valid? */
+            if(sstConfig.pstWatchBank != orxNULL)
+            {
+#ifdef __orxLINUX__
+
+              /* Creates notification descriptor, polling will be used if it fails */
+              sstConfig.s32NotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+#endif /* __orxLINUX__ */
+
+              /* Updates flags */
+              orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_WATCH, orxCONFIG_KU32_STATIC_FLAG_NONE);
+
+              /* Watches base file */
+              orxConfig_AddWatch(sstConfig.zBaseFile);
+            }
+            else
+            {
+              /* Logs message */
+              orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Failed to create watch bank, config files won't be watched.");
+            }
+          }
         }
         else
         {
@@ -1650,6 +2187,13 @@ void orxFASTCALL orxConfig_Exit()
       sstConfig.pstHistoryBank = orxNULL;
     }
 
+    /* Has watch bank? */
+    if(sstConfig.pstWatchBank != orxNULL)
+    {
+      /* Deletes all watches */
+      orxConfig_DeleteWatches();
+    }
+
     /* Updates flags */
     orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_NONE, orxCONFIG_KU32_STATIC_MASK_ALL);
   }
@@ -1678,16 +2222,17 @@ orxSTATUS orxFASTCALL orxConfig_SetEncryptionKey(const orxSTRING _zEncryptionKey
     /* Updates values */
     sstConfig.zEncryptionKey        = orxString_Duplicate(_zEncryptionKey);
     sstConfig.u32EncryptionKeySize  = orxString_GetLength(sstConfig.zEncryptionKey);
-    sstConfig.pcEncryptionChar      = sstConfig.zEncryptionKey;
   }
   else
   {
     /* Updates values */
     sstConfig.zEncryptionKey        = orxNULL;
     sstConfig.u32EncryptionKeySize  = 0;
-    sstConfig.pcEncryptionChar      = orxNULL;
   }
 
+  /* Expands key stream */
+  eResult = orxConfig_ExpandEncryptionKey();
+
   /* Done! */
   return eResult;
 }
@@ -1868,10 +2413,17 @@ orxSTATUS orxFASTCALL orxConfig_SelectSection(const orxSTRING _zSectionName)
       if(sstConfig.u32LoadCounter != 0)
       {
         /* Has new parent ID? */
-        if(u32ParentID != orxU32_UNDEFINED)
+        if((u32ParentID != orxU32_UNDEFINED) && (u32ParentID != pstSection->u32ParentID))
         {
           /* Updates parent ID */
           pstSection->u32ParentID = u32ParentID;
+
+          /* Reloading? */
+          if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_RELOAD))
+          {
+            /* Marks section as updated */
+            orxFLAG_SET(pstSection->u32Flags, orxCONFIG_SECTION_KU32_FLAG_UPDATED, orxCONFIG_SECTION_KU32_FLAG_NONE);
+          }
         }
       }
     }
@@ -2133,8 +2685,8 @@ orxSTATUS orxFASTCALL orxConfig_PopSection()
  */
 orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
 {
-  orxFILE  *pstFile;
-  orxSTATUS eResult = orxSTATUS_FAILURE;
+  orxFILE_VIEW  stView;
+  orxSTATUS     eResult = orxSTATUS_FAILURE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
@@ -2156,6 +2708,9 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
       {
         /* Stores the file name */
         *pzEntry = orxString_Duplicate(_zFileName);
+
+        /* Updates origin */
+        sstConfig.u32Origin = orxBank_GetCounter(sstConfig.pstHistoryBank);
       }
     }
   }
@@ -2164,26 +2719,33 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
   sstConfig.u32LoadCounter++;
 
   /* Valid file to open? */
-  if((_zFileName != orxSTRING_EMPTY) && ((pstFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY)) != orxNULL))
+  if((_zFileName != orxSTRING_EMPTY) && (orxFile_Map(_zFileName, orxFILE_KU32_FLAG_MAP_SEQUENTIAL, &stView) != orxSTATUS_FAILURE))
   {
-    orxCHAR             acBuffer[orxCONFIG_KU32_BUFFER_SIZE], *pcPreviousEncryptionChar;
-    orxU32              u32Size, u32Offset;
+    orxCHAR             acBuffer[orxCONFIG_KU32_BUFFER_SIZE];
+    orxU32              u32Size, u32Offset, u32Position = 0, u32PreviousEncryptionOffset;
     orxBOOL             bUseEncryption = orxFALSE, bFirstTime;
     orxCONFIG_SECTION  *pstPreviousSection;
 
+    /* Should watch it? */
+    if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_WATCH))
+    {
+      /* Adds it to watch list */
+      orxConfig_AddWatch(_zFileName);
+    }
+
     /* Gets previous config section */
     pstPreviousSection = sstConfig.pstCurrentSection;
 
-    /* Gets previous encryption character */
-    pcPreviousEncryptionChar = sstConfig.pcEncryptionChar;
+    /* Gets previous encryption offset */
+    u32PreviousEncryptionOffset = sstConfig.u32EncryptionOffset;
 
-    /* Reinits current encryption character */
-    sstConfig.pcEncryptionChar = sstConfig.zEncryptionKey;
+    /* Reinits current encryption offset */
+    sstConfig.u32EncryptionOffset = 0;
 
     /* While file isn't empty */
-    for(u32Size = orxFile_Read(acBuffer, sizeof(orxCHAR), orxCONFIG_KU32_BUFFER_SIZE, pstFile), u32Offset = 0, bFirstTime = orxTRUE;
+    for(u32Size = orxConfig_ReadView(&stView, &u32Position, acBuffer, orxCONFIG_KU32_BUFFER_SIZE), u32Offset = 0, bFirstTime = orxTRUE;
         u32Size > 0;
-        u32Size = orxFile_Read(acBuffer + u32Offset, sizeof(orxCHAR), orxCONFIG_KU32_BUFFER_SIZE - u32Offset, pstFile) + u32Offset, bFirstTime = orxFALSE)
+        u32Size = orxConfig_ReadView(&stView, &u32Position, acBuffer + u32Offset, orxCONFIG_KU32_BUFFER_SIZE - u32Offset) + u32Offset, bFirstTime = orxFALSE)
     {
       orxCHAR  *pc, *pcKeyEnd, *pcValueStart, *pcLineStart;
       orxBOOL   bBlockMode;
@@ -2251,6 +2813,7 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
             orxU32            u32KeyID;
             orxSTRING         pcValueEnd;
             orxCONFIG_ENTRY  *pstEntry;
+            orxBOOL           bAddEntry = orxTRUE;
 
             /* Finds end of value position */
             for(pcValueEnd = pc - 1;
@@ -2279,22 +2842,43 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
             /* Already defined? */
             if((pstEntry = orxConfig_GetEntry(u32KeyID)) != orxNULL)
             {
-              /* Not in block mode? */
-              if(!orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_BLOCK_MODE))
+              /* Reloading and up-to-date? */
+              if((orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_RELOAD))
+              && (orxConfig_RefreshEntry(pstEntry, pcValueStart, bBlockMode) != orxFALSE))
               {
-                /* Restores literal value */
-                orxConfig_RestoreLiteralValue(&(pstEntry->stValue));
+                /* Keeps it */
+                bAddEntry = orxFALSE;
               }
+              else
+              {
+                /* Not in block mode? */
+                if(!orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_BLOCK_MODE))
+                {
+                  /* Restores literal value */
+                  orxConfig_RestoreLiteralValue(&(pstEntry->stValue));
+                }
 
-              /* Logs */
-              orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Config entry [%s::%s]: Replacing value \"%s\" with new value \"%s\" from <%s>.", sstConfig.pstCurrentSection->zName, pstEntry->zKey, pstEntry->stValue.zValue, pcValueStart, _zFileName);
+                /* Logs */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Config entry [%s::%s]: Replacing value \"%s\" with new value \"%s\" from <%s>.", sstConfig.pstCurrentSection->zName, pstEntry->zKey, pstEntry->stValue.zValue, pcValueStart, _zFileName);
 
-              /* Deletes entry */
-              orxConfig_DeleteEntry(sstConfig.pstCurrentSection, pstEntry);
+                /* Deletes entry */
+                orxConfig_DeleteEntry(sstConfig.pstCurrentSection, pstEntry);
+              }
             }
 
-            /* Adds entry */
-            orxConfig_AddEntry(pcLineStart, pcValueStart, bBlockMode);
+            /* Should add entry? */
+            if(bAddEntry != orxFALSE)
+            {
+              /* Adds entry */
+              orxConfig_AddEntry(pcLineStart, pcValueStart, bBlockMode);
+
+              /* Reloading? */
+              if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_RELOAD))
+              {
+                /* Marks section as updated */
+                orxFLAG_SET(sstConfig.pstCurrentSection->u32Flags, orxCONFIG_SECTION_KU32_FLAG_UPDATED, orxCONFIG_SECTION_KU32_FLAG_NONE);
+              }
+            }
 
             /* Updates pointers */
             pcKeyEnd = pcValueStart = orxNULL;
@@ -2567,14 +3151,17 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
       }
     }
 
+    /* Unmaps file */
+    orxFile_Unmap(&stView);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
 
     /* Pops previous section */
     sstConfig.pstCurrentSection = pstPreviousSection;
 
-    /* Restores previous encryption character */
-    sstConfig.pcEncryptionChar = pcPreviousEncryptionChar;
+    /* Restores previous encryption offset */
+    sstConfig.u32EncryptionOffset = u32PreviousEncryptionOffset;
   }
   else
   {
@@ -2603,6 +3190,12 @@ orxSTATUS orxFASTCALL orxConfig_ReloadHistory()
   /* Has history? */
   if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_HISTORY))
   {
+    orxCONFIG_SECTION  *pstSection;
+    orxU32              u32Origin;
+
+    /* Sends event */
+    orxConfig_SendEvent(orxCONFIG_EVENT_RELOAD_START, orxNULL, orxNULL);
+
     /* Removes history flag */
     orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_NONE, orxCONFIG_KU32_STATIC_FLAG_HISTORY);
 
@@ -2610,17 +3203,19 @@ orxSTATUS orxFASTCALL orxConfig_ReloadHistory()
     orxConfig_Clear();
 
     /* Reloads default file */
+    sstConfig.u32Origin = 0;
     eResult = orxConfig_Load(sstConfig.zBaseFile);
 
     /* Logs */
     orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Config file [%s] has been reloaded.", sstConfig.zBaseFile);
 
     /* For all entries in history */
-    for(pzHistoryEntry = (orxSTRING *)orxBank_GetNext(sstConfig.pstHistoryBank, orxNULL);
+    for(pzHistoryEntry = (orxSTRING *)orxBank_GetNext(sstConfig.pstHistoryBank, orxNULL), u32Origin = 1;
         (pzHistoryEntry != orxNULL) && (eResult != orxSTATUS_FAILURE);
-        pzHistoryEntry = (orxSTRING *)orxBank_GetNext(sstConfig.pstHistoryBank, pzHistoryEntry))
+        pzHistoryEntry = (orxSTRING *)orxBank_GetNext(sstConfig.pstHistoryBank, pzHistoryEntry), u32Origin++)
     {
       /* Reloads it */
+      sstConfig.u32Origin = u32Origin;
       eResult = orxConfig_Load(*pzHistoryEntry);
 
       /* Logs */
@@ -2629,6 +3224,18 @@ orxSTATUS orxFASTCALL orxConfig_ReloadHistory()
 
     /* Restores history flag */
     orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_HISTORY, orxCONFIG_KU32_STATIC_FLAG_NONE);
+
+    /* For all sections */
+    for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        pstSection != orxNULL;
+        pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+    {
+      /* Sends event */
+      orxConfig_SendEvent(orxCONFIG_EVENT_SECTION_UPDATE, orxNULL, pstSection->zName);
+    }
+
+    /* Sends event */
+    orxConfig_SendEvent(orxCONFIG_EVENT_RELOAD_STOP, orxNULL, orxNULL);
   }
   else
   {
@@ -2643,6 +3250,293 @@ orxSTATUS orxFASTCALL orxConfig_ReloadHistory()
   return eResult;
 }
 
+/** Reloads a config file from history, only updating the keys it modified/removed and sending an event for every updated section.
+ * Values set at runtime or overridden by a file loaded afterwards are kept.
+ * @param[in] _zFileName        File name, as it was loaded
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_ReloadFile(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Has history? */
+  if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_HISTORY))
+  {
+    orxSTRING  *pzHistoryEntry;
+    orxU32      u32Origin, i;
+    orxBOOL     bFound;
+
+    /* Is base file? */
+    bFound    = (orxString_Compare(_zFileName, sstConfig.zBaseFile) == 0) ? orxTRUE : orxFALSE;
+    u32Origin = 0;
+
+    /* For all entries in history */
+    for(pzHistoryEntry = (orxSTRING *)orxBank_GetNext(sstConfig.pstHistoryBank, orxNULL), i = 1;
+        pzHistoryEntry != orxNULL;
+        pzHistoryEntry = (orxSTRING *)orxBank_GetNext(sstConfig.pstHistoryBank, pzHistoryEntry), i++)
+    {
+      /* Matches? */
+      if(orxString_Compare(_zFileName, *pzHistoryEntry) == 0)
+      {
+        /* Stores its origin, last load wins */
+        u32Origin = i;
+        bFound    = orxTRUE;
+      }
+    }
+
+    /* Found? */
+    if(bFound != orxFALSE)
+    {
+      orxCONFIG_SECTION  *pstSection;
+      orxCONFIG_ENTRY    *pstEntry, *pstNextEntry;
+      orxU32              u32PreviousOrigin, u32UpdateCounter = 0;
+
+      /* Sends event */
+      orxConfig_SendEvent(orxCONFIG_EVENT_RELOAD_START, _zFileName, orxNULL);
+
+      /* For all sections */
+      for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+          pstSection != orxNULL;
+          pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+      {
+        /* Clears its flags */
+        pstSection->u32Flags = orxCONFIG_SECTION_KU32_FLAG_NONE;
+
+        /* For all its entries */
+        for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+            pstEntry != orxNULL;
+            pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+        {
+          /* Comes from this file? */
+          if(pstEntry->u32Origin == u32Origin)
+          {
+            /* Marks it as stale till it's found again */
+            pstEntry->stValue.u16Flags |= orxCONFIG_VALUE_KU16_FLAG_STALE;
+          }
+        }
+      }
+
+      /* Removes history flag & sets reload one */
+      orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_RELOAD, orxCONFIG_KU32_STATIC_FLAG_HISTORY);
+
+      /* Reloads file */
+      u32PreviousOrigin   = sstConfig.u32Origin;
+      sstConfig.u32Origin = u32Origin;
+      eResult             = orxConfig_Load(_zFileName);
+      sstConfig.u32Origin = u32PreviousOrigin;
+
+      /* Restores history flag & removes reload one */
+      orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_HISTORY, orxCONFIG_KU32_STATIC_FLAG_RELOAD);
+
+      /* For all sections */
+      for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+          pstSection != orxNULL;
+          pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+      {
+        /* For all its entries */
+        for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+            pstEntry != orxNULL;
+            pstEntry = pstNextEntry)
+        {
+          /* Gets next entry */
+          pstNextEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode));
+
+          /* Still stale? */
+          if(orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_STALE))
+          {
+            /* Reloaded? */
+            if(eResult != orxSTATUS_FAILURE)
+            {
+              /* Logs */
+              orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Config entry [%s::%s]: Removed from <%s>.", pstSection->zName, pstEntry->zKey, _zFileName);
+
+              /* Deletes it */
+              orxConfig_DeleteEntry(pstSection, pstEntry);
+
+              /* Marks section as updated */
+              orxFLAG_SET(pstSection->u32Flags, orxCONFIG_SECTION_KU32_FLAG_UPDATED, orxCONFIG_SECTION_KU32_FLAG_NONE);
+            }
+            else
+            {
+              /* Keeps it */
+              pstEntry->stValue.u16Flags &= ~orxCONFIG_VALUE_KU16_FLAG_STALE;
+            }
+          }
+        }
+      }
+
+      /* For all sections */
+      for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+          pstSection != orxNULL;
+          pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+      {
+        /* Updated? */
+        if(orxFLAG_TEST(pstSection->u32Flags, orxCONFIG_SECTION_KU32_FLAG_UPDATED))
+        {
+          /* Clears its flags */
+          pstSection->u32Flags = orxCONFIG_SECTION_KU32_FLAG_NONE;
+
+          /* Updates counter */
+          u32UpdateCounter++;
+
+          /* Sends event */
+          orxConfig_SendEvent(orxCONFIG_EVENT_SECTION_UPDATE, _zFileName, pstSection->zName);
+        }
+      }
+
+      /* Logs */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Config file [%s] has been reloaded, %lu section(s) updated.", _zFileName, u32UpdateCounter);
+
+      /* Sends event */
+      orxConfig_SendEvent(orxCONFIG_EVENT_RELOAD_STOP, _zFileName, orxNULL);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't reload config file [%s]: not found in history.", _zFileName);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Config history isn't stored. Please check your config file under the [Config] section.");
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Checks watched config files (requires History & Watch in the [Config] section) and reloads the modified ones, should be called once per frame
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_UpdateWatch()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Watching? */
+  if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_WATCH))
+  {
+    orxCONFIG_WATCH *pstWatch;
+
+#ifdef __orxLINUX__
+
+    /* Uses notifications? */
+    if(sstConfig.s32NotifyDescriptor >= 0)
+    {
+      orxU8   au8Buffer[orxCONFIG_KU32_NOTIFY_BUFFER_SIZE] __attribute__((aligned(__alignof__(struct inotify_event))));
+      ssize_t s32Size;
+
+      /* For all pending notifications */
+      while((s32Size = read(sstConfig.s32NotifyDescriptor, au8Buffer, orxCONFIG_KU32_NOTIFY_BUFFER_SIZE)) > 0)
+      {
+        const struct inotify_event *pstEvent;
+        const orxU8                *pu8Event;
+
+        /* For all read events */
+        for(pu8Event = au8Buffer; pu8Event < au8Buffer + s32Size; pu8Event += sizeof(struct inotify_event) + pstEvent->len)
+        {
+          /* Gets it */
+          pstEvent = (const struct inotify_event *)pu8Event;
+
+          /* For all watches */
+          for(pstWatch = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, orxNULL);
+              pstWatch != orxNULL;
+              pstWatch = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, pstWatch))
+          {
+            /* Concerned? */
+            if(pstWatch->s32Descriptor == pstEvent->wd)
+            {
+              /* Marks it as modified */
+              pstWatch->bModified = orxTRUE;
+
+              /* File was replaced? */
+              if(pstEvent->mask & (IN_MOVE_SELF | IN_DELETE_SELF | IN_IGNORED))
+              {
+                /* No longer watching former one? */
+                if(!(pstEvent->mask & IN_IGNORED))
+                {
+                  /* Removes its descriptor */
+                  inotify_rm_watch(sstConfig.s32NotifyDescriptor, pstWatch->s32Descriptor);
+                }
+
+                /* Clears descriptor, it'll be watched again once reloaded */
+                pstWatch->s32Descriptor = -1;
+              }
+
+              break;
+            }
+          }
+        }
+      }
+    }
+    else
+
+#endif /* __orxLINUX__ */
+
+    {
+      /* Gets next watch to poll */
+      pstWatch = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, sstConfig.pstWatchCursor);
+
+      /* End of list? */
+      if(pstWatch == orxNULL)
+      {
+        /* Restarts from the beginning */
+        pstWatch = (orxCONFIG_WATCH *)orxBank_GetNext(sstConfig.pstWatchBank, orxNULL);
+      }
+
+      /* Valid? */
+      if(pstWatch != orxNULL)
+      {
+        orxFILESYSTEM_INFO stInfo;
+
+        /* Has a different time stamp? */
+        if((orxFileSystem_Info(pstWatch->zFileName, &stInfo) != orxSTATUS_FAILURE)
+        && (stInfo.u32TimeStamp != pstWatch->u32TimeStamp))
+        {
+          /* Marks it as modified */
+          pstWatch->bModified = orxTRUE;
+        }
+      }
+
+      /* Stores cursor */
+      sstConfig.pstWatchCursor = pstWatch;
+    }
+
+    /* For all modified files */
+    while((pstWatch = orxConfig_GetModifiedWatch()) != orxNULL)
+    {
+      orxSTRING zFileName;
+
+      /* Gets the file that loaded it */
+      zFileName = orxConfig_GetOriginFileName(pstWatch->u32Origin);
+
+      /* Valid? */
+      if(zFileName != orxNULL)
+      {
+        /* Logs */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Config file [%s] has been modified, reloading [%s].", pstWatch->zFileName, zFileName);
+
+        /* Reloads it */
+        if(orxConfig_ReloadFile(zFileName) == orxSTATUS_FAILURE)
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Writes config to given file. Will overwrite any existing file, including all comments.
  * @param[in] _zFileName        File name, if null or empty the default file name will be used
  * @param[in] _bUseEncryption   Use file encryption to make it human non-readable?
@@ -2680,17 +3574,17 @@ orxSTATUS orxFASTCALL orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEn
     if(pstFile != orxNULL)
     {
       orxCONFIG_SECTION  *pstSection;
-      orxCHAR             acBuffer[orxCONFIG_KU32_BUFFER_SIZE], *pcPreviousEncryptionChar = orxNULL;
-      orxU32              u32BufferSize;
+      orxCHAR             acBuffer[orxCONFIG_KU32_BUFFER_SIZE];
+      orxU32              u32BufferSize, u32PreviousEncryptionOffset = 0;
 
       /* Use encryption? */
       if(_bUseEncryption != orxFALSE)
       {
-        /* Gets previous encryption character */
-        pcPreviousEncryptionChar = sstConfig.pcEncryptionChar;
+        /* Gets previous encryption offset */
+        u32PreviousEncryptionOffset = sstConfig.u32EncryptionOffset;
 
-        /* Resets current encryption character */
-        sstConfig.pcEncryptionChar = sstConfig.zEncryptionKey;
+        /* Resets current encryption offset */
+        sstConfig.u32EncryptionOffset = 0;
 
         /* Adds encryption tag */
         orxFile_Print(pstFile, "%s", orxCONFIG_KZ_ENCRYPTION_TAG);
@@ -2799,8 +3693,8 @@ orxSTATUS orxFASTCALL orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEn
       /* Use encryption? */
       if(_bUseEncryption != orxFALSE)
       {
-        /* Restores previous encryption character */
-        sstConfig.pcEncryptionChar = pcPreviousEncryptionChar;
+        /* Restores previous encryption offset */
+        sstConfig.u32EncryptionOffset = u32PreviousEncryptionOffset;
       }
     }
   }
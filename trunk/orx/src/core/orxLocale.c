@@ -32,6 +32,7 @@
 #include "core/orxEvent.h"
 #include "debug/orxDebug.h"
 #include "core/orxConfig.h"
+#include "memory/orxMemory.h"
 #include "utils/orxString.h"
 
 
@@ -40,6 +41,7 @@
 #define orxLOCALE_KU32_STATIC_FLAG_NONE           0x00000000  /**< No flags */
 
 #define orxLOCALE_KU32_STATIC_FLAG_READY          0x00000001  /**< Ready flag */
+#define orxLOCALE_KU32_STATIC_FLAG_RELOADED       0x00000002  /**< Current language has been reloaded flag */
 
 #define orxLOCALE_KU32_STATIC_MASK_ALL            0xFFFFFFFF  /**< All mask */
 
@@ -49,16 +51,29 @@
 #define orxLOCALE_KZ_CONFIG_SECTION               "Locale"
 #define orxLOCALE_KZ_CONFIG_LANGUAGE_LIST         "LanguageList"
 
+#define orxLOCALE_KU32_TABLE_MIN_SIZE             16          /**< Minimum string table size */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** String table entry
+ */
+typedef struct __orxLOCALE_ENTRY_t
+{
+  orxU32              u32KeyID;             /**< Key ID (CRC), 0 for an empty entry : 4 */
+  orxSTRING           zValue;               /**< Value, owned by config : 8 */
+
+} orxLOCALE_ENTRY;
+
 /** Static structure
  */
 typedef struct __orxLOCALE_STATIC_t
 {
   orxSTRING           zCurrentLanguage;     /**< Current language */
+  orxLOCALE_ENTRY    *astEntryList;         /**< Current language string table (open addressing) */
+  orxU32              u32EntryMask;         /**< String table size - 1 */
   orxU32              u32Flags;             /**< Control flags */
 
 } orxLOCALE_STATIC;
@@ -77,6 +92,214 @@ static orxLOCALE_STATIC sstLocale;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Finds a string table entry
+ * @param[in] _u32KeyID         Key ID
+ * @return orxLOCALE_ENTRY / orxNULL
+ */
+static orxINLINE const orxLOCALE_ENTRY *orxLocale_FindEntry(orxU32 _u32KeyID)
+{
+  const orxLOCALE_ENTRY *pstResult = orxNULL;
+
+  /* Has table? */
+  if(sstLocale.astEntryList != orxNULL)
+  {
+    orxU32 i;
+
+    /* For all entries in probe sequence */
+    for(i = _u32KeyID & sstLocale.u32EntryMask; sstLocale.astEntryList[i].u32KeyID != 0; i = (i + 1) & sstLocale.u32EntryMask)
+    {
+      /* Found? */
+      if(sstLocale.astEntryList[i].u32KeyID == _u32KeyID)
+      {
+        /* Updates result */
+        pstResult = &(sstLocale.astEntryList[i]);
+
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Loads the string table of the current language, as a single block
+ */
+static void orxFASTCALL orxLocale_LoadTable()
+{
+  /* Has previous table? */
+  if(sstLocale.astEntryList != orxNULL)
+  {
+    /* Deletes it */
+    orxMemory_Free(sstLocale.astEntryList);
+    sstLocale.astEntryList = orxNULL;
+    sstLocale.u32EntryMask = 0;
+  }
+
+  /* Has current language? */
+  if(sstLocale.zCurrentLanguage != orxNULL)
+  {
+    orxS32 s32KeyCounter;
+    orxU32 u32Size;
+
+    /* Pushes its section */
+    orxConfig_PushSection(sstLocale.zCurrentLanguage);
+
+    /* Gets key counter */
+    s32KeyCounter = orxConfig_GetKeyCounter();
+
+    /* Gets table size (power of two, at most half full) */
+    for(u32Size = orxLOCALE_KU32_TABLE_MIN_SIZE; u32Size < (orxU32)(s32KeyCounter << 1); u32Size <<= 1);
+
+    /* Allocates table */
+    sstLocale.astEntryList = (orxLOCALE_ENTRY *)orxMemory_Allocate(u32Size * sizeof(orxLOCALE_ENTRY), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(sstLocale.astEntryList != orxNULL)
+    {
+      orxS32 i;
+
+      /* Cleans it */
+      orxMemory_Zero(sstLocale.astEntryList, u32Size * sizeof(orxLOCALE_ENTRY));
+      sstLocale.u32EntryMask = u32Size - 1;
+
+      /* For all keys */
+      for(i = 0; i < s32KeyCounter; i++)
+      {
+        orxSTRING zKey;
+        orxU32    u32KeyID, j;
+
+        /* Gets key & its ID */
+        zKey      = orxConfig_GetKey(i);
+        u32KeyID  = orxString_ToCRC(zKey);
+
+        /* Valid? */
+        if(u32KeyID != 0)
+        {
+          /* Finds its entry */
+          for(j = u32KeyID & sstLocale.u32EntryMask;
+              (sstLocale.astEntryList[j].u32KeyID != 0) && (sstLocale.astEntryList[j].u32KeyID != u32KeyID);
+              j = (j + 1) & sstLocale.u32EntryMask);
+
+          /* Stores it */
+          sstLocale.astEntryList[j].u32KeyID  = u32KeyID;
+          sstLocale.astEntryList[j].zValue    = orxConfig_GetString(zKey);
+        }
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Failed to allocate string table for language <%s>.", sstLocale.zCurrentLanguage);
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  return;
+}
+
+/** Event handler
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxLocale_EventHandler(const orxEVENT *_pstEvent)
+{
+  orxCONFIG_EVENT_PAYLOAD  *pstPayload;
+  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_CONFIG);
+
+  /* Gets payload */
+  pstPayload = (orxCONFIG_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+
+  /* Has current language? */
+  if(sstLocale.zCurrentLanguage != orxNULL)
+  {
+    /* Depending on event */
+    switch(_pstEvent->eID)
+    {
+      case orxCONFIG_EVENT_RELOAD_START:
+      {
+        /* Whole history? */
+        if(pstPayload->zFileName == orxNULL)
+        {
+          /* Has string table? */
+          if(sstLocale.astEntryList != orxNULL)
+          {
+            /* Deletes it: all config values are about to be cleared */
+            orxMemory_Free(sstLocale.astEntryList);
+            sstLocale.astEntryList = orxNULL;
+            sstLocale.u32EntryMask = 0;
+          }
+        }
+
+        break;
+      }
+
+      case orxCONFIG_EVENT_SECTION_UPDATE:
+      {
+        /* Current language? */
+        if(orxString_Compare(pstPayload->zSectionName, sstLocale.zCurrentLanguage) == 0)
+        {
+          /* Reloads its string table: its values may have been freed */
+          orxLocale_LoadTable();
+
+          /* Updates flags */
+          orxFLAG_SET(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_RELOADED, orxLOCALE_KU32_STATIC_FLAG_NONE);
+        }
+
+        break;
+      }
+
+      case orxCONFIG_EVENT_RELOAD_STOP:
+      {
+        /* Was reloaded? */
+        if(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_RELOADED))
+        {
+          orxLOCALE_EVENT_PAYLOAD stPayload;
+
+          /* Updates flags */
+          orxFLAG_SET(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_NONE, orxLOCALE_KU32_STATIC_FLAG_RELOADED);
+
+          /* Inits event payload */
+          orxMemory_Zero(&stPayload, sizeof(orxLOCALE_EVENT_PAYLOAD));
+          stPayload.zLanguage = sstLocale.zCurrentLanguage;
+
+          /* Sends it so that users can refresh their strings */
+          orxEVENT_SEND(orxEVENT_TYPE_LOCALE, orxLOCALE_EVENT_SELECT_LANGUAGE, orxNULL, orxNULL, &stPayload);
+        }
+
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Inits the module if its init has been deferred till its first use
+ */
+static orxINLINE void orxLocale_InitOnDemand()
+{
+  /* Not initialized? */
+  if(!orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY))
+  {
+    /* Inits it */
+    orxModule_Init(orxMODULE_ID_LOCALE);
+  }
+
+  return;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -87,6 +310,7 @@ static orxLOCALE_STATIC sstLocale;
 void orxFASTCALL orxLocale_Setup()
 {
   /* Adds module dependencies */
+  orxModule_AddDependency(orxMODULE_ID_LOCALE, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_LOCALE, orxMODULE_ID_CONFIG);
   orxModule_AddDependency(orxMODULE_ID_LOCALE, orxMODULE_ID_EVENT);
 
@@ -108,6 +332,9 @@ orxSTATUS orxFASTCALL orxLocale_Init()
     /* Inits Flags */
     orxFLAG_SET(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY, orxLOCALE_KU32_STATIC_MASK_ALL);
 
+    /* Registers config event handler, to rebuild the string table when the current language is reloaded */
+    orxEvent_AddHandler(orxEVENT_TYPE_CONFIG, orxLocale_EventHandler);
+
     /* Pushes locale config section */
     orxConfig_PushSection(orxLOCALE_KZ_CONFIG_SECTION);
 
@@ -147,6 +374,9 @@ void orxFASTCALL orxLocale_Exit()
   /* Initialized? */
   if(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY))
   {
+    /* Removes config event handler */
+    orxEvent_RemoveHandler(orxEVENT_TYPE_CONFIG, orxLocale_EventHandler);
+
     /* Has selected language? */
     if(sstLocale.zCurrentLanguage != orxNULL)
     {
@@ -157,6 +387,14 @@ void orxFASTCALL orxLocale_Exit()
       sstLocale.zCurrentLanguage = orxNULL;
     }
 
+    /* Has string table? */
+    if(sstLocale.astEntryList != orxNULL)
+    {
+      /* Deletes it */
+      orxMemory_Free(sstLocale.astEntryList);
+      sstLocale.astEntryList = orxNULL;
+    }
+
     /* Updates flags */
     orxFLAG_SET(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_NONE, orxLOCALE_KU32_STATIC_MASK_ALL);
   }
@@ -171,6 +409,9 @@ orxSTATUS orxFASTCALL orxLocale_SelectLanguage(const orxSTRING _zLanguage)
 {
   orxSTATUS eResult = orxSTATUS_FAILURE;
 
+  /* Inits module on first use */
+  orxLocale_InitOnDemand();
+
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY));
   orxASSERT(_zLanguage != orxNULL);
@@ -222,6 +463,9 @@ orxSTATUS orxFASTCALL orxLocale_SelectLanguage(const orxSTRING _zLanguage)
               /* Pops config section */
               orxConfig_PopSection();
 
+              /* Loads its string table */
+              orxLocale_LoadTable();
+
               /* Inits event payload */
               orxMemory_Zero(&stPayload, sizeof(orxLOCALE_EVENT_PAYLOAD));
               stPayload.zLanguage = sstLocale.zCurrentLanguage;
@@ -251,6 +495,9 @@ const orxSTRING orxFASTCALL orxLocale_GetCurrentLanguage()
 {
   orxSTRING zResult;
 
+  /* Inits module on first use */
+  orxLocale_InitOnDemand();
+
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY));
 
@@ -278,6 +525,9 @@ orxBOOL orxFASTCALL orxLocale_HasLanguage(const orxSTRING _zLanguage)
 {
   orxBOOL bResult = orxFALSE;
 
+  /* Inits module on first use */
+  orxLocale_InitOnDemand();
+
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY));
   orxASSERT(_zLanguage != orxNULL);
@@ -325,6 +575,9 @@ orxS32 orxFASTCALL orxLocale_GetLanguageCounter()
 {
   orxS32 s32Result;
 
+  /* Inits module on first use */
+  orxLocale_InitOnDemand();
+
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY));
 
@@ -349,6 +602,9 @@ const orxSTRING orxFASTCALL orxLocale_GetLanguage(orxS32 _s32LanguageIndex)
 {
   orxSTRING zResult;
 
+  /* Inits module on first use */
+  orxLocale_InitOnDemand();
+
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY));
 
@@ -373,6 +629,9 @@ orxBOOL orxFASTCALL orxLocale_HasString(const orxSTRING _zKey)
 {
   orxBOOL bResult;
 
+  /* Inits module on first use */
+  orxLocale_InitOnDemand();
+
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
@@ -381,14 +640,23 @@ orxBOOL orxFASTCALL orxLocale_HasString(const orxSTRING _zKey)
   /* Has current language? */
   if(sstLocale.zCurrentLanguage != orxNULL)
   {
-    /* Pushes its section */
-    orxConfig_PushSection(sstLocale.zCurrentLanguage);
+    /* In string table? */
+    if(orxLocale_FindEntry(orxString_ToCRC(_zKey)) != orxNULL)
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+    }
+    else
+    {
+      /* Pushes its section */
+      orxConfig_PushSection(sstLocale.zCurrentLanguage);
 
-    /* Updates result */
-    bResult = orxConfig_HasValue(_zKey);
+      /* Updates result (inherited keys) */
+      bResult = orxConfig_HasValue(_zKey);
 
-    /* Pops config section */
-    orxConfig_PopSection();
+      /* Pops config section */
+      orxConfig_PopSection();
+    }
   }
   else
   {
@@ -408,6 +676,9 @@ orxSTRING orxFASTCALL orxLocale_GetString(const orxSTRING _zKey)
 {
   orxSTRING zResult;
 
+  /* Inits module on first use */
+  orxLocale_InitOnDemand();
+
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
@@ -416,14 +687,28 @@ orxSTRING orxFASTCALL orxLocale_GetString(const orxSTRING _zKey)
   /* Has current language? */
   if(sstLocale.zCurrentLanguage != orxNULL)
   {
-    /* Pushes its section */
-    orxConfig_PushSection(sstLocale.zCurrentLanguage);
+    const orxLOCALE_ENTRY *pstEntry;
 
-    /* Updates result */
-    zResult = orxConfig_GetString(_zKey);
+    /* Finds its entry */
+    pstEntry = orxLocale_FindEntry(orxString_ToCRC(_zKey));
 
-    /* Pops config section */
-    orxConfig_PopSection();
+    /* Found? */
+    if(pstEntry != orxNULL)
+    {
+      /* Updates result */
+      zResult = pstEntry->zValue;
+    }
+    else
+    {
+      /* Pushes its section */
+      orxConfig_PushSection(sstLocale.zCurrentLanguage);
+
+      /* Updates result (inherited keys) */
+      zResult = orxConfig_GetString(_zKey);
+
+      /* Pops config section */
+      orxConfig_PopSection();
+    }
   }
   else
   {
@@ -435,6 +720,31 @@ orxSTRING orxFASTCALL orxLocale_GetString(const orxSTRING _zKey)
   return zResult;
 }
 
+/** Reads a string in the current language for the given pre-hashed key (inherited keys aren't found)
+ * @param[in] _u32KeyID         Key ID (orxString_ToCRC of its name)
+ * @return The value / orxNULL if not found
+ */
+orxSTRING orxFASTCALL orxLocale_GetStringFromID(orxU32 _u32KeyID)
+{
+  const orxLOCALE_ENTRY  *pstEntry;
+  orxSTRING               zResult;
+
+  /* Inits module on first use */
+  orxLocale_InitOnDemand();
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY));
+
+  /* Finds its entry */
+  pstEntry = orxLocale_FindEntry(_u32KeyID);
+
+  /* Updates result */
+  zResult = (pstEntry != orxNULL) ? pstEntry->zValue : orxNULL;
+
+  /* Done! */
+  return zResult;
+}
+
 /** Writes a string in the current language for the given key
  * @param[in] _zKey             Key name
  * @param[in] _zValue           Value
@@ -444,6 +754,9 @@ orxSTATUS orxFASTCALL orxLocale_SetString(const orxSTRING _zKey, const orxSTRING
 {
   orxSTATUS eResult;
 
+  /* Inits module on first use */
+  orxLocale_InitOnDemand();
+
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
@@ -464,6 +777,9 @@ orxSTATUS orxFASTCALL orxLocale_SetString(const orxSTRING _zKey, const orxSTRING
     /* Pops config section */
     orxConfig_PopSection();
 
+    /* Reloads string table (previous value has been freed) */
+    orxLocale_LoadTable();
+
     /* Inits event payload */
     orxMemory_Zero(&stPayload, sizeof(orxLOCALE_EVENT_PAYLOAD));
     stPayload.zLanguage     = sstLocale.zCurrentLanguage;
@@ -490,6 +806,9 @@ orxS32 orxFASTCALL orxLocale_GetKeyCounter()
 {
   orxS32 s32Result;
 
+  /* Inits module on first use */
+  orxLocale_InitOnDemand();
+
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY));
 
@@ -523,6 +842,9 @@ const orxSTRING orxFASTCALL orxLocale_GetKey(orxS32 _s32KeyIndex)
 {
   orxSTRING zResult;
 
+  /* Inits module on first use */
+  orxLocale_InitOnDemand();
+
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstLocale.u32Flags, orxLOCALE_KU32_STATIC_FLAG_READY));
 
@@ -28,6 +28,7 @@
 
 
 #include "display/orxDisplay.h"
+#include "core/orxEvent.h"
 #include "plugin/orxPluginCore.h"
 
 
@@ -90,6 +91,7 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_BlitBitmap, orxSTATUS, orxBITMAP *, co
 
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_SaveBitmap, orxSTATUS, const orxBITMAP *, const orxSTRING);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_LoadBitmap, orxBITMAP *, const orxSTRING);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_GetBitmapData, orxSTATUS, const orxBITMAP *, orxU8 *, orxU32);
 
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_GetBitmapColor, orxRGBA, const orxBITMAP *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_GetBitmapSize, orxSTATUS, const orxBITMAP *, orxFLOAT *, orxFLOAT *);
@@ -115,6 +117,8 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_GetVideoMode, orxDISPLAY_VIDEO_MODE *,
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_SetVideoMode, orxSTATUS, const orxDISPLAY_VIDEO_MODE *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_IsVideoModeAvailable, orxBOOL, const orxDISPLAY_VIDEO_MODE *);
 
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_EnableContext, orxSTATUS, orxBOOL);
+
 
 /* *** Core function info array *** */
 
@@ -130,6 +134,7 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, DELETE_BITMAP, orxDisplay_DeleteBitma
 
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, SAVE_BITMAP, orxDisplay_SaveBitmap)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, LOAD_BITMAP, orxDisplay_LoadBitmap)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, GET_BITMAP_DATA, orxDisplay_GetBitmapData)
 
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, TRANSFORM_BITMAP, orxDisplay_TransformBitmap)
 
@@ -176,6 +181,8 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, GET_VIDEO_MODE, orxDisplay_GetVideoMo
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, SET_VIDEO_MODE, orxDisplay_SetVideoMode)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, IS_VIDEO_MODE_AVAILABLE, orxDisplay_IsVideoModeAvailable)
 
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, ENABLE_CONTEXT, orxDisplay_EnableContext)
+
 orxPLUGIN_END_CORE_FUNCTION_ARRAY(DISPLAY)
 
 
@@ -203,6 +210,9 @@ orxDISPLAY_TEXT *orxFASTCALL orxDisplay_CreateText()
 
 void orxFASTCALL orxDisplay_DeleteText(orxDISPLAY_TEXT *_pstText)
 {
+  /* Notifies deletion */
+  orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_DELETE_TEXT, orxNULL, orxNULL, _pstText);
+
   orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_DeleteText)(_pstText);
 }
 
@@ -213,11 +223,17 @@ orxSTATUS orxFASTCALL orxDisplay_TransformText(orxBITMAP *_pstDst, const orxDISP
 
 orxSTATUS orxFASTCALL orxDisplay_SetTextString(orxDISPLAY_TEXT *_pstText, const orxSTRING _zString)
 {
+  /* Notifies update */
+  orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_UPDATE_TEXT, orxNULL, orxNULL, _pstText);
+
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_SetTextString)(_pstText, _zString);
 }
 
 orxSTATUS orxFASTCALL orxDisplay_SetTextFont(orxDISPLAY_TEXT *_pstText, const orxSTRING _zFont)
 {
+  /* Notifies update */
+  orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_UPDATE_TEXT, orxNULL, orxNULL, _pstText);
+
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_SetTextFont)(_pstText, _zFont);
 }
 
@@ -248,6 +264,9 @@ orxBITMAP *orxFASTCALL orxDisplay_CreateBitmap(orxU32 _u32Width, orxU32 _u32Heig
 
 void orxFASTCALL orxDisplay_DeleteBitmap(orxBITMAP *_pstBitmap)
 {
+  /* Notifies deletion */
+  orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_DELETE_BITMAP, orxNULL, orxNULL, _pstBitmap);
+
   orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_DeleteBitmap)(_pstBitmap);
 }
 
@@ -273,6 +292,9 @@ orxSTATUS orxFASTCALL orxDisplay_TransformBitmap(orxBITMAP *_pstDst, const orxBI
 
 orxSTATUS orxFASTCALL orxDisplay_SetBitmapColorKey(orxBITMAP *_pstBitmap, orxRGBA _stColor, orxBOOL _bEnable)
 {
+  /* Notifies update */
+  orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_UPDATE_BITMAP, orxNULL, orxNULL, _pstBitmap);
+
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_SetBitmapColorKey)(_pstBitmap, _stColor, _bEnable);
 }
 
@@ -301,6 +323,11 @@ orxBITMAP *orxFASTCALL orxDisplay_LoadBitmap(const orxSTRING _zFileName)
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_LoadBitmap)(_zFileName);
 }
 
+orxSTATUS orxFASTCALL orxDisplay_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_GetBitmapData)(_pstBitmap, _au8Data, _u32ByteNumber);
+}
+
 orxSTATUS orxFASTCALL orxDisplay_GetBitmapSize(const orxBITMAP *_pstBitmap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
 {
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_GetBitmapSize)(_pstBitmap, _pfWidth, _pfHeight);
@@ -385,3 +412,8 @@ orxBOOL orxFASTCALL orxDisplay_IsVideoModeAvailable(const orxDISPLAY_VIDEO_MODE
 {
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_IsVideoModeAvailable)(_pstVideoMode);
 }
+
+orxSTATUS orxFASTCALL orxDisplay_EnableContext(orxBOOL _bEnable)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_EnableContext)(_bEnable);
+}
@@ -30,7 +30,10 @@
 #include "display/orxText.h"
 
 #include "display/orxDisplay.h"
+#include "display/orxTexture.h"
+#include "memory/orxBank.h"
 #include "memory/orxMemory.h"
+#include "core/orxClock.h"
 #include "core/orxConfig.h"
 #include "core/orxEvent.h"
 #include "core/orxLocale.h"
@@ -50,6 +53,9 @@
  */
 #define orxTEXT_KU32_FLAG_NONE                0x00000000  /**< No flags */
 
+#define orxTEXT_KU32_FLAG_LOCALE_DIRTY        0x00000001  /**< Localized string needs refresh flag (text in use, counted) */
+#define orxTEXT_KU32_FLAG_LOCALE_STALE        0x00000002  /**< Localized string needs refresh on next use flag (text not in use, not counted) */
+
 #define orxTEXT_KU32_MASK_ALL                 0xFFFFFFFF  /**< All mask */
 
 
@@ -57,14 +63,50 @@
  */
 #define orxTEXT_KZ_CONFIG_STRING              "String"
 #define orxTEXT_KZ_CONFIG_FONT                "Font"
+#define orxTEXT_KZ_CONFIG_TEXTURE             "Texture"
+#define orxTEXT_KZ_CONFIG_CHARACTER_LIST      "CharacterList"
+#define orxTEXT_KZ_CONFIG_CHARACTER_SIZE      "CharacterSize"
+#define orxTEXT_KZ_CONFIG_CHARACTER_SPACING   "CharacterSpacing"
+
+#define orxTEXT_KZ_CONFIG_LOCALE_SECTION      "Locale"
+#define orxTEXT_KZ_CONFIG_LOCALE_BUDGET       "TextBudget"
 
 #define orxTEXT_KC_LOCALE_MARKER              '$'
+#define orxTEXT_KU32_DEFAULT_LOCALE_BUDGET    64          /**< Default number of localized texts refreshed per frame */
+
+#define orxTEXT_KU32_FONT_BANK_SIZE           8           /**< Bitmap font bank size */
+#define orxTEXT_KU32_FONT_TABLE_SIZE          16          /**< Bitmap font table size */
+#define orxTEXT_KU32_FONT_GLYPH_NUMBER        256         /**< Number of glyphs per bitmap font (one per character) */
 
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Bitmap font glyph
+ */
+typedef struct __orxTEXT_FONT_GLYPH_t
+{
+  orxBITMAP        *pstBitmap;                  /**< Atlas page bitmap, orxNULL if character isn't in the font : 4 */
+  orxFLOAT          fU, fV;                     /**< Top left corner in atlas page : 12 */
+
+} orxTEXT_FONT_GLYPH;
+
+/** Bitmap font, baked from config into atlas pages
+ */
+typedef struct __orxTEXT_FONT_t
+{
+  orxTEXT_FONT_GLYPH astGlyphList[orxTEXT_KU32_FONT_GLYPH_NUMBER]; /**< Glyphs, indexed by character : 3072 */
+  orxTEXTURE      **apstPageList;               /**< Atlas pages : 3076 */
+  orxSTRING         zName;                      /**< Name (config section) : 3080 */
+  orxVECTOR         vCharacterSize;             /**< Character size : 3092 */
+  orxVECTOR         vCharacterSpacing;          /**< Spacing between characters / lines : 3104 */
+  orxU32            u32PageNumber;              /**< Number of atlas pages : 3108 */
+  orxU32            u32ID;                      /**< Name CRC : 3112 */
+  orxU32            u32RefCounter;              /**< Reference counter : 3116 */
+
+} orxTEXT_FONT;
+
 /** Text structure
  */
 struct __orxTEXT_t
@@ -72,13 +114,27 @@ struct __orxTEXT_t
   orxSTRUCTURE      stStructure;                /**< Public structure, first structure member : 16 */
   orxDISPLAY_TEXT  *pstData;                    /**< Data : 20 */
   orxSTRING         zReference;                 /**< Config reference : 24 */
+  orxSTRING         zString;                    /**< String : 28 */
+  orxSTRING         zFont;                      /**< Font : 32 */
+  orxTEXT_FONT     *pstFont;                    /**< Bitmap font, orxNULL if rendered by display plugin : 36 */
+  orxTEXT_GLYPH    *astGlyphList;               /**< Cached glyph layout (bitmap font only) : 40 */
+  orxU32            u32GlyphNumber;             /**< Number of laid out glyphs : 44 */
+  orxU32            u32GlyphSize;               /**< Glyph layout capacity : 48 */
+  orxU32            u32StringSize;              /**< String buffer size : 52 */
+  orxFLOAT          fWidth, fHeight;            /**< Layout size (bitmap font only) : 60 */
+  orxU32            u32LocaleKeyID;             /**< Locale key ID, 0 if not localized : 64 */
 };
 
 /** Static structure
  */
 typedef struct __orxTEXT_STATIC_t
 {
-  orxU32        u32Flags;                       /**< Control flags : 4 */
+  orxBANK      *pstFontBank;                    /**< Bitmap font bank : 4 */
+  orxHASHTABLE *pstFontTable;                   /**< Bitmap font table : 8 */
+  orxCLOCK     *pstClock;                       /**< Locale refresh clock : 12 */
+  orxU32        u32DirtyCounter;                /**< Number of texts waiting for a locale refresh : 16 */
+  orxU32        u32LocaleBudget;                /**< Number of texts refreshed per frame, 0 for no limit : 20 */
+  orxU32        u32Flags;                       /**< Control flags : 24 */
 
 } orxTEXT_STATIC;
 
@@ -138,6 +194,361 @@ static orxINLINE const orxSTRING orxText_GetLocaleKey(const orxTEXT *_pstText)
   return zResult;
 }
 
+/** Loads a bitmap font from config, baking its characters into glyphs of its atlas pages
+ * @param[in]   _zFont          Font name (config section)
+ * @return      orxTEXT_FONT / orxNULL if not a bitmap font
+ */
+static orxTEXT_FONT *orxFASTCALL orxText_LoadFont(const orxSTRING _zFont)
+{
+  orxU32        u32ID;
+  orxTEXT_FONT *pstResult;
+
+  /* Checks */
+  orxASSERT((_zFont != orxNULL) && (_zFont != orxSTRING_EMPTY));
+
+  /* Gets font ID */
+  u32ID = orxString_ToCRC(_zFont);
+
+  /* Not already loaded? */
+  if((pstResult = (orxTEXT_FONT *)orxHashTable_Get(sstText.pstFontTable, u32ID)) == orxNULL)
+  {
+    /* Is a bitmap font section? */
+    if((orxConfig_HasSection(_zFont) != orxFALSE)
+    && (orxConfig_PushSection(_zFont) != orxSTATUS_FAILURE))
+    {
+      orxVECTOR vCharacterSize;
+
+      /* Has texture, character list & valid character size? */
+      if((orxConfig_HasValue(orxTEXT_KZ_CONFIG_TEXTURE) != orxFALSE)
+      && (orxConfig_HasValue(orxTEXT_KZ_CONFIG_CHARACTER_LIST) != orxFALSE)
+      && (orxConfig_GetVector(orxTEXT_KZ_CONFIG_CHARACTER_SIZE, &vCharacterSize) != orxNULL)
+      && (vCharacterSize.fX > orxFLOAT_0)
+      && (vCharacterSize.fY > orxFLOAT_0))
+      {
+        /* Allocates font */
+        pstResult = (orxTEXT_FONT *)orxBank_Allocate(sstText.pstFontBank);
+
+        /* Valid? */
+        if(pstResult != orxNULL)
+        {
+          /* Cleans it */
+          orxMemory_Zero(pstResult, sizeof(orxTEXT_FONT));
+
+          /* Allocates its page list */
+          pstResult->u32PageNumber  = (orxU32)orxConfig_GetListCounter(orxTEXT_KZ_CONFIG_TEXTURE);
+          pstResult->apstPageList   = (orxTEXTURE **)orxMemory_Allocate(pstResult->u32PageNumber * sizeof(orxTEXTURE *), orxMEMORY_TYPE_TEXT);
+
+          /* Valid? */
+          if(pstResult->apstPageList != orxNULL)
+          {
+            const orxCHAR  *pc;
+            orxU32          i;
+
+            /* Stores its name, ID & sizes */
+            pstResult->zName          = orxConfig_GetCurrentSection();
+            pstResult->u32ID          = u32ID;
+            pstResult->u32RefCounter  = 1;
+            orxVector_Copy(&(pstResult->vCharacterSize), &vCharacterSize);
+            if(orxConfig_GetVector(orxTEXT_KZ_CONFIG_CHARACTER_SPACING, &(pstResult->vCharacterSpacing)) == orxNULL)
+            {
+              orxVector_Copy(&(pstResult->vCharacterSpacing), &orxVECTOR_0);
+            }
+
+            /* Cleans page list */
+            orxMemory_Zero(pstResult->apstPageList, pstResult->u32PageNumber * sizeof(orxTEXTURE *));
+
+            /* For all pages, while there are characters left */
+            for(i = 0, pc = orxConfig_GetString(orxTEXT_KZ_CONFIG_CHARACTER_LIST);
+                (i < pstResult->u32PageNumber) && (*pc != orxCHAR_NULL);
+                i++)
+            {
+              orxTEXTURE *pstTexture;
+
+              /* Loads page */
+              pstTexture = orxTexture_CreateFromFile(orxConfig_GetListString(orxTEXT_KZ_CONFIG_TEXTURE, i));
+
+              /* Valid? */
+              if(pstTexture != orxNULL)
+              {
+                orxBITMAP  *pstBitmap;
+                orxFLOAT    fWidth, fHeight, fU, fV;
+
+                /* Stores it */
+                pstResult->apstPageList[i] = pstTexture;
+
+                /* Gets its bitmap & size */
+                pstBitmap = orxTexture_GetBitmap(pstTexture);
+                orxTexture_GetSize(pstTexture, &fWidth, &fHeight);
+
+                /* For all character cells, row by row */
+                for(fV = orxFLOAT_0; (fV + vCharacterSize.fY <= fHeight) && (*pc != orxCHAR_NULL); fV += vCharacterSize.fY)
+                {
+                  for(fU = orxFLOAT_0; (fU + vCharacterSize.fX <= fWidth) && (*pc != orxCHAR_NULL); fU += vCharacterSize.fX, pc++)
+                  {
+                    orxTEXT_FONT_GLYPH *pstGlyph;
+
+                    /* Bakes glyph */
+                    pstGlyph            = &(pstResult->astGlyphList[(orxU8)*pc]);
+                    pstGlyph->pstBitmap = pstBitmap;
+                    pstGlyph->fU        = fU;
+                    pstGlyph->fV        = fV;
+                  }
+                }
+              }
+              else
+              {
+                /* Logs message */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Font <%s>: couldn't load atlas page <%s>.", _zFont, orxConfig_GetListString(orxTEXT_KZ_CONFIG_TEXTURE, i));
+              }
+            }
+
+            /* Characters left? */
+            if(*pc != orxCHAR_NULL)
+            {
+              /* Logs message */
+              orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Font <%s>: atlas pages are too small, characters from <%c> won't be displayed.", _zFont, *pc);
+            }
+
+            /* Protects its section */
+            orxConfig_ProtectSection(pstResult->zName, orxTRUE);
+
+            /* Stores it */
+            orxHashTable_Add(sstText.pstFontTable, u32ID, pstResult);
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Font <%s>: couldn't allocate page list.", _zFont);
+
+            /* Frees font */
+            orxBank_Free(sstText.pstFontBank, pstResult);
+            pstResult = orxNULL;
+          }
+        }
+      }
+
+      /* Pops section */
+      orxConfig_PopSection();
+    }
+  }
+  else
+  {
+    /* Updates reference counter */
+    pstResult->u32RefCounter++;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Unloads a bitmap font
+ * @param[in]   _pstFont        Concerned font
+ */
+static void orxFASTCALL orxText_UnloadFont(orxTEXT_FONT *_pstFont)
+{
+  /* Checks */
+  orxASSERT(_pstFont != orxNULL);
+  orxASSERT(_pstFont->u32RefCounter > 0);
+
+  /* Last reference? */
+  if(--(_pstFont->u32RefCounter) == 0)
+  {
+    orxU32 i;
+
+    /* For all pages */
+    for(i = 0; i < _pstFont->u32PageNumber; i++)
+    {
+      /* Valid? */
+      if(_pstFont->apstPageList[i] != orxNULL)
+      {
+        /* Deletes it */
+        orxTexture_Delete(_pstFont->apstPageList[i]);
+      }
+    }
+
+    /* Frees page list */
+    orxMemory_Free(_pstFont->apstPageList);
+
+    /* Unprotects its section */
+    orxConfig_ProtectSection(_pstFont->zName, orxFALSE);
+
+    /* Removes it from table */
+    orxHashTable_Remove(sstText.pstFontTable, _pstFont->u32ID);
+
+    /* Frees it */
+    orxBank_Free(sstText.pstFontBank, _pstFont);
+  }
+
+  return;
+}
+
+/** Updates text's glyph layout, only rebuilding glyphs that changed
+ * @param[in]   _pstText        Concerned text
+ */
+static void orxFASTCALL orxText_UpdateLayout(orxTEXT *_pstText)
+{
+  orxU32 u32Length;
+
+  /* Checks */
+  orxSTRUCTURE_ASSERT(_pstText);
+  orxASSERT(_pstText->pstFont != orxNULL);
+
+  /* Gets string length */
+  u32Length = (_pstText->zString != orxNULL) ? orxString_GetLength(_pstText->zString) : 0;
+
+  /* Layout too small? */
+  if(u32Length > _pstText->u32GlyphSize)
+  {
+    orxTEXT_GLYPH *astGlyphList;
+    orxU32         u32Size;
+
+    /* Gets new capacity, at least doubling the current one so that growing strings don't reallocate every time */
+    u32Size = orxMAX(u32Length, _pstText->u32GlyphSize << 1);
+
+    /* Grows it, keeping current glyphs */
+    astGlyphList = (_pstText->astGlyphList != orxNULL)
+                 ? (orxTEXT_GLYPH *)orxMemory_Reallocate(_pstText->astGlyphList, u32Size * sizeof(orxTEXT_GLYPH))
+                 : (orxTEXT_GLYPH *)orxMemory_Allocate(u32Size * sizeof(orxTEXT_GLYPH), orxMEMORY_TYPE_TEXT);
+
+    /* Success? */
+    if(astGlyphList != orxNULL)
+    {
+      /* Stores it */
+      _pstText->astGlyphList  = astGlyphList;
+      _pstText->u32GlyphSize  = u32Size;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Failed to allocate layout for %lu glyphs.", u32Size);
+
+      /* Only lays out what fits */
+      u32Length = _pstText->u32GlyphSize;
+    }
+  }
+
+  /* Has string? */
+  if(u32Length > 0)
+  {
+    const orxTEXT_FONT *pstFont;
+    const orxCHAR      *pc;
+    orxFLOAT            fX, fY, fWidth;
+    orxU32              u32Number;
+
+    /* Gets font */
+    pstFont = _pstText->pstFont;
+
+    /* For all characters */
+    for(pc = _pstText->zString, u32Number = 0, fX = fY = fWidth = orxFLOAT_0; (*pc != orxCHAR_NULL) && (u32Number < u32Length); pc++)
+    {
+      /* New line? */
+      if(*pc == orxCHAR_LF)
+      {
+        /* Updates width */
+        fWidth = orxMAX(fWidth, fX - pstFont->vCharacterSpacing.fX);
+
+        /* Goes to next line */
+        fX  = orxFLOAT_0;
+        fY += pstFont->vCharacterSize.fY + pstFont->vCharacterSpacing.fY;
+      }
+      else if(*pc != orxCHAR_CR)
+      {
+        const orxTEXT_FONT_GLYPH *pstFontGlyph;
+
+        /* Gets its font glyph */
+        pstFontGlyph = &(pstFont->astGlyphList[(orxU8)*pc]);
+
+        /* Is in font? */
+        if(pstFontGlyph->pstBitmap != orxNULL)
+        {
+          orxTEXT_GLYPH *pstGlyph;
+
+          /* Gets its glyph */
+          pstGlyph = &(_pstText->astGlyphList[u32Number]);
+
+          /* New or changed? */
+          if((u32Number >= _pstText->u32GlyphNumber)
+          || (pstGlyph->cCharacter != *pc)
+          || (pstGlyph->fX != fX)
+          || (pstGlyph->fY != fY))
+          {
+            /* Rebuilds it */
+            pstGlyph->pstBitmap   = pstFontGlyph->pstBitmap;
+            pstGlyph->fX          = fX;
+            pstGlyph->fY          = fY;
+            pstGlyph->fU          = pstFontGlyph->fU;
+            pstGlyph->fV          = pstFontGlyph->fV;
+            pstGlyph->cCharacter  = *pc;
+          }
+
+          /* Updates glyph number */
+          u32Number++;
+        }
+
+        /* Advances */
+        fX += pstFont->vCharacterSize.fX + pstFont->vCharacterSpacing.fX;
+      }
+    }
+
+    /* Stores glyph number & size */
+    _pstText->u32GlyphNumber  = u32Number;
+    _pstText->fWidth          = orxMAX(fWidth, fX - pstFont->vCharacterSpacing.fX);
+    _pstText->fHeight         = fY + pstFont->vCharacterSize.fY;
+  }
+  else
+  {
+    /* Clears layout */
+    _pstText->u32GlyphNumber  = 0;
+    _pstText->fWidth          = orxFLOAT_0;
+    _pstText->fHeight         = orxFLOAT_0;
+  }
+
+  return;
+}
+
+/** Refreshes a localized text with the string of the current language
+ * @param[in]   _pstText      Concerned text
+ */
+static void orxFASTCALL orxText_RefreshLocale(orxTEXT *_pstText)
+{
+  orxSTRING zString;
+
+  /* Gets its string from pre-hashed key */
+  zString = orxLocale_GetStringFromID(_pstText->u32LocaleKeyID);
+
+  /* Not found (inherited key)? */
+  if(zString == orxNULL)
+  {
+    orxSTRING zLocaleKey;
+
+    /* Gets its corresponding locale key */
+    zLocaleKey = orxText_GetLocaleKey(_pstText);
+
+    /* Gets its string */
+    zString = (zLocaleKey != orxNULL) ? orxLocale_GetString(zLocaleKey) : orxSTRING_EMPTY;
+  }
+
+  /* Updates text (clears its dirty & stale status) */
+  orxText_SetString(_pstText, zString);
+
+  return;
+}
+
+/** Refreshes a stale localized text before it gets used
+ * @param[in]   _pstText      Concerned text
+ */
+static orxINLINE void orxText_UpdateStale(const orxTEXT *_pstText)
+{
+  /* Stale? */
+  if(orxStructure_TestFlags(_pstText, orxTEXT_KU32_FLAG_LOCALE_STALE))
+  {
+    /* Refreshes it */
+    orxText_RefreshLocale((orxTEXT *)_pstText);
+  }
+
+  return;
+}
+
 /** Event handler
  * @param[in]   _pstEvent                     Sent event
  * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
@@ -155,23 +566,41 @@ static orxSTATUS orxFASTCALL orxText_EventHandler(const orxEVENT *_pstEvent)
     /* Select language event */
     case orxLOCALE_EVENT_SELECT_LANGUAGE:
     {
-      orxTEXT *pstText;
+      orxLOCALE_EVENT_PAYLOAD  *pstPayload;
+      orxSTRUCTURE *const      *apstTextList;
+      orxU32                    u32KeyID, u32Number, i;
+
+      /* Gets payload */
+      pstPayload = (orxLOCALE_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+
+      /* Gets concerned key ID, 0 for all */
+      u32KeyID = ((pstPayload != orxNULL) && (pstPayload->zStringKey != orxNULL)) ? orxString_ToCRC(pstPayload->zStringKey) : 0;
 
       /* For all texts */
-      for(pstText = orxTEXT(orxStructure_GetFirst(orxSTRUCTURE_ID_TEXT));
-          pstText != orxNULL;
-          pstText = orxTEXT(orxStructure_GetNext(pstText)))
+      for(apstTextList = orxStructure_GetArray(orxSTRUCTURE_ID_TEXT, &u32Number), i = 0; i < u32Number; i++)
       {
-        orxSTRING zLocaleKey;
+        orxTEXT *pstText;
 
-        /* Gets its corresponding locale key */
-        zLocaleKey = orxText_GetLocaleKey(pstText);
+        /* Gets it */
+        pstText = (orxTEXT *)apstTextList[i];
 
-        /* Valid? */
-        if(zLocaleKey != orxNULL)
+        /* Localized with concerned key and not already waiting for a refresh? */
+        if((pstText->u32LocaleKeyID != 0)
+        && ((u32KeyID == 0) || (pstText->u32LocaleKeyID == u32KeyID))
+        && (!orxStructure_TestFlags(pstText, orxTEXT_KU32_FLAG_LOCALE_DIRTY | orxTEXT_KU32_FLAG_LOCALE_STALE)))
         {
-          /* Updates text */
-          orxText_SetString(pstText, orxLocale_GetString(zLocaleKey));
+          /* In use? */
+          if(orxStructure_GetRefCounter(pstText) != 0)
+          {
+            /* Marks it for budgeted refresh */
+            orxStructure_SetFlags(pstText, orxTEXT_KU32_FLAG_LOCALE_DIRTY, orxTEXT_KU32_FLAG_NONE);
+            sstText.u32DirtyCounter++;
+          }
+          else
+          {
+            /* Marks it for refresh on next use */
+            orxStructure_SetFlags(pstText, orxTEXT_KU32_FLAG_LOCALE_STALE, orxTEXT_KU32_FLAG_NONE);
+          }
         }
       }
 
@@ -188,6 +617,55 @@ static orxSTATUS orxFASTCALL orxText_EventHandler(const orxEVENT *_pstEvent)
   return eResult;
 }
 
+/** Refreshes localized texts after a language switch, within a per-frame budget
+ * Only texts in use (referenced by a graphic) are refreshed, the ones detached meanwhile wait till they get used again
+ * @param[in]   _pstClockInfo   Clock information where this callback has been registered
+ * @param[in]   _pContext       User defined context
+ */
+static void orxFASTCALL orxText_UpdateLocale(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  /* Any text to refresh? */
+  if(sstText.u32DirtyCounter != 0)
+  {
+    orxSTRUCTURE *const  *apstTextList;
+    orxU32                u32Number, u32Budget, i;
+
+    /* Gets budget */
+    u32Budget = (sstText.u32LocaleBudget != 0) ? sstText.u32LocaleBudget : orxU32_UNDEFINED;
+
+    /* For all texts, while within budget */
+    for(apstTextList = orxStructure_GetArray(orxSTRUCTURE_ID_TEXT, &u32Number), i = 0; (i < u32Number) && (u32Budget != 0); i++)
+    {
+      orxTEXT *pstText;
+
+      /* Gets it */
+      pstText = (orxTEXT *)apstTextList[i];
+
+      /* Dirty? */
+      if(orxStructure_TestFlags(pstText, orxTEXT_KU32_FLAG_LOCALE_DIRTY))
+      {
+        /* Still in use? */
+        if(orxStructure_GetRefCounter(pstText) != 0)
+        {
+          /* Refreshes it */
+          orxText_RefreshLocale(pstText);
+
+          /* Updates budget */
+          u32Budget--;
+        }
+        else
+        {
+          /* Detached: refreshes it on next use instead */
+          orxStructure_SetFlags(pstText, orxTEXT_KU32_FLAG_LOCALE_STALE, orxTEXT_KU32_FLAG_LOCALE_DIRTY);
+          sstText.u32DirtyCounter--;
+        }
+      }
+    }
+  }
+
+  return;
+}
+
 /** Deletes all texts
  */
 static orxINLINE void orxText_DeleteAll()
@@ -222,10 +700,12 @@ void orxFASTCALL orxText_Setup()
   /* Adds module dependencies */
   orxModule_AddDependency(orxMODULE_ID_TEXT, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_TEXT, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_TEXT, orxMODULE_ID_CLOCK);
   orxModule_AddDependency(orxMODULE_ID_TEXT, orxMODULE_ID_EVENT);
-  orxModule_AddDependency(orxMODULE_ID_TEXT, orxMODULE_ID_LOCALE);
   orxModule_AddDependency(orxMODULE_ID_TEXT, orxMODULE_ID_STRUCTURE);
   orxModule_AddDependency(orxMODULE_ID_TEXT, orxMODULE_ID_DISPLAY);
+  orxModule_AddDependency(orxMODULE_ID_TEXT, orxMODULE_ID_TEXTURE);
+  orxModule_AddOptionalDependency(orxMODULE_ID_TEXT, orxMODULE_ID_LOCALE);
 
   return;
 }
@@ -243,25 +723,83 @@ orxSTATUS orxFASTCALL orxText_Init()
     /* Cleans static controller */
     orxMemory_Zero(&sstText, sizeof(orxTEXT_STATIC));
 
-    /* Registers event handler */
-    eResult = orxEvent_AddHandler(orxEVENT_TYPE_LOCALE, orxText_EventHandler);
+    /* Creates font bank & table */
+    sstText.pstFontBank   = orxBank_Create(orxTEXT_KU32_FONT_BANK_SIZE, sizeof(orxTEXT_FONT), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_TEXT);
+    sstText.pstFontTable  = orxHashTable_Create(orxTEXT_KU32_FONT_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEXT);
 
     /* Valid? */
-    if(eResult != orxSTATUS_FAILURE)
+    if((sstText.pstFontBank != orxNULL) && (sstText.pstFontTable != orxNULL))
     {
-      /* Registers structure type */
-      eResult = orxSTRUCTURE_REGISTER(TEXT, orxSTRUCTURE_STORAGE_TYPE_LINKLIST, orxMEMORY_TYPE_MAIN, orxNULL);
+      /* Registers event handler */
+      eResult = orxEvent_AddHandler(orxEVENT_TYPE_LOCALE, orxText_EventHandler);
 
-      /* Success? */
-      if(eResult == orxSTATUS_SUCCESS)
+      /* Valid? */
+      if(eResult != orxSTATUS_FAILURE)
       {
-        /* Updates flags for screen text creation */
-        sstText.u32Flags = orxTEXT_KU32_STATIC_FLAG_READY;
+        /* Registers structure type */
+        eResult = orxSTRUCTURE_REGISTER(TEXT, orxSTRUCTURE_STORAGE_TYPE_LINKLIST, orxMEMORY_TYPE_MAIN, orxNULL);
+
+        /* Success? */
+        if(eResult == orxSTATUS_SUCCESS)
+        {
+          /* Gets core clock */
+          sstText.pstClock = orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE);
+
+          /* Registers locale refresh function to it */
+          eResult = (sstText.pstClock != orxNULL) ? orxClock_Register(sstText.pstClock, orxText_UpdateLocale, orxNULL, orxMODULE_ID_TEXT, orxCLOCK_PRIORITY_NORMAL) : orxSTATUS_FAILURE;
+
+          /* Success? */
+          if(eResult == orxSTATUS_SUCCESS)
+          {
+            /* Gets locale refresh budget */
+            orxConfig_PushSection(orxTEXT_KZ_CONFIG_LOCALE_SECTION);
+            sstText.u32LocaleBudget = (orxConfig_HasValue(orxTEXT_KZ_CONFIG_LOCALE_BUDGET) != orxFALSE) ? orxConfig_GetU32(orxTEXT_KZ_CONFIG_LOCALE_BUDGET) : orxTEXT_KU32_DEFAULT_LOCALE_BUDGET;
+            orxConfig_PopSection();
+
+            /* Updates flags for screen text creation */
+            sstText.u32Flags = orxTEXT_KU32_STATIC_FLAG_READY;
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Failed to register locale refresh callback.");
+
+            /* Unregisters structure type */
+            orxStructure_Unregister(orxSTRUCTURE_ID_TEXT);
+
+            /* Removes event handler */
+            orxEvent_RemoveHandler(orxEVENT_TYPE_LOCALE, orxText_EventHandler);
+          }
+        }
+        else
+        {
+          /* Removes event handler */
+          orxEvent_RemoveHandler(orxEVENT_TYPE_LOCALE, orxText_EventHandler);
+        }
       }
-      else
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Failed to create font bank/table.");
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+
+    /* Failed? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Deletes font bank & table */
+      if(sstText.pstFontBank != orxNULL)
+      {
+        orxBank_Delete(sstText.pstFontBank);
+        sstText.pstFontBank = orxNULL;
+      }
+      if(sstText.pstFontTable != orxNULL)
       {
-        /* Removes event handler */
-        orxEvent_RemoveHandler(orxEVENT_TYPE_LOCALE, orxText_EventHandler);
+        orxHashTable_Delete(sstText.pstFontTable);
+        sstText.pstFontTable = orxNULL;
       }
     }
   }
@@ -298,9 +836,16 @@ void orxFASTCALL orxText_Exit()
     /* Deletes text list */
     orxText_DeleteAll();
 
+    /* Unregisters locale refresh function */
+    orxClock_Unregister(sstText.pstClock, orxText_UpdateLocale);
+
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_TEXT);
 
+    /* Deletes font bank & table */
+    orxBank_Delete(sstText.pstFontBank);
+    orxHashTable_Delete(sstText.pstFontTable);
+
     /* Updates flags */
     sstText.u32Flags &= ~orxTEXT_KU32_STATIC_FLAG_READY;
   }
@@ -396,6 +941,9 @@ orxTEXT *orxFASTCALL orxText_CreateFromConfig(const orxSTRING _zConfigID)
       {
         /* Stores its locale value */
         orxText_SetString(pstResult, orxLocale_GetString(zTrimmedString + 1));
+
+        /* Stores its pre-hashed locale key */
+        pstResult->u32LocaleKeyID = orxString_ToCRC(zTrimmedString + 1);
       }
       else
       {
@@ -447,8 +995,16 @@ orxSTATUS orxFASTCALL orxText_Delete(orxTEXT *_pstText)
   /* Not referenced? */
   if(orxStructure_GetRefCounter(_pstText) == 0)
   {
-    /* Removes string */
+    /* Removes string & font */
     orxText_SetString(_pstText, orxNULL);
+    orxText_SetFont(_pstText, orxNULL);
+
+    /* Has glyph layout? */
+    if(_pstText->astGlyphList != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(_pstText->astGlyphList);
+    }
 
     /* Deletes internal data */
     orxDisplay_DeleteText(_pstText->pstData);
@@ -492,8 +1048,21 @@ orxSTATUS orxFASTCALL orxText_GetSize(const orxTEXT *_pstText, orxFLOAT *_pfWidt
   orxASSERT(_pfWidth != orxNULL);
   orxASSERT(_pfHeight != orxNULL);
 
-  /* Gets text size */
-  eResult = orxDisplay_GetTextSize(_pstText->pstData, _pfWidth, _pfHeight);
+  /* Refreshes it if stale (first use since a language switch) */
+  orxText_UpdateStale(_pstText);
+
+  /* Bitmap font? */
+  if(_pstText->pstFont != orxNULL)
+  {
+    /* Gets layout size */
+    *_pfWidth   = _pstText->fWidth;
+    *_pfHeight  = _pstText->fHeight;
+  }
+  else
+  {
+    /* Gets text size */
+    eResult = orxDisplay_GetTextSize(_pstText->pstData, _pfWidth, _pfHeight);
+  }
 
   /* Done! */
   return eResult;
@@ -530,12 +1099,11 @@ const orxSTRING orxFASTCALL orxText_GetString(const orxTEXT *_pstText)
   orxASSERT(sstText.u32Flags & orxTEXT_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstText);
 
+  /* Refreshes it if stale (first use since a language switch) */
+  orxText_UpdateStale(_pstText);
+
   /* Gets result */
-  zResult = orxDisplay_GetTextString(_pstText->pstData);
-  if(zResult == orxNULL)
-  {
-    zResult = orxSTRING_EMPTY;
-  }
+  zResult = (_pstText->zString != orxNULL) ? _pstText->zString : orxSTRING_EMPTY;
 
   /* Done! */
   return zResult;
@@ -554,7 +1122,7 @@ const orxSTRING orxFASTCALL orxText_GetFont(const orxTEXT *_pstText)
   orxSTRUCTURE_ASSERT(_pstText);
 
   /* Gets result */
-  zResult = orxDisplay_GetTextFont(_pstText->pstData);
+  zResult = _pstText->zFont;
 
   /* Done! */
   return zResult;
@@ -572,6 +1140,9 @@ orxDISPLAY_TEXT *orxFASTCALL orxText_GetData(const orxTEXT *_pstText)
   orxASSERT(sstText.u32Flags & orxTEXT_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstText);
 
+  /* Refreshes it if stale (first use since a language switch) */
+  orxText_UpdateStale(_pstText);
+
   /* Gets result */
   pstResult = _pstText->pstData;
 
@@ -579,6 +1150,48 @@ orxDISPLAY_TEXT *orxFASTCALL orxText_GetData(const orxTEXT *_pstText)
   return pstResult;
 }
 
+/** Gets text glyph layout, only available for texts using a bitmap font
+ * @param[in]   _pstText          Concerned text
+ * @param[out]  _pastGlyphList    Glyph list
+ * @param[out]  _pu32GlyphNumber  Number of glyphs
+ * @param[out]  _pvCharacterSize  Character size
+ * @return      orxSTATUS_SUCCESS if text uses a bitmap font / orxSTATUS_FAILURE otherwise
+ */
+orxSTATUS orxFASTCALL orxText_GetGlyphList(const orxTEXT *_pstText, const orxTEXT_GLYPH **_pastGlyphList, orxU32 *_pu32GlyphNumber, orxVECTOR *_pvCharacterSize)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(sstText.u32Flags & orxTEXT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstText);
+  orxASSERT(_pastGlyphList != orxNULL);
+  orxASSERT(_pu32GlyphNumber != orxNULL);
+  orxASSERT(_pvCharacterSize != orxNULL);
+
+  /* Refreshes it if stale (first use since a language switch) */
+  orxText_UpdateStale(_pstText);
+
+  /* Bitmap font? */
+  if(_pstText->pstFont != orxNULL)
+  {
+    /* Stores layout */
+    *_pastGlyphList   = _pstText->astGlyphList;
+    *_pu32GlyphNumber = _pstText->u32GlyphNumber;
+    orxVector_Copy(_pvCharacterSize, &(_pstText->pstFont->vCharacterSize));
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Sets text string 
  * @param[in]   _pstText      Concerned text
  * @param[in]   _zString      String to contain
@@ -593,26 +1206,95 @@ orxSTATUS orxFASTCALL orxText_SetString(orxTEXT *_pstText, const orxSTRING _zStr
   orxASSERT(sstText.u32Flags & orxTEXT_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstText);
 
-  /* Gets current string */
-  zString = orxDisplay_GetTextString(_pstText->pstData);
-
-  /* Valid? */
-  if((zString != orxNULL) && (zString != orxSTRING_EMPTY))
+  /* Was waiting for a locale refresh? */
+  if(orxStructure_TestFlags(_pstText, orxTEXT_KU32_FLAG_LOCALE_DIRTY))
   {
-    /* Deletes it */
-    orxString_Delete(zString);
+    /* Explicit strings take precedence */
+    orxStructure_SetFlags(_pstText, orxTEXT_KU32_FLAG_NONE, orxTEXT_KU32_FLAG_LOCALE_DIRTY);
+    sstText.u32DirtyCounter--;
   }
 
-  /* Has new string? */
-  if((_zString != orxNULL) && (_zString != orxSTRING_EMPTY))
-  {
-    /* Stores a duplicate */
-    orxDisplay_SetTextString(_pstText->pstData, orxString_Duplicate(_zString));
-  }
-  else
+  /* Clears stale status */
+  orxStructure_SetFlags(_pstText, orxTEXT_KU32_FLAG_NONE, orxTEXT_KU32_FLAG_LOCALE_STALE);
+
+  /* Gets new string, empty ones being cleared */
+  zString = ((_zString != orxNULL) && (*_zString != orxCHAR_NULL)) ? _zString : orxNULL;
+
+  /* Changed? */
+  if((zString != _pstText->zString)
+  && ((zString == orxNULL) || (_pstText->zString == orxNULL) || (orxString_Compare(zString, _pstText->zString) != 0)))
   {
-    /* Clears string */
-    orxDisplay_SetTextString(_pstText->pstData, orxNULL);
+    /* Has new string? */
+    if(zString != orxNULL)
+    {
+      orxU32 u32Size;
+
+      /* Gets its size */
+      u32Size = (orxString_GetLength(zString) + 1) * sizeof(orxCHAR);
+
+      /* Doesn't fit in current buffer? */
+      if(u32Size > _pstText->u32StringSize)
+      {
+        orxSTRING zBuffer;
+
+        /* Allocates new buffer */
+        zBuffer = (orxSTRING)orxMemory_Allocate(u32Size, orxMEMORY_TYPE_TEXT);
+
+        /* Success? */
+        if(zBuffer != orxNULL)
+        {
+          /* Copies string */
+          orxMemory_Copy(zBuffer, zString, u32Size);
+
+          /* Has current buffer? */
+          if(_pstText->zString != orxNULL)
+          {
+            /* Frees it */
+            orxMemory_Free(_pstText->zString);
+          }
+
+          /* Stores new buffer */
+          _pstText->zString       = zBuffer;
+          _pstText->u32StringSize = u32Size;
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Failed to allocate %ld bytes for text string.", u32Size);
+
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+      }
+      else
+      {
+        /* Reuses current buffer (source might overlap it) */
+        orxMemory_Move(_pstText->zString, zString, u32Size);
+      }
+    }
+    else
+    {
+      /* Frees current buffer */
+      orxMemory_Free(_pstText->zString);
+      _pstText->zString       = orxNULL;
+      _pstText->u32StringSize = 0;
+    }
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Bitmap font? */
+      if(_pstText->pstFont != orxNULL)
+      {
+        /* Updates its layout */
+        orxText_UpdateLayout(_pstText);
+      }
+      else
+      {
+        /* Updates display text */
+        orxDisplay_SetTextString(_pstText->pstData, _pstText->zString);
+      }
+    }
   }
 
   /* Done! */
@@ -626,33 +1308,53 @@ orxSTATUS orxFASTCALL orxText_SetString(orxTEXT *_pstText, const orxSTRING _zStr
  */
 orxSTATUS orxFASTCALL orxText_SetFont(orxTEXT *_pstText, const orxSTRING _zFont)
 {
-  orxSTRING zFont;
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxTEXT_FONT *pstFont;
+  orxSTRING     zFont;
+  orxSTATUS     eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
   orxASSERT(sstText.u32Flags & orxTEXT_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstText);
 
-  /* Gets current font */
-  zFont = orxDisplay_GetTextFont(_pstText->pstData);
+  /* Gets new font, empty ones being cleared */
+  zFont = ((_zFont != orxNULL) && (*_zFont != orxCHAR_NULL)) ? _zFont : orxNULL;
 
-  /* Valid? */
-  if(zFont != orxNULL)
+  /* Loads bitmap font, if any */
+  pstFont = (zFont != orxNULL) ? orxText_LoadFont(zFont) : orxNULL;
+
+  /* Had bitmap font? */
+  if(_pstText->pstFont != orxNULL)
+  {
+    /* Unloads it */
+    orxText_UnloadFont(_pstText->pstFont);
+  }
+
+  /* Has current font? */
+  if(_pstText->zFont != orxNULL)
   {
     /* Deletes it */
-    orxString_Delete(zFont);
+    orxString_Delete(_pstText->zFont);
   }
 
-  /* Has new font? */
-  if((_zFont != orxNULL) && (_zFont != orxSTRING_EMPTY))
+  /* Stores new font */
+  _pstText->zFont   = (zFont != orxNULL) ? orxString_Duplicate(zFont) : orxNULL;
+  _pstText->pstFont = pstFont;
+
+  /* Bitmap font? */
+  if(pstFont != orxNULL)
   {
-    /* Stores a duplicate */
-    orxDisplay_SetTextFont(_pstText->pstData, orxString_Duplicate(_zFont));
+    /* Removes string from display text */
+    orxDisplay_SetTextString(_pstText->pstData, orxNULL);
+
+    /* Rebuilds whole layout */
+    _pstText->u32GlyphNumber = 0;
+    orxText_UpdateLayout(_pstText);
   }
   else
   {
-    /* Clears string */
-    orxDisplay_SetTextFont(_pstText->pstData, orxNULL);
+    /* Updates display text */
+    orxDisplay_SetTextFont(_pstText->pstData, _pstText->zFont);
+    orxDisplay_SetTextString(_pstText->pstData, _pstText->zString);
   }
 
   /* Done! */
@@ -29,6 +29,7 @@
 
 #include "display/orxTexture.h"
 
+#include "core/orxEvent.h"
 #include "display/orxDisplay.h"
 #include "memory/orxMemory.h"
 #include "object/orxStructure.h"
@@ -654,6 +655,9 @@ orxSTATUS orxFASTCALL orxTexture_SetColor(orxTEXTURE *_pstTexture, const orxCOLO
   /* Valid? */
   if(pstBitmap != orxNULL)
   {
+    /* Notifies update (command lists still being rendered may refer to its color) */
+    orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_UPDATE_BITMAP, orxNULL, orxNULL, pstBitmap);
+
     /* Updates its color */
     eResult = orxDisplay_SetBitmapColor(pstBitmap, orxColor_ToRGBA(_pstColor));
   }
@@ -41,6 +41,34 @@
 #endif /* __orxMSVC__ */
 
 
+#include <sys/types.h>
+#include <sys/stat.h>
+
+
+/** Platform dependent includes
+ */
+#if defined(__orxLINUX__) || defined(__orxMAC__) || defined(__orxGP2X__) || defined(__orxIPHONE__)
+
+  #include <sys/mman.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+
+  #define __orxFILE_MMAP__
+
+#else /* __orxLINUX__ || __orxMAC__ || __orxGP2X__ || __orxIPHONE__ */
+
+  #ifdef __orxWINDOWS__
+
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+
+    #define __orxFILE_MMAP__
+
+  #endif /* __orxWINDOWS__ */
+
+#endif /* __orxLINUX__ || __orxMAC__ || __orxGP2X__ || __orxIPHONE__ */
+
+
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
@@ -48,9 +76,93 @@
 #define orxFILE_KU32_STATIC_FLAG_NONE   0x00000000  /**< No flags have been set */
 #define orxFILE_KU32_STATIC_FLAG_READY  0x00000001  /**< The module has been initialized */
 
+#define orxFILE_KH_VIEW_EMPTY           ((orxHANDLE)0)  /**< View on an empty file */
+#define orxFILE_KH_VIEW_MAPPED          ((orxHANDLE)1)  /**< View on a memory mapped file */
+#define orxFILE_KH_VIEW_BUFFER          ((orxHANDLE)2)  /**< View on a file copied in memory */
+#define orxFILE_KH_VIEW_PACKED          ((orxHANDLE)3)  /**< View on a file stored uncompressed in a pack */
+
+#define orxFILE_KU32_PACK_NUMBER        16          /**< Maximum number of mounted packs */
+#define orxFILE_KU32_PACKED_FILE_NUMBER 32          /**< Maximum number of packed files opened at once */
+#define orxFILE_KU32_PATH_LENGTH        1024        /**< Maximum packed path length */
+
+
+/** Pack format, all values are little endian 32 bit integers:
+ *  - Header, orxFILE_KU32_PACK_HEADER_SIZE bytes (magic, version, entry & bucket numbers, bucket/entry/name table offsets, name table size)
+ *  - Buckets: first entry index of each hash chain (path CRC & bucket mask), orxFILE_KU32_PACK_NONE if empty
+ *  - Entries, orxFILE_KU32_PACK_ENTRY_SIZE bytes each (see orxFILE_KU32_PACK_FIELD_*)
+ *  - Names: null-terminated normalized paths
+ *  - Data: file contents, aligned on orxFILE_KU32_PACK_ALIGNMENT bytes, stored as is or as LZ4 blocks
+ */
+#define orxFILE_KU32_PACK_MAGIC         0x5058524F  /**< 'ORXP' */
+#define orxFILE_KU32_PACK_VERSION       1
+#define orxFILE_KU32_PACK_ALIGNMENT     16
+
+#define orxFILE_KU32_PACK_BUCKET_SIZE   4
+#define orxFILE_KU32_PACK_NONE          0xFFFFFFFF  /**< Empty bucket / end of hash chain */
+
+#define orxFILE_KU32_PACK_HEADER_SIZE   32
+#define orxFILE_KU32_PACK_HEADER_MAGIC          0
+#define orxFILE_KU32_PACK_HEADER_VERSION        4
+#define orxFILE_KU32_PACK_HEADER_ENTRY_NUMBER   8
+#define orxFILE_KU32_PACK_HEADER_BUCKET_NUMBER  12
+#define orxFILE_KU32_PACK_HEADER_BUCKET_OFFSET  16
+#define orxFILE_KU32_PACK_HEADER_ENTRY_OFFSET   20
+#define orxFILE_KU32_PACK_HEADER_NAME_OFFSET    24
+#define orxFILE_KU32_PACK_HEADER_NAME_SIZE      28
+
+#define orxFILE_KU32_PACK_ENTRY_SIZE    32
+#define orxFILE_KU32_PACK_FIELD_ID              0   /**< Path CRC */
+#define orxFILE_KU32_PACK_FIELD_NAME            4   /**< Path offset in name table */
+#define orxFILE_KU32_PACK_FIELD_NEXT            8   /**< Next entry index in hash chain, lower than the entry's own one */
+#define orxFILE_KU32_PACK_FIELD_OFFSET          12  /**< Data offset */
+#define orxFILE_KU32_PACK_FIELD_SIZE            16  /**< Content size */
+#define orxFILE_KU32_PACK_FIELD_PACKED_SIZE     20  /**< Stored data size */
+#define orxFILE_KU32_PACK_FIELD_FLAGS           24  /**< Flags */
+#define orxFILE_KU32_PACK_FIELD_TIME_STAMP      28  /**< Last modification time stamp */
+
+#define orxFILE_KU32_PACK_FLAG_LZ4      0x00000001  /**< Data is a LZ4 block */
+
+#define orxFILE_KU32_LZ4_HASH_LOG       12          /**< LZ4 compressor hash table size (log2) */
+#define orxFILE_KU32_LZ4_MATCH_LIMIT    12          /**< LZ4 matches can't start in the last bytes */
+#define orxFILE_KU32_LZ4_LAST_LITERALS  5           /**< LZ4 last bytes are always literals */
+
+#define orxFILE_LZ4_BOUND(SIZE)         ((SIZE) + ((SIZE) / 255) + 16)
+
+
+/** Mounted pack
+ */
+typedef struct __orxFILE_PACK_t
+{
+  orxFILE_VIEW    stView;             /**< Pack content : 12 */
+  const orxU8    *pu8Bucket;          /**< Bucket table : 16 */
+  const orxU8    *pu8Entry;           /**< Entry table : 20 */
+  const orxCHAR  *pcName;             /**< Name table : 24 */
+  orxU32          u32EntryNumber;     /**< Number of entries : 28 */
+  orxU32          u32BucketMask;      /**< Bucket mask : 32 */
+  orxU32          u32ID;              /**< Pack's path CRC : 36 */
+
+} orxFILE_PACK;
+
+/** Opened packed file
+ */
+typedef struct __orxFILE_PACKED_t
+{
+  const orxU8    *pu8Data;            /**< Content, orxNULL if slot is free : 4 */
+  orxU8          *pu8Buffer;          /**< Decompressed content, orxNULL if read in place : 8 */
+  orxU32          u32Size;            /**< Content size : 12 */
+  orxU32          u32Cursor;          /**< Read cursor : 16 */
+
+} orxFILE_PACKED;
+
+/** Static structure
+ */
 typedef struct __orxFILE_STATIC_t
 {
-  orxU32 u32Flags;
+  orxFILE_PACK    astPackList[orxFILE_KU32_PACK_NUMBER];          /**< Mounted packs, by mount order */
+  orxFILE_PACKED  astPackedList[orxFILE_KU32_PACKED_FILE_NUMBER]; /**< Opened packed files */
+  orxU32          u32PackCounter;                                 /**< Number of mounted packs */
+  orxU32          u32Flags;                                       /**< Control flags */
+
 } orxFILE_STATIC;
 
 struct __orxFILE_t
@@ -68,6 +180,699 @@ static orxFILE_STATIC sstFile;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Reads a little endian 32 bit value
+ * @param[in] _pu8Data             Data to read
+ * @return Read value
+ */
+static orxINLINE orxU32 orxFile_ReadU32(const orxU8 *_pu8Data)
+{
+  /* Done! */
+  return (orxU32)_pu8Data[0] | ((orxU32)_pu8Data[1] << 8) | ((orxU32)_pu8Data[2] << 16) | ((orxU32)_pu8Data[3] << 24);
+}
+
+/** Writes a little endian 32 bit value
+ * @param[out] _pu8Data            Where to write
+ * @param[in] _u32Value            Value to write
+ */
+static orxINLINE void orxFile_WriteU32(orxU8 *_pu8Data, orxU32 _u32Value)
+{
+  /* Stores all bytes */
+  _pu8Data[0] = (orxU8)(_u32Value);
+  _pu8Data[1] = (orxU8)(_u32Value >> 8);
+  _pu8Data[2] = (orxU8)(_u32Value >> 16);
+  _pu8Data[3] = (orxU8)(_u32Value >> 24);
+
+  return;
+}
+
+/** Gets a packed path from a native one: '/' separators, no leading "./"
+ * @param[in] _zPath               Path to normalize
+ * @param[out] _acBuffer           Normalized path, orxFILE_KU32_PATH_LENGTH characters long
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE if path is too long
+ */
+static orxINLINE orxSTATUS orxFile_NormalizePath(const orxSTRING _zPath, orxCHAR *_acBuffer)
+{
+  const orxCHAR  *pcSrc;
+  orxCHAR        *pcDst;
+  orxSTATUS       eResult = orxSTATUS_SUCCESS;
+
+  /* Skips all leading current directory markers */
+  for(pcSrc = _zPath;
+      (*pcSrc == '.') && ((*(pcSrc + 1) == orxCHAR_DIRECTORY_SEPARATOR_LINUX) || (*(pcSrc + 1) == orxCHAR_DIRECTORY_SEPARATOR_WINDOWS));
+      pcSrc += 2);
+
+  /* For all characters */
+  for(pcDst = _acBuffer; *pcSrc != orxCHAR_NULL; pcSrc++, pcDst++)
+  {
+    /* Too long? */
+    if(pcDst == _acBuffer + orxFILE_KU32_PATH_LENGTH - 1)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+
+      break;
+    }
+
+    /* Stores it */
+    *pcDst = (*pcSrc == orxCHAR_DIRECTORY_SEPARATOR_WINDOWS) ? orxCHAR_DIRECTORY_SEPARATOR_LINUX : *pcSrc;
+  }
+
+  /* Ends string */
+  *pcDst = orxCHAR_NULL;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Finds an entry in a pack
+ * @param[in] _pstPack             Concerned pack
+ * @param[in] _u32ID               Entry's path CRC
+ * @param[in] _zPath               Entry's normalized path
+ * @return Entry / orxNULL
+ */
+static orxINLINE const orxU8 *orxFile_FindPackEntry(const orxFILE_PACK *_pstPack, orxU32 _u32ID, const orxSTRING _zPath)
+{
+  orxU32        u32Index;
+  const orxU8  *pu8Result = orxNULL;
+
+  /* For all entries in the bucket */
+  for(u32Index = orxFile_ReadU32(_pstPack->pu8Bucket + (_u32ID & _pstPack->u32BucketMask) * orxFILE_KU32_PACK_BUCKET_SIZE);
+      u32Index != orxFILE_KU32_PACK_NONE;
+      u32Index = orxFile_ReadU32(pu8Result + orxFILE_KU32_PACK_FIELD_NEXT))
+  {
+    /* Gets entry */
+    pu8Result = _pstPack->pu8Entry + u32Index * orxFILE_KU32_PACK_ENTRY_SIZE;
+
+    /* Found? */
+    if((orxFile_ReadU32(pu8Result + orxFILE_KU32_PACK_FIELD_ID) == _u32ID)
+    && (orxString_Compare((orxSTRING)_pstPack->pcName + orxFile_ReadU32(pu8Result + orxFILE_KU32_PACK_FIELD_NAME), _zPath) == 0))
+    {
+      break;
+    }
+  }
+
+  /* Not found? */
+  if(u32Index == orxFILE_KU32_PACK_NONE)
+  {
+    /* Updates result */
+    pu8Result = orxNULL;
+  }
+
+  /* Done! */
+  return pu8Result;
+}
+
+/** Finds a file in mounted packs, most recent ones first
+ * @param[in] _zPath               File's path
+ * @param[out] _ppstPack           Pack containing the file
+ * @return Entry / orxNULL
+ */
+static orxINLINE const orxU8 *orxFile_FindPacked(const orxSTRING _zPath, const orxFILE_PACK **_ppstPack)
+{
+  orxCHAR       acPath[orxFILE_KU32_PATH_LENGTH];
+  const orxU8  *pu8Result = orxNULL;
+
+  /* Has mounted packs and valid path? */
+  if((sstFile.u32PackCounter != 0) && (orxFile_NormalizePath(_zPath, acPath) != orxSTATUS_FAILURE))
+  {
+    orxU32 u32ID, i;
+
+    /* Gets its ID */
+    u32ID = orxString_ToCRC(acPath);
+
+    /* For all packs, most recent first */
+    for(i = sstFile.u32PackCounter; (i > 0) && (pu8Result == orxNULL); i--)
+    {
+      /* Finds entry */
+      pu8Result = orxFile_FindPackEntry(&(sstFile.astPackList[i - 1]), u32ID, acPath);
+
+      /* Found? */
+      if(pu8Result != orxNULL)
+      {
+        /* Stores pack */
+        *_ppstPack = &(sstFile.astPackList[i - 1]);
+      }
+    }
+  }
+
+  /* Done! */
+  return pu8Result;
+}
+
+/** Decompresses a LZ4 block
+ * @param[in] _pu8Src              Compressed data
+ * @param[in] _u32SrcSize          Compressed data size
+ * @param[out] _pu8Dst             Decompressed data
+ * @param[in] _u32DstSize          Decompressed data size
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE if data is corrupted
+ */
+static orxSTATUS orxFASTCALL orxFile_DecompressLZ4(const orxU8 *_pu8Src, orxU32 _u32SrcSize, orxU8 *_pu8Dst, orxU32 _u32DstSize)
+{
+  const orxU8  *pu8Src, *pu8SrcEnd;
+  orxU8        *pu8Dst, *pu8DstEnd;
+  orxSTATUS     eResult = orxSTATUS_SUCCESS;
+
+  /* For all sequences */
+  for(pu8Src = _pu8Src, pu8SrcEnd = _pu8Src + _u32SrcSize, pu8Dst = _pu8Dst, pu8DstEnd = _pu8Dst + _u32DstSize;
+      (pu8Src < pu8SrcEnd) && (eResult != orxSTATUS_FAILURE);)
+  {
+    orxU32 u32Token, u32Length, u32Byte;
+
+    /* Gets token */
+    u32Token = *pu8Src++;
+
+    /* Gets literal length */
+    u32Length = u32Token >> 4;
+    if(u32Length == 15)
+    {
+      do
+      {
+        u32Byte   = (pu8Src < pu8SrcEnd) ? *pu8Src++ : 0;
+        u32Length+= u32Byte;
+      } while(u32Byte == 255);
+    }
+
+    /* Invalid? */
+    if((u32Length > (orxU32)(pu8SrcEnd - pu8Src)) || (u32Length > (orxU32)(pu8DstEnd - pu8Dst)))
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+
+      break;
+    }
+
+    /* Copies literals */
+    orxMemory_Copy(pu8Dst, pu8Src, u32Length);
+    pu8Src += u32Length;
+    pu8Dst += u32Length;
+
+    /* Last sequence? */
+    if(pu8Src == pu8SrcEnd)
+    {
+      break;
+    }
+
+    /* Gets match offset */
+    if(pu8SrcEnd - pu8Src >= 2)
+    {
+      const orxU8  *pu8Match;
+      orxU32        u32Offset;
+
+      u32Offset = (orxU32)pu8Src[0] | ((orxU32)pu8Src[1] << 8);
+      pu8Src   += 2;
+
+      /* Gets match length */
+      u32Length = u32Token & 0x0F;
+      if(u32Length == 15)
+      {
+        do
+        {
+          u32Byte   = (pu8Src < pu8SrcEnd) ? *pu8Src++ : 0;
+          u32Length+= u32Byte;
+        } while(u32Byte == 255);
+      }
+      u32Length += 4;
+
+      /* Valid? */
+      if((u32Offset != 0) && (u32Offset <= (orxU32)(pu8Dst - _pu8Dst)) && (u32Length <= (orxU32)(pu8DstEnd - pu8Dst)))
+      {
+        /* Copies match, byte per byte as it can overlap */
+        for(pu8Match = pu8Dst - u32Offset; u32Length > 0; u32Length--)
+        {
+          *pu8Dst++ = *pu8Match++;
+        }
+      }
+      else
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Incomplete? */
+  if(pu8Dst != pu8DstEnd)
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Writes a LZ4 length extension
+ * @param[out] _pu8Dst             Where to write
+ * @param[in] _u32Length           Length remaining after the token's 15
+ * @return Next write position
+ */
+static orxINLINE orxU8 *orxFile_WriteLZ4Length(orxU8 *_pu8Dst, orxU32 _u32Length)
+{
+  /* Writes all full bytes */
+  for(; _u32Length >= 255; _u32Length -= 255)
+  {
+    *_pu8Dst++ = 255;
+  }
+
+  /* Writes remainder */
+  *_pu8Dst++ = (orxU8)_u32Length;
+
+  /* Done! */
+  return _pu8Dst;
+}
+
+/** Compresses data as a LZ4 block (greedy parsing)
+ * @param[in] _pu8Src              Data to compress
+ * @param[in] _u32SrcSize          Data size
+ * @param[out] _pu8Dst             Compressed data, needs orxFILE_LZ4_BOUND(_u32SrcSize) bytes
+ * @return Compressed size
+ */
+static orxU32 orxFASTCALL orxFile_CompressLZ4(const orxU8 *_pu8Src, orxU32 _u32SrcSize, orxU8 *_pu8Dst)
+{
+  orxU32  au32Table[1 << orxFILE_KU32_LZ4_HASH_LOG];
+  orxU32  u32Position, u32Anchor, u32Length;
+  orxU8  *pu8Dst;
+
+  /* Clears table */
+  orxMemory_Set(au32Table, 0xFF, sizeof(au32Table));
+
+  /* For all positions where a match can start */
+  for(u32Position = u32Anchor = 0, pu8Dst = _pu8Dst;
+      u32Position + orxFILE_KU32_LZ4_MATCH_LIMIT < _u32SrcSize;)
+  {
+    orxU32 u32Sequence, u32Hash, u32Reference;
+
+    /* Gets sequence & its hash */
+    u32Sequence = (orxU32)_pu8Src[u32Position] | ((orxU32)_pu8Src[u32Position + 1] << 8) | ((orxU32)_pu8Src[u32Position + 2] << 16) | ((orxU32)_pu8Src[u32Position + 3] << 24);
+    u32Hash     = ((u32Sequence * 2654435761U) & 0xFFFFFFFF) >> (32 - orxFILE_KU32_LZ4_HASH_LOG);
+
+    /* Gets reference & updates table */
+    u32Reference        = au32Table[u32Hash];
+    au32Table[u32Hash]  = u32Position;
+
+    /* Match? */
+    if((u32Reference != orxU32_UNDEFINED)
+    && (u32Position - u32Reference <= 0xFFFF)
+    && (orxMemory_Compare(_pu8Src + u32Reference, _pu8Src + u32Position, 4) == 0))
+    {
+      orxU32  u32Literal;
+      orxU8  *pu8Token;
+
+      /* Extends match, keeping the last literals */
+      for(u32Length = 4;
+          (u32Position + u32Length < _u32SrcSize - orxFILE_KU32_LZ4_LAST_LITERALS) && (_pu8Src[u32Reference + u32Length] == _pu8Src[u32Position + u32Length]);
+          u32Length++);
+
+      /* Writes token */
+      u32Literal  = u32Position - u32Anchor;
+      pu8Token    = pu8Dst++;
+      *pu8Token   = (orxU8)((orxMIN(u32Literal, 15) << 4) | orxMIN(u32Length - 4, 15));
+
+      /* Writes literals */
+      if(u32Literal >= 15)
+      {
+        pu8Dst = orxFile_WriteLZ4Length(pu8Dst, u32Literal - 15);
+      }
+      orxMemory_Copy(pu8Dst, _pu8Src + u32Anchor, u32Literal);
+      pu8Dst += u32Literal;
+
+      /* Writes offset */
+      *pu8Dst++ = (orxU8)(u32Position - u32Reference);
+      *pu8Dst++ = (orxU8)((u32Position - u32Reference) >> 8);
+
+      /* Writes match length */
+      if(u32Length - 4 >= 15)
+      {
+        pu8Dst = orxFile_WriteLZ4Length(pu8Dst, u32Length - 4 - 15);
+      }
+
+      /* Updates positions */
+      u32Position  += u32Length;
+      u32Anchor     = u32Position;
+    }
+    else
+    {
+      /* Next position */
+      u32Position++;
+    }
+  }
+
+  /* Writes last literals */
+  u32Length = _u32SrcSize - u32Anchor;
+  *pu8Dst++ = (orxU8)(orxMIN(u32Length, 15) << 4);
+  if(u32Length >= 15)
+  {
+    pu8Dst = orxFile_WriteLZ4Length(pu8Dst, u32Length - 15);
+  }
+  orxMemory_Copy(pu8Dst, _pu8Src + u32Anchor, u32Length);
+  pu8Dst += u32Length;
+
+  /* Done! */
+  return (orxU32)(pu8Dst - _pu8Dst);
+}
+
+/** Gets the content of a packed file, in place when it's not compressed
+ * @param[in] _pstPack             Pack containing the file
+ * @param[in] _pu8Entry            File's entry
+ * @param[out] _ppu8Data           Content
+ * @param[out] _ppu8Buffer         Allocated buffer if the content had to be decompressed, orxNULL otherwise
+ * @param[out] _pu32Size           Content size
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxFile_GetPackedContent(const orxFILE_PACK *_pstPack, const orxU8 *_pu8Entry, const orxU8 **_ppu8Data, orxU8 **_ppu8Buffer, orxU32 *_pu32Size)
+{
+  const orxU8  *pu8Data;
+  orxU32        u32Size;
+  orxSTATUS     eResult = orxSTATUS_SUCCESS;
+
+  /* Gets stored data & size */
+  pu8Data = (const orxU8 *)_pstPack->stView.pcData + orxFile_ReadU32(_pu8Entry + orxFILE_KU32_PACK_FIELD_OFFSET);
+  u32Size = orxFile_ReadU32(_pu8Entry + orxFILE_KU32_PACK_FIELD_SIZE);
+
+  /* Clears buffer */
+  *_ppu8Buffer = orxNULL;
+
+  /* Empty? */
+  if(u32Size == 0)
+  {
+    /* Uses empty content */
+    *_ppu8Data = (const orxU8 *)orxSTRING_EMPTY;
+  }
+  /* Compressed? */
+  else if(orxFile_ReadU32(_pu8Entry + orxFILE_KU32_PACK_FIELD_FLAGS) & orxFILE_KU32_PACK_FLAG_LZ4)
+  {
+    /* Allocates buffer */
+    *_ppu8Buffer = (orxU8 *)orxMemory_Allocate(u32Size, orxMEMORY_TYPE_MAIN);
+
+    /* Valid? */
+    if(*_ppu8Buffer != orxNULL)
+    {
+      /* Decompresses content */
+      if(orxFile_DecompressLZ4(pu8Data, orxFile_ReadU32(_pu8Entry + orxFILE_KU32_PACK_FIELD_PACKED_SIZE), *_ppu8Buffer, u32Size) != orxSTATUS_FAILURE)
+      {
+        /* Stores it */
+        *_ppu8Data = *_ppu8Buffer;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Packed file <%s> is corrupted.", _pstPack->pcName + orxFile_ReadU32(_pu8Entry + orxFILE_KU32_PACK_FIELD_NAME));
+
+        /* Frees buffer */
+        orxMemory_Free(*_ppu8Buffer);
+        *_ppu8Buffer = orxNULL;
+
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    /* Reads it in place */
+    *_ppu8Data = pu8Data;
+  }
+
+  /* Stores size */
+  *_pu32Size = u32Size;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets packed file from a file pointer
+ * @param[in] _pstFile             Concerned file
+ * @return orxFILE_PACKED / orxNULL if it's a native file
+ */
+static orxINLINE orxFILE_PACKED *orxFile_GetPacked(const orxFILE *_pstFile)
+{
+  /* Done! */
+  return (((const orxFILE_PACKED *)_pstFile >= sstFile.astPackedList) && ((const orxFILE_PACKED *)_pstFile < sstFile.astPackedList + orxFILE_KU32_PACKED_FILE_NUMBER))
+         ? (orxFILE_PACKED *)_pstFile
+         : (orxFILE_PACKED *)orxNULL;
+}
+
+/** Opens a packed file
+ * @param[in] _pstPack             Pack containing the file
+ * @param[in] _pu8Entry            File's entry
+ * @return orxFILE / orxNULL
+ */
+static orxINLINE orxFILE *orxFile_OpenPacked(const orxFILE_PACK *_pstPack, const orxU8 *_pu8Entry)
+{
+  orxU32  i;
+  orxFILE *pstResult = orxNULL;
+
+  /* Finds a free slot */
+  for(i = 0; (i < orxFILE_KU32_PACKED_FILE_NUMBER) && (sstFile.astPackedList[i].pu8Data != orxNULL); i++);
+
+  /* Found? */
+  if(i < orxFILE_KU32_PACKED_FILE_NUMBER)
+  {
+    orxFILE_PACKED *pstPacked;
+
+    /* Gets it */
+    pstPacked = &(sstFile.astPackedList[i]);
+
+    /* Gets its content */
+    if(orxFile_GetPackedContent(_pstPack, _pu8Entry, &(pstPacked->pu8Data), &(pstPacked->pu8Buffer), &(pstPacked->u32Size)) != orxSTATUS_FAILURE)
+    {
+      /* Rewinds it */
+      pstPacked->u32Cursor = 0;
+
+      /* Updates result */
+      pstResult = (orxFILE *)pstPacked;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't open packed file <%s>: too many packed files are already opened (%ld).", _pstPack->pcName + orxFile_ReadU32(_pu8Entry + orxFILE_KU32_PACK_FIELD_NAME), orxFILE_KU32_PACKED_FILE_NUMBER);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Maps a whole native file in memory for reading, without copying it when the platform supports memory mapping
+ * @param[in] _zPath               Full file's path to map
+ * @param[in] _u32MapFlags         Access hints (orxFILE_KU32_FLAG_MAP_*)
+ * @param[out] _pstView            View on the file content
+ * @return Returns the status of the operation
+ */
+static orxSTATUS orxFASTCALL orxFile_MapNative(const orxSTRING _zPath, orxU32 _u32MapFlags, orxFILE_VIEW *_pstView)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Module initialized ? */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+
+  /* Checks inputs */
+  orxASSERT(_zPath != orxNULL);
+  orxASSERT(_pstView != orxNULL);
+
+  /* Cleans view */
+  _pstView->pcData    = orxSTRING_EMPTY;
+  _pstView->u32Size   = 0;
+  _pstView->hInternal = orxFILE_KH_VIEW_EMPTY;
+
+#if defined(__orxWINDOWS__)
+
+  {
+    HANDLE hFile;
+
+    /* Opens file */
+    hFile = CreateFile(_zPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, (_u32MapFlags & orxFILE_KU32_FLAG_MAP_SEQUENTIAL) ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL, NULL);
+
+    /* Valid? */
+    if(hFile != INVALID_HANDLE_VALUE)
+    {
+      DWORD dwSizeHigh, dwSize;
+
+      /* Gets its size */
+      dwSize = GetFileSize(hFile, &dwSizeHigh);
+
+      /* Valid? */
+      if((dwSize != INVALID_FILE_SIZE) && (dwSizeHigh == 0))
+      {
+        /* Not empty? */
+        if(dwSize > 0)
+        {
+          HANDLE hMapping;
+
+          /* Creates mapping */
+          hMapping = CreateFileMapping(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+
+          /* Valid? */
+          if(hMapping != NULL)
+          {
+            const orxCHAR *pcData;
+
+            /* Maps the whole file */
+            pcData = (const orxCHAR *)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+
+            /* Success? */
+            if(pcData != NULL)
+            {
+              /* Updates view */
+              _pstView->pcData    = pcData;
+              _pstView->u32Size   = (orxU32)dwSize;
+              _pstView->hInternal = orxFILE_KH_VIEW_MAPPED;
+
+              /* Updates result */
+              eResult = orxSTATUS_SUCCESS;
+            }
+
+            /* Closes mapping, the view keeps it alive */
+            CloseHandle(hMapping);
+          }
+        }
+        else
+        {
+          /* Updates result */
+          eResult = orxSTATUS_SUCCESS;
+        }
+      }
+
+      /* Closes file */
+      CloseHandle(hFile);
+    }
+  }
+
+#elif defined(__orxFILE_MMAP__)
+
+  {
+    int s32File;
+
+    /* Opens file */
+    s32File = open(_zPath, O_RDONLY);
+
+    /* Valid? */
+    if(s32File >= 0)
+    {
+      struct stat stStat;
+
+      /* Gets its size */
+      if((fstat(s32File, &stStat) == 0) && ((orxU64)stStat.st_size <= (orxU64)orxU32_UNDEFINED))
+      {
+        /* Not empty? */
+        if(stStat.st_size > 0)
+        {
+          void *pData;
+
+          /* Maps the whole file */
+          pData = mmap(NULL, (size_t)stStat.st_size, PROT_READ, MAP_PRIVATE, s32File, 0);
+
+          /* Success? */
+          if(pData != MAP_FAILED)
+          {
+            /* Read ahead? */
+            if(_u32MapFlags & orxFILE_KU32_FLAG_MAP_READ_AHEAD)
+            {
+              /* Starts paging it in */
+              madvise(pData, (size_t)stStat.st_size, MADV_WILLNEED);
+            }
+
+            /* Sequential access? */
+            if(_u32MapFlags & orxFILE_KU32_FLAG_MAP_SEQUENTIAL)
+            {
+              /* Enables aggressive read ahead & early page release */
+              madvise(pData, (size_t)stStat.st_size, MADV_SEQUENTIAL);
+            }
+
+            /* Updates view */
+            _pstView->pcData    = (const orxCHAR *)pData;
+            _pstView->u32Size   = (orxU32)stStat.st_size;
+            _pstView->hInternal = orxFILE_KH_VIEW_MAPPED;
+
+            /* Updates result */
+            eResult = orxSTATUS_SUCCESS;
+          }
+        }
+        else
+        {
+          /* Updates result */
+          eResult = orxSTATUS_SUCCESS;
+        }
+      }
+
+      /* Closes file, the mapping keeps it alive */
+      close(s32File);
+    }
+  }
+
+#else /* __orxFILE_MMAP__ */
+
+  {
+    FILE *pstFile;
+
+    /* Opens file */
+    pstFile = fopen(_zPath, "rb");
+
+    /* Valid? */
+    if(pstFile != NULL)
+    {
+      long lSize;
+
+      /* Gets its size */
+      if((fseek(pstFile, 0, SEEK_END) == 0) && ((lSize = ftell(pstFile)) >= 0) && (fseek(pstFile, 0, SEEK_SET) == 0))
+      {
+        /* Not empty? */
+        if(lSize > 0)
+        {
+          orxCHAR *pcData;
+
+          /* Allocates buffer */
+          pcData = (orxCHAR *)orxMemory_Allocate((orxU32)lSize, orxMEMORY_TYPE_MAIN);
+
+          /* Valid? */
+          if(pcData != orxNULL)
+          {
+            /* Copies content */
+            if(fread(pcData, sizeof(orxCHAR), (size_t)lSize, pstFile) == (size_t)lSize)
+            {
+              /* Updates view */
+              _pstView->pcData    = pcData;
+              _pstView->u32Size   = (orxU32)lSize;
+              _pstView->hInternal = orxFILE_KH_VIEW_BUFFER;
+
+              /* Updates result */
+              eResult = orxSTATUS_SUCCESS;
+            }
+            else
+            {
+              /* Frees buffer */
+              orxMemory_Free(pcData);
+            }
+          }
+        }
+        else
+        {
+          /* Updates result */
+          eResult = orxSTATUS_SUCCESS;
+        }
+      }
+
+      /* Closes file */
+      fclose(pstFile);
+    }
+  }
+
+#endif /* __orxFILE_MMAP__ */
+
+  /* Done! */
+  return eResult;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -110,9 +915,32 @@ orxSTATUS orxFASTCALL orxFile_Init()
  */
 void orxFASTCALL orxFile_Exit()
 {
+  orxU32 i;
+
   /* Module initialized ? */
   orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
 
+  /* For all packed files */
+  for(i = 0; i < orxFILE_KU32_PACKED_FILE_NUMBER; i++)
+  {
+    /* Still opened with a decompressed content? */
+    if(sstFile.astPackedList[i].pu8Buffer != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(sstFile.astPackedList[i].pu8Buffer);
+    }
+  }
+
+  /* For all mounted packs */
+  for(i = 0; i < sstFile.u32PackCounter; i++)
+  {
+    /* Unmaps it */
+    orxFile_Unmap(&(sstFile.astPackList[i].stView));
+  }
+
+  /* Cleans static controller */
+  orxMemory_Zero(&sstFile, sizeof(orxFILE_STATIC));
+
   /* Module not ready now */
   sstFile.u32Flags = orxFILE_KU32_STATIC_FLAG_NONE;
 }
@@ -125,8 +953,11 @@ void orxFASTCALL orxFile_Exit()
 orxFILE *orxFASTCALL orxFile_Open(const orxSTRING _zPath, orxU32 _u32OpenFlags)
 {
   /* Convert the open flags into a string */
-  orxCHAR acMode[4];
-  orxBOOL bBinaryMode;
+  orxCHAR             acMode[4];
+  orxBOOL             bBinaryMode;
+  const orxU8        *pu8Entry;
+  const orxFILE_PACK *pstPack;
+  orxFILE            *pstResult;
 
   /* Module initialized ? */
   orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
@@ -253,8 +1084,21 @@ orxFILE *orxFASTCALL orxFile_Open(const orxSTRING _zPath, orxU32 _u32OpenFlags)
     }
   }
 
-  /* Open the file */
-  return(orxFILE*)fopen(_zPath, acMode);
+  /* Read only access to a packed file? */
+  if((_u32OpenFlags == orxFILE_KU32_FLAG_OPEN_READ)
+  && ((pu8Entry = orxFile_FindPacked(_zPath, &pstPack)) != orxNULL))
+  {
+    /* Opens it from its pack */
+    pstResult = orxFile_OpenPacked(pstPack, pu8Entry);
+  }
+  else
+  {
+    /* Open the file */
+    pstResult = (orxFILE *)fopen(_zPath, acMode);
+  }
+
+  /* Done! */
+  return pstResult;
 }
 
 /** Reads data from a file
@@ -275,7 +1119,24 @@ orxU32 orxFASTCALL orxFile_Read(void *_pReadData, orxU32 _u32ElemSize, orxU32 _u
   /* Valid input ? */
   if(_pstFile != orxNULL)
   {
-    u32Ret = (orxU32)fread(_pReadData, _u32ElemSize, _u32NbElem, (FILE*)_pstFile);
+    orxFILE_PACKED *pstPacked;
+
+    /* Packed? */
+    if((pstPacked = orxFile_GetPacked(_pstFile)) != orxNULL)
+    {
+      /* Gets number of available elements */
+      u32Ret = (_u32ElemSize != 0) ? orxMIN(_u32NbElem, (pstPacked->u32Size - pstPacked->u32Cursor) / _u32ElemSize) : 0;
+
+      /* Copies them */
+      orxMemory_Copy(_pReadData, pstPacked->pu8Data + pstPacked->u32Cursor, u32Ret * _u32ElemSize);
+
+      /* Updates cursor */
+      pstPacked->u32Cursor += u32Ret * _u32ElemSize;
+    }
+    else
+    {
+      u32Ret = (orxU32)fread(_pReadData, _u32ElemSize, _u32NbElem, (FILE*)_pstFile);
+    }
   }
 
   /* Returns the number of read elements */
@@ -300,8 +1161,8 @@ orxU32 orxFASTCALL orxFile_Write(void *_pDataToWrite, orxU32 _u32ElemSize, orxU3
   /* Checks inputs */
   orxASSERT(_pstFile != orxNULL);
 
-  /* Valid input ? */
-  if(_pstFile != orxNULL)
+  /* Valid input and not packed (read only)? */
+  if((_pstFile != orxNULL) && (orxFile_GetPacked(_pstFile) == orxNULL))
   {
     u32Ret = (orxU32)fwrite(_pDataToWrite, _u32ElemSize, _u32NbElem, (FILE*)_pstFile);
   }
@@ -317,14 +1178,14 @@ orxU32 orxFASTCALL orxFile_Write(void *_pDataToWrite, orxU32 _u32ElemSize, orxU3
  */
 orxS32 orxCDECL orxFile_Print(orxFILE *_pstFile, orxSTRING _zString, ...)
 {
-  orxS32 s32Result;
+  orxS32 s32Result = 0;
 
   /* Checks */
   orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
   orxASSERT(_zString != orxNULL);
 
-  /* Valid input? */
-  if(_pstFile != orxNULL)
+  /* Valid input and not packed (read only)? */
+  if((_pstFile != orxNULL) && (orxFile_GetPacked(_pstFile) == orxNULL))
   {
     va_list stArgs;
 
@@ -358,8 +1219,33 @@ orxBOOL orxFASTCALL orxFile_ReadLine(orxSTRING _zBuffer, orxU32 _u32Size, orxFIL
   /* Valid input ? */
   if(_pstFile != orxNULL)
   {
+    orxFILE_PACKED *pstPacked;
+
+    /* Packed? */
+    if((pstPacked = orxFile_GetPacked(_pstFile)) != orxNULL)
+    {
+      orxU32 u32Length;
+
+      /* Copies characters up to end of line (included) or end of buffer */
+      for(u32Length = 0; (u32Length + 1 < _u32Size) && (pstPacked->u32Cursor < pstPacked->u32Size);)
+      {
+        if((_zBuffer[u32Length++] = (orxCHAR)pstPacked->pu8Data[pstPacked->u32Cursor++]) == orxCHAR_LF)
+        {
+          break;
+        }
+      }
+
+      /* Ends string */
+      if(_u32Size > 0)
+      {
+        _zBuffer[u32Length] = orxCHAR_NULL;
+      }
+
+      /* Updates result */
+      bRet = (u32Length > 0) ? orxTRUE : orxFALSE;
+    }
     /* Try to read a line */
-    if(fgets(_zBuffer, _u32Size, (FILE*)_pstFile))
+    else if(fgets(_zBuffer, _u32Size, (FILE*)_pstFile))
     {
       bRet = orxTRUE;
     }
@@ -391,8 +1277,26 @@ orxSTATUS orxFASTCALL orxFile_Close(orxFILE *_pstFile)
   /* valid ? */
   if(_pstFile != orxNULL)
   {
+    orxFILE_PACKED *pstPacked;
+
+    /* Packed? */
+    if((pstPacked = orxFile_GetPacked(_pstFile)) != orxNULL)
+    {
+      /* Has decompressed content? */
+      if(pstPacked->pu8Buffer != orxNULL)
+      {
+        /* Frees it */
+        orxMemory_Free(pstPacked->pu8Buffer);
+      }
+
+      /* Frees slot */
+      orxMemory_Zero(pstPacked, sizeof(orxFILE_PACKED));
+
+      /* Success ! */
+      eRet = orxSTATUS_SUCCESS;
+    }
     /* Close file pointer */
-    if(fclose((FILE*)_pstFile) == 0)
+    else if(fclose((FILE*)_pstFile) == 0)
     {
       /* Success ! */
       eRet = orxSTATUS_SUCCESS;
@@ -403,6 +1307,691 @@ orxSTATUS orxFASTCALL orxFile_Close(orxFILE *_pstFile)
   return eRet;
 }
 
+/** Maps a whole file in memory for reading, without copying it when the platform supports memory mapping or when it's stored uncompressed in a pack
+ * @param[in] _zPath               Full file's path to map
+ * @param[in] _u32MapFlags         Access hints (orxFILE_KU32_FLAG_MAP_*)
+ * @param[out] _pstView            View on the file content
+ * @return Returns the status of the operation
+ */
+orxSTATUS orxFASTCALL orxFile_Map(const orxSTRING _zPath, orxU32 _u32MapFlags, orxFILE_VIEW *_pstView)
+{
+  const orxU8        *pu8Entry;
+  const orxFILE_PACK *pstPack;
+  orxSTATUS           eResult;
+
+  /* Module initialized ? */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+
+  /* Checks inputs */
+  orxASSERT(_zPath != orxNULL);
+  orxASSERT(_pstView != orxNULL);
+
+  /* Packed? */
+  if((pu8Entry = orxFile_FindPacked(_zPath, &pstPack)) != orxNULL)
+  {
+    const orxU8  *pu8Data;
+    orxU8        *pu8Buffer;
+
+    /* Gets its content */
+    eResult = orxFile_GetPackedContent(pstPack, pu8Entry, &pu8Data, &pu8Buffer, &(_pstView->u32Size));
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Updates view */
+      _pstView->pcData    = (const orxCHAR *)pu8Data;
+      _pstView->hInternal = (pu8Buffer != orxNULL) ? orxFILE_KH_VIEW_BUFFER : orxFILE_KH_VIEW_PACKED;
+    }
+    else
+    {
+      /* Cleans view */
+      _pstView->pcData    = orxSTRING_EMPTY;
+      _pstView->u32Size   = 0;
+      _pstView->hInternal = orxFILE_KH_VIEW_EMPTY;
+    }
+  }
+  else
+  {
+    /* Maps native file */
+    eResult = orxFile_MapNative(_zPath, _u32MapFlags, _pstView);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Unmaps a file view
+ * @param[in] _pstView             View to unmap, its content can't be accessed anymore
+ * @return Returns the status of the operation
+ */
+orxSTATUS orxFASTCALL orxFile_Unmap(orxFILE_VIEW *_pstView)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Module initialized ? */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+
+  /* Checks inputs */
+  orxASSERT(_pstView != orxNULL);
+
+  /* Mapped? */
+  if(_pstView->hInternal == orxFILE_KH_VIEW_MAPPED)
+  {
+#if defined(__orxWINDOWS__)
+
+    /* Unmaps it */
+    eResult = (UnmapViewOfFile(_pstView->pcData) != FALSE) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+#elif defined(__orxFILE_MMAP__)
+
+    /* Unmaps it */
+    eResult = (munmap((void *)_pstView->pcData, (size_t)_pstView->u32Size) == 0) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+#endif /* __orxFILE_MMAP__ */
+  }
+  /* Copied? */
+  else if(_pstView->hInternal == orxFILE_KH_VIEW_BUFFER)
+  {
+    /* Frees it */
+    orxMemory_Free((void *)_pstView->pcData);
+  }
+
+  /* Cleans view */
+  _pstView->pcData    = orxSTRING_EMPTY;
+  _pstView->u32Size   = 0;
+  _pstView->hInternal = orxFILE_KH_VIEW_EMPTY;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Mounts a pack, its content will be searched ahead of the native file system and of previously mounted packs
+ * @param[in] _zArchive            Pack's path
+ * @return Returns the status of the operation
+ */
+orxSTATUS orxFASTCALL orxFile_Mount(const orxSTRING _zArchive)
+{
+  orxU32    u32ID, i;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Module initialized ? */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+
+  /* Checks inputs */
+  orxASSERT(_zArchive != orxNULL);
+
+  /* Gets its ID */
+  u32ID = orxString_ToCRC(_zArchive);
+
+  /* Finds it */
+  for(i = 0; (i < sstFile.u32PackCounter) && (sstFile.astPackList[i].u32ID != u32ID); i++);
+
+  /* Already mounted? */
+  if(i < sstFile.u32PackCounter)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Pack <%s> is already mounted.", _zArchive);
+  }
+  /* Too many packs? */
+  else if(sstFile.u32PackCounter == orxFILE_KU32_PACK_NUMBER)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't mount pack <%s>: too many packs are already mounted (%ld).", _zArchive, orxFILE_KU32_PACK_NUMBER);
+  }
+  else
+  {
+    orxFILE_PACK *pstPack;
+
+    /* Gets new pack */
+    pstPack = &(sstFile.astPackList[sstFile.u32PackCounter]);
+
+    /* Maps it, index & data will be randomly accessed */
+    if(orxFile_MapNative(_zArchive, 0, &(pstPack->stView)) != orxSTATUS_FAILURE)
+    {
+      const orxU8  *pu8Pack;
+      orxU32        u32Size;
+
+      /* Gets its content */
+      pu8Pack = (const orxU8 *)pstPack->stView.pcData;
+      u32Size = pstPack->stView.u32Size;
+
+      /* Valid header? */
+      if((u32Size >= orxFILE_KU32_PACK_HEADER_SIZE)
+      && (orxFile_ReadU32(pu8Pack + orxFILE_KU32_PACK_HEADER_MAGIC) == orxFILE_KU32_PACK_MAGIC)
+      && (orxFile_ReadU32(pu8Pack + orxFILE_KU32_PACK_HEADER_VERSION) == orxFILE_KU32_PACK_VERSION))
+      {
+        orxU32 u32EntryNumber, u32BucketNumber, u32BucketOffset, u32EntryOffset, u32NameOffset, u32NameSize;
+
+        /* Gets layout */
+        u32EntryNumber  = orxFile_ReadU32(pu8Pack + orxFILE_KU32_PACK_HEADER_ENTRY_NUMBER);
+        u32BucketNumber = orxFile_ReadU32(pu8Pack + orxFILE_KU32_PACK_HEADER_BUCKET_NUMBER);
+        u32BucketOffset = orxFile_ReadU32(pu8Pack + orxFILE_KU32_PACK_HEADER_BUCKET_OFFSET);
+        u32EntryOffset  = orxFile_ReadU32(pu8Pack + orxFILE_KU32_PACK_HEADER_ENTRY_OFFSET);
+        u32NameOffset   = orxFile_ReadU32(pu8Pack + orxFILE_KU32_PACK_HEADER_NAME_OFFSET);
+        u32NameSize     = orxFile_ReadU32(pu8Pack + orxFILE_KU32_PACK_HEADER_NAME_SIZE);
+
+        /* Valid tables? */
+        if((u32BucketNumber != 0)
+        && ((u32BucketNumber & (u32BucketNumber - 1)) == 0)
+        && (u32BucketNumber <= (u32Size / orxFILE_KU32_PACK_BUCKET_SIZE))
+        && (u32EntryNumber <= (u32Size / orxFILE_KU32_PACK_ENTRY_SIZE))
+        && (u32BucketOffset <= u32Size - u32BucketNumber * orxFILE_KU32_PACK_BUCKET_SIZE)
+        && (u32EntryOffset <= u32Size - u32EntryNumber * orxFILE_KU32_PACK_ENTRY_SIZE)
+        && (u32NameSize > 0)
+        && (u32NameSize <= u32Size)
+        && (u32NameOffset <= u32Size - u32NameSize)
+        && (pu8Pack[u32NameOffset + u32NameSize - 1] == orxCHAR_NULL))
+        {
+          /* Stores tables */
+          pstPack->pu8Bucket      = pu8Pack + u32BucketOffset;
+          pstPack->pu8Entry       = pu8Pack + u32EntryOffset;
+          pstPack->pcName         = (const orxCHAR *)pu8Pack + u32NameOffset;
+          pstPack->u32EntryNumber = u32EntryNumber;
+          pstPack->u32BucketMask  = u32BucketNumber - 1;
+
+          /* For all buckets */
+          for(i = 0; i < u32BucketNumber; i++)
+          {
+            orxU32 u32Index;
+
+            /* Gets its first entry */
+            u32Index = orxFile_ReadU32(pstPack->pu8Bucket + i * orxFILE_KU32_PACK_BUCKET_SIZE);
+
+            /* Invalid? */
+            if((u32Index != orxFILE_KU32_PACK_NONE) && (u32Index >= u32EntryNumber))
+            {
+              break;
+            }
+          }
+
+          /* Valid buckets? */
+          if(i == u32BucketNumber)
+          {
+            /* For all entries */
+            for(i = 0; i < u32EntryNumber; i++)
+            {
+              const orxU8  *pu8Entry;
+              orxU32        u32Next, u32Offset, u32PackedSize;
+
+              /* Gets it */
+              pu8Entry      = pstPack->pu8Entry + i * orxFILE_KU32_PACK_ENTRY_SIZE;
+              u32Next       = orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_NEXT);
+              u32Offset     = orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_OFFSET);
+              u32PackedSize = orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_PACKED_SIZE);
+
+              /* Invalid? */
+              if((orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_NAME) >= u32NameSize)
+              || ((u32Next != orxFILE_KU32_PACK_NONE) && (u32Next >= i))
+              || (u32Offset > u32Size)
+              || (u32PackedSize > u32Size - u32Offset)
+              || (!(orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_FLAGS) & orxFILE_KU32_PACK_FLAG_LZ4)
+               && (u32PackedSize != orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_SIZE))))
+              {
+                break;
+              }
+            }
+
+            /* Valid entries? */
+            if(i == u32EntryNumber)
+            {
+              /* Stores its ID */
+              pstPack->u32ID = u32ID;
+
+              /* Updates pack counter */
+              sstFile.u32PackCounter++;
+
+              /* Updates result */
+              eResult = orxSTATUS_SUCCESS;
+            }
+          }
+        }
+      }
+
+      /* Failure? */
+      if(eResult == orxSTATUS_FAILURE)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't mount pack <%s>: invalid format.", _zArchive);
+
+        /* Unmaps it */
+        orxFile_Unmap(&(pstPack->stView));
+
+        /* Cleans it */
+        orxMemory_Zero(pstPack, sizeof(orxFILE_PACK));
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't mount pack <%s>: file not found.", _zArchive);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Unmounts a pack, all files & views opened from it have to be closed beforehand
+ * @param[in] _zArchive            Pack's path, as given to orxFile_Mount
+ * @return Returns the status of the operation
+ */
+orxSTATUS orxFASTCALL orxFile_Unmount(const orxSTRING _zArchive)
+{
+  orxU32    u32ID, i;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Module initialized ? */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+
+  /* Checks inputs */
+  orxASSERT(_zArchive != orxNULL);
+
+  /* Gets its ID */
+  u32ID = orxString_ToCRC(_zArchive);
+
+  /* Finds it */
+  for(i = 0; (i < sstFile.u32PackCounter) && (sstFile.astPackList[i].u32ID != u32ID); i++);
+
+  /* Found? */
+  if(i < sstFile.u32PackCounter)
+  {
+    /* Unmaps it */
+    eResult = orxFile_Unmap(&(sstFile.astPackList[i].stView));
+
+    /* Updates pack counter */
+    sstFile.u32PackCounter--;
+
+    /* Keeps mount order */
+    orxMemory_Move(&(sstFile.astPackList[i]), &(sstFile.astPackList[i + 1]), (sstFile.u32PackCounter - i) * sizeof(orxFILE_PACK));
+
+    /* Cleans last slot */
+    orxMemory_Zero(&(sstFile.astPackList[sstFile.u32PackCounter]), sizeof(orxFILE_PACK));
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't unmount pack <%s>: not mounted.", _zArchive);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Creates a pack from native files, they'll be stored under the given paths
+ * @param[in] _zArchive            Pack's path
+ * @param[in] _azFileList          List of file paths to store
+ * @param[in] _u32FileNumber       Number of files
+ * @param[in] _bCompress           If orxTRUE, files will be LZ4 compressed when it saves space
+ * @return Returns the status of the operation
+ */
+orxSTATUS orxFASTCALL orxFile_Pack(const orxSTRING _zArchive, const orxSTRING *_azFileList, orxU32 _u32FileNumber, orxBOOL _bCompress)
+{
+  static const orxU8 sau8Padding[orxFILE_KU32_PACK_ALIGNMENT] = {0};
+  orxCHAR   acPath[orxFILE_KU32_PATH_LENGTH];
+  orxU32    u32NameSize, u32BucketNumber, u32IndexSize, i;
+  orxU8    *pu8Index;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Module initialized ? */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+
+  /* Checks inputs */
+  orxASSERT(_zArchive != orxNULL);
+  orxASSERT((_azFileList != orxNULL) || (_u32FileNumber == 0));
+
+  /* For all files */
+  for(i = 0, u32NameSize = 1; i < _u32FileNumber; i++)
+  {
+    /* Invalid path? */
+    if(orxFile_NormalizePath(_azFileList[i], acPath) == orxSTATUS_FAILURE)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't pack file <%s>: path is too long.", _azFileList[i]);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+
+      break;
+    }
+
+    /* Updates name table size */
+    u32NameSize += orxString_GetLength(acPath) + 1;
+  }
+
+  /* Gets bucket number: power of two, at least as many as files */
+  for(u32BucketNumber = 1; u32BucketNumber < _u32FileNumber; u32BucketNumber <<= 1);
+
+  /* Gets index size */
+  u32IndexSize = orxFILE_KU32_PACK_HEADER_SIZE + u32BucketNumber * orxFILE_KU32_PACK_BUCKET_SIZE + _u32FileNumber * orxFILE_KU32_PACK_ENTRY_SIZE + u32NameSize;
+  u32IndexSize = (u32IndexSize + orxFILE_KU32_PACK_ALIGNMENT - 1) & ~(orxFILE_KU32_PACK_ALIGNMENT - 1);
+
+  /* Allocates index */
+  pu8Index = (eResult != orxSTATUS_FAILURE) ? (orxU8 *)orxMemory_Allocate(u32IndexSize, orxMEMORY_TYPE_MAIN) : (orxU8 *)orxNULL;
+
+  /* Valid? */
+  if(pu8Index != orxNULL)
+  {
+    FILE *pstFile;
+
+    /* Inits it */
+    orxMemory_Zero(pu8Index, u32IndexSize);
+    orxMemory_Set(pu8Index + orxFILE_KU32_PACK_HEADER_SIZE, 0xFF, u32BucketNumber * orxFILE_KU32_PACK_BUCKET_SIZE);
+    orxFile_WriteU32(pu8Index + orxFILE_KU32_PACK_HEADER_MAGIC, orxFILE_KU32_PACK_MAGIC);
+    orxFile_WriteU32(pu8Index + orxFILE_KU32_PACK_HEADER_VERSION, orxFILE_KU32_PACK_VERSION);
+    orxFile_WriteU32(pu8Index + orxFILE_KU32_PACK_HEADER_ENTRY_NUMBER, _u32FileNumber);
+    orxFile_WriteU32(pu8Index + orxFILE_KU32_PACK_HEADER_BUCKET_NUMBER, u32BucketNumber);
+    orxFile_WriteU32(pu8Index + orxFILE_KU32_PACK_HEADER_BUCKET_OFFSET, orxFILE_KU32_PACK_HEADER_SIZE);
+    orxFile_WriteU32(pu8Index + orxFILE_KU32_PACK_HEADER_ENTRY_OFFSET, orxFILE_KU32_PACK_HEADER_SIZE + u32BucketNumber * orxFILE_KU32_PACK_BUCKET_SIZE);
+    orxFile_WriteU32(pu8Index + orxFILE_KU32_PACK_HEADER_NAME_OFFSET, orxFILE_KU32_PACK_HEADER_SIZE + u32BucketNumber * orxFILE_KU32_PACK_BUCKET_SIZE + _u32FileNumber * orxFILE_KU32_PACK_ENTRY_SIZE);
+    orxFile_WriteU32(pu8Index + orxFILE_KU32_PACK_HEADER_NAME_SIZE, u32NameSize);
+
+    /* Opens pack & reserves its index */
+    pstFile = fopen(_zArchive, "wb");
+    if((pstFile != NULL) && (fwrite(pu8Index, 1, u32IndexSize, pstFile) == u32IndexSize))
+    {
+      orxFILE_PACK  stPack;
+      orxU32        u32Offset, u32NameOffset;
+
+      /* Uses a pack on the index for lookups */
+      orxMemory_Zero(&stPack, sizeof(orxFILE_PACK));
+      stPack.pu8Bucket      = pu8Index + orxFILE_KU32_PACK_HEADER_SIZE;
+      stPack.pu8Entry       = stPack.pu8Bucket + u32BucketNumber * orxFILE_KU32_PACK_BUCKET_SIZE;
+      stPack.pcName         = (const orxCHAR *)stPack.pu8Entry + _u32FileNumber * orxFILE_KU32_PACK_ENTRY_SIZE;
+      stPack.u32BucketMask  = u32BucketNumber - 1;
+
+      /* For all files */
+      for(i = 0, u32Offset = u32IndexSize, u32NameOffset = 1; (i < _u32FileNumber) && (eResult != orxSTATUS_FAILURE); i++)
+      {
+        orxFILE_VIEW  stView;
+        orxU32        u32ID;
+
+        /* Gets its packed path & ID */
+        orxFile_NormalizePath(_azFileList[i], acPath);
+        u32ID = orxString_ToCRC(acPath);
+
+        /* Duplicate? */
+        if(orxFile_FindPackEntry(&stPack, u32ID, acPath) != orxNULL)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't pack file <%s>: path already used.", _azFileList[i]);
+
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+        /* Reads it */
+        else if(orxFile_MapNative(acPath, orxFILE_KU32_FLAG_MAP_SEQUENTIAL, &stView) != orxSTATUS_FAILURE)
+        {
+          const orxU8  *pu8Data;
+          orxU8        *pu8Compressed = orxNULL, *pu8Entry, *pu8Bucket;
+          orxU32        u32PackedSize, u32Padding, u32Flags = 0;
+          struct stat   stStat;
+
+          /* Gets data */
+          pu8Data       = (const orxU8 *)stView.pcData;
+          u32PackedSize = stView.u32Size;
+
+          /* Should compress? */
+          if((_bCompress != orxFALSE) && (stView.u32Size > 0))
+          {
+            /* Allocates compression buffer */
+            pu8Compressed = (orxU8 *)orxMemory_Allocate(orxFILE_LZ4_BOUND(stView.u32Size), orxMEMORY_TYPE_MAIN);
+
+            /* Valid? */
+            if(pu8Compressed != orxNULL)
+            {
+              orxU32 u32CompressedSize;
+
+              /* Compresses data */
+              u32CompressedSize = orxFile_CompressLZ4(pu8Data, stView.u32Size, pu8Compressed);
+
+              /* Saves space? */
+              if(u32CompressedSize < stView.u32Size)
+              {
+                /* Uses it */
+                pu8Data       = pu8Compressed;
+                u32PackedSize = u32CompressedSize;
+                u32Flags      = orxFILE_KU32_PACK_FLAG_LZ4;
+              }
+            }
+          }
+
+          /* Gets padding */
+          u32Padding = ((u32PackedSize + orxFILE_KU32_PACK_ALIGNMENT - 1) & ~(orxFILE_KU32_PACK_ALIGNMENT - 1)) - u32PackedSize;
+
+          /* Writes data, aligned */
+          if((fwrite(pu8Data, 1, u32PackedSize, pstFile) != u32PackedSize)
+          || (fwrite(sau8Padding, 1, u32Padding, pstFile) != u32Padding))
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't write file <%s> to pack <%s>.", _azFileList[i], _zArchive);
+
+            /* Updates result */
+            eResult = orxSTATUS_FAILURE;
+          }
+
+          /* Stores entry */
+          pu8Entry  = (orxU8 *)stPack.pu8Entry + i * orxFILE_KU32_PACK_ENTRY_SIZE;
+          pu8Bucket = (orxU8 *)stPack.pu8Bucket + (u32ID & stPack.u32BucketMask) * orxFILE_KU32_PACK_BUCKET_SIZE;
+          orxFile_WriteU32(pu8Entry + orxFILE_KU32_PACK_FIELD_ID, u32ID);
+          orxFile_WriteU32(pu8Entry + orxFILE_KU32_PACK_FIELD_NAME, u32NameOffset);
+          orxFile_WriteU32(pu8Entry + orxFILE_KU32_PACK_FIELD_NEXT, orxFile_ReadU32(pu8Bucket));
+          orxFile_WriteU32(pu8Entry + orxFILE_KU32_PACK_FIELD_OFFSET, u32Offset);
+          orxFile_WriteU32(pu8Entry + orxFILE_KU32_PACK_FIELD_SIZE, stView.u32Size);
+          orxFile_WriteU32(pu8Entry + orxFILE_KU32_PACK_FIELD_PACKED_SIZE, u32PackedSize);
+          orxFile_WriteU32(pu8Entry + orxFILE_KU32_PACK_FIELD_FLAGS, u32Flags);
+          orxFile_WriteU32(pu8Entry + orxFILE_KU32_PACK_FIELD_TIME_STAMP, (stat(acPath, &stStat) == 0) ? (orxU32)stStat.st_mtime : 0);
+          orxFile_WriteU32(pu8Bucket, i);
+          orxString_Copy((orxSTRING)stPack.pcName + u32NameOffset, acPath);
+
+          /* Updates offsets */
+          u32Offset    += u32PackedSize + u32Padding;
+          u32NameOffset+= orxString_GetLength(acPath) + 1;
+
+          /* Has compression buffer? */
+          if(pu8Compressed != orxNULL)
+          {
+            /* Frees it */
+            orxMemory_Free(pu8Compressed);
+          }
+
+          /* Unmaps file */
+          orxFile_Unmap(&stView);
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't pack file <%s>: file not found.", _azFileList[i]);
+
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+      }
+
+      /* Writes final index */
+      if((eResult == orxSTATUS_FAILURE)
+      || (fseek(pstFile, 0, SEEK_SET) != 0)
+      || (fwrite(pu8Index, 1, u32IndexSize, pstFile) != u32IndexSize))
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't create pack <%s>.", _zArchive);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+
+    /* Closes pack */
+    if((pstFile != NULL) && (fclose(pstFile) != 0))
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+
+    /* Failure? */
+    if((pstFile != NULL) && (eResult == orxSTATUS_FAILURE))
+    {
+      /* Removes incomplete pack */
+      remove(_zArchive);
+    }
+
+    /* Frees index */
+    orxMemory_Free(pu8Index);
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets info about a file stored in a mounted pack
+ * @param[in] _zPath               File's path
+ * @param[out] _pu32Size           File's size (in bytes), can be orxNULL
+ * @param[out] _pu32TimeStamp      File's last modification time stamp, can be orxNULL
+ * @return Returns orxTRUE if the file is stored in a mounted pack, else returns orxFALSE.
+ */
+orxBOOL orxFASTCALL orxFile_GetPackedInfo(const orxSTRING _zPath, orxU32 *_pu32Size, orxU32 *_pu32TimeStamp)
+{
+  const orxU8        *pu8Entry;
+  const orxFILE_PACK *pstPack;
+  orxBOOL             bResult = orxFALSE;
+
+  /* Module initialized ? */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+
+  /* Checks inputs */
+  orxASSERT(_zPath != orxNULL);
+
+  /* Found? */
+  if((pu8Entry = orxFile_FindPacked(_zPath, &pstPack)) != orxNULL)
+  {
+    /* Stores info */
+    if(_pu32Size != orxNULL)
+    {
+      *_pu32Size = orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_SIZE);
+    }
+    if(_pu32TimeStamp != orxNULL)
+    {
+      *_pu32TimeStamp = orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_TIME_STAMP);
+    }
+
+    /* Updates result */
+    bResult = orxTRUE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Finds next file stored in mounted packs, directly inside a directory (files shadowed by more recent packs are skipped)
+ * @param[in] _zDirectory          Directory's path, empty for root
+ * @param[in,out] _pu32Cursor      Search cursor, 0 for the first file. Will be updated to the next one
+ * @param[out] _ppcName            File's name, without directory (null-terminated)
+ * @param[out] _pu32Size           File's size (in bytes)
+ * @param[out] _pu32TimeStamp      File's last modification time stamp
+ * @return Returns orxTRUE if a file has been found, else returns orxFALSE.
+ */
+orxBOOL orxFASTCALL orxFile_FindNextPacked(const orxSTRING _zDirectory, orxU32 *_pu32Cursor, const orxCHAR **_ppcName, orxU32 *_pu32Size, orxU32 *_pu32TimeStamp)
+{
+  orxCHAR acDirectory[orxFILE_KU32_PATH_LENGTH];
+  orxBOOL bResult = orxFALSE;
+
+  /* Module initialized ? */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+
+  /* Checks inputs */
+  orxASSERT(_zDirectory != orxNULL);
+  orxASSERT(_pu32Cursor != orxNULL);
+  orxASSERT(_ppcName != orxNULL);
+  orxASSERT(_pu32Size != orxNULL);
+  orxASSERT(_pu32TimeStamp != orxNULL);
+
+  /* Has mounted packs and valid directory? */
+  if((sstFile.u32PackCounter != 0) && (orxFile_NormalizePath(_zDirectory, acDirectory) != orxSTATUS_FAILURE))
+  {
+    orxU32 u32Length, u32Base, i;
+
+    /* Gets its length */
+    u32Length = orxString_GetLength(acDirectory);
+
+    /* Doesn't end with a separator? */
+    if((u32Length > 0) && (acDirectory[u32Length - 1] != orxCHAR_DIRECTORY_SEPARATOR_LINUX) && (u32Length < orxFILE_KU32_PATH_LENGTH - 1))
+    {
+      /* Adds it */
+      acDirectory[u32Length++] = orxCHAR_DIRECTORY_SEPARATOR_LINUX;
+      acDirectory[u32Length]   = orxCHAR_NULL;
+    }
+
+    /* For all packs, most recent first */
+    for(i = sstFile.u32PackCounter, u32Base = 0; (i > 0) && (bResult == orxFALSE); u32Base += sstFile.astPackList[--i].u32EntryNumber)
+    {
+      const orxFILE_PACK *pstPack;
+
+      /* Gets it */
+      pstPack = &(sstFile.astPackList[i - 1]);
+
+      /* Cursor inside? */
+      if(*_pu32Cursor < u32Base + pstPack->u32EntryNumber)
+      {
+        orxU32 j;
+
+        /* For all remaining entries */
+        for(j = *_pu32Cursor - u32Base; j < pstPack->u32EntryNumber; j++)
+        {
+          const orxU8    *pu8Entry;
+          const orxCHAR  *pcName;
+
+          /* Gets entry & its name */
+          pu8Entry  = pstPack->pu8Entry + j * orxFILE_KU32_PACK_ENTRY_SIZE;
+          pcName    = pstPack->pcName + orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_NAME);
+
+          /* Directly inside the directory? */
+          if((orxString_NCompare((orxSTRING)pcName, acDirectory, u32Length) == 0)
+          && (pcName[u32Length] != orxCHAR_NULL)
+          && (orxString_SearchCharIndex((orxSTRING)pcName + u32Length, orxCHAR_DIRECTORY_SEPARATOR_LINUX, 0) < 0))
+          {
+            orxU32 u32ID, k;
+
+            /* Gets its ID */
+            u32ID = orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_ID);
+
+            /* For all more recent packs */
+            for(k = sstFile.u32PackCounter; (k > i) && (orxFile_FindPackEntry(&(sstFile.astPackList[k - 1]), u32ID, (orxSTRING)pcName) == orxNULL); k--);
+
+            /* Not shadowed? */
+            if(k == i)
+            {
+              /* Stores info */
+              *_ppcName       = pcName + u32Length;
+              *_pu32Size      = orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_SIZE);
+              *_pu32TimeStamp = orxFile_ReadU32(pu8Entry + orxFILE_KU32_PACK_FIELD_TIME_STAMP);
+
+              /* Updates result */
+              bResult = orxTRUE;
+
+              break;
+            }
+          }
+        }
+
+        /* Updates cursor */
+        *_pu32Cursor = u32Base + orxMIN(j + 1, pstPack->u32EntryNumber);
+      }
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
 
 #ifdef __orxMSVC__
 
@@ -29,6 +29,7 @@
 
 
 #include "io/orxFileSystem.h"
+#include "io/orxFile.h"
 #include "memory/orxMemory.h"
 #include "utils/orxString.h"
 #include "debug/orxDebug.h"
@@ -167,157 +168,64 @@ static orxINLINE void orxFileSystem_GetInfoFromData(const struct dirent *_pstDat
 
 #endif /* __orxWINDOWS__ */
 
-/***************************************************************************
- * Public functions                                                        *
- ***************************************************************************/
-
-/** FileSystem module setup */
-void orxFASTCALL orxFileSystem_Setup()
-{
-  /* Adds module dependencies */
-  orxModule_AddDependency(orxMODULE_ID_FILESYSTEM, orxMODULE_ID_MEMORY);
-
-  return;
-}
-
-/** Inits the FileSystem Module
- */
-orxSTATUS orxFASTCALL orxFileSystem_Init()
-{
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
-
-  /* Was not already initialized? */
-  if(!(sstFileSystem.u32Flags & orxFILESYSTEM_KU32_STATIC_FLAG_READY))
-  {
-    /* Cleans static controller */
-    orxMemory_Zero(&sstFileSystem, sizeof(orxFILESYSTEM_STATIC));
-
-    /* Updates status */
-    sstFileSystem.u32Flags |= orxFILESYSTEM_KU32_STATIC_FLAG_READY;
-  }
-
-  /* Done! */
-  return eResult;
-}
-
-/** Exits from the FileSystem Module
- */
-void orxFASTCALL orxFileSystem_Exit()
-{
-  /* Was initialized? */
-  if(sstFileSystem.u32Flags & orxFILESYSTEM_KU32_STATIC_FLAG_READY)
-  {
-    /* Cleans static controller */
-    orxMemory_Zero(&sstFileSystem, sizeof(orxFILESYSTEM_STATIC));
-  }
-
-  return;
-}
-
-/** Returns orxTRUE if a file exists, else orxFALSE.
- * @param[in] _zFileName           Full File's name to test
- * @return orxFALSE if _zFileName doesn't exist, else orxTRUE
+/** Matches a file name against a pattern ('*' & '?' wildcards)
+ * @param[in] _pcPattern           Pattern
+ * @param[in] _pcName              File name
+ * @return orxTRUE if it matches, orxFALSE otherwise
  */
-orxBOOL orxFASTCALL orxFileSystem_Exists(const orxSTRING _zFileName)
+static orxINLINE orxBOOL orxFileSystem_MatchPattern(const orxCHAR *_pcPattern, const orxCHAR *_pcName)
 {
-  orxFILESYSTEM_INFO stInfo;
-
-  /* Clears it */
-  orxMemory_Zero(&stInfo, sizeof(orxFILESYSTEM_INFO));
-
-  /* Done! */
-	return(orxFileSystem_Info(_zFileName, &(stInfo)) == orxSTATUS_SUCCESS);
-}
-
-/** Starts a new search. Find the first file that will match to the given pattern (e.g : /bin/toto* or c:\*.*)
- * @param[in] _zSearchPattern      Pattern to find
- * @param[out] _pstFileInfo        Informations about the first file found
- * @return orxTRUE if a file has been found, else orxFALSE
- */
-orxBOOL orxFASTCALL orxFileSystem_FindFirst(const orxSTRING _zSearchPattern, orxFILESYSTEM_INFO *_pstFileInfo)
-{
-  orxBOOL bResult = orxFALSE;
-
-#ifdef __orxWINDOWS__
-
-  struct _finddata_t  stData;
-  orxS32              s32Handle;
-
-  /* Checks */
-  orxASSERT((sstFileSystem.u32Flags & orxFILESYSTEM_KU32_STATIC_FLAG_READY) == orxFILESYSTEM_KU32_STATIC_FLAG_READY);
-  orxASSERT(_pstFileInfo != orxNULL);
-
-  /* Opens the search */
-  s32Handle = (orxU32)_findfirst(_zSearchPattern, &stData);
+  const orxCHAR *pcStar = orxNULL, *pcResume = orxNULL;
 
-  /* Valid? */
-  if(s32Handle >= 0)
+  /* For all name characters */
+  while(*_pcName != orxCHAR_NULL)
   {
-    orxS32 s32LastSeparator, i;
-
-    /* Gets last directory separator */
-    for(s32LastSeparator = -1, i = orxString_SearchCharIndex(_zSearchPattern, orxCHAR_DIRECTORY_SEPARATOR_LINUX, 0);
-        i >= 0;
-        s32LastSeparator = i, i = orxString_SearchCharIndex(_zSearchPattern, orxCHAR_DIRECTORY_SEPARATOR_LINUX, i + 1));
-
-    /* Not found? */
-    if(s32LastSeparator < 0)
+    /* Wildcard? */
+    if(*_pcPattern == '*')
     {
-      /* Gets last directory separator */
-      for(s32LastSeparator = -1, i = orxString_SearchCharIndex(_zSearchPattern, orxCHAR_DIRECTORY_SEPARATOR_WINDOWS, 0);
-          i >= 0;
-          s32LastSeparator = i, i = orxString_SearchCharIndex(_zSearchPattern, orxCHAR_DIRECTORY_SEPARATOR_WINDOWS, i + 1));
+      /* Stores backtracking positions */
+      pcStar    = ++_pcPattern;
+      pcResume  = _pcName;
     }
-
-    /* Has directory? */
-    if(s32LastSeparator >= 0)
+    /* Matching character? */
+    else if((*_pcPattern == '?') || (*_pcPattern == *_pcName))
     {
-      orxU32 u32Index;
-
-      /* Updates path & full name base */
-      u32Index = orxMIN(s32LastSeparator + 1, 1023);
-      orxString_NCopy(_pstFileInfo->zPath, _zSearchPattern, u32Index);
-      _pstFileInfo->zPath[u32Index] = orxCHAR_NULL;
-      orxString_Copy(_pstFileInfo->zFullName, _pstFileInfo->zPath);
-
-      /* Stores pattern */
-      u32Index = orxMIN(orxString_GetLength(_zSearchPattern) - s32LastSeparator - 1, 255);
-      orxString_NCopy(_pstFileInfo->zPattern, &_zSearchPattern[s32LastSeparator] + 1, u32Index);
-      _pstFileInfo->zPattern[u32Index] = orxCHAR_NULL;
+      /* Next characters */
+      _pcPattern++;
+      _pcName++;
+    }
+    /* Can backtrack? */
+    else if(pcStar != orxNULL)
+    {
+      /* Lets the last wildcard eat one more character */
+      _pcPattern  = pcStar;
+      _pcName     = ++pcResume;
     }
     else
     {
-      orxU32 u32Index;
-
-      /* Clears vars */
-      _pstFileInfo->zPath[0]      = orxCHAR_NULL;
-      _pstFileInfo->zFullName[0]  = orxCHAR_NULL;
-
-      /* Stores pattern */
-      u32Index = orxMIN(orxString_GetLength(_zSearchPattern), 255);
-      orxString_NCopy(_pstFileInfo->zPattern, _zSearchPattern, u32Index);
-      _pstFileInfo->zPattern[u32Index] = orxCHAR_NULL;
+      /* Done! */
+      return orxFALSE;
     }
+  }
 
-    /* Tranfers file info */
-    orxFileSystem_GetInfoFromData(&stData, _pstFileInfo);
-
-    /* Stores handle */
-    _pstFileInfo->hInternal = (orxHANDLE)s32Handle;
-
-    /* Updates result */
-    bResult = orxTRUE;
+  /* Skips trailing wildcards */
+  while(*_pcPattern == '*')
+  {
+    _pcPattern++;
   }
 
-#else /* __orxWINDOWS__ */
+  /* Done! */
+  return (*_pcPattern == orxCHAR_NULL) ? orxTRUE : orxFALSE;
+}
 
-  /* Stores seach pattern */
+/** Inits a search: splits its pattern into directory & file pattern
+ * @param[in] _zSearchPattern      Pattern to find
+ * @param[out] _pstFileInfo        Search to init
+ */
+static orxINLINE void orxFileSystem_InitSearch(const orxSTRING _zSearchPattern, orxFILESYSTEM_INFO *_pstFileInfo)
+{
   orxS32 s32LastSeparator, i;
 
-  /* Checks */
-  orxASSERT((sstFileSystem.u32Flags & orxFILESYSTEM_KU32_STATIC_FLAG_READY) == orxFILESYSTEM_KU32_STATIC_FLAG_READY);
-  orxASSERT(_pstFileInfo != orxNULL);
-
   /* Gets last directory separator */
   for(s32LastSeparator = -1, i = orxString_SearchCharIndex(_zSearchPattern, orxCHAR_DIRECTORY_SEPARATOR_LINUX, 0);
       i >= 0;
@@ -357,22 +265,70 @@ orxBOOL orxFASTCALL orxFileSystem_FindFirst(const orxSTRING _zSearchPattern, orx
     orxString_NCopy(_pstFileInfo->zPattern, _zSearchPattern, u32Index);
     _pstFileInfo->zPattern[u32Index] = orxCHAR_NULL;
 
+#ifdef __orxWINDOWS__
+
+    /* Clears vars */
+    _pstFileInfo->zPath[0]      = orxCHAR_NULL;
+    _pstFileInfo->zFullName[0]  = orxCHAR_NULL;
+
+#else /* __orxWINDOWS__ */
+
     /* Clears vars */
     orxString_Print(_pstFileInfo->zPath, "./");
     orxString_Print(_pstFileInfo->zFullName, "./");
+
+#endif /* __orxWINDOWS__ */
   }
 
-  /* Open directory */
-  DIR *pDir = opendir(_pstFileInfo->zPath);
+  /* Packed files come first */
+  _pstFileInfo->u32PackCursor = 0;
 
-  /* Valid ? */
-  if(pDir != orxNULL)
+  /* Clears handle */
+  _pstFileInfo->hInternal     = 0;
+
+  return;
+}
+
+/** Continues a search in the native file system, packed files being skipped
+ * @param[in,out] _pstFileInfo    Informations about the found file
+ * @return orxTRUE, if the next file has been found, else returns orxFALSE
+ */
+static orxBOOL orxFASTCALL orxFileSystem_FindNextNative(orxFILESYSTEM_INFO *_pstFileInfo)
+{
+  orxBOOL bResult = orxFALSE;
+
+#ifdef __orxWINDOWS__
+
+  struct _finddata_t stData;
+
+  /* While there are files */
+  while((!bResult)
+     && (_findnext((orxS32)_pstFileInfo->hInternal, &stData) == 0))
   {
-    /* Stores the DIR handle */
-    _pstFileInfo->hInternal = (orxHANDLE) pDir;
+    /* Tranfers file info */
+    orxFileSystem_GetInfoFromData(&stData, _pstFileInfo);
 
-    /* Retrieves info */
-    bResult = orxFileSystem_FindNext(_pstFileInfo);
+    /* Not packed? */
+    bResult = (orxFile_GetPackedInfo(_pstFileInfo->zFullName, orxNULL, orxNULL) == orxFALSE);
+  }
+
+#else /* __orxWINDOWS__ */
+
+  struct dirent *pstDirEnt;
+
+  /* Updates full name */
+  orxString_Copy(_pstFileInfo->zFullName, _pstFileInfo->zPath);
+
+  /* loop on entries until the pattern match */
+  while((!bResult)
+     && (pstDirEnt = readdir((DIR*)_pstFileInfo->hInternal)))
+  {
+    /* Gets file info */
+    orxFileSystem_GetInfoFromData(pstDirEnt, _pstFileInfo);
+
+    /* Match & not packed? */
+    bResult = (fnmatch(_pstFileInfo->zPattern, _pstFileInfo->zName, 0) == 0)
+           && (orxFile_GetPackedInfo(_pstFileInfo->zFullName, orxNULL, orxNULL) == orxFALSE);
   }
 
 #endif /* __orxWINDOWS__ */
@@ -381,61 +337,199 @@ orxBOOL orxFASTCALL orxFileSystem_FindFirst(const orxSTRING _zSearchPattern, orx
   return bResult;
 }
 
-/** Continues a search. Find the next occurence of a pattern. The search has to be started with orxFileSystem_FindFirst
+/** Starts a search in the native file system, packed files being skipped
  * @param[in,out] _pstFileInfo    Informations about the found file
- * @return orxTRUE, if the next file has been found, else returns orxFALSE
+ * @return orxTRUE, if a file has been found, else returns orxFALSE
  */
-orxBOOL orxFASTCALL orxFileSystem_FindNext(orxFILESYSTEM_INFO *_pstFileInfo)
+static orxBOOL orxFASTCALL orxFileSystem_FindFirstNative(orxFILESYSTEM_INFO *_pstFileInfo)
 {
   orxBOOL bResult = orxFALSE;
 
 #ifdef __orxWINDOWS__
 
   struct _finddata_t  stData;
-  orxS32              s32FindResult;
+  orxCHAR             acSearchPattern[1280];
+  orxS32              s32Handle;
 
-  /* Checks */
-  orxASSERT((sstFileSystem.u32Flags & orxFILESYSTEM_KU32_STATIC_FLAG_READY) == orxFILESYSTEM_KU32_STATIC_FLAG_READY);
-  orxASSERT(_pstFileInfo != orxNULL);
+  /* Gets full search pattern */
+  orxString_Print(acSearchPattern, "%s%s", _pstFileInfo->zPath, _pstFileInfo->zPattern);
 
   /* Opens the search */
-  s32FindResult = _findnext((orxS32)_pstFileInfo->hInternal, &stData);
+  s32Handle = (orxU32)_findfirst(acSearchPattern, &stData);
 
   /* Valid? */
-  if(s32FindResult == 0)
+  if(s32Handle >= 0)
   {
+    /* Stores handle */
+    _pstFileInfo->hInternal = (orxHANDLE)s32Handle;
+
     /* Tranfers file info */
     orxFileSystem_GetInfoFromData(&stData, _pstFileInfo);
 
     /* Updates result */
-    bResult = orxTRUE;
+    bResult = (orxFile_GetPackedInfo(_pstFileInfo->zFullName, orxNULL, orxNULL) == orxFALSE) ? orxTRUE : orxFileSystem_FindNextNative(_pstFileInfo);
   }
 
 #else /* __orxWINDOWS__ */
 
-  struct dirent *pstDirEnt;
+  DIR *pDir;
+
+  /* Open directory */
+  pDir = opendir(_pstFileInfo->zPath);
+
+  /* Valid ? */
+  if(pDir != orxNULL)
+  {
+    /* Stores the DIR handle */
+    _pstFileInfo->hInternal = (orxHANDLE) pDir;
+
+    /* Retrieves info */
+    bResult = orxFileSystem_FindNextNative(_pstFileInfo);
+  }
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return bResult;
+}
+
+
+/***************************************************************************
+ * Public functions                                                        *
+ ***************************************************************************/
+
+/** FileSystem module setup */
+void orxFASTCALL orxFileSystem_Setup()
+{
+  /* Adds module dependencies */
+  orxModule_AddDependency(orxMODULE_ID_FILESYSTEM, orxMODULE_ID_MEMORY);
+  orxModule_AddDependency(orxMODULE_ID_FILESYSTEM, orxMODULE_ID_FILE);
+
+  return;
+}
+
+/** Inits the FileSystem Module
+ */
+orxSTATUS orxFASTCALL orxFileSystem_Init()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Was not already initialized? */
+  if(!(sstFileSystem.u32Flags & orxFILESYSTEM_KU32_STATIC_FLAG_READY))
+  {
+    /* Cleans static controller */
+    orxMemory_Zero(&sstFileSystem, sizeof(orxFILESYSTEM_STATIC));
+
+    /* Updates status */
+    sstFileSystem.u32Flags |= orxFILESYSTEM_KU32_STATIC_FLAG_READY;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Exits from the FileSystem Module
+ */
+void orxFASTCALL orxFileSystem_Exit()
+{
+  /* Was initialized? */
+  if(sstFileSystem.u32Flags & orxFILESYSTEM_KU32_STATIC_FLAG_READY)
+  {
+    /* Cleans static controller */
+    orxMemory_Zero(&sstFileSystem, sizeof(orxFILESYSTEM_STATIC));
+  }
+
+  return;
+}
+
+/** Returns orxTRUE if a file exists, else orxFALSE.
+ * @param[in] _zFileName           Full File's name to test
+ * @return orxFALSE if _zFileName doesn't exist, else orxTRUE
+ */
+orxBOOL orxFASTCALL orxFileSystem_Exists(const orxSTRING _zFileName)
+{
+  orxFILESYSTEM_INFO stInfo;
 
+  /* Clears it */
+  orxMemory_Zero(&stInfo, sizeof(orxFILESYSTEM_INFO));
+
+  /* Done! */
+	return(orxFileSystem_Info(_zFileName, &(stInfo)) == orxSTATUS_SUCCESS);
+}
+
+/** Starts a new search. Find the first file that will match to the given pattern (e.g : /bin/toto* or c:\*.*)
+ * Files stored in mounted packs are found first, native files are then searched.
+ * @param[in] _zSearchPattern      Pattern to find
+ * @param[out] _pstFileInfo        Informations about the first file found
+ * @return orxTRUE if a file has been found, else orxFALSE
+ */
+orxBOOL orxFASTCALL orxFileSystem_FindFirst(const orxSTRING _zSearchPattern, orxFILESYSTEM_INFO *_pstFileInfo)
+{
   /* Checks */
   orxASSERT((sstFileSystem.u32Flags & orxFILESYSTEM_KU32_STATIC_FLAG_READY) == orxFILESYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstFileInfo != orxNULL);
 
-  /* Updates full name */
-  orxString_Copy(_pstFileInfo->zFullName, _pstFileInfo->zPath);
+  /* Inits search */
+  orxFileSystem_InitSearch(_zSearchPattern, _pstFileInfo);
+
+  /* Done! */
+  return orxFileSystem_FindNext(_pstFileInfo);
+}
 
-  /* Read directory */
+/** Continues a search. Find the next occurence of a pattern. The search has to be started with orxFileSystem_FindFirst
+ * @param[in,out] _pstFileInfo    Informations about the found file
+ * @return orxTRUE, if the next file has been found, else returns orxFALSE
+ */
+orxBOOL orxFASTCALL orxFileSystem_FindNext(orxFILESYSTEM_INFO *_pstFileInfo)
+{
+  orxBOOL bResult = orxFALSE;
 
-  /* loop on entries until the pattern match */
-  while((!bResult)
-     && (pstDirEnt = readdir((DIR*)_pstFileInfo->hInternal)))
+  /* Checks */
+  orxASSERT((sstFileSystem.u32Flags & orxFILESYSTEM_KU32_STATIC_FLAG_READY) == orxFILESYSTEM_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstFileInfo != orxNULL);
+
+  /* Still searching packs? */
+  if(_pstFileInfo->u32PackCursor != orxU32_UNDEFINED)
   {
-    /* Gets file info */
-    orxFileSystem_GetInfoFromData(pstDirEnt, _pstFileInfo);
+    const orxCHAR  *pcName;
+    orxU32          u32Size, u32TimeStamp;
 
-    /* Match ? */
-    bResult = (fnmatch(_pstFileInfo->zPattern, _pstFileInfo->zName, 0) == 0);
-  }
+    /* While there are packed files in the directory */
+    while((!bResult)
+       && (orxFile_FindNextPacked(_pstFileInfo->zPath, &(_pstFileInfo->u32PackCursor), &pcName, &u32Size, &u32TimeStamp) != orxFALSE))
+    {
+      /* Match? */
+      if(orxFileSystem_MatchPattern(_pstFileInfo->zPattern, pcName) != orxFALSE)
+      {
+        /* Stores info */
+        orxString_NCopy(_pstFileInfo->zName, (orxSTRING)pcName, 255);
+        _pstFileInfo->zName[255]    = orxCHAR_NULL;
+        orxString_Copy(_pstFileInfo->zFullName + orxString_GetLength(_pstFileInfo->zPath), _pstFileInfo->zName);
+        _pstFileInfo->u32Flags      = orxFILESYSTEM_KU32_FLAG_INFO_RDONLY;
+        _pstFileInfo->u32Size       = u32Size;
+        _pstFileInfo->u32TimeStamp  = u32TimeStamp;
+
+        /* Updates result */
+        bResult = orxTRUE;
+      }
+    }
 
-#endif /* __orxWINDOWS__ */
+    /* No more packed file? */
+    if(!bResult)
+    {
+      /* Stops pack search */
+      _pstFileInfo->u32PackCursor = orxU32_UNDEFINED;
+
+      /* Starts native one */
+      bResult = orxFileSystem_FindFirstNative(_pstFileInfo);
+    }
+  }
+  /* Native search started? */
+  else if(_pstFileInfo->hInternal != 0)
+  {
+    /* Continues it */
+    bResult = orxFileSystem_FindNextNative(_pstFileInfo);
+  }
 
   /* Done! */
   return bResult;
@@ -461,8 +555,12 @@ void orxFASTCALL orxFileSystem_FindClose(orxFILESYSTEM_INFO *_pstFileInfo)
 
 #else /* __orxWINDOWS__ */
 
-  /* Closes the search */
-  closedir((DIR *) _pstFileInfo->hInternal);
+  /* Has valid handle? */
+  if(_pstFileInfo->hInternal != 0)
+  {
+    /* Closes the search */
+    closedir((DIR *) _pstFileInfo->hInternal);
+  }
 
 #endif /* __orxWINDOWS__ */
 
@@ -485,15 +583,32 @@ orxSTATUS orxFASTCALL orxFileSystem_Info(const orxSTRING _zFileName, orxFILESYST
   orxASSERT((sstFileSystem.u32Flags & orxFILESYSTEM_KU32_STATIC_FLAG_READY) == orxFILESYSTEM_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstFileInfo != orxNULL);
 
-  /* Finds for the file */
-  if(orxFileSystem_FindFirst(_zFileName, _pstFileInfo) != orxFALSE)
+  /* Packed file? */
+  if((orxString_SearchCharIndex(_zFileName, '*', 0) < 0)
+  && (orxString_SearchCharIndex(_zFileName, '?', 0) < 0)
+  && (orxFile_GetPackedInfo(_zFileName, &(_pstFileInfo->u32Size), &(_pstFileInfo->u32TimeStamp)) != orxFALSE))
   {
+    /* Gets its path & name, without searching */
+    orxFileSystem_InitSearch(_zFileName, _pstFileInfo);
+    orxString_Copy(_pstFileInfo->zName, _pstFileInfo->zPattern);
+    orxString_Copy(_pstFileInfo->zFullName + orxString_GetLength(_pstFileInfo->zPath), _pstFileInfo->zName);
+    _pstFileInfo->u32Flags = orxFILESYSTEM_KU32_FLAG_INFO_RDONLY;
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
+  else
+  {
+    /* Finds for the file */
+    if(orxFileSystem_FindFirst(_zFileName, _pstFileInfo) != orxFALSE)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
 
-  /* Closes the find */
-  orxFileSystem_FindClose(_pstFileInfo);
+    /* Closes the find */
+    orxFileSystem_FindClose(_pstFileInfo);
+  }
 
   /* Done! */
   return eResult;
@@ -33,8 +33,12 @@
 #include "core/orxClock.h"
 #include "core/orxConfig.h"
 #include "core/orxEvent.h"
+#include "core/orxSystem.h"
 #include "debug/orxDebug.h"
+#include "io/orxFile.h"
 #include "memory/orxBank.h"
+#include "plugin/orxPlugin.h"
+#include "plugin/define/orxPlugin_CoreDefine.h"
 #include "utils/orxLinkList.h"
 #include "utils/orxString.h"
 
@@ -44,6 +48,19 @@
 #define orxINPUT_KU32_STATIC_FLAG_NONE                0x00000000  /**< No flags */
 
 #define orxINPUT_KU32_STATIC_FLAG_READY               0x00000001  /**< Ready flag */
+#define orxINPUT_KU32_STATIC_FLAG_KEYBOARD_SNAPSHOT   0x00000010  /**< Keyboard snapshot flag */
+#define orxINPUT_KU32_STATIC_FLAG_MOUSE_SNAPSHOT      0x00000020  /**< Mouse snapshot flag */
+#define orxINPUT_KU32_STATIC_FLAG_JOYSTICK_SNAPSHOT   0x00000040  /**< Joystick snapshot flag */
+#define orxINPUT_KU32_STATIC_FLAG_FULL_UPDATE         0x00000100  /**< Full update flag */
+#define orxINPUT_KU32_STATIC_FLAG_RECORD              0x00000200  /**< Record flag */
+#define orxINPUT_KU32_STATIC_FLAG_REPLAY              0x00000400  /**< Replay flag */
+#define orxINPUT_KU32_STATIC_FLAG_QUIT_AFTER_REPLAY   0x00000800  /**< Quit after replay flag */
+#define orxINPUT_KU32_STATIC_FLAG_PROBED              0x00001000  /**< Device snapshot functions probed flag */
+#define orxINPUT_KU32_STATIC_FLAG_KEYBOARD_BITSET     0x00002000  /**< Keyboard plugin provides key bitset flag */
+#define orxINPUT_KU32_STATIC_FLAG_MOUSE_BITSET        0x00004000  /**< Mouse plugin provides button bitset flag */
+#define orxINPUT_KU32_STATIC_FLAG_JOYSTICK_STATE      0x00008000  /**< Joystick plugin provides state flag */
+
+#define orxINPUT_KU32_STATIC_MASK_SNAPSHOT            0x00000070  /**< Snapshot mask */
 
 #define orxINPUT_KU32_STATIC_MASK_ALL                 0xFFFFFFFF  /**< All mask */
 
@@ -54,10 +71,25 @@
 #define orxINPUT_KZ_CONFIG_SET_LIST                   "SetList"   /**< Input set list */
 #define orxINPUT_KZ_CONFIG_JOYSTICK_THRESHOLD         "JoystickThreshold" /**< Input joystick threshold */
 #define orxINPUT_KZ_CONFIG_COMBINE_LIST               "CombineList" /**< Combine input list */
+#define orxINPUT_KZ_CONFIG_RECORD_FILE                "RecordFile" /**< Record file */
+#define orxINPUT_KZ_CONFIG_REPLAY_FILE                "ReplayFile" /**< Replay file */
+#define orxINPUT_KZ_CONFIG_QUIT_AFTER_REPLAY          "QuitAfterReplay" /**< Quit after replay */
 
 #define orxINPUT_KZ_INPUT_EXTERNAL                    "EXTERNAL"  /**< External input */
 
 
+/** Record format, all values are little endian 32 bit integers or IEEE 754 single precision floats:
+ *  - Header, orxINPUT_KU32_RECORD_HEADER_SIZE bytes (magic, version)
+ *  - For each tick, orxINPUT_KU32_RECORD_TICK_SIZE bytes (core clock DT, number of active inputs)
+ *    followed by orxINPUT_KU32_RECORD_VALUE_SIZE bytes per active input (ID, value)
+ */
+#define orxINPUT_KU32_RECORD_MAGIC                    0x5258524F  /**< Record file magic number ('ORXR') */
+#define orxINPUT_KU32_RECORD_VERSION                  2           /**< Record file version */
+
+#define orxINPUT_KU32_RECORD_HEADER_SIZE              8           /**< Record header size */
+#define orxINPUT_KU32_RECORD_TICK_SIZE                8           /**< Record tick size */
+#define orxINPUT_KU32_RECORD_VALUE_SIZE               8           /**< Record value size */
+
 #define orxINPUT_KU32_SET_BANK_SIZE                   4
 #define orxINPUT_KU32_ENTRY_BANK_SIZE                 8
 
@@ -71,9 +103,11 @@
 #define orxINPUT_KU32_ENTRY_FLAG_EXTERNAL             0x02000000  /**< External flag */
 #define orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL       0x04000000  /**< Reset external flag */
 #define orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL        0x08000000  /**< Last external flag */
+#define orxINPUT_KU32_ENTRY_FLAG_DIRTY                0x00100000  /**< Dirty flag */
 
 #define orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING       0x0000000F  /**< Oldest binding mask */
 #define orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING  0x000000F0  /**< Last active binding mask */
+#define orxINPUT_KU32_ENTRY_MASK_UPDATE               0x0E100000  /**< Entry needs to be evaluated mask */
 
 #define orxINPUT_KU32_ENTRY_MASK_ALL                  0xFFFFFFFF  /**< All mask */
 
@@ -125,15 +159,38 @@ typedef struct __orxINPUT_SET_t
 
 } orxINPUT_SET;
 
+/** Device snapshot structure
+ */
+typedef struct __orxINPUT_SNAPSHOT_t
+{
+  orxU32        au32KeyBitset[orxKEYBOARD_KU32_KEY_BITSET_SIZE];  /**< Keyboard key bitset */
+  orxU32        u32MouseButtonBitset;                             /**< Mouse button bitset */
+  orxFLOAT      fMouseWheelDelta;                                 /**< Mouse wheel delta */
+  orxU32        u32JoystickButtonBitset;                          /**< Joystick button bitset */
+  orxFLOAT      afJoystickAxisList[orxJOYSTICK_AXIS_NUMBER];      /**< Joystick axis values */
+
+} orxINPUT_SNAPSHOT;
+
 /** Static structure
  */
 typedef struct __orxINPUT_STATIC_t
 {
-  orxBANK      *pstSetBank;                                       /**< Set bank */
-  orxINPUT_SET *pstCurrentSet;                                    /**< Current set */
-  orxFLOAT      fJoystickAxisThreshold;                           /**< Joystick axis threshold */
-  orxU32        u32Flags;                                         /**< Control flags */
-  orxLINKLIST   stSetList;                                        /**< Set list */
+  orxBANK          *pstSetBank;                                   /**< Set bank */
+  orxINPUT_SET     *pstCurrentSet;                                /**< Current set */
+  orxFLOAT          fJoystickAxisThreshold;                       /**< Joystick axis threshold */
+  orxU32            u32Flags;                                     /**< Control flags */
+  orxLINKLIST       stSetList;                                    /**< Set list */
+  orxINPUT_SNAPSHOT astSnapshotList[2];                           /**< Current & previous device snapshots */
+  orxU32            u32SnapshotIndex;                             /**< Current snapshot index */
+  orxU32            au32KeyChangeBitset[orxKEYBOARD_KU32_KEY_BITSET_SIZE]; /**< Keys that changed since previous snapshot */
+  orxU32            u32MouseChangeBitset;                         /**< Mouse buttons (wheel included) that changed since previous snapshot */
+  orxU32            u32JoystickButtonChangeBitset;                /**< Joystick buttons that changed since previous snapshot */
+  orxU32            u32JoystickAxisChangeBitset;                  /**< Joystick axes that changed since previous snapshot */
+  orxFILE          *pstRecordFile;                                /**< Record file */
+  orxFILE          *pstReplayFile;                                /**< Replay file */
+  orxU32            u32ReplayCounter;                             /**< Number of values of the next replayed tick */
+  orxCLOCK_MOD_TYPE eReplayModType;                               /**< Core clock modifier type before replay */
+  orxFLOAT          fReplayModValue;                              /**< Core clock modifier value before replay */
 
 } orxINPUT_STATIC;
 
@@ -151,33 +208,307 @@ static orxINPUT_STATIC sstInput;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Reads a little endian 32 bit value from a record
+ * @param[in]   _pu8Data        Where to read
+ * @return Read value
+ */
+static orxINLINE orxU32 orxInput_ReadRecordU32(const orxU8 *_pu8Data)
+{
+  /* Done! */
+  return (orxU32)_pu8Data[0] | ((orxU32)_pu8Data[1] << 8) | ((orxU32)_pu8Data[2] << 16) | ((orxU32)_pu8Data[3] << 24);
+}
+
+/** Writes a little endian 32 bit value to a record
+ * @param[out]  _pu8Data        Where to write
+ * @param[in]   _u32Value       Value to write
+ */
+static orxINLINE void orxInput_WriteRecordU32(orxU8 *_pu8Data, orxU32 _u32Value)
+{
+  /* Stores all bytes */
+  _pu8Data[0] = (orxU8)(_u32Value);
+  _pu8Data[1] = (orxU8)(_u32Value >> 8);
+  _pu8Data[2] = (orxU8)(_u32Value >> 16);
+  _pu8Data[3] = (orxU8)(_u32Value >> 24);
+
+  return;
+}
+
+/** Copies a float's bytes, reversing them on big endian hosts so that record data is always little endian
+ * @param[out]  _pu8Dst         Destination
+ * @param[in]   _pu8Src         Source
+ */
+static orxINLINE void orxInput_CopyRecordFloat(orxU8 *_pu8Dst, const orxU8 *_pu8Src)
+{
+  orxU16 u16Order = 1;
+  orxU32 i;
+
+  /* Checks */
+  orxASSERT(sizeof(orxFLOAT) == 4);
+
+  /* For all bytes */
+  for(i = 0; i < 4; i++)
+  {
+    /* Copies it */
+    _pu8Dst[i] = _pu8Src[(*(orxU8 *)&u16Order == 1) ? i : 3 - i];
+  }
+
+  return;
+}
+
+/** Takes a snapshot of all devices and computes what changed since the previous one
+ */
+static orxINLINE void orxInput_TakeSnapshot()
+{
+  orxINPUT_SNAPSHOT  *pstSnapshot, *pstPrevious;
+  orxU32              u32PreviousFlags, i;
+
+  /* Swaps snapshots */
+  sstInput.u32SnapshotIndex ^= 1;
+  pstSnapshot = &(sstInput.astSnapshotList[sstInput.u32SnapshotIndex]);
+  pstPrevious = &(sstInput.astSnapshotList[sstInput.u32SnapshotIndex ^ 1]);
+
+  /* Backups device flags */
+  u32PreviousFlags = orxFLAG_GET(sstInput.u32Flags, orxINPUT_KU32_STATIC_MASK_SNAPSHOT);
+
+  /* Not probed yet and plugins are available? */
+  if(!orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_PROBED)
+  && (orxModule_IsInitialized(orxMODULE_ID_PLUGIN) != orxFALSE))
+  {
+    orxU32 u32SupportFlags = orxINPUT_KU32_STATIC_FLAG_PROBED;
+
+    /* Checks which device plugins can provide a snapshot (calling a missing one would log an error every frame) */
+    if(orxPlugin_IsCoreFunctionLoaded(orxPLUGIN_MAKE_CORE_FUNCTION_ID(orxPLUGIN_CORE_ID_KEYBOARD, orxPLUGIN_FUNCTION_BASE_ID_KEYBOARD_GET_KEY_BITSET)) != orxFALSE)
+    {
+      u32SupportFlags |= orxINPUT_KU32_STATIC_FLAG_KEYBOARD_BITSET;
+    }
+    if(orxPlugin_IsCoreFunctionLoaded(orxPLUGIN_MAKE_CORE_FUNCTION_ID(orxPLUGIN_CORE_ID_MOUSE, orxPLUGIN_FUNCTION_BASE_ID_MOUSE_GET_BUTTON_BITSET)) != orxFALSE)
+    {
+      u32SupportFlags |= orxINPUT_KU32_STATIC_FLAG_MOUSE_BITSET;
+    }
+    if(orxPlugin_IsCoreFunctionLoaded(orxPLUGIN_MAKE_CORE_FUNCTION_ID(orxPLUGIN_CORE_ID_JOYSTICK, orxPLUGIN_FUNCTION_BASE_ID_JOYSTICK_GET_STATE)) != orxFALSE)
+    {
+      u32SupportFlags |= orxINPUT_KU32_STATIC_FLAG_JOYSTICK_STATE;
+    }
+
+    /* Updates status */
+    orxFLAG_SET(sstInput.u32Flags, u32SupportFlags, orxINPUT_KU32_STATIC_FLAG_NONE);
+  }
+
+  /* Replaying? */
+  if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_REPLAY))
+  {
+    /* Devices are ignored: uses an idle snapshot */
+    orxMemory_Zero(pstSnapshot, sizeof(orxINPUT_SNAPSHOT));
+    orxMemory_Zero(sstInput.au32KeyChangeBitset, orxKEYBOARD_KU32_KEY_BITSET_SIZE * sizeof(orxU32));
+    sstInput.u32MouseChangeBitset = sstInput.u32JoystickButtonChangeBitset = sstInput.u32JoystickAxisChangeBitset = 0;
+
+    /* Updates status */
+    orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_MASK_SNAPSHOT, orxINPUT_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    /* Keyboard can provide a snapshot? */
+    if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_KEYBOARD_BITSET)
+    && (orxModule_IsInitialized(orxMODULE_ID_KEYBOARD) != orxFALSE)
+    && (orxKeyboard_GetKeyBitset(pstSnapshot->au32KeyBitset) != orxSTATUS_FAILURE))
+    {
+      /* For all key words */
+      for(i = 0; i < orxKEYBOARD_KU32_KEY_BITSET_SIZE; i++)
+      {
+        /* Gets changes */
+        sstInput.au32KeyChangeBitset[i] = pstSnapshot->au32KeyBitset[i] ^ pstPrevious->au32KeyBitset[i];
+      }
+
+      /* Updates status */
+      orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_KEYBOARD_SNAPSHOT, orxINPUT_KU32_STATIC_FLAG_NONE);
+    }
+    else
+    {
+      /* Clears snapshot, keys will be polled */
+      orxMemory_Zero(pstSnapshot->au32KeyBitset, orxKEYBOARD_KU32_KEY_BITSET_SIZE * sizeof(orxU32));
+
+      /* Updates status */
+      orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_NONE, orxINPUT_KU32_STATIC_FLAG_KEYBOARD_SNAPSHOT);
+    }
+
+    /* Mouse can provide a snapshot? */
+    if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_MOUSE_BITSET)
+    && (orxModule_IsInitialized(orxMODULE_ID_MOUSE) != orxFALSE)
+    && (orxMouse_GetButtonBitset(&(pstSnapshot->u32MouseButtonBitset)) != orxSTATUS_FAILURE))
+    {
+      /* Gets wheel delta */
+      pstSnapshot->fMouseWheelDelta = orxMouse_GetWheelDelta();
+
+      /* Gets changes */
+      sstInput.u32MouseChangeBitset = pstSnapshot->u32MouseButtonBitset ^ pstPrevious->u32MouseButtonBitset;
+      if(orxMAX(pstSnapshot->fMouseWheelDelta, orxFLOAT_0) != orxMAX(pstPrevious->fMouseWheelDelta, orxFLOAT_0))
+      {
+        sstInput.u32MouseChangeBitset |= 1U << orxMOUSE_BUTTON_WHEEL_UP;
+      }
+      if(orxMIN(pstSnapshot->fMouseWheelDelta, orxFLOAT_0) != orxMIN(pstPrevious->fMouseWheelDelta, orxFLOAT_0))
+      {
+        sstInput.u32MouseChangeBitset |= 1U << orxMOUSE_BUTTON_WHEEL_DOWN;
+      }
+
+      /* Updates status */
+      orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_MOUSE_SNAPSHOT, orxINPUT_KU32_STATIC_FLAG_NONE);
+    }
+    else
+    {
+      /* Clears snapshot, buttons will be polled */
+      pstSnapshot->u32MouseButtonBitset = 0;
+      pstSnapshot->fMouseWheelDelta     = orxFLOAT_0;
+
+      /* Updates status */
+      orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_NONE, orxINPUT_KU32_STATIC_FLAG_MOUSE_SNAPSHOT);
+    }
+
+    /* Joystick can provide a snapshot? */
+    if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_JOYSTICK_STATE)
+    && (orxModule_IsInitialized(orxMODULE_ID_JOYSTICK) != orxFALSE)
+    && (orxJoystick_GetState(0, &(pstSnapshot->u32JoystickButtonBitset), pstSnapshot->afJoystickAxisList) != orxSTATUS_FAILURE))
+    {
+      /* Gets changes */
+      sstInput.u32JoystickButtonChangeBitset  = pstSnapshot->u32JoystickButtonBitset ^ pstPrevious->u32JoystickButtonBitset;
+      sstInput.u32JoystickAxisChangeBitset    = 0;
+      for(i = 0; i < orxJOYSTICK_AXIS_NUMBER; i++)
+      {
+        if(pstSnapshot->afJoystickAxisList[i] != pstPrevious->afJoystickAxisList[i])
+        {
+          sstInput.u32JoystickAxisChangeBitset |= 1U << i;
+        }
+      }
+
+      /* Updates status */
+      orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_JOYSTICK_SNAPSHOT, orxINPUT_KU32_STATIC_FLAG_NONE);
+    }
+    else
+    {
+      /* Clears snapshot, joystick will be polled */
+      pstSnapshot->u32JoystickButtonBitset = 0;
+      orxMemory_Zero(pstSnapshot->afJoystickAxisList, orxJOYSTICK_AXIS_NUMBER * sizeof(orxFLOAT));
+
+      /* Updates status */
+      orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_NONE, orxINPUT_KU32_STATIC_FLAG_JOYSTICK_SNAPSHOT);
+    }
+  }
+
+  /* Device capabilities changed? */
+  if(orxFLAG_GET(sstInput.u32Flags, orxINPUT_KU32_STATIC_MASK_SNAPSHOT) != u32PreviousFlags)
+  {
+    /* Previous values can't be trusted anymore, re-evaluates everything */
+    orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_FULL_UPDATE, orxINPUT_KU32_STATIC_FLAG_NONE);
+  }
+
+  return;
+}
+
+/** Has a binding changed since the previous snapshot?
+ * @param[in] _eType            Binding type
+ * @param[in] _eID              Binding ID
+ * @return orxTRUE if it changed or if its device has to be polled, orxFALSE otherwise
+ */
+static orxINLINE orxBOOL orxInput_HasBindingChanged(orxINPUT_TYPE _eType, orxENUM _eID)
+{
+  orxBOOL bResult;
+
+  /* Depending on type */
+  switch(_eType)
+  {
+    case orxINPUT_TYPE_KEYBOARD_KEY:
+    {
+      /* Updates result */
+      bResult = (!orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_KEYBOARD_SNAPSHOT)
+              || (sstInput.au32KeyChangeBitset[_eID >> 5] & (1U << (_eID & 31)))) ? orxTRUE : orxFALSE;
+
+      break;
+    }
+
+    case orxINPUT_TYPE_MOUSE_BUTTON:
+    {
+      /* Updates result */
+      bResult = (!orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_MOUSE_SNAPSHOT)
+              || (sstInput.u32MouseChangeBitset & (1U << _eID))) ? orxTRUE : orxFALSE;
+
+      break;
+    }
+
+    case orxINPUT_TYPE_JOYSTICK_BUTTON:
+    {
+      /* Updates result */
+      bResult = (!orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_JOYSTICK_SNAPSHOT)
+              || (sstInput.u32JoystickButtonChangeBitset & (1U << _eID))) ? orxTRUE : orxFALSE;
+
+      break;
+    }
+
+    case orxINPUT_TYPE_JOYSTICK_AXIS:
+    {
+      /* Updates result */
+      bResult = (!orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_JOYSTICK_SNAPSHOT)
+              || (sstInput.u32JoystickAxisChangeBitset & (1U << _eID))) ? orxTRUE : orxFALSE;
+
+      break;
+    }
+
+    default:
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
 static orxINLINE orxFLOAT orxInput_GetBindingValue(orxINPUT_TYPE _eType, orxENUM _eID)
 {
-  orxFLOAT fResult = orxFLOAT_0;
+  const orxINPUT_SNAPSHOT  *pstSnapshot;
+  orxFLOAT                  fResult = orxFLOAT_0;
 
   /* Checks */
   orxASSERT(_eType < orxINPUT_TYPE_NUMBER);
 
+  /* Gets current snapshot */
+  pstSnapshot = &(sstInput.astSnapshotList[sstInput.u32SnapshotIndex]);
+
   /* Depending on type */
   switch(_eType)
   {
     case orxINPUT_TYPE_KEYBOARD_KEY:
     {
-      /* Updates result */
-      fResult = (orxKeyboard_IsKeyPressed((orxKEYBOARD_KEY)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
+      /* Has snapshot? */
+      if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_KEYBOARD_SNAPSHOT))
+      {
+        /* Updates result */
+        fResult = (pstSnapshot->au32KeyBitset[_eID >> 5] & (1U << (_eID & 31))) ? orxFLOAT_1 : orxFLOAT_0;
+      }
+      else
+      {
+        /* Updates result */
+        fResult = (orxKeyboard_IsKeyPressed((orxKEYBOARD_KEY)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
+      }
 
       break;
     }
 
     case orxINPUT_TYPE_MOUSE_BUTTON:
     {
+      orxBOOL bSnapshot;
+
+      /* Has snapshot? */
+      bSnapshot = orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_MOUSE_SNAPSHOT) ? orxTRUE : orxFALSE;
+
       /* Wheel? */
       switch(_eID)
       {
         case orxMOUSE_BUTTON_WHEEL_UP:
         {
           /* Updates result */
-          fResult = orxMouse_GetWheelDelta();
+          fResult = (bSnapshot != orxFALSE) ? pstSnapshot->fMouseWheelDelta : orxMouse_GetWheelDelta();
           fResult = orxMAX(fResult, orxFLOAT_0);
           break;
         }
@@ -185,15 +516,24 @@ static orxINLINE orxFLOAT orxInput_GetBindingValue(orxINPUT_TYPE _eType, orxENUM
         case orxMOUSE_BUTTON_WHEEL_DOWN:
         {
           /* Updates result */
-          fResult = -orxMouse_GetWheelDelta();
+          fResult = (bSnapshot != orxFALSE) ? -pstSnapshot->fMouseWheelDelta : -orxMouse_GetWheelDelta();
           fResult = orxMAX(fResult, orxFLOAT_0);
           break;
         }
 
         default:
         {
-          /* Updates result */
-          fResult = (orxMouse_IsButtonPressed((orxMOUSE_BUTTON)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
+          /* Has snapshot? */
+          if(bSnapshot != orxFALSE)
+          {
+            /* Updates result */
+            fResult = (pstSnapshot->u32MouseButtonBitset & (1U << _eID)) ? orxFLOAT_1 : orxFLOAT_0;
+          }
+          else
+          {
+            /* Updates result */
+            fResult = (orxMouse_IsButtonPressed((orxMOUSE_BUTTON)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
+          }
           break;
         }
       }
@@ -203,16 +543,36 @@ static orxINLINE orxFLOAT orxInput_GetBindingValue(orxINPUT_TYPE _eType, orxENUM
 
     case orxINPUT_TYPE_JOYSTICK_BUTTON:
     {
-      /* Updates result */
-      fResult = (orxJoystick_IsButtonPressed(0, (orxJOYSTICK_BUTTON)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
+      /* Has snapshot? */
+      if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_JOYSTICK_SNAPSHOT))
+      {
+        /* Updates result */
+        fResult = (pstSnapshot->u32JoystickButtonBitset & (1U << _eID)) ? orxFLOAT_1 : orxFLOAT_0;
+      }
+      /* Joystick ready? */
+      else if(orxModule_IsInitialized(orxMODULE_ID_JOYSTICK) != orxFALSE)
+      {
+        /* Updates result */
+        fResult = (orxJoystick_IsButtonPressed(0, (orxJOYSTICK_BUTTON)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
+      }
 
       break;
     }
 
     case orxINPUT_TYPE_JOYSTICK_AXIS:
     {
-      /* Updates result */
-      fResult = orxJoystick_GetAxisValue(0, (orxJOYSTICK_AXIS)_eID);
+      /* Has snapshot? */
+      if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_JOYSTICK_SNAPSHOT))
+      {
+        /* Updates result */
+        fResult = pstSnapshot->afJoystickAxisList[_eID];
+      }
+      /* Joystick ready? */
+      else if(orxModule_IsInitialized(orxMODULE_ID_JOYSTICK) != orxFALSE)
+      {
+        /* Updates result */
+        fResult = orxJoystick_GetAxisValue(0, (orxJOYSTICK_AXIS)_eID);
+      }
 
       break;
     }
@@ -344,16 +704,252 @@ static orxBOOL orxFASTCALL orxInput_SaveCallback(const orxSTRING _zSetName, cons
   return bResult;
 }
 
+/** Gets an entry's current value
+ * @param[in]   _pstEntry       Concerned entry
+ * @return orxFLOAT
+ */
+static orxINLINE orxFLOAT orxInput_GetEntryValue(const orxINPUT_ENTRY *_pstEntry)
+{
+  orxFLOAT fResult = orxFLOAT_0;
+
+  /* External value? */
+  if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
+  {
+    /* Updates result */
+    fResult = _pstEntry->fExternalValue;
+  }
+  else
+  {
+    orxU32 i;
+
+    /* For all bindings */
+    for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+    {
+      /* Valid & active? */
+      if((_pstEntry->astBindingList[i].eID != orxINPUT_TYPE_NONE)
+      && (orxMath_Abs(_pstEntry->astBindingList[i].fValue) > _pstEntry->astBindingList[i].fThreshold))
+      {
+        /* Updates result */
+        fResult = _pstEntry->astBindingList[i].fValue;
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return fResult;
+}
+
+/** Reads next replayed tick header and locks core clock on its DT
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE (end of replay)
+ */
+static orxINLINE orxSTATUS orxInput_ReadReplayTick()
+{
+  orxU8     au8Tick[orxINPUT_KU32_RECORD_TICK_SIZE];
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Reads it */
+  if(orxFile_Read(au8Tick, orxINPUT_KU32_RECORD_TICK_SIZE, 1, sstInput.pstReplayFile) == 1)
+  {
+    orxFLOAT fDT;
+
+    /* Gets its DT */
+    orxInput_CopyRecordFloat((orxU8 *)&fDT, au8Tick);
+
+    /* Stores its value counter */
+    sstInput.u32ReplayCounter = orxInput_ReadRecordU32(au8Tick + 4);
+
+    /* Locks core clock on recorded DT */
+    eResult = orxClock_SetModifier(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxCLOCK_MOD_TYPE_FIXED, fDT);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Applies replayed values of current tick as permanent external values
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE (corrupted replay)
+ */
+static orxINLINE orxSTATUS orxInput_ApplyReplayTick()
+{
+  orxINPUT_ENTRY *pstEntry;
+  orxU32          i;
+  orxSTATUS       eResult = orxSTATUS_SUCCESS;
+
+  /* For all entries */
+  for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
+      pstEntry != orxNULL;
+      pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+  {
+    /* Inactive unless recorded */
+    pstEntry->fExternalValue = orxFLOAT_0;
+    orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL);
+  }
+
+  /* For all recorded values */
+  for(i = 0; i < sstInput.u32ReplayCounter; i++)
+  {
+    orxU8     au8Value[orxINPUT_KU32_RECORD_VALUE_SIZE];
+    orxU32    u32ID;
+    orxFLOAT  fValue;
+
+    /* Can't read it? */
+    if(orxFile_Read(au8Value, orxINPUT_KU32_RECORD_VALUE_SIZE, 1, sstInput.pstReplayFile) != 1)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+
+      break;
+    }
+
+    /* Gets its ID & value */
+    u32ID = orxInput_ReadRecordU32(au8Value);
+    orxInput_CopyRecordFloat((orxU8 *)&fValue, au8Value + 4);
+
+    /* For all entries */
+    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    {
+      /* Found? */
+      if(pstEntry->u32ID == u32ID)
+      {
+        /* Updates its value */
+        pstEntry->fExternalValue = fValue;
+
+        break;
+      }
+    }
+  }
+
+  /* Clears counter */
+  sstInput.u32ReplayCounter = 0;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Writes current tick to record file, stops recording if it can't be written
+ * @param[in]   _fDT            Core clock DT
+ */
+static orxINLINE void orxInput_WriteRecordTick(orxFLOAT _fDT)
+{
+  orxU8           au8Tick[orxINPUT_KU32_RECORD_TICK_SIZE];
+  orxINPUT_ENTRY *pstEntry;
+  orxU32          u32Counter = 0;
+  orxSTATUS       eResult = orxSTATUS_SUCCESS;
+
+  /* Has current set? */
+  if(sstInput.pstCurrentSet != orxNULL)
+  {
+    /* For all entries */
+    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    {
+      /* Active? */
+      if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
+      {
+        /* Updates counter */
+        u32Counter++;
+      }
+    }
+  }
+
+  /* Inits tick */
+  orxInput_CopyRecordFloat(au8Tick, (const orxU8 *)&_fDT);
+  orxInput_WriteRecordU32(au8Tick + 4, u32Counter);
+
+  /* Writes it */
+  if(orxFile_Write(au8Tick, orxINPUT_KU32_RECORD_TICK_SIZE, 1, sstInput.pstRecordFile) != 1)
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+  /* Has active entries? */
+  else if(u32Counter != 0)
+  {
+    /* For all entries */
+    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    {
+      /* Active? */
+      if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
+      {
+        orxU8     au8Value[orxINPUT_KU32_RECORD_VALUE_SIZE];
+        orxFLOAT  fValue;
+
+        /* Inits value */
+        fValue = orxInput_GetEntryValue(pstEntry);
+        orxInput_WriteRecordU32(au8Value, pstEntry->u32ID);
+        orxInput_CopyRecordFloat(au8Value + 4, (const orxU8 *)&fValue);
+
+        /* Can't write it? */
+        if(orxFile_Write(au8Value, orxINPUT_KU32_RECORD_VALUE_SIZE, 1, sstInput.pstRecordFile) != 1)
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+          break;
+        }
+      }
+    }
+  }
+
+  /* Failed? */
+  if(eResult == orxSTATUS_FAILURE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't write input record: stopping recording.");
+
+    /* Stops recording */
+    orxInput_StopRecording();
+  }
+
+  return;
+}
+
 /** Updates inputs
  * @param[in]   _pstClockInfo   Clock info of the clock used upon registration
  * @param[in]   _pContext     Context sent when registering callback to the clock
  */
 static void orxFASTCALL orxInput_Update(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
+  /* Takes devices snapshot */
+  orxInput_TakeSnapshot();
+
   /* Has current set? */
   if(sstInput.pstCurrentSet != orxNULL)
   {
     orxINPUT_ENTRY *pstEntry;
+    orxBOOL         bFullUpdate;
+
+    /* Replaying? */
+    if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_REPLAY))
+    {
+      /* Applies recorded values and gets next tick */
+      if((orxInput_ApplyReplayTick() == orxSTATUS_FAILURE)
+      || (orxInput_ReadReplayTick() == orxSTATUS_FAILURE))
+      {
+        orxBOOL bQuit;
+
+        /* Should quit? */
+        bQuit = orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_QUIT_AFTER_REPLAY) ? orxTRUE : orxFALSE;
+
+        /* Stops replay */
+        orxInput_StopReplay();
+
+        /* Should quit? */
+        if(bQuit != orxFALSE)
+        {
+          /* Sends close event */
+          orxEvent_SendShort(orxEVENT_TYPE_SYSTEM, orxSYSTEM_EVENT_CLOSE);
+        }
+      }
+    }
+
+    /* Should update all entries? */
+    bFullUpdate = orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_FULL_UPDATE) ? orxTRUE : orxFALSE;
 
     /* For all entries */
     for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
@@ -363,6 +959,36 @@ static void orxFASTCALL orxInput_Update(const orxCLOCK_INFO *_pstClockInfo, void
       orxU32  i, u32ActiveIndex = 0;
       orxBOOL bActive = orxFALSE, bStatusSet = orxFALSE, bHasBinding = orxFALSE;
 
+      /* Not dirty, no external value and no full update? */
+      if((bFullUpdate == orxFALSE)
+      && (!orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_MASK_UPDATE)))
+      {
+        orxBOOL bChanged = orxFALSE;
+
+        /* For all bindings */
+        for(i = 0; (bChanged == orxFALSE) && (i < orxINPUT_KU32_BINDING_NUMBER); i++)
+        {
+          /* Valid? */
+          if(pstEntry->astBindingList[i].eType != orxINPUT_TYPE_NONE)
+          {
+            /* Updates change status */
+            bChanged = orxInput_HasBindingChanged(pstEntry->astBindingList[i].eType, pstEntry->astBindingList[i].eID);
+          }
+        }
+
+        /* Nothing changed? */
+        if(bChanged == orxFALSE)
+        {
+          /* Keeps its status, which isn't new anymore */
+          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS);
+
+          continue;
+        }
+      }
+
+      /* Cleans dirty status */
+      orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_DIRTY);
+
       /* Had external value? */
       if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL))
       {
@@ -591,6 +1217,16 @@ static void orxFASTCALL orxInput_Update(const orxCLOCK_INFO *_pstClockInfo, void
     }
   }
 
+  /* Recording? */
+  if(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_RECORD))
+  {
+    /* Writes current tick */
+    orxInput_WriteRecordTick(_pstClockInfo->fDT);
+  }
+
+  /* Clears full update status */
+  orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_NONE, orxINPUT_KU32_STATIC_FLAG_FULL_UPDATE);
+
   return;
 }
 
@@ -624,7 +1260,7 @@ static orxINLINE orxINPUT_ENTRY *orxInput_CreateEntry(const orxSTRING _zEntryNam
       /* Inits it */
       pstResult->zName      = orxString_Duplicate(_zEntryName);
       pstResult->u32ID      = orxString_ToCRC(_zEntryName);
-      pstResult->u32Status  = orxINPUT_KU32_ENTRY_FLAG_NONE;
+      pstResult->u32Status  = orxINPUT_KU32_ENTRY_FLAG_DIRTY;
       for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
       {
         pstResult->astBindingList[i].eType = orxINPUT_TYPE_NONE;
@@ -777,6 +1413,7 @@ void orxFASTCALL orxInput_Setup()
   orxModule_AddDependency(orxMODULE_ID_INPUT, orxMODULE_ID_CONFIG);
   orxModule_AddDependency(orxMODULE_ID_INPUT, orxMODULE_ID_CLOCK);
   orxModule_AddDependency(orxMODULE_ID_INPUT, orxMODULE_ID_EVENT);
+  orxModule_AddDependency(orxMODULE_ID_INPUT, orxMODULE_ID_FILE);
   orxModule_AddOptionalDependency(orxMODULE_ID_INPUT, orxMODULE_ID_KEYBOARD);
   orxModule_AddOptionalDependency(orxMODULE_ID_INPUT, orxMODULE_ID_MOUSE);
   orxModule_AddOptionalDependency(orxMODULE_ID_INPUT, orxMODULE_ID_JOYSTICK);
@@ -822,6 +1459,33 @@ orxSTATUS orxFASTCALL orxInput_Init()
 
           /* Loads from input */
           orxInput_Load(orxSTRING_EMPTY);
+
+          /* Pushes input section */
+          orxConfig_PushSection(orxINPUT_KZ_CONFIG_SECTION);
+
+          /* Has replay file? */
+          if(orxConfig_HasValue(orxINPUT_KZ_CONFIG_REPLAY_FILE) != orxFALSE)
+          {
+            /* Starts replay */
+            if(orxInput_StartReplay(orxConfig_GetString(orxINPUT_KZ_CONFIG_REPLAY_FILE)) != orxSTATUS_FAILURE)
+            {
+              /* Should quit after it? */
+              if(orxConfig_GetBool(orxINPUT_KZ_CONFIG_QUIT_AFTER_REPLAY) != orxFALSE)
+              {
+                /* Updates flags */
+                orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_QUIT_AFTER_REPLAY, orxINPUT_KU32_STATIC_FLAG_NONE);
+              }
+            }
+          }
+          /* Has record file? */
+          else if(orxConfig_HasValue(orxINPUT_KZ_CONFIG_RECORD_FILE) != orxFALSE)
+          {
+            /* Starts recording */
+            orxInput_StartRecording(orxConfig_GetString(orxINPUT_KZ_CONFIG_RECORD_FILE));
+          }
+
+          /* Pops config section */
+          orxConfig_PopSection();
         }
         else
         {
@@ -862,6 +1526,10 @@ void orxFASTCALL orxInput_Exit()
     orxCLOCK     *pstClock;
     orxINPUT_SET *pstSet;
 
+    /* Stops recording & replay */
+    orxInput_StopRecording();
+    orxInput_StopReplay();
+
     /* While there's still a set */
     while((pstSet = (orxINPUT_SET *)orxLinkList_GetFirst(&(sstInput.stSetList))) != orxNULL)
     {
@@ -1077,6 +1745,9 @@ orxSTATUS orxFASTCALL orxInput_SelectSet(const orxSTRING _zSetName)
           /* Selects it */
           sstInput.pstCurrentSet = pstSet;
 
+          /* Its entries haven't been following device changes */
+          orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_FULL_UPDATE, orxINPUT_KU32_STATIC_FLAG_NONE);
+
           break;
         }
       }
@@ -1256,29 +1927,8 @@ orxFLOAT orxFASTCALL orxInput_GetValue(const orxSTRING _zInputName)
       /* Found? */
       if(pstEntry->u32ID == u32EntryID)
       {
-        orxU32 i;
-
-        /* External value? */
-        if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
-        {
-          /* Updates result */
-          fResult = pstEntry->fExternalValue;
-        }
-        else
-        {
-          /* For all bindings */
-          for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-          {
-            /* Valid & active? */
-            if((pstEntry->astBindingList[i].eID != orxINPUT_TYPE_NONE)
-            && (orxMath_Abs(pstEntry->astBindingList[i].fValue) > pstEntry->astBindingList[i].fThreshold))
-            {
-              /* Updates result */
-              fResult = pstEntry->astBindingList[i].fValue;
-              break;
-            }
-          }
-        }
+        /* Updates result */
+        fResult = orxInput_GetEntryValue(pstEntry);
 
         break;
       }
@@ -1466,12 +2116,12 @@ orxSTATUS orxFASTCALL orxInput_SetCombineMode(const orxSTRING _zName, orxBOOL _b
         if(_bCombine != orxFALSE)
         {
           /* Updates its status */
-          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE, orxINPUT_KU32_ENTRY_FLAG_NONE);
+          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE | orxINPUT_KU32_ENTRY_FLAG_DIRTY, orxINPUT_KU32_ENTRY_FLAG_NONE);
         }
         else
         {
           /* Updates its status */
-          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_COMBINE);
+          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_DIRTY, orxINPUT_KU32_ENTRY_FLAG_COMBINE);
         }
 
         /* Updates result */
@@ -1548,6 +2198,14 @@ orxSTATUS orxFASTCALL orxInput_Bind(const orxSTRING _zName, orxINPUT_TYPE _eType
     orxINPUT_ENTRY *pstEntry, *pstSelectedEntry = orxNULL;
     orxU32          u32EntryID;
 
+    /* Joystick binding while joystick init was deferred? */
+    if(((_eType == orxINPUT_TYPE_JOYSTICK_BUTTON) || (_eType == orxINPUT_TYPE_JOYSTICK_AXIS))
+    && (orxModule_IsInitialized(orxMODULE_ID_JOYSTICK) == orxFALSE))
+    {
+      /* Inits it on first use */
+      orxModule_Init(orxMODULE_ID_JOYSTICK);
+    }
+
     /* Gets entry ID */
     u32EntryID = orxString_ToCRC(_zName);
 
@@ -1612,7 +2270,7 @@ orxSTATUS orxFASTCALL orxInput_Bind(const orxSTRING _zName, orxINPUT_TYPE _eType
       u32OldestIndex = (u32OldestIndex + 1) % orxINPUT_KU32_BINDING_NUMBER;
 
       /* Updates status */
-      orxFLAG_SET(pstSelectedEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_BOUND | u32OldestIndex, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING);
+      orxFLAG_SET(pstSelectedEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_BOUND | orxINPUT_KU32_ENTRY_FLAG_DIRTY | u32OldestIndex, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING);
 
       /* Updates result */
       eResult = orxSTATUS_SUCCESS;
@@ -1681,12 +2339,12 @@ orxSTATUS orxFASTCALL orxInput_Unbind(orxINPUT_TYPE _eType, orxENUM _eID)
           if(bBound != orxFALSE)
           {
             /* Updates status */
-            orxFLAG_SET(pstEntry->u32Status, i, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING);
+            orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_DIRTY | i, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING);
           }
           else
           {
             /* Updates status */
-            orxFLAG_SET(pstEntry->u32Status, i, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING | orxINPUT_KU32_ENTRY_FLAG_BOUND);
+            orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_DIRTY | i, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING | orxINPUT_KU32_ENTRY_FLAG_BOUND);
           }
 
           /* Updates result */
@@ -2078,3 +2736,219 @@ orxSTATUS orxFASTCALL orxInput_GetActiveBinding(orxINPUT_TYPE *_peType, orxENUM
   /* Done! */
   return eResult;
 }
+
+/** Starts recording inputs to a file (core clock DT & active input values, for each tick)
+ * @param[in]   _zFileName      Record file name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxInput_StartRecording(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Stops current recording */
+  orxInput_StopRecording();
+
+  /* Valid name? */
+  if(_zFileName != orxSTRING_EMPTY)
+  {
+    /* Opens file */
+    sstInput.pstRecordFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+    /* Success? */
+    if(sstInput.pstRecordFile != orxNULL)
+    {
+      orxU8 au8Header[orxINPUT_KU32_RECORD_HEADER_SIZE];
+
+      /* Inits header */
+      orxInput_WriteRecordU32(au8Header, orxINPUT_KU32_RECORD_MAGIC);
+      orxInput_WriteRecordU32(au8Header + 4, orxINPUT_KU32_RECORD_VERSION);
+
+      /* Writes it */
+      if(orxFile_Write(au8Header, orxINPUT_KU32_RECORD_HEADER_SIZE, 1, sstInput.pstRecordFile) == 1)
+      {
+        /* Updates flags */
+        orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_RECORD, orxINPUT_KU32_STATIC_FLAG_NONE);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Closes file */
+        orxFile_Close(sstInput.pstRecordFile);
+        sstInput.pstRecordFile = orxNULL;
+      }
+    }
+
+    /* Failed? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't record inputs to file <%s>.", _zFileName);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops recording inputs
+ */
+void orxFASTCALL orxInput_StopRecording()
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+
+  /* Recording? */
+  if(sstInput.pstRecordFile != orxNULL)
+  {
+    /* Closes file */
+    orxFile_Close(sstInput.pstRecordFile);
+    sstInput.pstRecordFile = orxNULL;
+
+    /* Updates flags */
+    orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_NONE, orxINPUT_KU32_STATIC_FLAG_RECORD);
+  }
+
+  return;
+}
+
+/** Starts replaying inputs from a record file: devices are ignored and core clock is locked on recorded DTs till the end of the replay
+ * @param[in]   _zFileName      Record file name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxInput_StartReplay(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Stops current replay */
+  orxInput_StopReplay();
+
+  /* Valid name? */
+  if(_zFileName != orxSTRING_EMPTY)
+  {
+    /* Opens file */
+    sstInput.pstReplayFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+    /* Success? */
+    if(sstInput.pstReplayFile != orxNULL)
+    {
+      orxU8 au8Header[orxINPUT_KU32_RECORD_HEADER_SIZE];
+
+      /* Valid header? */
+      if((orxFile_Read(au8Header, orxINPUT_KU32_RECORD_HEADER_SIZE, 1, sstInput.pstReplayFile) == 1)
+      && (orxInput_ReadRecordU32(au8Header) == orxINPUT_KU32_RECORD_MAGIC)
+      && (orxInput_ReadRecordU32(au8Header + 4) == orxINPUT_KU32_RECORD_VERSION))
+      {
+        const orxCLOCK_INFO *pstClockInfo;
+
+        /* Backups core clock modifier */
+        pstClockInfo              = orxClock_GetInfo(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE));
+        sstInput.eReplayModType   = pstClockInfo->eModType;
+        sstInput.fReplayModValue  = pstClockInfo->fModValue;
+
+        /* Gets first tick */
+        eResult = orxInput_ReadReplayTick();
+
+        /* Success? */
+        if(eResult != orxSTATUS_FAILURE)
+        {
+          /* Updates flags */
+          orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_REPLAY | orxINPUT_KU32_STATIC_FLAG_FULL_UPDATE, orxINPUT_KU32_STATIC_FLAG_NONE);
+        }
+        else
+        {
+          /* Restores core clock modifier */
+          orxClock_SetModifier(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), sstInput.eReplayModType, sstInput.fReplayModValue);
+        }
+      }
+
+      /* Failed? */
+      if(eResult == orxSTATUS_FAILURE)
+      {
+        /* Closes file */
+        orxFile_Close(sstInput.pstReplayFile);
+        sstInput.pstReplayFile = orxNULL;
+      }
+    }
+
+    /* Failed? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't replay inputs from file <%s>: invalid or empty record.", _zFileName);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops replaying inputs: devices are used again and core clock modifier is restored
+ */
+void orxFASTCALL orxInput_StopReplay()
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+
+  /* Replaying? */
+  if(sstInput.pstReplayFile != orxNULL)
+  {
+    /* Closes file */
+    orxFile_Close(sstInput.pstReplayFile);
+    sstInput.pstReplayFile = orxNULL;
+
+    /* Restores core clock modifier */
+    orxClock_SetModifier(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), sstInput.eReplayModType, sstInput.fReplayModValue);
+
+    /* Has current set? */
+    if(sstInput.pstCurrentSet != orxNULL)
+    {
+      orxINPUT_ENTRY *pstEntry;
+
+      /* For all entries */
+      for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
+          pstEntry != orxNULL;
+          pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+      {
+        /* Had replayed value? */
+        if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
+        {
+          /* Clears its value */
+          pstEntry->fExternalValue = orxFLOAT_0;
+
+          /* Updates its status */
+          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
+        }
+      }
+    }
+
+    /* Updates flags */
+    orxFLAG_SET(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_FULL_UPDATE, orxINPUT_KU32_STATIC_FLAG_REPLAY | orxINPUT_KU32_STATIC_FLAG_QUIT_AFTER_REPLAY);
+
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Input replay is over.");
+  }
+
+  return;
+}
+
+/** Is replaying inputs?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxInput_IsReplaying()
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+
+  /* Done! */
+  return orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_REPLAY) ? orxTRUE : orxFALSE;
+}
@@ -154,6 +154,7 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxJoystick_Init, orxSTATUS, void);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxJoystick_Exit, void, void);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxJoystick_GetAxisValue, orxFLOAT, orxU32, orxJOYSTICK_AXIS);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxJoystick_IsButtonPressed, orxBOOL, orxU32, orxJOYSTICK_BUTTON);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxJoystick_GetState, orxSTATUS, orxU32, orxU32 *, orxFLOAT *);
 
 
 /* *** Core function info array *** */
@@ -164,6 +165,7 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(JOYSTICK, INIT, orxJoystick_Init)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(JOYSTICK, EXIT, orxJoystick_Exit)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(JOYSTICK, GET_AXIS_VALUE, orxJoystick_GetAxisValue)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(JOYSTICK, IS_BUTTON_PRESSED, orxJoystick_IsButtonPressed)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(JOYSTICK, GET_STATE, orxJoystick_GetState)
 
 orxPLUGIN_END_CORE_FUNCTION_ARRAY(JOYSTICK)
 
@@ -204,3 +206,14 @@ orxBOOL orxFASTCALL orxJoystick_IsButtonPressed(orxU32 _u32ID, orxJOYSTICK_BUTTO
 {
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxJoystick_IsButtonPressed)(_u32ID, _eButton);
 }
+
+/** Gets the whole state of a joystick at once
+ * @param[in] _u32ID              ID of the joystick to query
+ * @param[out] _pu32ButtonBitset  Button bitset to fill
+ * @param[out] _afAxisList        Axis values to fill
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxJoystick_GetState(orxU32 _u32ID, orxU32 *_pu32ButtonBitset, orxFLOAT _afAxisList[orxJOYSTICK_AXIS_NUMBER])
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxJoystick_GetState)(_u32ID, _pu32ButtonBitset, _afAxisList);
+}
@@ -204,6 +204,7 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxKeyboard_IsKeyPressed, orxBOOL, orxKEYBOARD_KE
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxKeyboard_Hit, orxBOOL, void);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxKeyboard_Read, orxKEYBOARD_KEY, void);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxKeyboard_ClearBuffer, void, void);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxKeyboard_GetKeyBitset, orxSTATUS, orxU32 *);
 
 
 /* *** Core function info array *** */
@@ -216,6 +217,7 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(KEYBOARD, IS_KEY_PRESSED, orxKeyboard_IsKeyPre
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(KEYBOARD, HIT, orxKeyboard_Hit)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(KEYBOARD, READ, orxKeyboard_Read)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(KEYBOARD, CLEAR_BUFFER, orxKeyboard_ClearBuffer)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(KEYBOARD, GET_KEY_BITSET, orxKeyboard_GetKeyBitset)
 
 orxPLUGIN_END_CORE_FUNCTION_ARRAY(KEYBOARD)
 
@@ -270,3 +272,12 @@ void orxFASTCALL orxKeyboard_ClearBuffer()
 {
   orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxKeyboard_ClearBuffer)();
 }
+
+/** Gets the state of all keys at once
+ * @param[out] _au32KeyBitset Key bitset to fill
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxKeyboard_GetKeyBitset(orxU32 _au32KeyBitset[orxKEYBOARD_KU32_KEY_BITSET_SIZE])
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxKeyboard_GetKeyBitset)(_au32KeyBitset);
+}
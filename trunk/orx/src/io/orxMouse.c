@@ -112,6 +112,7 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxMouse_IsButtonPressed, orxBOOL, orxMOUSE_BUTTO
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxMouse_GetMoveDelta, orxVECTOR *, orxVECTOR *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxMouse_GetWheelDelta, orxFLOAT, void);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxMouse_ShowCursor, orxSTATUS, orxBOOL);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxMouse_GetButtonBitset, orxSTATUS, orxU32 *);
 
 
 /* *** Core function info array *** */
@@ -126,6 +127,7 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(MOUSE, IS_BUTTON_PRESSED, orxMouse_IsButtonPre
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(MOUSE, GET_MOVE_DELTA, orxMouse_GetMoveDelta)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(MOUSE, GET_WHEEL_DELTA, orxMouse_GetWheelDelta)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(MOUSE, SHOW_CURSOR, orxMouse_ShowCursor)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(MOUSE, GET_BUTTON_BITSET, orxMouse_GetButtonBitset)
 
 orxPLUGIN_END_CORE_FUNCTION_ARRAY(MOUSE)
 
@@ -198,3 +200,12 @@ orxSTATUS orxFASTCALL orxMouse_ShowCursor(orxBOOL _bShow)
 {
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxMouse_ShowCursor)(_bShow);
 }
+
+/** Gets the state of all mouse buttons at once (wheel excluded)
+ * @param[out] _pu32ButtonBitset  Button bitset to fill
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxMouse_GetButtonBitset(orxU32 *_pu32ButtonBitset)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxMouse_GetButtonBitset)(_pu32ButtonBitset);
+}
@@ -0,0 +1,1227 @@
+/* Orx - Portable Game Engine
+ *
+ * Orx is the legal property of its developers, whose names
+ * are listed in the COPYRIGHT file distributed
+ * with this source distribution.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file orxBench.c
+ * @date 19/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * Headless benchmark executable
+ *
+ * Runs all the scenarios listed in [Bench] for a fixed number of frames each
+ * and writes per-scenario timings as JSON. Determinism comes from config:
+ * a fixed global clock modifier ([Clock] ModifierType = fixed) and a fixed random seed.
+ *
+ */
+
+
+/** Includes
+ */
+#include "orx.h"
+
+/** Flags
+ */
+#define orxBENCH_KU32_STATIC_FLAG_NONE      0x00000000  /**< No flags */
+
+#define orxBENCH_KU32_STATIC_FLAG_READY     0x00000001  /**< Ready flag */
+#define orxBENCH_KU32_STATIC_FLAG_EXIT      0x00000002  /**< Exit flag */
+#define orxBENCH_KU32_STATIC_FLAG_RUNNING   0x00000004  /**< Scenario running flag */
+#define orxBENCH_KU32_STATIC_FLAG_FIRST     0x00000008  /**< No scenario written yet flag */
+#define orxBENCH_KU32_STATIC_FLAG_TEXT      0x00000010  /**< Updates texts every frame flag */
+#define orxBENCH_KU32_STATIC_FLAG_STARTUP   0x00000020  /**< Startup results not written yet flag */
+
+#define orxBENCH_KU32_STATIC_MASK_ALL       0xFFFFFFFF  /**< All mask */
+
+/** Misc defines
+ */
+#define orxBENCH_KZ_CONFIG_SECTION          "Bench"         /**< Bench config section */
+#define orxBENCH_KZ_CONFIG_SCENARIO_LIST    "ScenarioList"  /**< Scenario list config key */
+#define orxBENCH_KZ_CONFIG_OUTPUT           "Output"        /**< Output file config key */
+#define orxBENCH_KZ_CONFIG_SEED             "Seed"          /**< Random seed config key */
+#define orxBENCH_KZ_CONFIG_VIEWPORT         "Viewport"      /**< Viewport config key */
+#define orxBENCH_KZ_CONFIG_MATH_BATCH_SIZE  "MathBatchSize" /**< Math kernel batch size config key */
+#define orxBENCH_KZ_CONFIG_MATH_LOOP_NUMBER "MathLoopNumber"/**< Math kernel loop number config key */
+#define orxBENCH_KZ_CONFIG_ITERATION_SIZE   "IterationSize" /**< Structure iteration object number config key */
+#define orxBENCH_KZ_CONFIG_ITERATION_LOOP_NUMBER "IterationLoopNumber" /**< Structure iteration loop number config key */
+#define orxBENCH_KZ_CONFIG_HASH_SIZE        "HashSize"      /**< String hash buffer size config key */
+#define orxBENCH_KZ_CONFIG_HASH_LOOP_NUMBER "HashLoopNumber"/**< String hash loop number config key */
+
+#define orxBENCH_KZ_CONFIG_OBJECT_LIST      "ObjectList"    /**< Scenario object list config key */
+#define orxBENCH_KZ_CONFIG_OBJECT_COUNTER   "ObjectCounter" /**< Scenario object counter list config key */
+#define orxBENCH_KZ_CONFIG_FRAME_NUMBER     "FrameNumber"   /**< Scenario frame number config key */
+#define orxBENCH_KZ_CONFIG_TEXT_UPDATE      "TextUpdate"    /**< Scenario text update config key */
+#define orxBENCH_KZ_CONFIG_LANGUAGE_SWITCH  "LanguageSwitch"/**< Scenario language switch period (frames) config key */
+#define orxBENCH_KZ_CONFIG_STATIC_CACHE     "StaticCache"   /**< Scenario viewport static cache config key */
+#define orxBENCH_KZ_CONFIG_CAMERA_SPEED     "CameraSpeed"   /**< Scenario camera scrolling speed config key */
+#define orxBENCH_KZ_CONFIG_VIEWPORT_LIST    "ViewportList"  /**< Scenario viewport list (replaces bench viewport) config key */
+
+#define orxBENCH_KZ_DEFAULT_OUTPUT          "orxbench.json" /**< Default output file */
+#define orxBENCH_KU32_DEFAULT_SEED          0x0B0E5EED      /**< Default random seed */
+#define orxBENCH_KU32_DEFAULT_FRAME_NUMBER  600             /**< Default frame number */
+#define orxBENCH_KU32_DEFAULT_MATH_LOOP     100             /**< Default math kernel loop number */
+#define orxBENCH_KU32_DEFAULT_ITERATION_LOOP 100            /**< Default structure iteration loop number */
+#define orxBENCH_KU32_DEFAULT_HASH_LOOP     100             /**< Default string hash loop number */
+#define orxBENCH_KU32_HASH_KEY_LENGTH       16              /**< String hash short key length */
+#define orxBENCH_KU32_MATH_FLOAT_NUMBER     19              /**< Floats per element in math buffer */
+#define orxBENCH_KU32_TEXT_BUFFER_SIZE      16              /**< Text update buffer size */
+#define orxBENCH_KU32_VIEWPORT_NUMBER       4               /**< Scenario viewport max number */
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Static structure
+ */
+typedef struct __orxBENCH_STATIC_t
+{
+  orxU32      u32Flags;               /**< Control flags */
+  orxFILE     *pstFile;               /**< Output file */
+  orxVIEWPORT *pstViewport;           /**< Bench viewport */
+  orxU32      u32Seed;                /**< Random seed */
+  orxS32      s32ScenarioIndex;       /**< Current scenario index */
+  orxS32      s32ScenarioCounter;     /**< Scenario counter */
+  orxU32      u32Frame;               /**< Current scenario frame */
+  orxU32      u32FrameNumber;         /**< Current scenario frame number */
+  orxFLOAT    fSetupTime;             /**< Current scenario setup time */
+  orxU32      u32SetupAllocation;     /**< Current scenario setup allocation counter */
+  orxFLOAT    fStartTime;             /**< Current scenario start time */
+  orxU32      u32StartAllocation;     /**< Current scenario start allocation counter */
+  orxU32      u32LanguageSwitch;      /**< Current scenario language switch period, 0 for none */
+  orxFLOAT    fFrameTime;             /**< Current scenario last frame time stamp */
+  orxFLOAT    fMaxFrameTime;          /**< Current scenario longest frame */
+  orxVECTOR   vCameraSpeed;           /**< Current scenario camera scrolling speed */
+  orxVECTOR   vCameraPosition;        /**< Camera position before current scenario */
+  orxU32      u32ViewportCounter;     /**< Current scenario viewport counter */
+  orxVIEWPORT *apstViewportList[orxBENCH_KU32_VIEWPORT_NUMBER]; /**< Current scenario viewports */
+
+} orxBENCH_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxBENCH_STATIC sstBench;
+
+/** Module names, used for JSON output, in orxMODULE_ID order (! Needs to be updated for all new modules !)
+ */
+static const orxSTRING sazModuleName[] =
+{
+  "anim", "animpointer", "animset", "bank", "body", "camera", "clock", "config", "display", "event",
+  "file", "filesystem", "fps", "frame", "fx", "fxpointer", "graphic", "input", "joystick", "keyboard",
+  "locale", "main", "memory", "mouse", "object", "param", "physics", "plugin", "render", "screenshot",
+  "shader", "shaderpointer", "sound", "soundpointer", "soundsystem", "spawner", "structure", "system", "text", "texture",
+  "viewport"
+};
+
+/** Compile-time check: fails to build (negative array size) if a module name is missing or extra
+ */
+typedef orxU8 orxBENCH_MODULE_NAME_CHECK[((sizeof(sazModuleName) / sizeof(sazModuleName[0])) == orxMODULE_ID_NUMBER) ? 1 : -1];
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Main event handler
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxBench_EventHandler(const orxEVENT *_pstEvent)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_SYSTEM);
+
+  /* Close event? */
+  if(_pstEvent->eID == orxSYSTEM_EVENT_CLOSE)
+  {
+    /* Updates status */
+    orxFLAG_SET(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_EXIT, orxBENCH_KU32_STATIC_FLAG_NONE);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Deletes all unreferenced objects
+ */
+static void orxFASTCALL orxBench_DeleteObjects()
+{
+  orxOBJECT *pstObject;
+
+  /* For all objects */
+  for(pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
+      pstObject != orxNULL;)
+  {
+    /* Not referenced? */
+    if(orxStructure_GetRefCounter(pstObject) == 0)
+    {
+      /* Deletes it */
+      orxObject_Delete(pstObject);
+
+      /* Restarts from first object as deletion can cascade */
+      pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
+    }
+    else
+    {
+      /* Gets next object */
+      pstObject = orxOBJECT(orxStructure_GetNext(pstObject));
+    }
+  }
+
+  return;
+}
+
+/** Updates all texts with changing numbers, as score counters or damage numbers would
+ */
+static void orxFASTCALL orxBench_UpdateTexts()
+{
+  orxTEXT  *pstText;
+  orxU32    i;
+
+  /* For all texts */
+  for(pstText = orxTEXT(orxStructure_GetFirst(orxSTRUCTURE_ID_TEXT)), i = 0;
+      pstText != orxNULL;
+      pstText = orxTEXT(orxStructure_GetNext(pstText)), i++)
+  {
+    orxCHAR acBuffer[orxBENCH_KU32_TEXT_BUFFER_SIZE];
+
+    /* Prints its new value */
+    orxString_NPrint(acBuffer, orxBENCH_KU32_TEXT_BUFFER_SIZE - 1, "%lu", (sstBench.u32Frame * 7 + i * 131) % 100000);
+    acBuffer[orxBENCH_KU32_TEXT_BUFFER_SIZE - 1] = orxCHAR_NULL;
+
+    /* Updates it */
+    orxText_SetString(pstText, acBuffer);
+  }
+
+  return;
+}
+
+/** Scrolls bench camera, as a side-scroller would
+ */
+static void orxFASTCALL orxBench_ScrollCamera()
+{
+  orxCAMERA *pstCamera;
+
+  /* Gets bench camera */
+  pstCamera = (sstBench.pstViewport != orxNULL) ? orxViewport_GetCamera(sstBench.pstViewport) : orxNULL;
+
+  /* Valid? */
+  if(pstCamera != orxNULL)
+  {
+    orxCLOCK  *pstClock;
+    orxVECTOR  vPosition, vOffset;
+
+    /* Gets core clock */
+    pstClock = orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE);
+
+    /* Valid? */
+    if(pstClock != orxNULL)
+    {
+      /* Moves camera by one frame */
+      orxCamera_GetPosition(pstCamera, &vPosition);
+      orxVector_Add(&vPosition, &vPosition, orxVector_Mulf(&vOffset, &(sstBench.vCameraSpeed), orxClock_GetInfo(pstClock)->fDT));
+      orxCamera_SetPosition(pstCamera, &vPosition);
+    }
+  }
+
+  return;
+}
+
+/** Starts a scenario
+ * @param[in]   _zScenario                    Scenario config section
+ */
+static void orxFASTCALL orxBench_StartScenario(const orxSTRING _zScenario)
+{
+  orxS32 i, s32ObjectCounter, s32ViewportCounter;
+
+  /* Logs message */
+  orxLOG("Starting scenario <%s>.", _zScenario);
+
+  /* Gets setup time & allocation counter */
+  sstBench.fSetupTime         = orxSystem_GetTime();
+  sstBench.u32SetupAllocation = orxMemory_GetAllocationCounter();
+
+  /* Uses the same random sequence for every run */
+  orxMath_InitRandom(sstBench.u32Seed);
+
+  /* Pushes scenario section */
+  orxConfig_PushSection(_zScenario);
+
+  /* Gets frame number */
+  sstBench.u32FrameNumber = (orxConfig_HasValue(orxBENCH_KZ_CONFIG_FRAME_NUMBER) != orxFALSE) ? orxConfig_GetU32(orxBENCH_KZ_CONFIG_FRAME_NUMBER) : orxBENCH_KU32_DEFAULT_FRAME_NUMBER;
+
+  /* Should update texts? */
+  if(orxConfig_GetBool(orxBENCH_KZ_CONFIG_TEXT_UPDATE) != orxFALSE)
+  {
+    /* Updates status */
+    orxFLAG_SET(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_TEXT, orxBENCH_KU32_STATIC_FLAG_NONE);
+  }
+
+  /* Gets language switch period */
+  sstBench.u32LanguageSwitch = orxConfig_GetU32(orxBENCH_KZ_CONFIG_LANGUAGE_SWITCH);
+
+  /* Gets camera scrolling speed */
+  if(orxConfig_GetVector(orxBENCH_KZ_CONFIG_CAMERA_SPEED, &(sstBench.vCameraSpeed)) == orxNULL)
+  {
+    /* Doesn't scroll */
+    orxVector_Copy(&(sstBench.vCameraSpeed), &orxVECTOR_0);
+  }
+
+  /* Has viewport? */
+  if(sstBench.pstViewport != orxNULL)
+  {
+    orxCAMERA *pstCamera;
+
+    /* Enables/disables its static cache */
+    orxViewport_EnableStaticCache(sstBench.pstViewport, orxConfig_GetBool(orxBENCH_KZ_CONFIG_STATIC_CACHE));
+
+    /* Stores camera position */
+    pstCamera = orxViewport_GetCamera(sstBench.pstViewport);
+    if(pstCamera != orxNULL)
+    {
+      orxCamera_GetPosition(pstCamera, &(sstBench.vCameraPosition));
+    }
+  }
+
+  /* For all scenario viewports */
+  for(i = 0, s32ViewportCounter = orxMIN(orxConfig_GetListCounter(orxBENCH_KZ_CONFIG_VIEWPORT_LIST), (orxS32)orxBENCH_KU32_VIEWPORT_NUMBER); i < s32ViewportCounter; i++)
+  {
+    orxVIEWPORT *pstViewport;
+
+    /* Creates it */
+    pstViewport = orxViewport_CreateFromConfig(orxConfig_GetListString(orxBENCH_KZ_CONFIG_VIEWPORT_LIST, i));
+
+    /* Valid? */
+    if(pstViewport != orxNULL)
+    {
+      /* Stores it */
+      sstBench.apstViewportList[sstBench.u32ViewportCounter++] = pstViewport;
+    }
+  }
+
+  /* Has scenario viewports? */
+  if((sstBench.u32ViewportCounter != 0) && (sstBench.pstViewport != orxNULL))
+  {
+    /* Disables bench viewport, scenario ones replace it */
+    orxViewport_Enable(sstBench.pstViewport, orxFALSE);
+  }
+
+  /* For all objects */
+  for(i = 0, s32ObjectCounter = orxConfig_GetListCounter(orxBENCH_KZ_CONFIG_OBJECT_LIST); i < s32ObjectCounter; i++)
+  {
+    orxSTRING       zObject;
+    orxU32          j, u32Counter;
+
+    /* Gets object name */
+    zObject = orxConfig_GetListString(orxBENCH_KZ_CONFIG_OBJECT_LIST, i);
+
+    /* Gets its counter (defaults to one instance) */
+    u32Counter = (i < orxConfig_GetListCounter(orxBENCH_KZ_CONFIG_OBJECT_COUNTER)) ? orxConfig_GetListU32(orxBENCH_KZ_CONFIG_OBJECT_COUNTER, i) : 1;
+
+    /* Creates all instances */
+    for(j = 0; j < u32Counter; j++)
+    {
+      orxObject_CreateFromConfig(zObject);
+    }
+  }
+
+  /* Pops section */
+  orxConfig_PopSection();
+
+  /* Updates setup time & allocation counter */
+  sstBench.fSetupTime         = orxSystem_GetTime() - sstBench.fSetupTime;
+  sstBench.u32SetupAllocation = orxMemory_GetAllocationCounter() - sstBench.u32SetupAllocation;
+
+  /* Resets module times */
+  orxClock_ResetProfiler();
+
+  /* Starts measure */
+  sstBench.u32Frame           = 0;
+  sstBench.u32StartAllocation = orxMemory_GetAllocationCounter();
+  sstBench.fStartTime         = orxSystem_GetTime();
+  sstBench.fFrameTime         = sstBench.fStartTime;
+  sstBench.fMaxFrameTime      = orxFLOAT_0;
+
+  /* Updates status */
+  orxFLAG_SET(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_RUNNING, orxBENCH_KU32_STATIC_FLAG_NONE);
+
+  return;
+}
+
+/** Stops current scenario and writes its results
+ * @param[in]   _zScenario                    Scenario config section
+ */
+static void orxFASTCALL orxBench_StopScenario(const orxSTRING _zScenario)
+{
+  orxFLOAT  fTime, fDT;
+  orxU32    i, u32Allocation;
+  orxCLOCK *pstClock;
+  orxBOOL   bFirst;
+
+  /* Gets measures */
+  fTime         = orxSystem_GetTime() - sstBench.fStartTime;
+  u32Allocation = orxMemory_GetAllocationCounter() - sstBench.u32StartAllocation;
+
+  /* Gets core clock DT */
+  pstClock  = orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE);
+  fDT       = (pstClock != orxNULL) ? orxClock_GetInfo(pstClock)->fDT : orxFLOAT_0;
+
+  /* Writes results */
+  orxFile_Print(sstBench.pstFile, "%s    {\n", orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_FIRST) ? "" : ",\n");
+  orxFile_Print(sstBench.pstFile, "      \"name\": \"%s\",\n", _zScenario);
+  orxFile_Print(sstBench.pstFile, "      \"frames\": %lu,\n", sstBench.u32Frame);
+  orxFile_Print(sstBench.pstFile, "      \"dt\": %g,\n", fDT);
+  orxFile_Print(sstBench.pstFile, "      \"setup_time\": %g,\n", sstBench.fSetupTime);
+  orxFile_Print(sstBench.pstFile, "      \"setup_allocations\": %lu,\n", sstBench.u32SetupAllocation);
+  orxFile_Print(sstBench.pstFile, "      \"time\": %g,\n", fTime);
+  orxFile_Print(sstBench.pstFile, "      \"fps\": %g,\n", (fTime > orxFLOAT_0) ? orxU2F(sstBench.u32Frame) / fTime : orxFLOAT_0);
+  orxFile_Print(sstBench.pstFile, "      \"max_frame_time\": %g,\n", sstBench.fMaxFrameTime);
+  orxFile_Print(sstBench.pstFile, "      \"allocations\": %lu,\n", u32Allocation);
+  orxFile_Print(sstBench.pstFile, "      \"allocations_per_frame\": %g,\n", (sstBench.u32Frame > 0) ? orxU2F(u32Allocation) / orxU2F(sstBench.u32Frame) : orxFLOAT_0);
+  orxFile_Print(sstBench.pstFile, "      \"modules\":\n      {");
+
+  /* For all modules */
+  for(i = 0, bFirst = orxTRUE; i < orxMODULE_ID_NUMBER; i++)
+  {
+    orxFLOAT fModuleTime;
+
+    /* Gets its time */
+    fModuleTime = orxClock_GetProfilerTime((orxMODULE_ID)i);
+
+    /* Was profiled? */
+    if(fModuleTime > orxFLOAT_0)
+    {
+      /* Writes it */
+      orxFile_Print(sstBench.pstFile, "%s\n        \"%s\": %g", (bFirst != orxFALSE) ? "" : ",", sazModuleName[i], fModuleTime);
+
+      /* Updates status */
+      bFirst = orxFALSE;
+    }
+  }
+  orxFile_Print(sstBench.pstFile, "\n      }\n    }");
+
+  /* Logs message */
+  orxLOG("Scenario <%s>: %lu frames in %gs (%g FPS), %lu allocations.", _zScenario, sstBench.u32Frame, fTime, (fTime > orxFLOAT_0) ? orxU2F(sstBench.u32Frame) / fTime : orxFLOAT_0, u32Allocation);
+
+  /* Cleans scenario */
+  orxBench_DeleteObjects();
+
+  /* Has viewport? */
+  if(sstBench.pstViewport != orxNULL)
+  {
+    orxCAMERA *pstCamera;
+
+    /* Disables its static cache */
+    orxViewport_EnableStaticCache(sstBench.pstViewport, orxFALSE);
+
+    /* Restores camera position */
+    pstCamera = orxViewport_GetCamera(sstBench.pstViewport);
+    if(pstCamera != orxNULL)
+    {
+      orxCamera_SetPosition(pstCamera, &(sstBench.vCameraPosition));
+    }
+
+    /* Re-enables it */
+    orxViewport_Enable(sstBench.pstViewport, orxTRUE);
+  }
+
+  /* Deletes scenario viewports */
+  for(i = 0; i < sstBench.u32ViewportCounter; i++)
+  {
+    orxViewport_Delete(sstBench.apstViewportList[i]);
+  }
+  sstBench.u32ViewportCounter = 0;
+
+  /* Has switched language? */
+  if(sstBench.u32LanguageSwitch != 0)
+  {
+    /* Restores default one */
+    orxLocale_SelectLanguage(orxLocale_GetLanguage(0));
+  }
+
+  /* Updates status */
+  orxFLAG_SET(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_NONE, orxBENCH_KU32_STATIC_FLAG_RUNNING | orxBENCH_KU32_STATIC_FLAG_FIRST | orxBENCH_KU32_STATIC_FLAG_TEXT);
+
+  return;
+}
+
+
+/** Writes module init times, as measured during engine startup
+ */
+static void orxFASTCALL orxBench_WriteStartup()
+{
+  orxFLOAT  fTotalTime;
+  orxBOOL   bFirst;
+  orxU32    i;
+
+  /* Writes header */
+  orxFile_Print(sstBench.pstFile, "  \"startup\":\n  {\n    \"modules\":\n    {");
+
+  /* For all modules */
+  for(i = 0, fTotalTime = orxFLOAT_0, bFirst = orxTRUE; i < orxMODULE_ID_NUMBER; i++)
+  {
+    orxFLOAT fModuleTime;
+
+    /* Gets its init time */
+    fModuleTime = orxModule_GetInitTime((orxMODULE_ID)i);
+
+    /* Was timed? */
+    if(fModuleTime > orxFLOAT_0)
+    {
+      /* Writes it */
+      orxFile_Print(sstBench.pstFile, "%s\n      \"%s\": %g", (bFirst != orxFALSE) ? "" : ",", sazModuleName[i], fModuleTime);
+
+      /* Updates total time & status */
+      fTotalTime += fModuleTime;
+      bFirst      = orxFALSE;
+    }
+  }
+
+  /* Writes footer */
+  orxFile_Print(sstBench.pstFile, "\n    },\n    \"time\": %g\n  },\n", fTotalTime);
+
+  /* Logs it */
+  orxLOG("Startup: modules initialized in %gs.", fTotalTime);
+
+  return;
+}
+
+/** Writes a math kernel result
+ * @param[in]   _zKernel                      Kernel name
+ * @param[in]   _fScalarTime                  Scalar reference time
+ * @param[in]   _fBatchTime                   Batch time
+ * @param[in]   _bFirst                       First kernel?
+ */
+static void orxFASTCALL orxBench_WriteMathResult(const orxSTRING _zKernel, orxFLOAT _fScalarTime, orxFLOAT _fBatchTime, orxBOOL _bFirst)
+{
+  orxFLOAT fSpeedup;
+
+  /* Gets speedup */
+  fSpeedup = (_fBatchTime > orxFLOAT_0) ? _fScalarTime / _fBatchTime : orxFLOAT_0;
+
+  /* Writes it */
+  orxFile_Print(sstBench.pstFile, "%s\n      { \"name\": \"%s\", \"scalar_time\": %g, \"batch_time\": %g, \"speedup\": %g }", (_bFirst != orxFALSE) ? "" : ",", _zKernel, _fScalarTime, _fBatchTime, fSpeedup);
+
+  /* Logs it */
+  orxLOG("Math kernel <%s>: scalar %gs, batch %gs (x%g).", _zKernel, _fScalarTime, _fBatchTime, fSpeedup);
+
+  return;
+}
+
+/** Runs math kernels on random data, scalar reference versus batch (needs bench section to be pushed)
+ */
+static void orxFASTCALL orxBench_RunMath()
+{
+  orxU32    u32BatchSize, u32LoopNumber;
+  orxFLOAT *afBuffer;
+  orxOBOX  *astBox;
+  orxU8    *au8Result;
+
+  /* Gets batch size & loop number */
+  u32BatchSize  = orxConfig_GetU32(orxBENCH_KZ_CONFIG_MATH_BATCH_SIZE);
+  u32LoopNumber = (orxConfig_HasValue(orxBENCH_KZ_CONFIG_MATH_LOOP_NUMBER) != orxFALSE) ? orxConfig_GetU32(orxBENCH_KZ_CONFIG_MATH_LOOP_NUMBER) : orxBENCH_KU32_DEFAULT_MATH_LOOP;
+
+  /* Allocates buffers */
+  afBuffer  = (orxFLOAT *)orxMemory_Allocate(u32BatchSize * orxBENCH_KU32_MATH_FLOAT_NUMBER * sizeof(orxFLOAT), orxMEMORY_TYPE_MAIN);
+  astBox    = (orxOBOX *)orxMemory_Allocate(u32BatchSize * sizeof(orxOBOX), orxMEMORY_TYPE_MAIN);
+  au8Result = (orxU8 *)orxMemory_Allocate(u32BatchSize * sizeof(orxU8), orxMEMORY_TYPE_MAIN);
+
+  /* Valid? */
+  if((u32BatchSize > 0) && (afBuffer != orxNULL) && (astBox != orxNULL) && (au8Result != orxNULL))
+  {
+    orxBATCH_OBOX_DEF   stDef;
+    orxBATCH_OBOX       stBox;
+    orxBATCH_TRANSFORM  stTransform;
+    orxVECTOR           vPosition, vScale;
+    orxFLOAT           *afResX, *afResY, fTime, fScalarTime;
+    orxU32              i, j;
+    orxS32              s32HitDelta = 0;
+
+    /* Gets definitions */
+    stDef.afPositionX = afBuffer;
+    stDef.afPositionY = afBuffer + u32BatchSize;
+    stDef.afPositionZ = afBuffer + (2 * u32BatchSize);
+    stDef.afPivotX    = afBuffer + (3 * u32BatchSize);
+    stDef.afPivotY    = afBuffer + (4 * u32BatchSize);
+    stDef.afSizeX     = afBuffer + (5 * u32BatchSize);
+    stDef.afSizeY     = afBuffer + (6 * u32BatchSize);
+    stDef.afSizeZ     = afBuffer + (7 * u32BatchSize);
+    stDef.afAngle     = afBuffer + (8 * u32BatchSize);
+
+    /* Gets boxes */
+    stBox.afOriginX   = afBuffer + (9 * u32BatchSize);
+    stBox.afOriginY   = afBuffer + (10 * u32BatchSize);
+    stBox.afXX        = afBuffer + (11 * u32BatchSize);
+    stBox.afXY        = afBuffer + (12 * u32BatchSize);
+    stBox.afYX        = afBuffer + (13 * u32BatchSize);
+    stBox.afYY        = afBuffer + (14 * u32BatchSize);
+    stBox.afZ         = afBuffer + (15 * u32BatchSize);
+    stBox.afDepth     = afBuffer + (16 * u32BatchSize);
+
+    /* Gets transform results */
+    afResX            = afBuffer + (17 * u32BatchSize);
+    afResY            = afBuffer + (18 * u32BatchSize);
+
+    /* Inits random data */
+    orxMath_InitRandom(sstBench.u32Seed);
+    for(i = 0; i < u32BatchSize; i++)
+    {
+      afBuffer[i]                       = orxMath_GetRandomFloat(orx2F(-1000.0f), orx2F(1000.0f));
+      afBuffer[i + u32BatchSize]        = orxMath_GetRandomFloat(orx2F(-1000.0f), orx2F(1000.0f));
+      afBuffer[i + (2 * u32BatchSize)]  = orxMath_GetRandomFloat(orxFLOAT_0, orx2F(10.0f));
+      afBuffer[i + (3 * u32BatchSize)]  = orxMath_GetRandomFloat(orxFLOAT_0, orx2F(32.0f));
+      afBuffer[i + (4 * u32BatchSize)]  = orxMath_GetRandomFloat(orxFLOAT_0, orx2F(32.0f));
+      afBuffer[i + (5 * u32BatchSize)]  = orxMath_GetRandomFloat(orx2F(8.0f), orx2F(64.0f));
+      afBuffer[i + (6 * u32BatchSize)]  = orxMath_GetRandomFloat(orx2F(8.0f), orx2F(64.0f));
+      afBuffer[i + (7 * u32BatchSize)]  = orxFLOAT_1;
+      afBuffer[i + (8 * u32BatchSize)]  = orxMath_GetRandomFloat(orxFLOAT_0, orxMATH_KF_2_PI);
+    }
+
+    /* Writes header */
+    orxFile_Print(sstBench.pstFile, "  \"math\":\n  {\n    \"instruction_set\": \"%s\",\n    \"batch_size\": %lu,\n    \"loops\": %lu,\n    \"kernels\":\n    [", orxBatch_GetInstructionSet(), u32BatchSize, u32LoopNumber);
+
+    /* Oriented box set, scalar */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      for(i = 0; i < u32BatchSize; i++)
+      {
+        orxVECTOR vPivot, vSize;
+
+        orxVector_Set(&vPosition, stDef.afPositionX[i], stDef.afPositionY[i], stDef.afPositionZ[i]);
+        orxVector_Set(&vPivot, stDef.afPivotX[i], stDef.afPivotY[i], orxFLOAT_0);
+        orxVector_Set(&vSize, stDef.afSizeX[i], stDef.afSizeY[i], stDef.afSizeZ[i]);
+        orxOBox_2DSet(&(astBox[i]), &vPosition, &vPivot, &vSize, stDef.afAngle[i]);
+      }
+    }
+    fScalarTime = orxSystem_GetTime() - fTime;
+
+    /* Oriented box set, batch */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      orxBatch_2DSetOBox(&stBox, &stDef, u32BatchSize);
+    }
+    orxBench_WriteMathResult("obox_set", fScalarTime, orxSystem_GetTime() - fTime, orxTRUE);
+
+    /* Oriented box intersection, scalar */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      for(i = 0; i < u32BatchSize; i++)
+      {
+        s32HitDelta += (orxOBox_2DTestIntersection(&(astBox[i]), &(astBox[j % u32BatchSize])) != orxFALSE) ? 1 : 0;
+      }
+    }
+    fScalarTime = orxSystem_GetTime() - fTime;
+
+    /* Oriented box intersection, batch */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      s32HitDelta -= (orxS32)orxBatch_2DTestOBoxIntersection(&stBox, u32BatchSize, &(astBox[j % u32BatchSize]), au8Result);
+    }
+    orxBench_WriteMathResult("obox_intersection", fScalarTime, orxSystem_GetTime() - fTime, orxFALSE);
+
+    /* Inside oriented box, scalar */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      orxVector_Set(&vPosition, stDef.afPositionX[j % u32BatchSize], stDef.afPositionY[j % u32BatchSize], orxFLOAT_0);
+      for(i = 0; i < u32BatchSize; i++)
+      {
+        s32HitDelta += (orxOBox_2DIsInside(&(astBox[i]), &vPosition) != orxFALSE) ? 1 : 0;
+      }
+    }
+    fScalarTime = orxSystem_GetTime() - fTime;
+
+    /* Inside oriented box, batch */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      orxVector_Set(&vPosition, stDef.afPositionX[j % u32BatchSize], stDef.afPositionY[j % u32BatchSize], orxFLOAT_0);
+      s32HitDelta -= (orxS32)orxBatch_2DIsInsideOBox(&stBox, u32BatchSize, &vPosition, au8Result);
+    }
+    orxBench_WriteMathResult("obox_inside", fScalarTime, orxSystem_GetTime() - fTime, orxFALSE);
+
+    /* Circle intersection, scalar */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      orxVector_Set(&vPosition, stDef.afPositionX[j % u32BatchSize], stDef.afPositionY[j % u32BatchSize], orxFLOAT_0);
+      for(i = 0; i < u32BatchSize; i++)
+      {
+        orxVECTOR vDist;
+
+        orxVector_Set(&vDist, stDef.afPositionX[i] - vPosition.fX, stDef.afPositionY[i] - vPosition.fY, orxFLOAT_0);
+        s32HitDelta += (orxVector_GetSquareSize(&vDist) <= (stDef.afSizeX[i] + orx2F(100.0f)) * (stDef.afSizeX[i] + orx2F(100.0f))) ? 1 : 0;
+      }
+    }
+    fScalarTime = orxSystem_GetTime() - fTime;
+
+    /* Circle intersection, batch */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      orxVector_Set(&vPosition, stDef.afPositionX[j % u32BatchSize], stDef.afPositionY[j % u32BatchSize], orxFLOAT_0);
+      s32HitDelta -= (orxS32)orxBatch_2DTestCircleIntersection(stDef.afPositionX, stDef.afPositionY, stDef.afSizeX, u32BatchSize, &vPosition, orx2F(100.0f), au8Result);
+    }
+    orxBench_WriteMathResult("circle_intersection", fScalarTime, orxSystem_GetTime() - fTime, orxFALSE);
+
+    /* Gets transform */
+    orxVector_Set(&vPosition, orx2F(10.0f), orx2F(20.0f), orxFLOAT_0);
+    orxVector_Set(&vScale, orx2F(2.0f), orx2F(0.5f), orxFLOAT_1);
+    orxBatch_2DSetTransform(&stTransform, &vPosition, orx2F(0.5f), &vScale);
+
+    /* Transform, scalar */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      for(i = 0; i < u32BatchSize; i++)
+      {
+        orxVECTOR vPos;
+
+        orxVector_Set(&vPos, stDef.afPositionX[i], stDef.afPositionY[i], orxFLOAT_0);
+        orxVector_2DRotate(&vPos, orxVector_Mul(&vPos, &vPos, &vScale), orx2F(0.5f));
+        afResX[i] = vPos.fX + vPosition.fX;
+        afResY[i] = vPos.fY + vPosition.fY;
+      }
+    }
+    fScalarTime = orxSystem_GetTime() - fTime;
+
+    /* Transform, batch */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      orxBatch_2DTransform(&stTransform, stDef.afPositionX, stDef.afPositionY, afResX, afResY, u32BatchSize);
+    }
+    orxBench_WriteMathResult("transform", fScalarTime, orxSystem_GetTime() - fTime, orxFALSE);
+
+    /* Writes footer */
+    orxFile_Print(sstBench.pstFile, "\n    ],\n    \"hit_delta\": %ld\n  },\n", s32HitDelta);
+
+    /* Mismatch? */
+    if(s32HitDelta != 0)
+    {
+      /* Logs message */
+      orxLOG("Math kernels: scalar and batch hit counts differ by %ld.", s32HitDelta);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't allocate math buffers for batch size %ld.", u32BatchSize);
+  }
+
+  /* Frees buffers */
+  if(afBuffer != orxNULL)
+  {
+    orxMemory_Free(afBuffer);
+  }
+  if(astBox != orxNULL)
+  {
+    orxMemory_Free(astBox);
+  }
+  if(au8Result != orxNULL)
+  {
+    orxMemory_Free(au8Result);
+  }
+
+  return;
+}
+
+/** Runs full object iteration, storage list versus packed array (needs bench section to be pushed)
+ */
+static void orxFASTCALL orxBench_RunIteration()
+{
+  orxOBJECT **apstObjectList;
+  orxU32      u32Size, u32LoopNumber;
+
+  /* Gets object number & loop number */
+  u32Size       = orxConfig_GetU32(orxBENCH_KZ_CONFIG_ITERATION_SIZE);
+  u32LoopNumber = (orxConfig_HasValue(orxBENCH_KZ_CONFIG_ITERATION_LOOP_NUMBER) != orxFALSE) ? orxConfig_GetU32(orxBENCH_KZ_CONFIG_ITERATION_LOOP_NUMBER) : orxBENCH_KU32_DEFAULT_ITERATION_LOOP;
+
+  /* Allocates object list */
+  apstObjectList = (orxOBJECT **)orxMemory_Allocate(u32Size * sizeof(orxOBJECT *), orxMEMORY_TYPE_MAIN);
+
+  /* Valid? */
+  if((u32Size > 0) && (apstObjectList != orxNULL))
+  {
+    orxSTRUCTURE *const  *apstArray;
+    orxOBJECT            *pstObject;
+    orxFLOAT              fTime, fListTime, fArrayTime;
+    orxU32                u32ListCounter = 0, u32ArrayCounter = 0, u32Number, i, j;
+
+    /* Creates objects */
+    for(i = 0; i < u32Size; i++)
+    {
+      apstObjectList[i] = orxObject_Create();
+    }
+
+    /* Recreates every fourth one to shuffle both storages */
+    for(i = 3; i < u32Size; i += 4)
+    {
+      orxObject_Delete(apstObjectList[i]);
+    }
+    for(i = 3; i < u32Size; i += 4)
+    {
+      apstObjectList[i] = orxObject_Create();
+    }
+
+    /* Disables every other one */
+    for(i = 1; i < u32Size; i += 2)
+    {
+      orxObject_Enable(apstObjectList[i], orxFALSE);
+    }
+
+    /* Storage list */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      for(pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
+          pstObject != orxNULL;
+          pstObject = orxOBJECT(orxStructure_GetNext(pstObject)))
+      {
+        if(orxObject_IsEnabled(pstObject) != orxFALSE)
+        {
+          u32ListCounter++;
+        }
+      }
+    }
+    fListTime = orxSystem_GetTime() - fTime;
+
+    /* Packed array */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      for(apstArray = orxStructure_GetArray(orxSTRUCTURE_ID_OBJECT, &u32Number), i = 0; i < u32Number; i++)
+      {
+        if(orxObject_IsEnabled((orxOBJECT *)apstArray[i]) != orxFALSE)
+        {
+          u32ArrayCounter++;
+        }
+      }
+    }
+    fArrayTime = orxSystem_GetTime() - fTime;
+
+    /* Writes result */
+    orxFile_Print(sstBench.pstFile, "  \"iteration\":\n  {\n    \"objects\": %lu,\n    \"loops\": %lu,\n    \"list_time\": %g,\n    \"array_time\": %g,\n    \"speedup\": %g,\n    \"count_delta\": %ld\n  },\n", orxStructure_GetCounter(orxSTRUCTURE_ID_OBJECT), u32LoopNumber, fListTime, fArrayTime, (fArrayTime > orxFLOAT_0) ? fListTime / fArrayTime : orxFLOAT_0, (orxS32)u32ListCounter - (orxS32)u32ArrayCounter);
+
+    /* Logs it */
+    orxLOG("Object iteration: list %gs, array %gs (x%g).", fListTime, fArrayTime, (fArrayTime > orxFLOAT_0) ? fListTime / fArrayTime : orxFLOAT_0);
+
+    /* Deletes objects */
+    for(i = 0; i < u32Size; i++)
+    {
+      orxObject_Delete(apstObjectList[i]);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't allocate iteration buffer for %ld objects.", u32Size);
+  }
+
+  /* Frees object list */
+  if(apstObjectList != orxNULL)
+  {
+    orxMemory_Free(apstObjectList);
+  }
+
+  return;
+}
+
+
+/** Reference byte-at-a-time CRC32, used to time the string hash and check its stability
+ * @param[in]   _au32Table                    Byte table
+ * @param[in]   _zString                      String to hash
+ * @param[in]   _u32CRC                       Base CRC
+ * @return      CRC32 of the string
+ */
+static orxU32 orxFASTCALL orxBench_ReferenceCRC(const orxU32 *_au32Table, const orxCHAR *_zString, orxU32 _u32CRC)
+{
+  const orxCHAR  *pc;
+  orxU32          u32CRC;
+
+  /* For the whole string */
+  for(pc = _zString, u32CRC = _u32CRC ^ 0xFFFFFFFF; *pc != orxCHAR_NULL; pc++)
+  {
+    /* Computes the CRC */
+    u32CRC = _au32Table[(u32CRC ^ (orxU8)*pc) & 0xFF] ^ (u32CRC >> 8);
+  }
+
+  /* Done! */
+  return u32CRC ^ 0xFFFFFFFF;
+}
+
+/** Runs string hashes on random data, byte-at-a-time reference versus orxString's CRC, in MB/s (needs bench section to be pushed)
+ */
+static void orxFASTCALL orxBench_RunHash()
+{
+  orxCHAR  *acBuffer;
+  orxU32    u32Size, u32LoopNumber;
+
+  /* Gets buffer size & loop number */
+  u32Size       = orxConfig_GetU32(orxBENCH_KZ_CONFIG_HASH_SIZE);
+  u32LoopNumber = (orxConfig_HasValue(orxBENCH_KZ_CONFIG_HASH_LOOP_NUMBER) != orxFALSE) ? orxConfig_GetU32(orxBENCH_KZ_CONFIG_HASH_LOOP_NUMBER) : orxBENCH_KU32_DEFAULT_HASH_LOOP;
+
+  /* Allocates buffer */
+  acBuffer = (orxCHAR *)orxMemory_Allocate(u32Size + 1, orxMEMORY_TYPE_MAIN);
+
+  /* Valid? */
+  if((u32Size > 0) && (acBuffer != orxNULL))
+  {
+    orxU32    au32Table[256];
+    orxFLOAT  fTime, fReferenceTime, fHashTime, fKeyTime, fMegaBytes, fKeyMegaBytes;
+    orxU32    u32ReferenceCRC = 0, u32CRC = 0, u32KeyCRC = 0, i, j;
+
+    /* Builds reference table */
+    for(i = 0; i < 256; i++)
+    {
+      for(j = 0, au32Table[i] = i; j < 8; j++)
+      {
+        au32Table[i] = (au32Table[i] & 1) ? (au32Table[i] >> 1) ^ 0xEDB88320 : au32Table[i] >> 1;
+      }
+    }
+
+    /* Fills buffer with random printable characters */
+    orxMath_InitRandom(sstBench.u32Seed);
+    for(i = 0; i < u32Size; i++)
+    {
+      acBuffer[i] = (orxCHAR)orxMath_GetRandomU32(0x21, 0x7E);
+    }
+    acBuffer[u32Size] = orxCHAR_NULL;
+
+    /* Reference (chained so that no pass can be skipped) */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      u32ReferenceCRC = orxBench_ReferenceCRC(au32Table, acBuffer, u32ReferenceCRC);
+    }
+    fReferenceTime = orxSystem_GetTime() - fTime;
+
+    /* Whole buffer */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      u32CRC = orxString_ContinueCRC(acBuffer, u32CRC);
+    }
+    fHashTime = orxSystem_GetTime() - fTime;
+
+    /* Short keys */
+    for(j = 0, fTime = orxSystem_GetTime(); j < u32LoopNumber; j++)
+    {
+      for(i = 0; i + orxBENCH_KU32_HASH_KEY_LENGTH <= u32Size; i += orxBENCH_KU32_HASH_KEY_LENGTH)
+      {
+        u32KeyCRC = orxString_NContinueCRC(acBuffer + i, u32KeyCRC, orxBENCH_KU32_HASH_KEY_LENGTH);
+      }
+    }
+    fKeyTime = orxSystem_GetTime() - fTime;
+
+    /* Gets processed sizes */
+    fMegaBytes    = orxU2F(u32Size) * orxU2F(u32LoopNumber) / orx2F(1024.0f * 1024.0f);
+    fKeyMegaBytes = orxU2F(u32Size - (u32Size % orxBENCH_KU32_HASH_KEY_LENGTH)) * orxU2F(u32LoopNumber) / orx2F(1024.0f * 1024.0f);
+
+    /* Writes result */
+    orxFile_Print(sstBench.pstFile, "  \"hash\":\n  {\n    \"implementation\": \"%s\",\n    \"size\": %lu,\n    \"loops\": %lu,\n    \"reference_mbps\": %g,\n    \"mbps\": %g,\n    \"key_mbps\": %g,\n    \"speedup\": %g,\n    \"match\": %s\n  },\n",
+                  orxString_GetCRCImplementation(), u32Size, u32LoopNumber,
+                  (fReferenceTime > orxFLOAT_0) ? fMegaBytes / fReferenceTime : orxFLOAT_0,
+                  (fHashTime > orxFLOAT_0) ? fMegaBytes / fHashTime : orxFLOAT_0,
+                  (fKeyTime > orxFLOAT_0) ? fKeyMegaBytes / fKeyTime : orxFLOAT_0,
+                  (fHashTime > orxFLOAT_0) ? fReferenceTime / fHashTime : orxFLOAT_0,
+                  (u32CRC == u32ReferenceCRC) ? "true" : "false");
+
+    /* Logs it */
+    orxLOG("String hash <%s>: reference %gMB/s, hash %gMB/s, keys %gMB/s (x%g).", orxString_GetCRCImplementation(), (fReferenceTime > orxFLOAT_0) ? fMegaBytes / fReferenceTime : orxFLOAT_0, (fHashTime > orxFLOAT_0) ? fMegaBytes / fHashTime : orxFLOAT_0, (fKeyTime > orxFLOAT_0) ? fKeyMegaBytes / fKeyTime : orxFLOAT_0, (fHashTime > orxFLOAT_0) ? fReferenceTime / fHashTime : orxFLOAT_0);
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't allocate hash buffer of %ld bytes.", u32Size);
+  }
+
+  /* Frees buffer */
+  if(acBuffer != orxNULL)
+  {
+    orxMemory_Free(acBuffer);
+  }
+
+  return;
+}
+
+/** Writes startup times then runs microbenchmarks, after all modules (this one included) have been initialized
+ */
+static void orxFASTCALL orxBench_RunStartup()
+{
+  /* Pushes bench section */
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_SECTION);
+
+  /* Writes startup times */
+  orxBench_WriteStartup();
+
+  /* Has math batch size? */
+  if(orxConfig_HasValue(orxBENCH_KZ_CONFIG_MATH_BATCH_SIZE) != orxFALSE)
+  {
+    /* Runs math kernels */
+    orxBench_RunMath();
+  }
+
+  /* Has iteration size? */
+  if(orxConfig_HasValue(orxBENCH_KZ_CONFIG_ITERATION_SIZE) != orxFALSE)
+  {
+    /* Runs object iteration */
+    orxBench_RunIteration();
+  }
+
+  /* Has hash size? */
+  if(orxConfig_HasValue(orxBENCH_KZ_CONFIG_HASH_SIZE) != orxFALSE)
+  {
+    /* Runs string hashes */
+    orxBench_RunHash();
+  }
+
+  /* Writes scenario header */
+  orxFile_Print(sstBench.pstFile, "  \"scenarios\":\n  [\n");
+
+  /* Pops section */
+  orxConfig_PopSection();
+
+  return;
+}
+
+
+/***************************************************************************
+ * Public functions                                                        *
+ ***************************************************************************/
+
+/** Inits the bench module
+ */
+orxSTATUS orxFASTCALL orxBench_Init()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Not already initialized? */
+  if(!orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_READY))
+  {
+    orxSTRING zOutput;
+
+    /* Cleans static controller */
+    orxMemory_Zero(&sstBench, sizeof(orxBENCH_STATIC));
+
+    /* Pushes bench section */
+    orxConfig_PushSection(orxBENCH_KZ_CONFIG_SECTION);
+
+    /* Gets scenario counter & seed */
+    sstBench.s32ScenarioCounter = orxConfig_GetListCounter(orxBENCH_KZ_CONFIG_SCENARIO_LIST);
+    sstBench.u32Seed            = (orxConfig_HasValue(orxBENCH_KZ_CONFIG_SEED) != orxFALSE) ? orxConfig_GetU32(orxBENCH_KZ_CONFIG_SEED) : orxBENCH_KU32_DEFAULT_SEED;
+
+    /* Opens output file */
+    zOutput           = (orxConfig_HasValue(orxBENCH_KZ_CONFIG_OUTPUT) != orxFALSE) ? orxConfig_GetString(orxBENCH_KZ_CONFIG_OUTPUT) : orxBENCH_KZ_DEFAULT_OUTPUT;
+    sstBench.pstFile  = orxFile_Open(zOutput, orxFILE_KU32_FLAG_OPEN_WRITE);
+
+    /* Valid? */
+    if(sstBench.pstFile != orxNULL)
+    {
+      /* Has viewport? */
+      if(orxConfig_HasValue(orxBENCH_KZ_CONFIG_VIEWPORT) != orxFALSE)
+      {
+        /* Creates it */
+        sstBench.pstViewport = orxViewport_CreateFromConfig(orxConfig_GetString(orxBENCH_KZ_CONFIG_VIEWPORT));
+      }
+
+      /* Registers custom system event handler */
+      eResult = orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, orxBench_EventHandler);
+
+      /* Valid? */
+      if(eResult != orxSTATUS_FAILURE)
+      {
+        /* Profiles all clock callbacks & counts allocations */
+        orxClock_EnableProfiler(orxTRUE);
+        orxMemory_EnableStats(orxTRUE);
+
+        /* Writes header */
+        orxFile_Print(sstBench.pstFile, "{\n");
+
+        /* Updates status (startup times & microbenchmarks are written on first run, once this module's init has been timed too) */
+        orxFLAG_SET(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_READY | orxBENCH_KU32_STATIC_FLAG_FIRST | orxBENCH_KU32_STATIC_FLAG_STARTUP, orxBENCH_KU32_STATIC_MASK_ALL);
+      }
+      else
+      {
+        /* Closes output file */
+        orxFile_Close(sstBench.pstFile);
+        sstBench.pstFile = orxNULL;
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't open bench output file <%s>.", zOutput);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+
+    /* Pops section */
+    orxConfig_PopSection();
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Attempted to initialize Bench module when already loaded.");
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Exits from bench module
+ */
+void orxFASTCALL orxBench_Exit()
+{
+  /* Module initialized ? */
+  if(orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_READY))
+  {
+    /* Removes event handler */
+    orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, orxBench_EventHandler);
+
+    /* Stops profiling */
+    orxClock_EnableProfiler(orxFALSE);
+
+    /* Logs memory & bank statistics */
+    orxMemory_LogStats();
+    orxBank_LogStats();
+
+    /* Stops counting allocations */
+    orxMemory_EnableStats(orxFALSE);
+
+    /* Writes footer */
+    orxFile_Print(sstBench.pstFile, "\n  ]\n}\n");
+
+    /* Closes output file */
+    orxFile_Close(sstBench.pstFile);
+
+    /* Has viewport? */
+    if(sstBench.pstViewport != orxNULL)
+    {
+      /* Deletes it */
+      orxViewport_Delete(sstBench.pstViewport);
+    }
+
+    /* Cleans static controller */
+    orxMemory_Zero(&sstBench, sizeof(orxBENCH_STATIC));
+  }
+
+  /* Done */
+  return;
+}
+
+/** Runs the bench: called once per frame, before the clock update
+ */
+orxSTATUS orxFASTCALL orxBench_Run()
+{
+  orxSTATUS eResult;
+
+  /* First run? */
+  if(orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_STARTUP))
+  {
+    /* Runs startup benches */
+    orxBench_RunStartup();
+
+    /* Updates status */
+    orxFLAG_SET(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_NONE, orxBENCH_KU32_STATIC_FLAG_STARTUP);
+  }
+
+  /* Is a scenario running? */
+  if(orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_RUNNING))
+  {
+    orxFLOAT fTime;
+
+    /* Updates longest frame */
+    fTime                   = orxSystem_GetTime();
+    sstBench.fMaxFrameTime  = orxMAX(sstBench.fMaxFrameTime, fTime - sstBench.fFrameTime);
+    sstBench.fFrameTime     = fTime;
+
+    /* Should switch language? */
+    if((sstBench.u32LanguageSwitch != 0) && (((sstBench.u32Frame + 1) % sstBench.u32LanguageSwitch) == 0) && (orxLocale_GetLanguageCounter() > 0))
+    {
+      /* Selects next one */
+      orxLocale_SelectLanguage(orxLocale_GetLanguage(((sstBench.u32Frame + 1) / sstBench.u32LanguageSwitch) % orxLocale_GetLanguageCounter()));
+    }
+
+    /* Last frame? */
+    if(++sstBench.u32Frame >= sstBench.u32FrameNumber)
+    {
+      /* Stops it */
+      orxConfig_PushSection(orxBENCH_KZ_CONFIG_SECTION);
+      orxBench_StopScenario(orxConfig_GetListString(orxBENCH_KZ_CONFIG_SCENARIO_LIST, sstBench.s32ScenarioIndex));
+      orxConfig_PopSection();
+
+      /* Goes to next scenario */
+      sstBench.s32ScenarioIndex++;
+    }
+    else
+    {
+      /* Should update texts? */
+      if(orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_TEXT))
+      {
+        /* Updates them */
+        orxBench_UpdateTexts();
+      }
+
+      /* Should scroll? */
+      if(orxVector_IsNull(&(sstBench.vCameraSpeed)) == orxFALSE)
+      {
+        /* Scrolls camera */
+        orxBench_ScrollCamera();
+      }
+    }
+  }
+
+  /* No scenario running? */
+  if(!orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_RUNNING))
+  {
+    /* Has remaining scenario? */
+    if(sstBench.s32ScenarioIndex < sstBench.s32ScenarioCounter)
+    {
+      /* Starts it */
+      orxConfig_PushSection(orxBENCH_KZ_CONFIG_SECTION);
+      orxBench_StartScenario(orxConfig_GetListString(orxBENCH_KZ_CONFIG_SCENARIO_LIST, sstBench.s32ScenarioIndex));
+      orxConfig_PopSection();
+    }
+    else
+    {
+      /* Done with all scenarios */
+      orxFLAG_SET(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_EXIT, orxBENCH_KU32_STATIC_FLAG_NONE);
+    }
+  }
+
+  /* Updates result */
+  eResult = (orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_EXIT)) ? orxSTATUS_FAILURE : orxSTATUS_SUCCESS;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Main entry point
+ * @param[in] argc                            Number of parameters
+ * @param[in] argv                            List of parameters
+ * @return    EXIT_SUCCESS / EXIT_FAILURE
+ */
+int main(int argc, char **argv)
+{
+  /* Executes orx */
+  orx_Execute(argc, argv, orxBench_Init, orxBench_Run, orxBench_Exit);
+
+  /* Done! */
+  return EXIT_SUCCESS;
+}
@@ -46,6 +46,7 @@
  */
 #define orxMAIN_KZ_CONFIG_SECTION       "Main"      /**< Main config section */
 #define orxMAIN_KZ_CONFIG_GAME_FILE     "GameFile"  /**< Game file config key */
+#define orxMAIN_KZ_CONFIG_MEMORY_DUMP   "MemoryDumpPeriod" /**< Memory dump period config key */
 
 
 /***************************************************************************
@@ -107,6 +108,20 @@ static orxSTATUS orxFASTCALL orxMain_EventHandler(const orxEVENT *_pstEvent)
   return eResult;
 }
 
+/** Dumps memory statistics
+ * @param[in]   _pstClockInfo                 Clock info of the clock used upon registration
+ * @param[in]   _pContext                     Context sent when registering callback to the clock
+ */
+static void orxFASTCALL orxMain_DumpMemory(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  /* Logs memory & bank statistics */
+  orxMemory_LogStats();
+  orxBank_LogStats();
+
+  /* Done! */
+  return;
+}
+
 /** Inits the main module
  */
 orxSTATUS orxFASTCALL orxMain_Init()
@@ -140,6 +155,16 @@ orxSTATUS orxFASTCALL orxMain_Init()
         eResult = (orxPlugin_LoadUsingExt(zGameFileName, zGameFileName) != orxHANDLE_UNDEFINED) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
       }
 
+      /* Has memory dump period? */
+      if(orxConfig_GetFloat(orxMAIN_KZ_CONFIG_MEMORY_DUMP) > orxFLOAT_0)
+      {
+        /* Enables memory statistics */
+        orxMemory_EnableStats(orxTRUE);
+
+        /* Adds memory dump timer */
+        orxClock_AddGlobalTimer(orxMain_DumpMemory, orxConfig_GetFloat(orxMAIN_KZ_CONFIG_MEMORY_DUMP), -1, orxNULL);
+      }
+
       /* Successful? */
       if(eResult != orxSTATUS_FAILURE)
       {
@@ -168,6 +193,9 @@ void orxFASTCALL orxMain_Exit()
     /* Removes event handler */
     orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, orxMain_EventHandler);
 
+    /* Removes memory dump timer */
+    orxClock_RemoveGlobalTimer(orxMain_DumpMemory, orx2F(-1.0f));
+
     /* Sets module as not ready */
     orxFLAG_SET(sstMain.u32Flags, orxMAIN_KU32_STATIC_FLAG_NONE, orxMAIN_KU32_STATIC_FLAG_READY);
   }
@@ -185,7 +213,7 @@ orxSTATUS orxFASTCALL orxMain_Run()
   /* Is keyboard module initialized? */
   if(orxModule_IsInitialized(orxMODULE_ID_KEYBOARD) != orxFALSE)
   {
-    static orxBOOL sbBackSpacePressed = 0, sbF11Pressed = 0, sbF12Pressed = 0;
+    static orxBOOL sbBackSpacePressed = 0, sbF10Pressed = 0, sbF11Pressed = 0, sbF12Pressed = 0;
 
     /* Is escape pressed? */
     if(orxKeyboard_IsKeyPressed(orxKEYBOARD_KEY_ESCAPE) != orxFALSE)
@@ -217,6 +245,29 @@ orxSTATUS orxFASTCALL orxMain_Run()
       }
     }
 
+    /* Was F10 pressed? */
+    if(sbF10Pressed != orxFALSE)
+    {
+      /* No longer pressed? */
+      if(orxKeyboard_IsKeyPressed(orxKEYBOARD_KEY_F10) == orxFALSE)
+      {
+        /* Updates key status */
+        sbF10Pressed = orxFALSE;
+      }
+    }
+    else
+    {
+      /* Is F10 pressed? */
+      if(orxKeyboard_IsKeyPressed(orxKEYBOARD_KEY_F10) != orxFALSE)
+      {
+        /* Dumps memory statistics */
+        orxMain_DumpMemory(orxNULL, orxNULL);
+
+        /* Updates key status */
+        sbF10Pressed = orxTRUE;
+      }
+    }
+
     /* Is display module initialized? */
     if(orxModule_IsInitialized(orxMODULE_ID_DISPLAY) != orxFALSE)
     {
@@ -0,0 +1,695 @@
+/* Orx - Portable Game Engine
+ *
+ * Orx is the legal property of its developers, whose names
+ * are listed in the COPYRIGHT file distributed
+ * with this source distribution.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file orxBatch.c
+ * @date 19/10/2026
+ * @author iarwain@orx-project.org
+ *
+ */
+
+
+#include "math/orxBatch.h"
+
+
+/** Instruction set selection: every kernel runs its wide loop on orxBATCH_KU32_WIDTH floats at once
+ * then finishes the remaining elements with the scalar loop (which is the only one used if no SIMD is available)
+ */
+#if defined(__AVX__)
+
+  #include <immintrin.h>
+
+  #define orxBATCH_KZ_INSTRUCTION_SET   "avx"
+  #define orxBATCH_KU32_WIDTH           8
+
+  typedef __m256                        orxBATCH_VEC;
+
+  #define orxBATCH_LOAD(P)              _mm256_loadu_ps(P)
+  #define orxBATCH_STORE(P, V)          _mm256_storeu_ps(P, V)
+  #define orxBATCH_SET(F)               _mm256_set1_ps(F)
+  #define orxBATCH_ADD(A, B)            _mm256_add_ps(A, B)
+  #define orxBATCH_SUB(A, B)            _mm256_sub_ps(A, B)
+  #define orxBATCH_MUL(A, B)            _mm256_mul_ps(A, B)
+  #define orxBATCH_MIN(A, B)            _mm256_min_ps(A, B)
+  #define orxBATCH_MAX(A, B)            _mm256_max_ps(A, B)
+  #define orxBATCH_CMPLE(A, B)          _mm256_cmp_ps(A, B, _CMP_LE_OQ)
+  #define orxBATCH_AND(A, B)            _mm256_and_ps(A, B)
+  #define orxBATCH_GET_MASK(V)          ((orxU32)_mm256_movemask_ps(V))
+
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+
+  #include <xmmintrin.h>
+
+  #define orxBATCH_KZ_INSTRUCTION_SET   "sse"
+  #define orxBATCH_KU32_WIDTH           4
+
+  typedef __m128                        orxBATCH_VEC;
+
+  #define orxBATCH_LOAD(P)              _mm_loadu_ps(P)
+  #define orxBATCH_STORE(P, V)          _mm_storeu_ps(P, V)
+  #define orxBATCH_SET(F)               _mm_set1_ps(F)
+  #define orxBATCH_ADD(A, B)            _mm_add_ps(A, B)
+  #define orxBATCH_SUB(A, B)            _mm_sub_ps(A, B)
+  #define orxBATCH_MUL(A, B)            _mm_mul_ps(A, B)
+  #define orxBATCH_MIN(A, B)            _mm_min_ps(A, B)
+  #define orxBATCH_MAX(A, B)            _mm_max_ps(A, B)
+  #define orxBATCH_CMPLE(A, B)          _mm_cmple_ps(A, B)
+  #define orxBATCH_AND(A, B)            _mm_and_ps(A, B)
+  #define orxBATCH_GET_MASK(V)          ((orxU32)_mm_movemask_ps(V))
+
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+  #include <arm_neon.h>
+
+  #define orxBATCH_KZ_INSTRUCTION_SET   "neon"
+  #define orxBATCH_KU32_WIDTH           4
+
+  typedef float32x4_t                   orxBATCH_VEC;
+
+  #define orxBATCH_LOAD(P)              vld1q_f32(P)
+  #define orxBATCH_STORE(P, V)          vst1q_f32(P, V)
+  #define orxBATCH_SET(F)               vdupq_n_f32(F)
+  #define orxBATCH_ADD(A, B)            vaddq_f32(A, B)
+  #define orxBATCH_SUB(A, B)            vsubq_f32(A, B)
+  #define orxBATCH_MUL(A, B)            vmulq_f32(A, B)
+  #define orxBATCH_MIN(A, B)            vminq_f32(A, B)
+  #define orxBATCH_MAX(A, B)            vmaxq_f32(A, B)
+  #define orxBATCH_CMPLE(A, B)          vreinterpretq_f32_u32(vcleq_f32(A, B))
+  #define orxBATCH_AND(A, B)            vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(A), vreinterpretq_u32_f32(B)))
+  #define orxBATCH_GET_MASK(V)          orxBatch_NEON_GetMask(V)
+
+  /** Gets sign bits of all lanes (NEON has no movemask)
+   */
+  static orxINLINE orxU32 orxBatch_NEON_GetMask(orxBATCH_VEC _vOp)
+  {
+    uint32x4_t vBits;
+
+    /* Gets sign bits */
+    vBits = vshrq_n_u32(vreinterpretq_u32_f32(_vOp), 31);
+
+    /* Done! */
+    return (orxU32)(vgetq_lane_u32(vBits, 0) | (vgetq_lane_u32(vBits, 1) << 1) | (vgetq_lane_u32(vBits, 2) << 2) | (vgetq_lane_u32(vBits, 3) << 3));
+  }
+
+#else
+
+  #define orxBATCH_KZ_INSTRUCTION_SET   "scalar"
+  #define orxBATCH_KU32_WIDTH           1
+
+#endif
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+#if (orxBATCH_KU32_WIDTH > 1)
+
+/** Stores a wide mask as bytes
+ * @param[in]   _u32Mask                      Lane mask
+ * @param[out]  _au8Result                    Result bytes
+ * @return      Number of set lanes
+ */
+static orxINLINE orxU32 orxBatch_StoreMask(orxU32 _u32Mask, orxU8 *_au8Result)
+{
+  orxU32 i, u32Result = 0;
+
+  /* For all lanes */
+  for(i = 0; i < orxBATCH_KU32_WIDTH; i++)
+  {
+    /* Stores it */
+    _au8Result[i] = (orxU8)((_u32Mask >> i) & 1);
+
+    /* Updates result */
+    u32Result += _au8Result[i];
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Tests if [_vMin, _vMax] overlaps [0, _vLimit]
+ */
+static orxINLINE orxBATCH_VEC orxBatch_TestRange(orxBATCH_VEC _vMin, orxBATCH_VEC _vMax, orxBATCH_VEC _vLimit)
+{
+  /* Done! */
+  return orxBATCH_AND(orxBATCH_CMPLE(orxBATCH_SET(orxFLOAT_0), _vMax), orxBATCH_CMPLE(_vMin, _vLimit));
+}
+
+#endif /* orxBATCH_KU32_WIDTH > 1 */
+
+
+/***************************************************************************
+ * Public functions                                                        *
+ ***************************************************************************/
+
+/** Gets the name of the instruction set used by the kernels
+ * @return      "avx", "sse", "neon" or "scalar"
+ */
+const orxSTRING orxFASTCALL orxBatch_GetInstructionSet()
+{
+  /* Done! */
+  return orxBATCH_KZ_INSTRUCTION_SET;
+}
+
+/** Transforms 2D positions
+ * @param[in]   _pstTransform                 Transform to apply
+ * @param[in]   _afX                          Positions, X
+ * @param[in]   _afY                          Positions, Y
+ * @param[out]  _afResX                       Transformed positions, X
+ * @param[out]  _afResY                       Transformed positions, Y
+ * @param[in]   _u32Number                    Number of positions
+ */
+void orxFASTCALL orxBatch_2DTransform(const orxBATCH_TRANSFORM *_pstTransform, const orxFLOAT *_afX, const orxFLOAT *_afY, orxFLOAT *_afResX, orxFLOAT *_afResY, orxU32 _u32Number)
+{
+  orxU32 i = 0;
+
+  /* Checks */
+  orxASSERT(_pstTransform != orxNULL);
+  orxASSERT((_u32Number == 0) || ((_afX != orxNULL) && (_afY != orxNULL)));
+  orxASSERT((_u32Number == 0) || ((_afResX != orxNULL) && (_afResY != orxNULL)));
+
+#if (orxBATCH_KU32_WIDTH > 1)
+
+  {
+    orxBATCH_VEC vXX, vXY, vTX, vYX, vYY, vTY;
+
+    /* Gets matrix */
+    vXX = orxBATCH_SET(_pstTransform->fXX);
+    vXY = orxBATCH_SET(_pstTransform->fXY);
+    vTX = orxBATCH_SET(_pstTransform->fTX);
+    vYX = orxBATCH_SET(_pstTransform->fYX);
+    vYY = orxBATCH_SET(_pstTransform->fYY);
+    vTY = orxBATCH_SET(_pstTransform->fTY);
+
+    /* For all full packs */
+    for(; i + orxBATCH_KU32_WIDTH <= _u32Number; i += orxBATCH_KU32_WIDTH)
+    {
+      orxBATCH_VEC vX, vY;
+
+      /* Loads positions */
+      vX = orxBATCH_LOAD(_afX + i);
+      vY = orxBATCH_LOAD(_afY + i);
+
+      /* Stores transformed ones */
+      orxBATCH_STORE(_afResX + i, orxBATCH_ADD(orxBATCH_ADD(orxBATCH_MUL(vXX, vX), orxBATCH_MUL(vXY, vY)), vTX));
+      orxBATCH_STORE(_afResY + i, orxBATCH_ADD(orxBATCH_ADD(orxBATCH_MUL(vYX, vX), orxBATCH_MUL(vYY, vY)), vTY));
+    }
+  }
+
+#endif /* orxBATCH_KU32_WIDTH > 1 */
+
+  /* For all remaining positions */
+  for(; i < _u32Number; i++)
+  {
+    orxFLOAT fX, fY;
+
+    /* Loads position */
+    fX = _afX[i];
+    fY = _afY[i];
+
+    /* Stores transformed one */
+    _afResX[i] = (_pstTransform->fXX * fX) + (_pstTransform->fXY * fY) + _pstTransform->fTX;
+    _afResY[i] = (_pstTransform->fYX * fX) + (_pstTransform->fYY * fY) + _pstTransform->fTY;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Sets 2D oriented boxes, same as calling orxOBox_2DSet on each of them
+ * @param[out]  _pstRes                       Boxes to set
+ * @param[in]   _pstDef                       Box definitions
+ * @param[in]   _u32Number                    Number of boxes
+ */
+void orxFASTCALL orxBatch_2DSetOBox(const orxBATCH_OBOX *_pstRes, const orxBATCH_OBOX_DEF *_pstDef, orxU32 _u32Number)
+{
+  orxU32 i;
+
+  /* Checks */
+  orxASSERT(_pstRes != orxNULL);
+  orxASSERT(_pstDef != orxNULL);
+
+  /* Has angles? */
+  if(_pstDef->afAngle != orxNULL)
+  {
+    /* For all boxes */
+    for(i = 0; i < _u32Number; i++)
+    {
+      /* Stores cosine and sine in X axis (trigonometry stays scalar) */
+      _pstRes->afXX[i] = orxMath_Cos(_pstDef->afAngle[i]);
+      _pstRes->afXY[i] = orxMath_Sin(_pstDef->afAngle[i]);
+    }
+  }
+  else
+  {
+    /* For all boxes */
+    for(i = 0; i < _u32Number; i++)
+    {
+      /* Stores identity rotation */
+      _pstRes->afXX[i] = orxFLOAT_1;
+      _pstRes->afXY[i] = orxFLOAT_0;
+    }
+  }
+
+  /* Starts with first box */
+  i = 0;
+
+#if (orxBATCH_KU32_WIDTH > 1)
+
+  /* For all full packs */
+  for(; i + orxBATCH_KU32_WIDTH <= _u32Number; i += orxBATCH_KU32_WIDTH)
+  {
+    orxBATCH_VEC vCos, vSin, vSizeX, vSizeY, vPivotX, vPivotY;
+
+    /* Loads values */
+    vCos    = orxBATCH_LOAD(_pstRes->afXX + i);
+    vSin    = orxBATCH_LOAD(_pstRes->afXY + i);
+    vSizeX  = orxBATCH_LOAD(_pstDef->afSizeX + i);
+    vSizeY  = orxBATCH_LOAD(_pstDef->afSizeY + i);
+    vPivotX = orxBATCH_LOAD(_pstDef->afPivotX + i);
+    vPivotY = orxBATCH_LOAD(_pstDef->afPivotY + i);
+
+    /* Sets axis */
+    orxBATCH_STORE(_pstRes->afXX + i, orxBATCH_MUL(vCos, vSizeX));
+    orxBATCH_STORE(_pstRes->afXY + i, orxBATCH_MUL(vSin, vSizeX));
+    orxBATCH_STORE(_pstRes->afYX + i, orxBATCH_MUL(orxBATCH_SUB(orxBATCH_SET(orxFLOAT_0), vSin), vSizeY));
+    orxBATCH_STORE(_pstRes->afYY + i, orxBATCH_MUL(vCos, vSizeY));
+
+    /* Sets origin (position - rotated pivot) */
+    orxBATCH_STORE(_pstRes->afOriginX + i, orxBATCH_SUB(orxBATCH_LOAD(_pstDef->afPositionX + i), orxBATCH_SUB(orxBATCH_MUL(vCos, vPivotX), orxBATCH_MUL(vSin, vPivotY))));
+    orxBATCH_STORE(_pstRes->afOriginY + i, orxBATCH_SUB(orxBATCH_LOAD(_pstDef->afPositionY + i), orxBATCH_ADD(orxBATCH_MUL(vSin, vPivotX), orxBATCH_MUL(vCos, vPivotY))));
+
+    /* Sets Z */
+    orxBATCH_STORE(_pstRes->afZ + i, orxBATCH_LOAD(_pstDef->afPositionZ + i));
+    orxBATCH_STORE(_pstRes->afDepth + i, orxBATCH_LOAD(_pstDef->afSizeZ + i));
+  }
+
+#endif /* orxBATCH_KU32_WIDTH > 1 */
+
+  /* For all remaining boxes */
+  for(; i < _u32Number; i++)
+  {
+    orxFLOAT fCos, fSin;
+
+    /* Gets cosine and sine */
+    fCos = _pstRes->afXX[i];
+    fSin = _pstRes->afXY[i];
+
+    /* Sets axis */
+    _pstRes->afXX[i]      = fCos * _pstDef->afSizeX[i];
+    _pstRes->afXY[i]      = fSin * _pstDef->afSizeX[i];
+    _pstRes->afYX[i]      = -fSin * _pstDef->afSizeY[i];
+    _pstRes->afYY[i]      = fCos * _pstDef->afSizeY[i];
+
+    /* Sets origin (position - rotated pivot) */
+    _pstRes->afOriginX[i] = _pstDef->afPositionX[i] - ((fCos * _pstDef->afPivotX[i]) - (fSin * _pstDef->afPivotY[i]));
+    _pstRes->afOriginY[i] = _pstDef->afPositionY[i] - ((fSin * _pstDef->afPivotX[i]) + (fCos * _pstDef->afPivotY[i]));
+
+    /* Sets Z */
+    _pstRes->afZ[i]       = _pstDef->afPositionZ[i];
+    _pstRes->afDepth[i]   = _pstDef->afSizeZ[i];
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Tests 2D oriented boxes against a single one, same as orxOBox_2DTestIntersection
+ * @param[in]   _pstBoxes                     Boxes to test
+ * @param[in]   _u32Number                    Number of boxes
+ * @param[in]   _pstBox                       Box to test against
+ * @param[out]  _au8Result                    Per box result: 1 if intersecting, 0 otherwise
+ * @return      Number of intersecting boxes
+ */
+orxU32 orxFASTCALL orxBatch_2DTestOBoxIntersection(const orxBATCH_OBOX *_pstBoxes, orxU32 _u32Number, const orxOBOX *_pstBox, orxU8 *_au8Result)
+{
+  orxFLOAT  fOriginX, fOriginY, fSqrX, fSqrY;
+  orxU32    i = 0, u32Result = 0;
+
+  /* Checks */
+  orxASSERT(_pstBoxes != orxNULL);
+  orxASSERT(_pstBox != orxNULL);
+  orxASSERT((_u32Number == 0) || (_au8Result != orxNULL));
+
+  /* Gets box origin & square axis sizes */
+  fOriginX  = _pstBox->vPosition.fX - _pstBox->vPivot.fX;
+  fOriginY  = _pstBox->vPosition.fY - _pstBox->vPivot.fY;
+  fSqrX     = orxVector_2DDot(&(_pstBox->vX), &(_pstBox->vX));
+  fSqrY     = orxVector_2DDot(&(_pstBox->vY), &(_pstBox->vY));
+
+  /* Projected extents of a box along an axis are origin + min/max(0, projected X axis) + min/max(0, projected Y axis):
+   * that's the same separating axis test as orxOBox_2DTestIntersection without looping over corners */
+
+#if (orxBATCH_KU32_WIDTH > 1)
+
+  {
+    orxBATCH_VEC vZero, vOriginX, vOriginY, vXX, vXY, vYX, vYY, vSqrX, vSqrY, vZ, vDepth;
+
+    /* Gets constant values */
+    vZero     = orxBATCH_SET(orxFLOAT_0);
+    vOriginX  = orxBATCH_SET(fOriginX);
+    vOriginY  = orxBATCH_SET(fOriginY);
+    vXX       = orxBATCH_SET(_pstBox->vX.fX);
+    vXY       = orxBATCH_SET(_pstBox->vX.fY);
+    vYX       = orxBATCH_SET(_pstBox->vY.fX);
+    vYY       = orxBATCH_SET(_pstBox->vY.fY);
+    vSqrX     = orxBATCH_SET(fSqrX);
+    vSqrY     = orxBATCH_SET(fSqrY);
+    vZ        = orxBATCH_SET(_pstBox->vPosition.fZ);
+    vDepth    = orxBATCH_SET(_pstBox->vPosition.fZ + _pstBox->vZ.fZ);
+
+    /* For all full packs */
+    for(; i + orxBATCH_KU32_WIDTH <= _u32Number; i += orxBATCH_KU32_WIDTH)
+    {
+      orxBATCH_VEC vBoxZ, vBoxXX, vBoxXY, vBoxYX, vBoxYY, vDX, vDY, vP, vPX, vPY, vMask;
+
+      /* Loads box */
+      vBoxZ   = orxBATCH_LOAD(_pstBoxes->afZ + i);
+      vBoxXX  = orxBATCH_LOAD(_pstBoxes->afXX + i);
+      vBoxXY  = orxBATCH_LOAD(_pstBoxes->afXY + i);
+      vBoxYX  = orxBATCH_LOAD(_pstBoxes->afYX + i);
+      vBoxYY  = orxBATCH_LOAD(_pstBoxes->afYY + i);
+
+      /* Z test */
+      vMask   = orxBATCH_AND(orxBATCH_CMPLE(vZ, orxBATCH_ADD(vBoxZ, orxBATCH_LOAD(_pstBoxes->afDepth + i))), orxBATCH_CMPLE(vBoxZ, vDepth));
+
+      /* Gets box origin relative to reference box */
+      vDX     = orxBATCH_SUB(orxBATCH_LOAD(_pstBoxes->afOriginX + i), vOriginX);
+      vDY     = orxBATCH_SUB(orxBATCH_LOAD(_pstBoxes->afOriginY + i), vOriginY);
+
+      /* Reference box X axis */
+      vP      = orxBATCH_ADD(orxBATCH_MUL(vDX, vXX), orxBATCH_MUL(vDY, vXY));
+      vPX     = orxBATCH_ADD(orxBATCH_MUL(vBoxXX, vXX), orxBATCH_MUL(vBoxXY, vXY));
+      vPY     = orxBATCH_ADD(orxBATCH_MUL(vBoxYX, vXX), orxBATCH_MUL(vBoxYY, vXY));
+      vMask   = orxBATCH_AND(vMask, orxBatch_TestRange(orxBATCH_ADD(vP, orxBATCH_ADD(orxBATCH_MIN(vZero, vPX), orxBATCH_MIN(vZero, vPY))), orxBATCH_ADD(vP, orxBATCH_ADD(orxBATCH_MAX(vZero, vPX), orxBATCH_MAX(vZero, vPY))), vSqrX));
+
+      /* Reference box Y axis */
+      vP      = orxBATCH_ADD(orxBATCH_MUL(vDX, vYX), orxBATCH_MUL(vDY, vYY));
+      vPX     = orxBATCH_ADD(orxBATCH_MUL(vBoxXX, vYX), orxBATCH_MUL(vBoxXY, vYY));
+      vPY     = orxBATCH_ADD(orxBATCH_MUL(vBoxYX, vYX), orxBATCH_MUL(vBoxYY, vYY));
+      vMask   = orxBATCH_AND(vMask, orxBatch_TestRange(orxBATCH_ADD(vP, orxBATCH_ADD(orxBATCH_MIN(vZero, vPX), orxBATCH_MIN(vZero, vPY))), orxBATCH_ADD(vP, orxBATCH_ADD(orxBATCH_MAX(vZero, vPX), orxBATCH_MAX(vZero, vPY))), vSqrY));
+
+      /* Gets reference box origin relative to box */
+      vDX     = orxBATCH_SUB(vZero, vDX);
+      vDY     = orxBATCH_SUB(vZero, vDY);
+
+      /* Box X axis */
+      vP      = orxBATCH_ADD(orxBATCH_MUL(vDX, vBoxXX), orxBATCH_MUL(vDY, vBoxXY));
+      vPX     = orxBATCH_ADD(orxBATCH_MUL(vXX, vBoxXX), orxBATCH_MUL(vXY, vBoxXY));
+      vPY     = orxBATCH_ADD(orxBATCH_MUL(vYX, vBoxXX), orxBATCH_MUL(vYY, vBoxXY));
+      vMask   = orxBATCH_AND(vMask, orxBatch_TestRange(orxBATCH_ADD(vP, orxBATCH_ADD(orxBATCH_MIN(vZero, vPX), orxBATCH_MIN(vZero, vPY))), orxBATCH_ADD(vP, orxBATCH_ADD(orxBATCH_MAX(vZero, vPX), orxBATCH_MAX(vZero, vPY))), orxBATCH_ADD(orxBATCH_MUL(vBoxXX, vBoxXX), orxBATCH_MUL(vBoxXY, vBoxXY))));
+
+      /* Box Y axis */
+      vP      = orxBATCH_ADD(orxBATCH_MUL(vDX, vBoxYX), orxBATCH_MUL(vDY, vBoxYY));
+      vPX     = orxBATCH_ADD(orxBATCH_MUL(vXX, vBoxYX), orxBATCH_MUL(vXY, vBoxYY));
+      vPY     = orxBATCH_ADD(orxBATCH_MUL(vYX, vBoxYX), orxBATCH_MUL(vYY, vBoxYY));
+      vMask   = orxBATCH_AND(vMask, orxBatch_TestRange(orxBATCH_ADD(vP, orxBATCH_ADD(orxBATCH_MIN(vZero, vPX), orxBATCH_MIN(vZero, vPY))), orxBATCH_ADD(vP, orxBATCH_ADD(orxBATCH_MAX(vZero, vPX), orxBATCH_MAX(vZero, vPY))), orxBATCH_ADD(orxBATCH_MUL(vBoxYX, vBoxYX), orxBATCH_MUL(vBoxYY, vBoxYY))));
+
+      /* Stores results */
+      u32Result += orxBatch_StoreMask(orxBATCH_GET_MASK(vMask), _au8Result + i);
+    }
+  }
+
+#endif /* orxBATCH_KU32_WIDTH > 1 */
+
+  /* For all remaining boxes */
+  for(; i < _u32Number; i++)
+  {
+    orxFLOAT  afAxisX[4], afAxisY[4], afAxisSqr[4];
+    orxFLOAT  fDX, fDY;
+    orxU32    j;
+    orxBOOL   bResult;
+
+    /* Z test */
+    bResult = ((_pstBoxes->afZ[i] + _pstBoxes->afDepth[i] >= _pstBox->vPosition.fZ) && (_pstBoxes->afZ[i] <= _pstBox->vPosition.fZ + _pstBox->vZ.fZ)) ? orxTRUE : orxFALSE;
+
+    /* Gets all axis: reference box ones then box ones */
+    afAxisX[0] = _pstBox->vX.fX;      afAxisY[0] = _pstBox->vX.fY;      afAxisSqr[0] = fSqrX;
+    afAxisX[1] = _pstBox->vY.fX;      afAxisY[1] = _pstBox->vY.fY;      afAxisSqr[1] = fSqrY;
+    afAxisX[2] = _pstBoxes->afXX[i];  afAxisY[2] = _pstBoxes->afXY[i];  afAxisSqr[2] = (afAxisX[2] * afAxisX[2]) + (afAxisY[2] * afAxisY[2]);
+    afAxisX[3] = _pstBoxes->afYX[i];  afAxisY[3] = _pstBoxes->afYY[i];  afAxisSqr[3] = (afAxisX[3] * afAxisX[3]) + (afAxisY[3] * afAxisY[3]);
+
+    /* Gets box origin relative to reference box */
+    fDX = _pstBoxes->afOriginX[i] - fOriginX;
+    fDY = _pstBoxes->afOriginY[i] - fOriginY;
+
+    /* For all axis, while intersecting */
+    for(j = 0; (j < 4) && (bResult != orxFALSE); j++)
+    {
+      orxFLOAT fP, fPX, fPY, fMin, fMax;
+
+      /* Box axis? */
+      if(j == 2)
+      {
+        /* Gets reference box origin relative to box */
+        fDX = -fDX;
+        fDY = -fDY;
+      }
+
+      /* Projects origin & the other box axis */
+      fP    = (fDX * afAxisX[j]) + (fDY * afAxisY[j]);
+      fPX   = (afAxisX[2 - (j & 2)] * afAxisX[j]) + (afAxisY[2 - (j & 2)] * afAxisY[j]);
+      fPY   = (afAxisX[3 - (j & 2)] * afAxisX[j]) + (afAxisY[3 - (j & 2)] * afAxisY[j]);
+
+      /* Gets extrema */
+      fMin  = fP + orxMIN(orxFLOAT_0, fPX) + orxMIN(orxFLOAT_0, fPY);
+      fMax  = fP + orxMAX(orxFLOAT_0, fPX) + orxMAX(orxFLOAT_0, fPY);
+
+      /* Updates result */
+      bResult = ((fMax >= orxFLOAT_0) && (fMin <= afAxisSqr[j])) ? orxTRUE : orxFALSE;
+    }
+
+    /* Stores result */
+    _au8Result[i] = (bResult != orxFALSE) ? 1 : 0;
+    u32Result    += _au8Result[i];
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Tests if a 2D position is inside oriented boxes, same as orxOBox_2DIsInside
+ * @param[in]   _pstBoxes                     Boxes to test
+ * @param[in]   _u32Number                    Number of boxes
+ * @param[in]   _pvPosition                   Position to test (no Z-test)
+ * @param[out]  _au8Result                    Per box result: 1 if position is inside, 0 otherwise
+ * @return      Number of boxes containing the position
+ */
+orxU32 orxFASTCALL orxBatch_2DIsInsideOBox(const orxBATCH_OBOX *_pstBoxes, orxU32 _u32Number, const orxVECTOR *_pvPosition, orxU8 *_au8Result)
+{
+  orxU32 i = 0, u32Result = 0;
+
+  /* Checks */
+  orxASSERT(_pstBoxes != orxNULL);
+  orxASSERT(_pvPosition != orxNULL);
+  orxASSERT((_u32Number == 0) || (_au8Result != orxNULL));
+
+#if (orxBATCH_KU32_WIDTH > 1)
+
+  {
+    orxBATCH_VEC vX, vY;
+
+    /* Gets position */
+    vX = orxBATCH_SET(_pvPosition->fX);
+    vY = orxBATCH_SET(_pvPosition->fY);
+
+    /* For all full packs */
+    for(; i + orxBATCH_KU32_WIDTH <= _u32Number; i += orxBATCH_KU32_WIDTH)
+    {
+      orxBATCH_VEC vDX, vDY, vXX, vXY, vYX, vYY, vP, vMask;
+
+      /* Gets origin to position vector */
+      vDX   = orxBATCH_SUB(vX, orxBATCH_LOAD(_pstBoxes->afOriginX + i));
+      vDY   = orxBATCH_SUB(vY, orxBATCH_LOAD(_pstBoxes->afOriginY + i));
+
+      /* Loads axis */
+      vXX   = orxBATCH_LOAD(_pstBoxes->afXX + i);
+      vXY   = orxBATCH_LOAD(_pstBoxes->afXY + i);
+      vYX   = orxBATCH_LOAD(_pstBoxes->afYX + i);
+      vYY   = orxBATCH_LOAD(_pstBoxes->afYY + i);
+
+      /* X-axis test */
+      vP    = orxBATCH_ADD(orxBATCH_MUL(vDX, vXX), orxBATCH_MUL(vDY, vXY));
+      vMask = orxBatch_TestRange(vP, vP, orxBATCH_ADD(orxBATCH_MUL(vXX, vXX), orxBATCH_MUL(vXY, vXY)));
+
+      /* Y-axis test */
+      vP    = orxBATCH_ADD(orxBATCH_MUL(vDX, vYX), orxBATCH_MUL(vDY, vYY));
+      vMask = orxBATCH_AND(vMask, orxBatch_TestRange(vP, vP, orxBATCH_ADD(orxBATCH_MUL(vYX, vYX), orxBATCH_MUL(vYY, vYY))));
+
+      /* Stores results */
+      u32Result += orxBatch_StoreMask(orxBATCH_GET_MASK(vMask), _au8Result + i);
+    }
+  }
+
+#endif /* orxBATCH_KU32_WIDTH > 1 */
+
+  /* For all remaining boxes */
+  for(; i < _u32Number; i++)
+  {
+    orxFLOAT fDX, fDY, fProj;
+
+    /* Gets origin to position vector */
+    fDX = _pvPosition->fX - _pstBoxes->afOriginX[i];
+    fDY = _pvPosition->fY - _pstBoxes->afOriginY[i];
+
+    /* X-axis test */
+    fProj = (fDX * _pstBoxes->afXX[i]) + (fDY * _pstBoxes->afXY[i]);
+    _au8Result[i] = ((fProj >= orxFLOAT_0) && (fProj <= (_pstBoxes->afXX[i] * _pstBoxes->afXX[i]) + (_pstBoxes->afXY[i] * _pstBoxes->afXY[i]))) ? 1 : 0;
+
+    /* Y-axis test */
+    fProj = (fDX * _pstBoxes->afYX[i]) + (fDY * _pstBoxes->afYY[i]);
+    _au8Result[i] &= ((fProj >= orxFLOAT_0) && (fProj <= (_pstBoxes->afYX[i] * _pstBoxes->afYX[i]) + (_pstBoxes->afYY[i] * _pstBoxes->afYY[i]))) ? 1 : 0;
+
+    /* Updates result */
+    u32Result += _au8Result[i];
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Tests 2D circles against a single one
+ * @param[in]   _afX                          Circle centers, X
+ * @param[in]   _afY                          Circle centers, Y
+ * @param[in]   _afRadius                     Circle radii, orxNULL for points
+ * @param[in]   _u32Number                    Number of circles
+ * @param[in]   _pvCenter                     Center of the circle to test against (no Z-test)
+ * @param[in]   _fRadius                      Radius of the circle to test against
+ * @param[out]  _au8Result                    Per circle result: 1 if intersecting, 0 otherwise
+ * @return      Number of intersecting circles
+ */
+orxU32 orxFASTCALL orxBatch_2DTestCircleIntersection(const orxFLOAT *_afX, const orxFLOAT *_afY, const orxFLOAT *_afRadius, orxU32 _u32Number, const orxVECTOR *_pvCenter, orxFLOAT _fRadius, orxU8 *_au8Result)
+{
+  orxU32 i = 0, u32Result = 0;
+
+  /* Checks */
+  orxASSERT((_u32Number == 0) || ((_afX != orxNULL) && (_afY != orxNULL)));
+  orxASSERT(_pvCenter != orxNULL);
+  orxASSERT((_u32Number == 0) || (_au8Result != orxNULL));
+
+#if (orxBATCH_KU32_WIDTH > 1)
+
+  {
+    orxBATCH_VEC vX, vY, vRadius;
+
+    /* Gets circle */
+    vX      = orxBATCH_SET(_pvCenter->fX);
+    vY      = orxBATCH_SET(_pvCenter->fY);
+    vRadius = orxBATCH_SET(_fRadius);
+
+    /* For all full packs */
+    for(; i + orxBATCH_KU32_WIDTH <= _u32Number; i += orxBATCH_KU32_WIDTH)
+    {
+      orxBATCH_VEC vDX, vDY, vR;
+
+      /* Gets distance vector */
+      vDX = orxBATCH_SUB(orxBATCH_LOAD(_afX + i), vX);
+      vDY = orxBATCH_SUB(orxBATCH_LOAD(_afY + i), vY);
+
+      /* Gets radius sum */
+      vR  = (_afRadius != orxNULL) ? orxBATCH_ADD(orxBATCH_LOAD(_afRadius + i), vRadius) : vRadius;
+
+      /* Stores results */
+      u32Result += orxBatch_StoreMask(orxBATCH_GET_MASK(orxBATCH_CMPLE(orxBATCH_ADD(orxBATCH_MUL(vDX, vDX), orxBATCH_MUL(vDY, vDY)), orxBATCH_MUL(vR, vR))), _au8Result + i);
+    }
+  }
+
+#endif /* orxBATCH_KU32_WIDTH > 1 */
+
+  /* For all remaining circles */
+  for(; i < _u32Number; i++)
+  {
+    orxFLOAT fDX, fDY, fR;
+
+    /* Gets distance vector */
+    fDX = _afX[i] - _pvCenter->fX;
+    fDY = _afY[i] - _pvCenter->fY;
+
+    /* Gets radius sum */
+    fR  = (_afRadius != orxNULL) ? _afRadius[i] + _fRadius : _fRadius;
+
+    /* Stores result */
+    _au8Result[i] = (((fDX * fDX) + (fDY * fDY)) <= (fR * fR)) ? 1 : 0;
+    u32Result    += _au8Result[i];
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets 2D square distances to a position
+ * @param[in]   _afX                          Positions, X
+ * @param[in]   _afY                          Positions, Y
+ * @param[in]   _u32Number                    Number of positions
+ * @param[in]   _pvPosition                   Position to get distances from (no Z)
+ * @param[out]  _afRes                        Square distances
+ */
+void orxFASTCALL orxBatch_2DGetSquareDistance(const orxFLOAT *_afX, const orxFLOAT *_afY, orxU32 _u32Number, const orxVECTOR *_pvPosition, orxFLOAT *_afRes)
+{
+  orxU32 i = 0;
+
+  /* Checks */
+  orxASSERT((_u32Number == 0) || ((_afX != orxNULL) && (_afY != orxNULL)));
+  orxASSERT(_pvPosition != orxNULL);
+  orxASSERT((_u32Number == 0) || (_afRes != orxNULL));
+
+#if (orxBATCH_KU32_WIDTH > 1)
+
+  {
+    orxBATCH_VEC vX, vY;
+
+    /* Gets position */
+    vX = orxBATCH_SET(_pvPosition->fX);
+    vY = orxBATCH_SET(_pvPosition->fY);
+
+    /* For all full packs */
+    for(; i + orxBATCH_KU32_WIDTH <= _u32Number; i += orxBATCH_KU32_WIDTH)
+    {
+      orxBATCH_VEC vDX, vDY;
+
+      /* Gets distance vector */
+      vDX = orxBATCH_SUB(orxBATCH_LOAD(_afX + i), vX);
+      vDY = orxBATCH_SUB(orxBATCH_LOAD(_afY + i), vY);
+
+      /* Stores square distance */
+      orxBATCH_STORE(_afRes + i, orxBATCH_ADD(orxBATCH_MUL(vDX, vDX), orxBATCH_MUL(vDY, vDY)));
+    }
+  }
+
+#endif /* orxBATCH_KU32_WIDTH > 1 */
+
+  /* For all remaining positions */
+  for(; i < _u32Number; i++)
+  {
+    orxFLOAT fDX, fDY;
+
+    /* Gets distance vector */
+    fDX = _afX[i] - _pvPosition->fX;
+    fDY = _afY[i] - _pvPosition->fY;
+
+    /* Stores square distance */
+    _afRes[i] = (fDX * fDX) + (fDY * fDY);
+  }
+
+  /* Done! */
+  return;
+}
@@ -31,6 +31,35 @@
 #include "debug/orxDebug.h"
 #include "utils/orxString.h"
 
+/* Windows */
+#ifdef __orxWINDOWS__
+
+  #define WIN32_LEAN_AND_MEAN
+  #include <windows.h>
+
+  typedef CRITICAL_SECTION                  orxBANK_MUTEX;
+
+  #define __orxBANK_THREAD__
+
+#else /* __orxWINDOWS__ */
+
+  /* Linux / Mac / IPhone */
+  #if defined(__orxLINUX__) || defined(__orxMAC__) || defined(__orxIPHONE__)
+
+    #include <pthread.h>
+
+    typedef pthread_mutex_t                 orxBANK_MUTEX;
+
+    #define __orxBANK_THREAD__
+
+  #else /* __orxLINUX__ || __orxMAC__ || __orxIPHONE__ */
+
+    #undef __orxBANK_THREAD__
+
+  #endif /* __orxLINUX__ || __orxMAC__ || __orxIPHONE__ */
+
+#endif /* __orxWINDOWS__ */
+
 #define orxBANK_KU32_STATIC_FLAG_NONE         0x00000000  /**< No flags have been set */
 #define orxBANK_KU32_STATIC_FLAG_READY        0x00000001  /**< The module has been initialized */
 
@@ -59,11 +88,20 @@ struct __orxBANK_t
   orxU16            u16NbCellPerSegments;   /**< Number of cells per banks */
   orxU16            u16SizeSegmentBitField; /**< Number of u32 (4 bytes) to represent a segment */
   orxU32            u32Counter;             /**< Number of allocated cells */
+  struct __orxBANK_t *pstPrevious;          /**< Previous bank */
+  struct __orxBANK_t *pstNext;              /**< Next bank */
 };
 
 typedef struct __orxBANK_STATIC_t
 {
-  orxU32 u32Flags;                      /**< Flags set by the memory module */
+  orxBANK  *pstFirstBank;               /**< First created bank */
+  orxU32    u32Flags;                   /**< Flags set by the memory module */
+
+#ifdef __orxBANK_THREAD__
+
+  orxBANK_MUTEX stMutex;                /**< Protects the bank list, banks can be created from any thread */
+
+#endif /* __orxBANK_THREAD__ */
 
 } orxBANK_STATIC;
 
@@ -76,6 +114,52 @@ static orxBANK_STATIC sstBank;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Locks the bank list
+ */
+static orxINLINE void orxBank_Lock()
+{
+#ifdef __orxBANK_THREAD__
+
+#ifdef __orxWINDOWS__
+  EnterCriticalSection(&(sstBank.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_mutex_lock(&(sstBank.stMutex));
+#endif /* __orxWINDOWS__ */
+
+#endif /* __orxBANK_THREAD__ */
+
+  return;
+}
+
+/** Unlocks the bank list
+ */
+static orxINLINE void orxBank_Unlock()
+{
+#ifdef __orxBANK_THREAD__
+
+#ifdef __orxWINDOWS__
+  LeaveCriticalSection(&(sstBank.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_mutex_unlock(&(sstBank.stMutex));
+#endif /* __orxWINDOWS__ */
+
+#endif /* __orxBANK_THREAD__ */
+
+  return;
+}
+
+/** Gets the size of a segment
+ * @param[in] _pstBank    Concerned bank
+ * @return  Segment size, in bytes
+ */
+static orxINLINE orxU32 orxBank_GetSegmentSize(const orxBANK *_pstBank)
+{
+  /* Done! */
+  return(sizeof(orxBANK_SEGMENT) +                                /* Size of the structure */
+         _pstBank->u16SizeSegmentBitField * sizeof(orxU32) +      /* Size of bitfields */
+         _pstBank->u16NbCellPerSegments * _pstBank->u32ElemSize); /* Size of stored Data */
+}
+
 /** Create a new segment of memory and returns a pointer on it
  * @param[in] _pstBank    Concerned bank
  * @return  returns a pointer on the memory segment (orxNULL if an error occured)
@@ -92,12 +176,10 @@ static orxINLINE orxBANK_SEGMENT *orxBank_SegmentCreate(const orxBANK *_pstBank)
   orxASSERT(_pstBank != orxNULL);
 
   /* Compute the segment size */
-  u32SegmentSize = sizeof(orxBANK_SEGMENT) +                                /* Size of the structure */
-                   _pstBank->u16SizeSegmentBitField * sizeof(orxU32) +      /* Size of bitfields */
-                   _pstBank->u16NbCellPerSegments * _pstBank->u32ElemSize;  /* Size of stored Data */
+  u32SegmentSize = orxBank_GetSegmentSize(_pstBank);
 
   /* Allocate a new segent of memory */
-  pstSegment = (orxBANK_SEGMENT *)orxMemory_Allocate(u32SegmentSize, _pstBank->eMemType);
+  pstSegment = (orxBANK_SEGMENT *)((_pstBank->u32Flags & orxBANK_KU32_FLAG_FRAME_MEMORY) ? orxMemory_AllocateFrame(u32SegmentSize) : orxMemory_Allocate(u32SegmentSize, _pstBank->eMemType));
   if(pstSegment != orxNULL)
   {
     /* Set initial segment values */
@@ -199,6 +281,17 @@ orxSTATUS orxFASTCALL orxBank_Init()
     /* Set module has ready */
     sstBank.u32Flags = orxBANK_KU32_STATIC_FLAG_READY;
 
+#ifdef __orxBANK_THREAD__
+
+    /* Inits mutex */
+#ifdef __orxWINDOWS__
+    InitializeCriticalSection(&(sstBank.stMutex));
+#else /* __orxWINDOWS__ */
+    pthread_mutex_init(&(sstBank.stMutex), NULL);
+#endif /* __orxWINDOWS__ */
+
+#endif /* __orxBANK_THREAD__ */
+
     /* Success */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -222,6 +315,17 @@ void orxFASTCALL orxBank_Exit()
   /* Module initialized ? */
   if((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY)
   {
+#ifdef __orxBANK_THREAD__
+
+    /* Deletes mutex */
+#ifdef __orxWINDOWS__
+    DeleteCriticalSection(&(sstBank.stMutex));
+#else /* __orxWINDOWS__ */
+    pthread_mutex_destroy(&(sstBank.stMutex));
+#endif /* __orxWINDOWS__ */
+
+#endif /* __orxBANK_THREAD__ */
+
     /* Module not ready now */
     sstBank.u32Flags = orxBANK_KU32_STATIC_FLAG_NONE;
   }
@@ -249,7 +353,7 @@ orxBANK *orxFASTCALL orxBank_Create(orxU16 _u16NbElem, orxU32 _u32Size, orxU32 _
   orxASSERT(_u32Size > 0);
 
   /* Allocate the bank */
-  pstBank = (orxBANK *)orxMemory_Allocate(sizeof(orxBANK), _eMemType);
+  pstBank = (orxBANK *)((_u32Flags & orxBANK_KU32_FLAG_FRAME_MEMORY) ? orxMemory_AllocateFrame(sizeof(orxBANK)) : orxMemory_Allocate(sizeof(orxBANK), _eMemType));
 
   /* Memory allocated ? */
   if(pstBank != orxNULL)
@@ -272,9 +376,25 @@ orxBANK *orxFASTCALL orxBank_Create(orxU16 _u16NbElem, orxU32 _u32Size, orxU32 _
     if(pstBank->pstFirstSegment == orxNULL)
     {
       /* Can't allocate segment, cancel bank allocation */
-      orxMemory_Free(pstBank);
+      if(!(_u32Flags & orxBANK_KU32_FLAG_FRAME_MEMORY))
+      {
+        orxMemory_Free(pstBank);
+      }
       pstBank = orxNULL;
     }
+    /* Not in frame memory? (frame banks aren't listed as they vanish with the frame arena) */
+    else if(!(_u32Flags & orxBANK_KU32_FLAG_FRAME_MEMORY))
+    {
+      /* Links it at the head of the bank list */
+      orxBank_Lock();
+      pstBank->pstNext = sstBank.pstFirstBank;
+      if(sstBank.pstFirstBank != orxNULL)
+      {
+        sstBank.pstFirstBank->pstPrevious = pstBank;
+      }
+      sstBank.pstFirstBank = pstBank;
+      orxBank_Unlock();
+    }
   }
 
   return pstBank;
@@ -291,12 +411,31 @@ void orxFASTCALL orxBank_Delete(orxBANK *_pstBank)
   /* Correct parameters ? */
   orxASSERT(_pstBank != orxNULL);
 
-  /* Delete segment(s) (This segment is the first one, it can't be orxNULL) */
-  orxBank_SegmentDelete(_pstBank->pstFirstSegment);
+  /* Not in frame memory? (the frame arena will release it otherwise) */
+  if(!(_pstBank->u32Flags & orxBANK_KU32_FLAG_FRAME_MEMORY))
+  {
+    /* Unlinks it from the bank list */
+    orxBank_Lock();
+    if(_pstBank->pstPrevious != orxNULL)
+    {
+      _pstBank->pstPrevious->pstNext = _pstBank->pstNext;
+    }
+    else
+    {
+      sstBank.pstFirstBank = _pstBank->pstNext;
+    }
+    if(_pstBank->pstNext != orxNULL)
+    {
+      _pstBank->pstNext->pstPrevious = _pstBank->pstPrevious;
+    }
+    orxBank_Unlock();
 
-  /* Completly Free Bank */
-  orxMemory_Free(_pstBank);
+    /* Delete segment(s) (This segment is the first one, it can't be orxNULL) */
+    orxBank_SegmentDelete(_pstBank->pstFirstSegment);
 
+    /* Completly Free Bank */
+    orxMemory_Free(_pstBank);
+  }
 }
 
 /** Allocate a new cell from the bank
@@ -562,6 +701,116 @@ orxU32 orxFASTCALL orxBank_GetCounter(const orxBANK *_pstBank)
   return _pstBank->u32Counter;
 }
 
+/** Gets bank statistics
+ * @param[in]  _pstBank   Concerned bank
+ * @param[out] _pstStats  Statistics of the bank
+ */
+void orxFASTCALL orxBank_GetStats(const orxBANK *_pstBank, orxBANK_STATS *_pstStats)
+{
+  const orxBANK_SEGMENT *pstSegment;
+
+  /* Checks */
+  orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBank != orxNULL);
+  orxASSERT(_pstStats != orxNULL);
+
+  /* Cleans stats */
+  orxMemory_Zero(_pstStats, sizeof(orxBANK_STATS));
+
+  /* Stores bank info */
+  _pstStats->eMemType     = _pstBank->eMemType;
+  _pstStats->u32ElemSize  = _pstBank->u32ElemSize;
+  _pstStats->u32Counter   = _pstBank->u32Counter;
+
+  /* For all segments */
+  for(pstSegment = _pstBank->pstFirstSegment; pstSegment != orxNULL; pstSegment = pstSegment->pstNext)
+  {
+    orxU32 u32Used, u32Bucket;
+
+    /* Gets its used cells */
+    u32Used = (orxU32)(_pstBank->u16NbCellPerSegments - pstSegment->u16NbFree);
+
+    /* Empty? */
+    if(u32Used == 0)
+    {
+      u32Bucket = 0;
+    }
+    /* Full? */
+    else if(u32Used == (orxU32)_pstBank->u16NbCellPerSegments)
+    {
+      u32Bucket = orxBANK_KU32_HISTOGRAM_SIZE - 1;
+    }
+    else
+    {
+      /* Gets its quarter */
+      u32Bucket = 1 + (((u32Used * 4) - 1) / (orxU32)_pstBank->u16NbCellPerSegments);
+    }
+
+    /* Updates stats */
+    _pstStats->au32Histogram[u32Bucket]++;
+    _pstStats->u32SegmentCounter++;
+  }
+
+  /* Updates totals */
+  _pstStats->u32Capacity  = _pstStats->u32SegmentCounter * (orxU32)_pstBank->u16NbCellPerSegments;
+  _pstStats->u32Size      = sizeof(orxBANK) + (_pstStats->u32SegmentCounter * orxBank_GetSegmentSize(_pstBank));
+
+  /* Done! */
+  return;
+}
+
+/** Gets the next bank
+ * @param[in]  _pstBank   Current bank, orxNULL to get the first one
+ * @return Next bank / orxNULL
+ */
+orxBANK *orxFASTCALL orxBank_GetNextBank(const orxBANK *_pstBank)
+{
+  /* Checks */
+  orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return (_pstBank != orxNULL) ? _pstBank->pstNext : sstBank.pstFirstBank;
+}
+
+/** Logs statistics of all banks
+ */
+void orxFASTCALL orxBank_LogStats()
+{
+  const orxBANK  *pstBank;
+  orxU32          u32Size = 0, u32BankCounter = 0;
+
+  /* Checks */
+  orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
+
+  /* Locks bank list */
+  orxBank_Lock();
+
+  /* For all banks */
+  for(pstBank = sstBank.pstFirstBank; pstBank != orxNULL; pstBank = pstBank->pstNext)
+  {
+    orxBANK_STATS stStats;
+
+    /* Gets its stats */
+    orxBank_GetStats(pstBank, &stStats);
+
+    /* Logs them */
+    orxLOG("[BANK] %p: %4lu bytes/cell, %6lu/%6lu cells in %3lu segments, %8lu bytes, occupancy [%lu|%lu|%lu|%lu|%lu|%lu].", pstBank, stStats.u32ElemSize, stStats.u32Counter, stStats.u32Capacity, stStats.u32SegmentCounter, stStats.u32Size, stStats.au32Histogram[0], stStats.au32Histogram[1], stStats.au32Histogram[2], stStats.au32Histogram[3], stStats.au32Histogram[4], stStats.au32Histogram[5]);
+
+    /* Updates totals */
+    u32Size += stStats.u32Size;
+    u32BankCounter++;
+  }
+
+  /* Unlocks bank list */
+  orxBank_Unlock();
+
+  /* Logs totals */
+  orxLOG("[BANK] %lu banks, %lu bytes.", u32BankCounter, u32Size);
+
+  /* Done! */
+  return;
+}
+
 /*******************************************************************************
  * DEBUG FUNCTION
  ******************************************************************************/
@@ -32,15 +32,110 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* Windows */
+#ifdef __orxWINDOWS__
+
+  #define WIN32_LEAN_AND_MEAN
+  #include <windows.h>
+
+  typedef CRITICAL_SECTION                  orxMEMORY_MUTEX;
+  typedef DWORD                             orxMEMORY_THREAD_ID;
+
+  #define __orxMEMORY_THREAD__
+
+#else /* __orxWINDOWS__ */
+
+  /* Linux / Mac / IPhone */
+  #if defined(__orxLINUX__) || defined(__orxMAC__) || defined(__orxIPHONE__)
+
+    #include <pthread.h>
+
+    typedef pthread_mutex_t                 orxMEMORY_MUTEX;
+    typedef pthread_t                       orxMEMORY_THREAD_ID;
+
+    #define __orxMEMORY_THREAD__
+
+  #else /* __orxLINUX__ || __orxMAC__ || __orxIPHONE__ */
+
+    #undef __orxMEMORY_THREAD__
+
+  #endif /* __orxLINUX__ || __orxMAC__ || __orxIPHONE__ */
+
+#endif /* __orxWINDOWS__ */
+
 #define orxMEMORY_KU32_STATIC_FLAG_NONE   0x00000000  /**< No flags have been set */
 #define orxMEMORY_KU32_STATIC_FLAG_READY  0x00000001  /**< The module has been initialized */
+#define orxMEMORY_KU32_STATIC_FLAG_STATS  0x00000002  /**< Statistics are enabled */
+
+#define orxMEMORY_KU16_HEADER_FLAG_NONE   0x0000      /**< No flags */
+#define orxMEMORY_KU16_HEADER_FLAG_STATS  0x0001      /**< Block is counted in statistics */
+
+#define orxMEMORY_KU32_HEADER_SIZE        16          /**< Size reserved in front of each block, keeps blocks 16-byte aligned */
+
+#define orxMEMORY_KU32_FRAME_ARENA_SIZE   0x00040000  /**< Frame arena chunk size (256KB) */
+#define orxMEMORY_KU8_FRAME_ARENA_POISON  0xCD        /**< Value written over released frame arena memory (debug only) */
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
+
+/** Block header, stored in front of each allocated block
+ */
+typedef struct __orxMEMORY_HEADER_t
+{
+  orxU32          u32Size;      /**< Requested size */
+  orxMEMORY_TYPE  eMemType;     /**< Memory type */
+  orxU16          u16Flags;     /**< Block flags */
+
+} orxMEMORY_HEADER;
+
+/** Memory type allocator
+ */
+typedef struct __orxMEMORY_ALLOCATOR_t
+{
+  orxMEMORY_ALLOCATE_FUNCTION pfnAllocate;  /**< Allocate function, orxNULL for system */
+  orxMEMORY_FREE_FUNCTION     pfnFree;      /**< Free function, orxNULL for system */
+  void                       *pContext;     /**< Allocator context */
+
+} orxMEMORY_ALLOCATOR;
+
+/** Frame arena chunk, its data follows the header
+ */
+typedef struct __orxMEMORY_ARENA_CHUNK_t
+{
+  struct __orxMEMORY_ARENA_CHUNK_t *pstNext;  /**< Next chunk */
+  orxU8                            *pu8End;   /**< Chunk end */
+
+} orxMEMORY_ARENA_CHUNK;
+
+/** Frame arena (linear allocator reset once per frame, grows by chunks that are kept until exit)
+ */
+typedef struct __orxMEMORY_ARENA_t
+{
+  orxMEMORY_ARENA_CHUNK  *pstFirstChunk;      /**< First chunk */
+  orxMEMORY_ARENA_CHUNK  *pstCurrentChunk;    /**< Chunk used by current frame, orxNULL if none yet */
+  orxU8                  *pu8Current;         /**< Current allocation position */
+  orxU32                  u32FrameSize;       /**< Size allocated during current frame */
+  orxU32                  u32PeakSize;        /**< Peak size allocated over a frame */
+  orxU32                  u32ChunkCounter;    /**< Number of chunks */
+
+} orxMEMORY_ARENA;
+
 typedef struct __orxMEMORY_STATIC_t
 {
-  orxU32 u32Flags;   /**< Flags set by the memory module */
+  orxMEMORY_ARENA     stFrameArena;                         /**< Frame arena */
+  orxMEMORY_STATS     astStats[orxMEMORY_TYPE_NUMBER];      /**< Statistics per memory type */
+  orxMEMORY_ALLOCATOR astAllocator[orxMEMORY_TYPE_NUMBER];  /**< Allocators per memory type */
+  orxU32              u32Flags;                             /**< Flags set by the memory module */
+  orxU32              u32AllocationCounter;                 /**< Number of allocations since init */
+
+#ifdef __orxMEMORY_THREAD__
+
+  orxMEMORY_MUTEX     stMutex;                              /**< Protects statistics, allocations can come from any thread */
+  orxMEMORY_THREAD_ID stMainThread;                         /**< Thread that initialized the module, the only one allowed to use the frame arena */
+
+#endif /* __orxMEMORY_THREAD__ */
+
 } orxMEMORY_STATIC;
 
 /***************************************************************************
@@ -48,10 +143,204 @@ typedef struct __orxMEMORY_STATIC_t
  ***************************************************************************/
 static orxMEMORY_STATIC sstMemory;
 
+/** Memory type names
+ */
+static const orxSTRING sazMemoryTypeName[orxMEMORY_TYPE_NUMBER] =
+{
+  "main",
+  "video",
+  "sprite",
+  "background",
+  "palette",
+  "config",
+  "text",
+  "temp"
+};
+
 /***************************************************************************
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Locks statistics
+ */
+static orxINLINE void orxMemory_Lock()
+{
+#ifdef __orxMEMORY_THREAD__
+
+#ifdef __orxWINDOWS__
+  EnterCriticalSection(&(sstMemory.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_mutex_lock(&(sstMemory.stMutex));
+#endif /* __orxWINDOWS__ */
+
+#endif /* __orxMEMORY_THREAD__ */
+
+  return;
+}
+
+/** Unlocks statistics
+ */
+static orxINLINE void orxMemory_Unlock()
+{
+#ifdef __orxMEMORY_THREAD__
+
+#ifdef __orxWINDOWS__
+  LeaveCriticalSection(&(sstMemory.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_mutex_unlock(&(sstMemory.stMutex));
+#endif /* __orxWINDOWS__ */
+
+#endif /* __orxMEMORY_THREAD__ */
+
+  return;
+}
+
+#ifdef __orxDEBUG__
+
+/** Is current thread the main one?
+ * @return orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxMemory_IsMainThread()
+{
+  orxBOOL bResult;
+
+#ifdef __orxMEMORY_THREAD__
+
+#ifdef __orxWINDOWS__
+  bResult = (GetCurrentThreadId() == sstMemory.stMainThread) ? orxTRUE : orxFALSE;
+#else /* __orxWINDOWS__ */
+  bResult = (pthread_equal(pthread_self(), sstMemory.stMainThread) != 0) ? orxTRUE : orxFALSE;
+#endif /* __orxWINDOWS__ */
+
+#else /* __orxMEMORY_THREAD__ */
+
+  bResult = orxTRUE;
+
+#endif /* __orxMEMORY_THREAD__ */
+
+  /* Done! */
+  return bResult;
+}
+
+#endif /* __orxDEBUG__ */
+
+/** Gets the data of a frame arena chunk
+ * @param[in] _pstChunk   Concerned chunk
+ * @return Chunk data
+ */
+static orxINLINE orxU8 *orxMemory_GetChunkData(const orxMEMORY_ARENA_CHUNK *_pstChunk)
+{
+  /* Done! */
+  return (orxU8 *)_pstChunk + orxMEMORY_KU32_HEADER_SIZE;
+}
+
+/** Is a pointer inside the frame arena? Has to be called from main thread or with statistics locked
+ * @param[in] _pMem       Concerned pointer
+ * @return orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxMemory_IsInFrameArena(const void *_pMem)
+{
+  const orxMEMORY_ARENA_CHUNK  *pstChunk;
+  orxBOOL                       bResult = orxFALSE;
+
+  /* For all chunks */
+  for(pstChunk = sstMemory.stFrameArena.pstFirstChunk; pstChunk != orxNULL; pstChunk = pstChunk->pstNext)
+  {
+    /* Inside? */
+    if(((const orxU8 *)_pMem >= orxMemory_GetChunkData(pstChunk)) && ((const orxU8 *)_pMem < pstChunk->pu8End))
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+      break;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Gets the header of a block
+ * @param[in] _pMem       Block returned by orxMemory_Allocate
+ * @return Block header
+ */
+static orxINLINE orxMEMORY_HEADER *orxMemory_GetHeader(void *_pMem)
+{
+  /* Done! */
+  return (orxMEMORY_HEADER *)((orxU8 *)_pMem - orxMEMORY_KU32_HEADER_SIZE);
+}
+
+/** Allocates a raw block using the memory type allocator
+ * @param[in] _u32Size    Raw size (header included)
+ * @param[in] _eMemType   Memory type
+ * @return Raw block / orxNULL
+ */
+static orxINLINE void *orxMemory_RawAllocate(orxU32 _u32Size, orxMEMORY_TYPE _eMemType)
+{
+  const orxMEMORY_ALLOCATOR *pstAllocator;
+
+  /* Gets allocator */
+  pstAllocator = &(sstMemory.astAllocator[_eMemType]);
+
+  /* Done! */
+  return (pstAllocator->pfnAllocate != orxNULL) ? pstAllocator->pfnAllocate(_u32Size, pstAllocator->pContext) : malloc(_u32Size);
+}
+
+/** Frees a raw block using the memory type allocator
+ * @param[in] _pRaw       Raw block
+ * @param[in] _eMemType   Memory type
+ */
+static orxINLINE void orxMemory_RawFree(void *_pRaw, orxMEMORY_TYPE _eMemType)
+{
+  const orxMEMORY_ALLOCATOR *pstAllocator;
+
+  /* Gets allocator */
+  pstAllocator = &(sstMemory.astAllocator[_eMemType]);
+
+  /* Custom allocator? */
+  if(pstAllocator->pfnFree != orxNULL)
+  {
+    /* Frees it */
+    pstAllocator->pfnFree(_pRaw, pstAllocator->pContext);
+  }
+  else
+  {
+    /* System call to free memory */
+    free(_pRaw);
+  }
+
+  return;
+}
+
+/** Updates memory type statistics, has to be called with statistics locked
+ * @param[in] _eMemType   Memory type
+ * @param[in] _u32Added   Added size
+ * @param[in] _u32Removed Removed size
+ * @param[in] _s32Counter Live allocation counter delta
+ */
+static orxINLINE void orxMemory_UpdateStats(orxMEMORY_TYPE _eMemType, orxU32 _u32Added, orxU32 _u32Removed, orxS32 _s32Counter)
+{
+  orxMEMORY_STATS *pstStats;
+
+  /* Gets stats */
+  pstStats = &(sstMemory.astStats[_eMemType]);
+
+  /* Updates values */
+  pstStats->u32Size     = pstStats->u32Size + _u32Added - _u32Removed;
+  pstStats->u32Counter  = (orxU32)((orxS32)pstStats->u32Counter + _s32Counter);
+
+  /* Updates peaks */
+  if(pstStats->u32Size > pstStats->u32PeakSize)
+  {
+    pstStats->u32PeakSize = pstStats->u32Size;
+  }
+  if(pstStats->u32Counter > pstStats->u32PeakCounter)
+  {
+    pstStats->u32PeakCounter = pstStats->u32Counter;
+  }
+
+  return;
+}
+
 /***************************************************************************
  * Public functions                                                        *
  ***************************************************************************/
@@ -85,6 +374,19 @@ orxSTATUS orxFASTCALL orxMemory_Init()
     /* Module initialized */
     sstMemory.u32Flags = orxMEMORY_KU32_STATIC_FLAG_READY;
 
+#ifdef __orxMEMORY_THREAD__
+
+    /* Inits mutex & stores main thread */
+#ifdef __orxWINDOWS__
+    InitializeCriticalSection(&(sstMemory.stMutex));
+    sstMemory.stMainThread = GetCurrentThreadId();
+#else /* __orxWINDOWS__ */
+    pthread_mutex_init(&(sstMemory.stMutex), NULL);
+    sstMemory.stMainThread = pthread_self();
+#endif /* __orxWINDOWS__ */
+
+#endif /* __orxMEMORY_THREAD__ */
+
     /* Success */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -108,6 +410,35 @@ void orxFASTCALL orxMemory_Exit()
   /* Module initialized ? */
   if((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY)
   {
+    /* For all frame arena chunks */
+    while(sstMemory.stFrameArena.pstFirstChunk != orxNULL)
+    {
+      orxMEMORY_ARENA_CHUNK *pstChunk;
+
+      /* Gets it */
+      pstChunk = sstMemory.stFrameArena.pstFirstChunk;
+
+      /* Removes it from list */
+      sstMemory.stFrameArena.pstFirstChunk = pstChunk->pstNext;
+
+      /* Frees it */
+      free(pstChunk);
+    }
+
+    /* Cleans frame arena */
+    orxMemory_Zero(&(sstMemory.stFrameArena), sizeof(orxMEMORY_ARENA));
+
+#ifdef __orxMEMORY_THREAD__
+
+    /* Deletes mutex */
+#ifdef __orxWINDOWS__
+    DeleteCriticalSection(&(sstMemory.stMutex));
+#else /* __orxWINDOWS__ */
+    pthread_mutex_destroy(&(sstMemory.stMutex));
+#endif /* __orxWINDOWS__ */
+
+#endif /* __orxMEMORY_THREAD__ */
+
     /* Module uninitialized */
     sstMemory.u32Flags = orxMEMORY_KU32_STATIC_FLAG_NONE;
   }
@@ -136,14 +467,52 @@ orxU32 orxFASTCALL orxMemory_GetAlign(orxU32 _u32OriginalValue, orxU32 _u32Align
  */
 void *orxFASTCALL orxMemory_Allocate(orxU32 _u32Size, orxMEMORY_TYPE _eMemType)
 {
+  orxMEMORY_HEADER *pstHeader;
+  void             *pResult = orxNULL;
+
   /* Module initialized ? */
   orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
 
   /* Valid parameters ? */
   orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
 
-  /* Returns system allocation function */
-  return((void *)malloc(_u32Size));
+  /* Allocates block with its header */
+  pstHeader = (orxMEMORY_HEADER *)orxMemory_RawAllocate(_u32Size + orxMEMORY_KU32_HEADER_SIZE, _eMemType);
+
+  /* Success? */
+  if(pstHeader != orxNULL)
+  {
+    /* Stores block info */
+    pstHeader->u32Size  = _u32Size;
+    pstHeader->eMemType = _eMemType;
+
+    /* Statistics enabled? */
+    if(sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_STATS)
+    {
+      /* Updates stats */
+      orxMemory_Lock();
+      orxMemory_UpdateStats(_eMemType, _u32Size, 0, 1);
+      sstMemory.astStats[_eMemType].u32TotalCounter++;
+
+      /* Updates allocation counter */
+      sstMemory.u32AllocationCounter++;
+      orxMemory_Unlock();
+
+      /* Marks block as counted */
+      pstHeader->u16Flags = orxMEMORY_KU16_HEADER_FLAG_STATS;
+    }
+    else
+    {
+      /* Clears flags */
+      pstHeader->u16Flags = orxMEMORY_KU16_HEADER_FLAG_NONE;
+    }
+
+    /* Updates result */
+    pResult = (orxU8 *)pstHeader + orxMEMORY_KU32_HEADER_SIZE;
+  }
+
+  /* Done! */
+  return pResult;
 }
 
 /** Free a portion of memory allocated with orxMemory_Allocateate
@@ -151,18 +520,357 @@ void *orxFASTCALL orxMemory_Allocate(orxU32 _u32Size, orxMEMORY_TYPE _eMemType)
  */
 void orxFASTCALL orxMemory_Free(void *_pMem)
 {
+  orxMEMORY_HEADER *pstHeader;
+
   /* Module initialized ? */
   orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
 
   /* Valid parameters ? */
   orxASSERT(_pMem != orxNULL);
 
-  /* System call to free memory */
-  free(_pMem);
+#ifdef __orxDEBUG__
+
+  /* Locks frame arena chunk list */
+  orxMemory_Lock();
+
+  /* Frame memory? (it's only released by orxMemory_ResetFrameArena(), its header mustn't be read) */
+  if(orxMemory_IsInFrameArena(_pMem) != orxFALSE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_MEMORY, "[%p] Frame memory can't be freed.", _pMem);
+
+    /* Ignores it */
+    pstHeader = orxNULL;
+  }
+  else
+  {
+    /* Gets its header */
+    pstHeader = orxMemory_GetHeader(_pMem);
+  }
+
+  /* Unlocks */
+  orxMemory_Unlock();
+
+#else /* __orxDEBUG__ */
+
+  /* Gets its header */
+  pstHeader = orxMemory_GetHeader(_pMem);
+
+#endif /* __orxDEBUG__ */
+
+  /* Valid? */
+  if(pstHeader != orxNULL)
+  {
+    /* Checks */
+    orxASSERT(pstHeader->eMemType < orxMEMORY_TYPE_NUMBER);
+
+    /* Was counted in statistics? */
+    if(pstHeader->u16Flags & orxMEMORY_KU16_HEADER_FLAG_STATS)
+    {
+      /* Updates stats */
+      orxMemory_Lock();
+      orxMemory_UpdateStats(pstHeader->eMemType, 0, pstHeader->u32Size, -1);
+      orxMemory_Unlock();
+    }
+
+    /* Frees block */
+    orxMemory_RawFree(pstHeader, pstHeader->eMemType);
+  }
+
+  return;
+}
+
+/** Enables / disables statistics, only blocks allocated while they're enabled are counted
+ * @param[in] _bEnable    Enable / disable
+ */
+void orxFASTCALL orxMemory_EnableStats(orxBOOL _bEnable)
+{
+  /* Module initialized ? */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates flags */
+    sstMemory.u32Flags |= orxMEMORY_KU32_STATIC_FLAG_STATS;
+  }
+  else
+  {
+    /* Updates flags */
+    sstMemory.u32Flags &= ~orxMEMORY_KU32_STATIC_FLAG_STATS;
+  }
+
+  return;
+}
+
+/** Gets the number of allocations made while statistics were enabled
+ * @return Allocation counter
+ */
+orxU32 orxFASTCALL orxMemory_GetAllocationCounter()
+{
+  /* Module initialized ? */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstMemory.u32AllocationCounter;
+}
+
+/** Gets statistics of a memory type
+ * @param[in]  _eMemType  Concerned memory type
+ * @param[out] _pstStats  Statistics of the memory type
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxMemory_GetStats(orxMEMORY_TYPE _eMemType, orxMEMORY_STATS *_pstStats)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Module initialized ? */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstStats != orxNULL);
+
+  /* Valid type? */
+  if(_eMemType < orxMEMORY_TYPE_NUMBER)
+  {
+    /* Copies stats */
+    orxMemory_Lock();
+    orxMemory_Copy(_pstStats, &(sstMemory.astStats[_eMemType]), sizeof(orxMEMORY_STATS));
+    orxMemory_Unlock();
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Logs statistics of all memory types
+ */
+void orxFASTCALL orxMemory_LogStats()
+{
+  orxMEMORY_STATS astStats[orxMEMORY_TYPE_NUMBER];
+  orxU32          i;
+
+  /* Module initialized ? */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Has frame arena? */
+  if(sstMemory.stFrameArena.pstFirstChunk != orxNULL)
+  {
+    /* Logs its usage */
+    orxLOG("[MEMORY] frame arena: %lu bytes used at peak, in %lu chunks.", sstMemory.stFrameArena.u32PeakSize, sstMemory.stFrameArena.u32ChunkCounter);
+  }
+
+  /* Gets a consistent copy of all stats */
+  orxMemory_Lock();
+  orxMemory_Copy(astStats, sstMemory.astStats, orxMEMORY_TYPE_NUMBER * sizeof(orxMEMORY_STATS));
+  orxMemory_Unlock();
+
+  /* For all memory types */
+  for(i = 0; i < orxMEMORY_TYPE_NUMBER; i++)
+  {
+    const orxMEMORY_STATS *pstStats;
+
+    /* Gets its stats */
+    pstStats = &(astStats[i]);
+
+    /* Was used? */
+    if(pstStats->u32TotalCounter != 0)
+    {
+      /* Logs them */
+      orxLOG("[MEMORY] %-10s: %8lu bytes in %6lu blocks (peak: %8lu bytes in %6lu blocks), %8lu allocations%s.", sazMemoryTypeName[i], pstStats->u32Size, pstStats->u32Counter, pstStats->u32PeakSize, pstStats->u32PeakCounter, pstStats->u32TotalCounter, (sstMemory.astAllocator[i].pfnAllocate != orxNULL) ? " [custom]" : orxSTRING_EMPTY);
+    }
+  }
+
+  return;
+}
+
+/** Allocates frame memory: it's only valid until the end of the current frame and mustn't be freed
+ * @param[in] _u32Size    Size of the memory to allocate
+ * @return Allocated memory / orxNULL
+ */
+void *orxFASTCALL orxMemory_AllocateFrame(orxU32 _u32Size)
+{
+  orxMEMORY_ARENA  *pstArena;
+  orxU32            u32Size;
+  void             *pResult = orxNULL;
+
+  /* Module initialized ? */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+  orxASSERT(orxMemory_IsMainThread() != orxFALSE);
+
+  /* Gets arena */
+  pstArena = &(sstMemory.stFrameArena);
+
+  /* Gets aligned size */
+  u32Size = _orxALIGN(_u32Size, orxMEMORY_KU32_HEADER_SIZE);
+
+  /* Doesn't fit in current chunk? */
+  if((pstArena->pstCurrentChunk == orxNULL)
+  || (u32Size > (orxU32)(pstArena->pstCurrentChunk->pu8End - pstArena->pu8Current)))
+  {
+    orxMEMORY_ARENA_CHUNK *pstChunk;
+
+    /* Gets next chunk */
+    pstChunk = (pstArena->pstCurrentChunk != orxNULL) ? pstArena->pstCurrentChunk->pstNext : pstArena->pstFirstChunk;
+
+    /* None or too small? */
+    if((pstChunk == orxNULL)
+    || (u32Size > (orxU32)(pstChunk->pu8End - orxMemory_GetChunkData(pstChunk))))
+    {
+      orxU32 u32ChunkSize;
+
+      /* Gets chunk size */
+      u32ChunkSize = orxMEMORY_KU32_HEADER_SIZE + ((u32Size > orxMEMORY_KU32_FRAME_ARENA_SIZE) ? u32Size : orxMEMORY_KU32_FRAME_ARENA_SIZE);
+
+      /* Allocates it */
+      pstChunk = (orxMEMORY_ARENA_CHUNK *)malloc(u32ChunkSize);
+
+      /* Success? */
+      if(pstChunk != orxNULL)
+      {
+        /* Inits it */
+        pstChunk->pu8End = (orxU8 *)pstChunk + u32ChunkSize;
+
+        /* Links it after current one */
+        orxMemory_Lock();
+        if(pstArena->pstCurrentChunk != orxNULL)
+        {
+          pstChunk->pstNext                   = pstArena->pstCurrentChunk->pstNext;
+          pstArena->pstCurrentChunk->pstNext  = pstChunk;
+        }
+        else
+        {
+          pstChunk->pstNext       = pstArena->pstFirstChunk;
+          pstArena->pstFirstChunk = pstChunk;
+        }
+        orxMemory_Unlock();
+
+        /* Updates chunk counter */
+        pstArena->u32ChunkCounter++;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_MEMORY, "Couldn't allocate %lu bytes of frame memory.", _u32Size);
+      }
+    }
+
+    /* Valid? */
+    if(pstChunk != orxNULL)
+    {
+      /* Uses it */
+      pstArena->pstCurrentChunk = pstChunk;
+      pstArena->pu8Current      = orxMemory_GetChunkData(pstChunk);
+    }
+  }
+
+  /* Has room? */
+  if((pstArena->pstCurrentChunk != orxNULL)
+  && (u32Size <= (orxU32)(pstArena->pstCurrentChunk->pu8End - pstArena->pu8Current)))
+  {
+    /* Gets block */
+    pResult = pstArena->pu8Current;
+
+    /* Updates arena */
+    pstArena->pu8Current   += u32Size;
+    pstArena->u32FrameSize += u32Size;
+  }
+
+  /* Done! */
+  return pResult;
+}
+
+/** Resets the frame arena, releasing all frame memory
+ */
+void orxFASTCALL orxMemory_ResetFrameArena()
+{
+  orxMEMORY_ARENA *pstArena;
+
+  /* Module initialized ? */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+  orxASSERT(orxMemory_IsMainThread() != orxFALSE);
+
+  /* Gets arena */
+  pstArena = &(sstMemory.stFrameArena);
+
+  /* Updates peak size */
+  if(pstArena->u32FrameSize > pstArena->u32PeakSize)
+  {
+    pstArena->u32PeakSize = pstArena->u32FrameSize;
+  }
+
+#ifdef __orxDEBUG__
+
+  /* Was used? */
+  if(pstArena->pstCurrentChunk != orxNULL)
+  {
+    orxMEMORY_ARENA_CHUNK *pstChunk;
+
+    /* For all chunks used during this frame */
+    for(pstChunk = pstArena->pstFirstChunk; pstChunk != pstArena->pstCurrentChunk; pstChunk = pstChunk->pstNext)
+    {
+      /* Poisons its memory */
+      orxMemory_Set(orxMemory_GetChunkData(pstChunk), orxMEMORY_KU8_FRAME_ARENA_POISON, (orxU32)(pstChunk->pu8End - orxMemory_GetChunkData(pstChunk)));
+    }
+
+    /* Poisons used part of current chunk */
+    orxMemory_Set(orxMemory_GetChunkData(pstChunk), orxMEMORY_KU8_FRAME_ARENA_POISON, (orxU32)(pstArena->pu8Current - orxMemory_GetChunkData(pstChunk)));
+  }
+
+#endif /* __orxDEBUG__ */
+
+  /* Resets arena, chunks are kept for next frames */
+  pstArena->pstCurrentChunk = orxNULL;
+  pstArena->pu8Current      = orxNULL;
+  pstArena->u32FrameSize    = 0;
 
   return;
 }
 
+/** Sets a custom allocator for a memory type
+ * @param[in]  _eMemType    Concerned memory type
+ * @param[in]  _pfnAllocate Allocate function, orxNULL to restore the system allocator
+ * @param[in]  _pfnFree     Free function, orxNULL to restore the system allocator
+ * @param[in]  _pContext    Context that will be given to both functions
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxMemory_SetAllocator(orxMEMORY_TYPE _eMemType, orxMEMORY_ALLOCATE_FUNCTION _pfnAllocate, orxMEMORY_FREE_FUNCTION _pfnFree, void *_pContext)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Module initialized ? */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
+  orxASSERT((_pfnAllocate != orxNULL) == (_pfnFree != orxNULL));
+
+  /* Locks statistics */
+  orxMemory_Lock();
+
+  /* No live allocation? */
+  if(sstMemory.astStats[_eMemType].u32Counter == 0)
+  {
+    /* Stores allocator */
+    sstMemory.astAllocator[_eMemType].pfnAllocate = _pfnAllocate;
+    sstMemory.astAllocator[_eMemType].pfnFree     = _pfnFree;
+    sstMemory.astAllocator[_eMemType].pContext    = _pContext;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_MEMORY, "Can't change allocator of memory type <%s>: %lu blocks are still allocated.", sazMemoryTypeName[_eMemType], sstMemory.astStats[_eMemType].u32Counter);
+  }
+
+  /* Unlocks statistics */
+  orxMemory_Unlock();
+
+  /* Done! */
+  return eResult;
+}
+
 /** Copy a portion of memory into another one
  * @param[out] _pDest     Destination pointer
  * @param[in] _pSrc       Pointer of memory from where data are read
@@ -225,5 +933,78 @@ void *orxFASTCALL orxMemory_Zero(void *_pDest, orxU32 _u32Size)
  */
 void *orxFASTCALL orxMemory_Reallocate(void *_pMem, orxU32 _u32Size)
 {
-  return((void *)realloc(_pMem, _u32Size));
+  void *pResult;
+
+  /* Module initialized ? */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* No block yet? */
+  if(_pMem == orxNULL)
+  {
+    /* Allocates it */
+    pResult = orxMemory_Allocate(_u32Size, orxMEMORY_TYPE_MAIN);
+  }
+  else
+  {
+    orxMEMORY_HEADER *pstHeader;
+    orxMEMORY_TYPE    eMemType;
+    orxU32            u32OldSize;
+
+    /* Checks */
+    orxASSERT(orxMemory_IsInFrameArena(_pMem) == orxFALSE);
+
+    /* Gets its header */
+    pstHeader   = orxMemory_GetHeader(_pMem);
+    eMemType    = pstHeader->eMemType;
+    u32OldSize  = pstHeader->u32Size;
+
+    /* Custom allocator? */
+    if(sstMemory.astAllocator[eMemType].pfnAllocate != orxNULL)
+    {
+      /* Allocates new block */
+      pResult = orxMemory_Allocate(_u32Size, eMemType);
+
+      /* Success? */
+      if(pResult != orxNULL)
+      {
+        /* Copies content */
+        orxMemory_Copy(pResult, _pMem, (u32OldSize < _u32Size) ? u32OldSize : _u32Size);
+
+        /* Frees old block */
+        orxMemory_Free(_pMem);
+      }
+    }
+    else
+    {
+      /* Reallocates block with its header */
+      pstHeader = (orxMEMORY_HEADER *)realloc(pstHeader, _u32Size + orxMEMORY_KU32_HEADER_SIZE);
+
+      /* Success? */
+      if(pstHeader != orxNULL)
+      {
+        /* Updates block info */
+        pstHeader->u32Size = _u32Size;
+
+        /* Is counted in statistics? */
+        if(pstHeader->u16Flags & orxMEMORY_KU16_HEADER_FLAG_STATS)
+        {
+          /* Updates stats */
+          orxMemory_Lock();
+          orxMemory_UpdateStats(eMemType, _u32Size, u32OldSize, 0);
+          orxMemory_Unlock();
+        }
+
+        /* Updates result */
+        pResult = (orxU8 *)pstHeader + orxMEMORY_KU32_HEADER_SIZE;
+      }
+      else
+      {
+        /* Updates result */
+        pResult = orxNULL;
+      }
+    }
+  }
+
+  /* Done! */
+  return pResult;
 }
@@ -84,6 +84,7 @@ struct __orxFRAME_t
 {
   orxSTRUCTURE      stStructure;            /**< Public structure, first structure member : 16 */
   orxFRAME_DATA_2D  stData;                 /**< Frame data : 76 */
+  orxU32            u32Revision;            /**< Global data revision : 80 */
 };
 
 /** Static structure
@@ -93,6 +94,7 @@ typedef struct __orxFRAME_STATIC_t
   orxU32    u32Flags;                       /**< Control flags : 4 */
   orxFRAME *pstRoot;                        /**< Frame root : 8 */
   orxBANK  *pst2DDataBank;                  /**< 2D Data bank : 12 */
+  orxU32    u32Revision;                    /**< Last given revision : 16 */
 
 } orxFRAME_STATIC;
 
@@ -128,6 +130,9 @@ static orxINLINE void _orxFrame_SetPosition(orxFRAME *_pstFrame, const orxVECTOR
     {
       orxVector_Copy(&(_pstFrame->stData.vGlobalPos), _pvPos);
 
+      /* Updates revision */
+      _pstFrame->u32Revision = ++sstFrame.u32Revision;
+
       break;
     }
 
@@ -168,6 +173,9 @@ static orxINLINE void _orxFrame_SetRotation(orxFRAME *_pstFrame, orxFLOAT _fAngl
     {
       _pstFrame->stData.fGlobalAngle  = _fAngle;
 
+      /* Updates revision */
+      _pstFrame->u32Revision = ++sstFrame.u32Revision;
+
       break;
     }
 
@@ -210,6 +218,9 @@ static orxINLINE void _orxFrame_SetScale(orxFRAME *_pstFrame, const orxVECTOR *_
       _pstFrame->stData.fGlobalScaleX = _pvScale->fX;
       _pstFrame->stData.fGlobalScaleY = _pvScale->fY;
 
+      /* Updates revision */
+      _pstFrame->u32Revision = ++sstFrame.u32Revision;
+
       break;
 
     case orxFRAME_SPACE_LOCAL:
@@ -670,6 +681,9 @@ orxFRAME *orxFASTCALL orxFrame_Create(orxU32 _u32Flags)
     /* Inits flags */
     orxStructure_SetFlags(pstFrame, _u32Flags & orxFRAME_KU32_MASK_USER_ALL, orxFRAME_KU32_MASK_ALL);
 
+    /* Inits revision */
+    pstFrame->u32Revision = ++sstFrame.u32Revision;
+
     /* Inits members */
     if(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_DATA_2D)
     {
@@ -802,6 +816,23 @@ orxBOOL orxFASTCALL orxFrame_IsDirty(const orxFRAME *_pstFrame)
   return bResult;
 }
 
+/** Gets a frame revision, which changes every time the frame global data (position, rotation or scale) changes
+ * @param[in]   _pstFrame       Concerned frame
+ * @return Revision, unique among all frames
+ */
+orxU32 orxFASTCALL orxFrame_GetRevision(orxFRAME *_pstFrame)
+{
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstFrame);
+
+  /* Process dirty cell */
+  orxFrame_ProcessDirty(_pstFrame);
+
+  /* Done! */
+  return _pstFrame->u32Revision;
+}
+
 /** Sets a frame position
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _eSpace         Coordinate space system to use
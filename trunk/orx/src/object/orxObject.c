@@ -32,6 +32,7 @@
 #include "debug/orxDebug.h"
 #include "core/orxConfig.h"
 #include "core/orxEvent.h"
+#include "math/orxBatch.h"
 #include "memory/orxMemory.h"
 #include "anim/orxAnimPointer.h"
 #include "display/orxGraphic.h"
@@ -62,6 +63,7 @@
 
 #define orxOBJECT_KU32_FLAG_2D                  0x00000010  /**< 2D flag */
 #define orxOBJECT_KU32_FLAG_HAS_COLOR           0x00000020  /**< Has color flag */
+#define orxOBJECT_KU32_FLAG_STATIC              0x00000040  /**< Static flag */
 #define orxOBJECT_KU32_FLAG_ENABLED             0x10000000  /**< Enabled flag */
 #define orxOBJECT_KU32_FLAG_PAUSED              0x20000000  /**< Paused flag */
 #define orxOBJECT_KU32_FLAG_RENDERED            0x40000000  /**< Rendered flag */
@@ -91,6 +93,7 @@
 /** Misc defines
  */
 #define orxOBJECT_KU32_NEIGHBOR_LIST_SIZE       128
+#define orxOBJECT_KU32_BOX_BUFFER_FLOAT_NUMBER  8           /**< Floats per object in box buffer */
 
 #define orxOBJECT_KZ_CONFIG_GRAPHIC_NAME        "Graphic"
 #define orxOBJECT_KZ_CONFIG_ANIMPOINTER_NAME    "AnimationSet"
@@ -120,6 +123,7 @@
 #define orxOBJECT_KZ_CONFIG_PARENT_CAMERA       "ParentCamera"
 #define orxOBJECT_KZ_CONFIG_USE_RELATIVE_SPEED  "UseRelativeSpeed"
 #define orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE    "UseParentSpace"
+#define orxOBJECT_KZ_CONFIG_STATIC              "Static"
 
 #define orxOBJECT_KZ_CENTERED_PIVOT             "centered"
 #define orxOBJECT_KZ_X                          "x"
@@ -158,14 +162,24 @@ struct __orxOBJECT_t
   orxFLOAT          fAngularVelocity;           /**< Angular velocity : 116 */
   orxVECTOR         vSpeed;                     /**< Object speed : 128 */
   orxCOLOR          stColor;                    /**< Object color : 144 */
+  orxOBOX           stBoundingBox;              /**< Cached bounding box : 204 */
+  orxAABOX          stBoundingAABox;            /**< Cached axis aligned bounding box : 228 */
+  orxVECTOR         vBoundingSize;              /**< Graphic size used for cached boxes : 240 */
+  orxVECTOR         vBoundingPivot;             /**< Graphic pivot used for cached boxes : 252 */
+  orxU32            u32BoundingRevision;        /**< Frame revision used for cached boxes, 0 if none : 256 */
+  orxU32            u32BoundingFlip;            /**< Flipping used for cached boxes : 260 */
 };
 
 /** Static structure
  */
 typedef struct __orxOBJECT_STATIC_t
 {
-  orxCLOCK *pstClock;                           /**< Clock */
-  orxU32    u32Flags;                           /**< Control flags */
+  orxCLOCK         *pstClock;                   /**< Clock */
+  orxU32            u32Flags;                   /**< Control flags */
+  orxU32            u32BoxSize;                 /**< Box buffer size */
+  orxOBJECT       **apstBoxObject;              /**< Box buffer objects */
+  orxU8            *au8BoxResult;               /**< Box buffer test results */
+  orxBATCH_OBOX     stBox;                      /**< Box buffer boxes */
 
 } orxOBJECT_STATIC;
 
@@ -183,6 +197,186 @@ static orxOBJECT_STATIC sstObject;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Updates object's cached bounding boxes if its frame, graphic size, pivot or flipping changed
+ * @param[in]   _pstObject      Concerned object
+ * @return      Cached bounding box / orxNULL if object has no bounding box
+ */
+static orxINLINE const orxOBOX *orxObject_UpdateBoundingBox(orxOBJECT *_pstObject)
+{
+  orxGRAPHIC     *pstGraphic;
+  orxFRAME       *pstFrame;
+  orxVECTOR       vSize;
+  const orxOBOX  *pstResult = orxNULL;
+
+  /* Is 2D and has frame & sized graphic? */
+  if((orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_2D))
+  && ((pstFrame = orxOBJECT_GET_STRUCTURE(_pstObject, FRAME)) != orxNULL)
+  && ((pstGraphic = orxOBJECT_GET_STRUCTURE(_pstObject, GRAPHIC)) != orxNULL)
+  && (orxGraphic_GetSize(pstGraphic, &vSize) != orxNULL))
+  {
+    orxVECTOR vPivot;
+    orxBOOL   bObjectFlipX, bObjectFlipY, bGraphicFlipX, bGraphicFlipY;
+    orxU32    u32Revision, u32Flip;
+
+    /* Gets pivot, frame revision & combined flipping */
+    orxGraphic_GetPivot(pstGraphic, &vPivot);
+    u32Revision = orxFrame_GetRevision(pstFrame);
+    orxObject_GetFlip(_pstObject, &bObjectFlipX, &bObjectFlipY);
+    orxGraphic_GetFlip(pstGraphic, &bGraphicFlipX, &bGraphicFlipY);
+    u32Flip     = ((bObjectFlipX ^ bGraphicFlipX) ? orxFRAME_KU32_FLAG_FLIP_X : orxFRAME_KU32_FLAG_NONE)
+                | ((bObjectFlipY ^ bGraphicFlipY) ? orxFRAME_KU32_FLAG_FLIP_Y : orxFRAME_KU32_FLAG_NONE);
+
+    /* Cache outdated? */
+    if((u32Revision != _pstObject->u32BoundingRevision)
+    || (u32Flip != _pstObject->u32BoundingFlip)
+    || (orxVector_AreEqual(&vSize, &(_pstObject->vBoundingSize)) == orxFALSE)
+    || (orxVector_AreEqual(&vPivot, &(_pstObject->vBoundingPivot)) == orxFALSE))
+    {
+      orxVECTOR vPosition, vScale, vBoxPivot, vBoxSize;
+
+      /* Stores cache key */
+      _pstObject->u32BoundingRevision = u32Revision;
+      _pstObject->u32BoundingFlip     = u32Flip;
+      orxVector_Copy(&(_pstObject->vBoundingSize), &vSize);
+      orxVector_Copy(&(_pstObject->vBoundingPivot), &vPivot);
+
+      /* Gets world position & scale */
+      orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vPosition);
+      orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vScale);
+
+      /* Flipped pivots are mirrored, as when rendering */
+      orxVector_Copy(&vBoxPivot, &vPivot);
+      if(u32Flip & orxFRAME_KU32_FLAG_FLIP_X)
+      {
+        vBoxPivot.fX = vSize.fX - vBoxPivot.fX;
+      }
+      if(u32Flip & orxFRAME_KU32_FLAG_FLIP_Y)
+      {
+        vBoxPivot.fY = vSize.fY - vBoxPivot.fY;
+      }
+
+      /* Updates pivot & size */
+      orxVector_Mul(&vBoxSize, &vSize, &vScale);
+      orxVector_Mul(&vBoxPivot, &vBoxPivot, &vScale);
+
+      /* Updates boxes */
+      orxOBox_2DSet(&(_pstObject->stBoundingBox), &vPosition, &vBoxPivot, &vBoxSize, orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL));
+      orxOBox_2DGetAABox(&(_pstObject->stBoundingBox), &(_pstObject->stBoundingAABox));
+    }
+
+    /* Updates result */
+    pstResult = &(_pstObject->stBoundingBox);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets bounding boxes of all objects in the box buffer, rejecting the ones whose axis aligned bounding box is outside a filter
+ * @param[in]   _pstFilter      Axis aligned box filter
+ * @param[in]   _bFilterZ       Filters on Z-axis too?
+ * @param[in]   _bEnabledOnly   Only gets enabled objects
+ * @return      Number of objects in the box buffer
+ */
+static orxU32 orxFASTCALL orxObject_GetAllBoundingBoxes(const orxAABOX *_pstFilter, orxBOOL _bFilterZ, orxBOOL _bEnabledOnly)
+{
+  orxSTRUCTURE *const  *apstObjectList;
+  orxU32                u32ObjectNumber, u32Number, i, u32Result = 0;
+
+  /* Gets all objects */
+  apstObjectList = orxStructure_GetArray(orxSTRUCTURE_ID_OBJECT, &u32ObjectNumber);
+
+  /* Gets object number */
+  u32Number = u32ObjectNumber;
+
+  /* Box buffer too small? */
+  if(u32Number > sstObject.u32BoxSize)
+  {
+    orxU8 *pu8Buffer;
+
+    /* Gets new size */
+    u32Number = orxMAX(u32Number, sstObject.u32BoxSize << 1);
+
+    /* Allocates all buffers at once (pointers first for alignment) */
+    pu8Buffer = (orxU8 *)orxMemory_Allocate(u32Number * (sizeof(orxOBJECT *) + (orxOBJECT_KU32_BOX_BUFFER_FLOAT_NUMBER * sizeof(orxFLOAT)) + sizeof(orxU8)), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(pu8Buffer != orxNULL)
+    {
+      orxFLOAT *pfBuffer;
+
+      /* Frees previous buffers */
+      if(sstObject.apstBoxObject != orxNULL)
+      {
+        orxMemory_Free(sstObject.apstBoxObject);
+      }
+
+      /* Stores objects */
+      sstObject.u32BoxSize    = u32Number;
+      sstObject.apstBoxObject = (orxOBJECT **)pu8Buffer;
+      pfBuffer                = (orxFLOAT *)(sstObject.apstBoxObject + u32Number);
+
+      /* Stores boxes */
+      sstObject.stBox.afOriginX       = pfBuffer;
+      sstObject.stBox.afOriginY       = (pfBuffer += u32Number);
+      sstObject.stBox.afXX            = (pfBuffer += u32Number);
+      sstObject.stBox.afXY            = (pfBuffer += u32Number);
+      sstObject.stBox.afYX            = (pfBuffer += u32Number);
+      sstObject.stBox.afYY            = (pfBuffer += u32Number);
+      sstObject.stBox.afZ             = (pfBuffer += u32Number);
+      sstObject.stBox.afDepth         = (pfBuffer += u32Number);
+
+      /* Stores results */
+      sstObject.au8BoxResult          = (orxU8 *)(pfBuffer + u32Number);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to allocate box buffer for %ld objects.", u32Number);
+    }
+  }
+
+  /* For all objects */
+  for(i = 0; (i < u32ObjectNumber) && (u32Result < sstObject.u32BoxSize); i++)
+  {
+    orxOBJECT     *pstObject;
+    const orxOBOX *pstBox;
+
+    /* Gets object */
+    pstObject = (orxOBJECT *)apstObjectList[i];
+
+    /* Enabled if needed and has bounding box? */
+    if(((_bEnabledOnly == orxFALSE) || (orxObject_IsEnabled(pstObject) != orxFALSE))
+    && ((pstBox = orxObject_UpdateBoundingBox(pstObject)) != orxNULL))
+    {
+      /* Axis aligned bounding box intersects filter? */
+      if((_bFilterZ != orxFALSE)
+       ? (orxAABox_TestIntersection(_pstFilter, &(pstObject->stBoundingAABox)) != orxFALSE)
+       : (orxAABox_Test2DIntersection(_pstFilter, &(pstObject->stBoundingAABox)) != orxFALSE))
+      {
+        /* Stores object */
+        sstObject.apstBoxObject[u32Result]    = pstObject;
+
+        /* Stores its bounding box */
+        sstObject.stBox.afOriginX[u32Result]  = pstBox->vPosition.fX - pstBox->vPivot.fX;
+        sstObject.stBox.afOriginY[u32Result]  = pstBox->vPosition.fY - pstBox->vPivot.fY;
+        sstObject.stBox.afXX[u32Result]       = pstBox->vX.fX;
+        sstObject.stBox.afXY[u32Result]       = pstBox->vX.fY;
+        sstObject.stBox.afYX[u32Result]       = pstBox->vY.fX;
+        sstObject.stBox.afYY[u32Result]       = pstBox->vY.fY;
+        sstObject.stBox.afZ[u32Result]        = pstBox->vPosition.fZ;
+        sstObject.stBox.afDepth[u32Result]    = pstBox->vZ.fZ;
+
+        /* Updates result */
+        u32Result++;
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Deletes all the objects
  */
 static orxINLINE void orxObject_DeleteAll()
@@ -492,6 +686,15 @@ void orxFASTCALL orxObject_Exit()
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_OBJECT);
 
+    /* Has box buffer? */
+    if(sstObject.apstBoxObject != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(sstObject.apstBoxObject);
+      sstObject.apstBoxObject = orxNULL;
+      sstObject.u32BoxSize    = 0;
+    }
+
     /* Updates flags */
     sstObject.u32Flags &= ~orxOBJECT_KU32_STATIC_FLAG_READY;
   }
@@ -1125,6 +1328,13 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxObject_SetLifeTime(pstResult, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_LIFETIME));
       }
 
+      /* Static? */
+      if(orxConfig_GetBool(orxOBJECT_KZ_CONFIG_STATIC) != orxFALSE)
+      {
+        /* Updates flags */
+        u32Flags |= orxOBJECT_KU32_FLAG_STATIC;
+      }
+
       /* Updates flags */
       orxStructure_SetFlags(pstResult, u32Flags, orxOBJECT_KU32_FLAG_NONE);
 
@@ -1437,6 +1647,45 @@ orxBOOL orxFASTCALL orxObject_IsRendered(const orxOBJECT *_pstObject)
   return(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_RENDERED));
 }
 
+/** Sets static status of an object
+ * @param[in]   _pstObject    Concerned object
+ * @param[in]   _bStatic      Static or not
+ */
+void orxFASTCALL    orxObject_SetStatic(orxOBJECT *_pstObject, orxBOOL _bStatic)
+{
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstObject);
+
+  /* Static? */
+  if(_bStatic != orxFALSE)
+  {
+    /* Updates status flags */
+    orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_STATIC, orxOBJECT_KU32_FLAG_NONE);
+  }
+  else
+  {
+    /* Updates status flags */
+    orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_STATIC);
+  }
+
+  return;
+}
+
+/** Is object static?
+ * @param[in]   _pstObject    Concerned object
+ * @return      orxTRUE if static, orxFALSE otherwise
+ */
+orxBOOL orxFASTCALL orxObject_IsStatic(const orxOBJECT *_pstObject)
+{
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstObject);
+
+  /* Done! */
+  return(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_STATIC));
+}
+
 /** Sets user data for an object
  * @param[in]   _pstObject    Concerned object
  * @param[in]   _pUserData    User data to store / orxNULL
@@ -3295,6 +3544,34 @@ orxOBJECT *orxFASTCALL orxObject_Raycast(const orxVECTOR *_pvStart, const orxVEC
   return pstResult;
 }
 
+/** Issues a batch of queries (rays, box & sphere overlaps) to test for potential objects
+ * @param[in]   _astQueryList   List of queries
+ * @param[in]   _u32QueryNumber Number of queries
+ * @param[out]  _astHitList     List that will receive the hits: hOwner will hold the orxOBJECT (orxNULL if the body isn't owned by an object)
+ * @param[in]   _u32HitNumber   Size of the hit list, extra hits are dropped
+ * @return Number of hits written in _astHitList
+ */
+orxU32 orxFASTCALL orxObject_Query(const orxPHYSICS_QUERY *_astQueryList, orxU32 _u32QueryNumber, orxPHYSICS_HIT *_astHitList, orxU32 _u32HitNumber)
+{
+  orxU32 i, u32Result;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+
+  /* Issues queries */
+  u32Result = orxBody_Query(_astQueryList, _u32QueryNumber, _astHitList, _u32HitNumber);
+
+  /* For all hits */
+  for(i = 0; i < u32Result; i++)
+  {
+    /* Only keeps object owners */
+    _astHitList[i].hOwner = (orxHANDLE)orxOBJECT((orxSTRUCTURE *)_astHitList[i].hOwner);
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Gets object's bounding box (OBB)
  * @param[in]   _pstObject      Concerned object
  * @param[in]   _pstBoundingBox Bounding box result
@@ -3302,35 +3579,58 @@ orxOBJECT *orxFASTCALL orxObject_Raycast(const orxVECTOR *_pvStart, const orxVEC
  */
 orxOBOX *orxFASTCALL orxObject_GetBoundingBox(const orxOBJECT *_pstObject, orxOBOX *_pstBoundingBox)
 {
-  orxVECTOR   vSize;
-  orxGRAPHIC *pstGraphic;
-  orxOBOX    *pstResult;
+  const orxOBOX  *pstBox;
+  orxOBOX        *pstResult;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstObject);
   orxASSERT(_pstBoundingBox != orxNULL);
 
-  /* Is 2D and has sized graphic? */
-  if((orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_2D))
-  && ((pstGraphic = orxOBJECT_GET_STRUCTURE(_pstObject, GRAPHIC)) != orxNULL)
-  && (orxGraphic_GetSize(pstGraphic, &vSize) != orxNULL))
+  /* Gets cached box */
+  pstBox = orxObject_UpdateBoundingBox((orxOBJECT *)_pstObject);
+
+  /* Valid? */
+  if(pstBox != orxNULL)
   {
-    orxVECTOR vPivot, vPosition, vScale;
-    orxFLOAT  fAngle;
+    /* Copies it */
+    orxOBox_Copy(_pstBoundingBox, pstBox);
+
+    /* Updates result */
+    pstResult = _pstBoundingBox;
+  }
+  else
+  {
+    /* Updates result */
+    pstResult = orxNULL;
+
+    /* Cleans it */
+    orxMemory_Zero(_pstBoundingBox, sizeof(orxOBOX));
+  }
+
+  /* Done! */
+  return pstResult;
+}
 
-    /* Gets pivot, position, scale & rotation */
-    orxObject_GetPivot(_pstObject, &vPivot);
-    orxObject_GetWorldPosition(_pstObject, &vPosition);
-    orxObject_GetWorldScale(_pstObject, &vScale);
-    fAngle = orxObject_GetWorldRotation(_pstObject);
+/** Gets object's axis aligned bounding box (AABB), ie. the one enclosing its bounding box
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _pstBoundingBox Axis aligned bounding box result
+ * @return      Axis aligned bounding box / orxNULL
+ */
+orxAABOX *orxFASTCALL orxObject_GetBoundingAABox(const orxOBJECT *_pstObject, orxAABOX *_pstBoundingBox)
+{
+  orxAABOX *pstResult;
 
-    /* Updates pivot & size */
-    orxVector_Mul(&vSize, &vSize, &vScale);
-    orxVector_Mul(&vPivot, &vPivot, &vScale);
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstObject);
+  orxASSERT(_pstBoundingBox != orxNULL);
 
-    /* Updates box */
-    orxOBox_2DSet(_pstBoundingBox, &vPosition, &vPivot, &vSize, fAngle);
+  /* Has bounding box? */
+  if(orxObject_UpdateBoundingBox((orxOBJECT *)_pstObject) != orxNULL)
+  {
+    /* Copies cached one */
+    orxAABox_Copy(_pstBoundingBox, &(_pstObject->stBoundingAABox));
 
     /* Updates result */
     pstResult = _pstBoundingBox;
@@ -3947,54 +4247,56 @@ const orxSTRING orxFASTCALL orxObject_GetName(const orxOBJECT *_pstObject)
 
 /** Creates a list of object at neighboring of the given box (ie. whose bounding volume intersects this box)
  * @param[in]   _pstCheckBox    Box to check intersection with
- * @return      orxBANK / orxNULL
+ * @return      orxBANK (only valid until the end of the current frame) / orxNULL
  */
 orxBANK *orxFASTCALL orxObject_CreateNeighborList(const orxOBOX *_pstCheckBox)
 {
-  orxOBOX    stObjectBox;
-  orxOBJECT  *pstObject;
   orxBANK    *pstResult;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstCheckBox != orxNULL);
 
-  /* Creates bank */
-  pstResult = orxBank_Create(orxOBJECT_KU32_NEIGHBOR_LIST_SIZE, sizeof(orxOBJECT *), orxBANK_KU32_FLAG_NOT_EXPANDABLE, orxMEMORY_TYPE_TEMP);
+  /* Creates bank in frame memory */
+  pstResult = orxBank_Create(orxOBJECT_KU32_NEIGHBOR_LIST_SIZE, sizeof(orxOBJECT *), orxBANK_KU32_FLAG_NOT_EXPANDABLE | orxBANK_KU32_FLAG_FRAME_MEMORY, orxMEMORY_TYPE_TEMP);
 
   /* Valid? */
   if(pstResult != orxNULL)
   {
-    orxU32 u32Counter;
+    orxAABOX  stFilter;
+    orxU32    u32Number, i;
+
+    /* Gets check box's enclosing axis aligned box */
+    orxOBox_2DGetAABox(_pstCheckBox, &stFilter);
+
+    /* Gets bounding boxes of all objects whose axis aligned boxes intersect it */
+    u32Number = orxObject_GetAllBoundingBoxes(&stFilter, orxTRUE, orxFALSE);
+
+    /* Tests them against check box */
+    orxBatch_2DTestOBoxIntersection(&(sstObject.stBox), u32Number, _pstCheckBox, sstObject.au8BoxResult);
 
     /* For all objects */
-    for(u32Counter = 0, pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
-        (u32Counter < orxOBJECT_KU32_NEIGHBOR_LIST_SIZE) && (pstObject != orxNULL);
-        pstObject = orxOBJECT(orxStructure_GetNext(pstObject)), u32Counter++)
+    for(i = 0; i < u32Number; i++)
     {
-      /* Gets its bounding box */
-      if(orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
+      /* Is intersecting? */
+      if(sstObject.au8BoxResult[i] != 0)
       {
-        /* Is intersecting? */
-        if(orxOBox_2DTestIntersection(_pstCheckBox, &stObjectBox) != orxFALSE)
-        {
-          orxOBJECT **ppstObject;
+        orxOBJECT **ppstObject;
 
-          /* Creates a new cell */
-          ppstObject = (orxOBJECT **)orxBank_Allocate(pstResult);
+        /* Creates a new cell */
+        ppstObject = (orxOBJECT **)orxBank_Allocate(pstResult);
 
-          /* Valid? */
-          if(ppstObject != orxNULL)
-          {
-            /* Adds object */
-            *ppstObject = pstObject;
-          }
-          else
-          {
-            /* Logs message */
-            orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to allocate new cell.");
-            break;
-          }
+        /* Valid? */
+        if(ppstObject != orxNULL)
+        {
+          /* Adds object */
+          *ppstObject = sstObject.apstBoxObject[i];
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to allocate new cell.");
+          break;
         }
       }
     }
@@ -4319,54 +4621,38 @@ orxFLOAT orxFASTCALL orxObject_GetLifeTime(const orxOBJECT *_pstObject)
  */
 orxOBJECT *orxFASTCALL orxObject_Pick(const orxVECTOR *_pvPosition)
 {
+  orxAABOX    stFilter;
   orxFLOAT    fSelectedZ;
-  orxOBJECT  *pstResult = orxNULL, *pstObject;
+  orxU32      u32Number, i;
+  orxOBJECT  *pstResult = orxNULL;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pvPosition != orxNULL);
 
+  /* Uses position as a degenerate filter box */
+  orxAABox_Set(&stFilter, _pvPosition, _pvPosition);
+
+  /* Gets bounding boxes of all enabled objects whose axis aligned boxes contain position */
+  u32Number = orxObject_GetAllBoundingBoxes(&stFilter, orxFALSE, orxTRUE);
+
+  /* Tests position against them */
+  orxBatch_2DIsInsideOBox(&(sstObject.stBox), u32Number, _pvPosition, sstObject.au8BoxResult);
+
   /* For all objects */
-  for(pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT)), fSelectedZ = _pvPosition->fZ;
-      pstObject != orxNULL;
-      pstObject = orxOBJECT(orxStructure_GetNext(pstObject)))
+  for(i = 0, fSelectedZ = _pvPosition->fZ; i < u32Number; i++)
   {
-    /* Is enabled? */
-    if(orxObject_IsEnabled(pstObject) != orxFALSE)
+    /* Is position in 2D box and object under position? */
+    if((sstObject.au8BoxResult[i] != 0) && (sstObject.stBox.afZ[i] >= _pvPosition->fZ))
     {
-      orxGRAPHIC *pstGraphic;
-
-      /* Has graphic? */
-      if((pstGraphic = orxOBJECT_GET_STRUCTURE(pstObject, GRAPHIC)) != orxNULL)
+      /* No selection or above it? */
+      if((pstResult == orxNULL) || (sstObject.stBox.afZ[i] <= fSelectedZ))
       {
-        orxVECTOR vObjectPos;
-
-        /* Gets object position */
-        orxObject_GetWorldPosition(pstObject, &vObjectPos);
-
-        /* Is under position? */
-        if(vObjectPos.fZ >= _pvPosition->fZ)
-        {
-          /* No selection or above it? */
-          if((pstResult == orxNULL) || (vObjectPos.fZ <= fSelectedZ))
-          {
-            orxOBOX stObjectBox;
+        /* Updates result */
+        pstResult = sstObject.apstBoxObject[i];
 
-            /* Gets its bounding box */
-            if(orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
-            {
-              /* Is position in 2D box? */
-              if(orxOBox_2DIsInside(&stObjectBox, _pvPosition) != orxFALSE)
-              {
-                /* Updates result */
-                pstResult = pstObject;
-
-                /* Updates selected position */
-                fSelectedZ = vObjectPos.fZ;
-              }
-            }
-          }
-        }
+        /* Updates selected position */
+        fSelectedZ = sstObject.stBox.afZ[i];
       }
     }
   }
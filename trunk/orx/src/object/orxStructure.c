@@ -50,11 +50,28 @@
 
 #define orxSTRUCTURE_KU32_STRUCTURE_BANK_SIZE 32
 
+#define orxSTRUCTURE_KU32_SLOT_TABLE_SIZE     64
+
+#define orxSTRUCTURE_KU32_HANDLE_SHIFT_ID     32
+#define orxSTRUCTURE_KU32_HANDLE_SHIFT_GEN    40
+#define orxSTRUCTURE_KU32_HANDLE_MASK_ID      0x000000FF
+#define orxSTRUCTURE_KU32_HANDLE_MASK_GEN     0x00FFFFFF
+
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Internal handle slot
+ */
+typedef struct __orxSTRUCTURE_SLOT_t
+{
+  orxSTRUCTURE             *pstStructure;     /**< Structure, orxNULL if slot is free : 4 */
+  orxU32                    u32Generation;    /**< Slot generation, increased when freed : 8 */
+  orxU32                    u32NextFree;      /**< Next free slot index : 12 */
+
+} orxSTRUCTURE_SLOT;
+
 /** Internal storage structure
  */
 typedef struct __orxSTRUCTURE_STORAGE_t
@@ -62,12 +79,18 @@ typedef struct __orxSTRUCTURE_STORAGE_t
   orxSTRUCTURE_STORAGE_TYPE eType;            /**< Storage type : 4 */
   orxBANK                  *pstNodeBank;      /**< Associated node bank : 8 */
   orxBANK                  *pstStructureBank; /**< Associated structure bank : 12 */
+  orxSTRUCTURE_SLOT        *astSlotList;      /**< Handle slot table : 16 */
+  orxU32                    u32SlotSize;      /**< Handle slot table size : 20 */
+  orxU32                    u32SlotCounter;   /**< Handle slot table used size : 24 */
+  orxU32                    u32FreeSlot;      /**< First free slot index : 28 */
+  orxSTRUCTURE            **apstDenseList;    /**< Packed structure array, same size as slot table : 32 */
+  orxU32                    u32DenseCounter;  /**< Packed structure counter : 36 */
 
   union
   {
-    orxLINKLIST             stLinkList;       /**< Linklist : 24 */
-    orxTREE                 stTree;           /**< Tree : 20 */
-  };                                          /**< Storage union : 24 */
+    orxLINKLIST             stLinkList;       /**< Linklist : 48 */
+    orxTREE                 stTree;           /**< Tree : 44 */
+  };                                          /**< Storage union : 48 */
 
 } orxSTRUCTURE_STORAGE;
 
@@ -93,6 +116,8 @@ typedef struct __orxSTRUCTURE_STORAGE_NODE_t
   };                                          /**< Storage node union : 16 */
   orxSTRUCTURE *pstStructure;                 /**< Pointer to structure : 20 */
   orxSTRUCTURE_STORAGE_TYPE eType;            /**< Storage type : 24 */
+  orxU32 u32Slot;                             /**< Handle slot index : 28 */
+  orxU32 u32DenseIndex;                       /**< Index in packed structure array : 32 */
 
 } orxSTRUCTURE_STORAGE_NODE;
 
@@ -120,6 +145,157 @@ static orxSTRUCTURE_STATIC sstStructure;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Allocates a handle slot for a structure
+ * @param[in]   _eStructureID   Concerned structure ID
+ * @param[in]   _pstStructure   Structure to store
+ * @return      Slot index / orxU32_UNDEFINED
+ */
+static orxU32 orxFASTCALL orxStructure_AllocateSlot(orxSTRUCTURE_ID _eStructureID, orxSTRUCTURE *_pstStructure)
+{
+  orxSTRUCTURE_STORAGE *pstStorage;
+  orxU32                u32Result = orxU32_UNDEFINED;
+
+  /* Gets storage */
+  pstStorage = &(sstStructure.astStorage[_eStructureID]);
+
+  /* Has a free slot? */
+  if(pstStorage->u32FreeSlot != orxU32_UNDEFINED)
+  {
+    /* Uses it */
+    u32Result = pstStorage->u32FreeSlot;
+
+    /* Updates free list */
+    pstStorage->u32FreeSlot = pstStorage->astSlotList[u32Result].u32NextFree;
+  }
+  else
+  {
+    /* Table full? */
+    if(pstStorage->u32SlotCounter == pstStorage->u32SlotSize)
+    {
+      orxSTRUCTURE_SLOT  *astSlotList;
+      orxSTRUCTURE      **apstDenseList;
+      orxU32              u32Size;
+
+      /* Gets new size */
+      u32Size = (pstStorage->u32SlotSize != 0) ? pstStorage->u32SlotSize << 1 : orxSTRUCTURE_KU32_SLOT_TABLE_SIZE;
+
+      /* Grows packed array (there can't be more live structures than used slots) */
+      apstDenseList = (pstStorage->apstDenseList != orxNULL)
+                    ? (orxSTRUCTURE **)orxMemory_Reallocate(pstStorage->apstDenseList, u32Size * sizeof(orxSTRUCTURE *))
+                    : (orxSTRUCTURE **)orxMemory_Allocate(u32Size * sizeof(orxSTRUCTURE *), orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(apstDenseList != orxNULL)
+      {
+        /* Stores it */
+        pstStorage->apstDenseList = apstDenseList;
+
+        /* Grows table */
+        astSlotList = (pstStorage->astSlotList != orxNULL)
+                    ? (orxSTRUCTURE_SLOT *)orxMemory_Reallocate(pstStorage->astSlotList, u32Size * sizeof(orxSTRUCTURE_SLOT))
+                    : (orxSTRUCTURE_SLOT *)orxMemory_Allocate(u32Size * sizeof(orxSTRUCTURE_SLOT), orxMEMORY_TYPE_MAIN);
+
+        /* Success? */
+        if(astSlotList != orxNULL)
+        {
+          /* Stores it */
+          pstStorage->astSlotList = astSlotList;
+          pstStorage->u32SlotSize = u32Size;
+        }
+      }
+    }
+
+    /* Has room? */
+    if(pstStorage->u32SlotCounter < pstStorage->u32SlotSize)
+    {
+      /* Uses next slot */
+      u32Result = pstStorage->u32SlotCounter++;
+
+      /* Inits its generation (0 is never issued) */
+      pstStorage->astSlotList[u32Result].u32Generation = 1;
+    }
+  }
+
+  /* Valid? */
+  if(u32Result != orxU32_UNDEFINED)
+  {
+    /* Stores structure */
+    pstStorage->astSlotList[u32Result].pstStructure = _pstStructure;
+    pstStorage->astSlotList[u32Result].u32NextFree  = orxU32_UNDEFINED;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Frees a handle slot, invalidating all the handles issued for it
+ * @param[in]   _eStructureID   Concerned structure ID
+ * @param[in]   _u32Slot        Slot index
+ */
+static orxINLINE void orxStructure_FreeSlot(orxSTRUCTURE_ID _eStructureID, orxU32 _u32Slot)
+{
+  orxSTRUCTURE_STORAGE *pstStorage;
+  orxSTRUCTURE_SLOT    *pstSlot;
+
+  /* Gets storage & slot */
+  pstStorage  = &(sstStructure.astStorage[_eStructureID]);
+  pstSlot     = &(pstStorage->astSlotList[_u32Slot]);
+
+  /* Checks */
+  orxASSERT(_u32Slot < pstStorage->u32SlotCounter);
+
+  /* Cleans it */
+  pstSlot->pstStructure = orxNULL;
+
+  /* Increases its generation, skipping 0 */
+  pstSlot->u32Generation = (pstSlot->u32Generation + 1) & orxSTRUCTURE_KU32_HANDLE_MASK_GEN;
+  if(pstSlot->u32Generation == 0)
+  {
+    pstSlot->u32Generation = 1;
+  }
+
+  /* Adds it to free list */
+  pstSlot->u32NextFree    = pstStorage->u32FreeSlot;
+  pstStorage->u32FreeSlot = _u32Slot;
+
+  return;
+}
+
+/** Cleans handle slot table & packed structure array
+ * @param[in]   _eStructureID   Concerned structure ID
+ */
+static orxINLINE void orxStructure_CleanSlotTable(orxSTRUCTURE_ID _eStructureID)
+{
+  orxSTRUCTURE_STORAGE *pstStorage;
+
+  /* Gets storage */
+  pstStorage = &(sstStructure.astStorage[_eStructureID]);
+
+  /* Has table? */
+  if(pstStorage->astSlotList != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(pstStorage->astSlotList);
+  }
+
+  /* Has packed array? */
+  if(pstStorage->apstDenseList != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(pstStorage->apstDenseList);
+  }
+
+  /* Cleans them */
+  pstStorage->astSlotList     = orxNULL;
+  pstStorage->u32SlotSize     = 0;
+  pstStorage->u32SlotCounter  = 0;
+  pstStorage->u32FreeSlot     = orxU32_UNDEFINED;
+  pstStorage->apstDenseList   = orxNULL;
+  pstStorage->u32DenseCounter = 0;
+
+  return;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -158,6 +334,9 @@ orxSTATUS orxFASTCALL orxStructure_Init()
 
       /* Cleans storage type */
       sstStructure.astStorage[i].eType = orxSTRUCTURE_STORAGE_TYPE_NONE;
+
+      /* Cleans free slot list */
+      sstStructure.astStorage[i].u32FreeSlot = orxU32_UNDEFINED;
     }
 
     /* All banks created? */
@@ -243,6 +422,9 @@ void orxFASTCALL orxStructure_Exit()
         /* Deletes it */
         orxBank_Delete(sstStructure.astStorage[i].pstStructureBank);
       }
+
+      /* Cleans slot table */
+      orxStructure_CleanSlotTable((orxSTRUCTURE_ID)i);
     }
 
     /* Updates flags */
@@ -328,6 +510,9 @@ orxSTATUS orxFASTCALL orxStructure_Unregister(orxSTRUCTURE_ID _eStructureID)
     /* Deletes structure storage bank */
     orxBank_Delete(sstStructure.astStorage[_eStructureID].pstStructureBank);
 
+    /* Cleans slot table */
+    orxStructure_CleanSlotTable(_eStructureID);
+
     /* Unregisters it */
     orxMemory_Zero(&(sstStructure.astInfo[_eStructureID]), sizeof(orxSTRUCTURE_REGISTER_INFO));
     sstStructure.astStorage[_eStructureID].pstStructureBank = orxNULL;
@@ -379,8 +564,11 @@ orxSTRUCTURE *orxFASTCALL orxStructure_Create(orxSTRUCTURE_ID _eStructureID)
         /* Stores its type */
         pstNode->eType = sstStructure.astStorage[_eStructureID].eType;
 
+        /* Gets a handle slot */
+        pstNode->u32Slot = orxStructure_AllocateSlot(_eStructureID, pstStructure);
+
         /* Dependig on type */
-        switch(pstNode->eType)
+        switch((pstNode->u32Slot != orxU32_UNDEFINED) ? pstNode->eType : orxSTRUCTURE_STORAGE_TYPE_NONE)
         {
         case orxSTRUCTURE_STORAGE_TYPE_LINKLIST:
 
@@ -408,7 +596,7 @@ orxSTRUCTURE *orxFASTCALL orxStructure_Create(orxSTRUCTURE_ID _eStructureID)
         default:
 
           /* Logs message */
-          orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Invalid structure storage type.");
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, (pstNode->u32Slot != orxU32_UNDEFINED) ? "Invalid structure storage type." : "Failed to allocate handle slot.");
 
           /* Wrong type */
           eResult = orxSTATUS_FAILURE;
@@ -428,12 +616,23 @@ orxSTRUCTURE *orxFASTCALL orxStructure_Create(orxSTRUCTURE_ID _eStructureID)
 
           /* Stores structure pointer */
           pstNode->pstStructure       = pstStructure;
+
+          /* Adds it at the end of packed array */
+          pstNode->u32DenseIndex      = sstStructure.astStorage[_eStructureID].u32DenseCounter++;
+          sstStructure.astStorage[_eStructureID].apstDenseList[pstNode->u32DenseIndex] = pstStructure;
         }
         else
         {
           /* Logs message */
           orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed adding node to list.");
 
+          /* Has slot? */
+          if(pstNode->u32Slot != orxU32_UNDEFINED)
+          {
+            /* Frees it */
+            orxStructure_FreeSlot(_eStructureID, pstNode->u32Slot);
+          }
+
           /* Frees allocated node & structure */
           orxBank_Free(sstStructure.astStorage[_eStructureID].pstNodeBank, pstNode);
           orxBank_Free(sstStructure.astStorage[_eStructureID].pstStructureBank, pstStructure);
@@ -488,6 +687,9 @@ orxSTATUS orxFASTCALL orxStructure_Delete(void *_pStructure)
   /* Valid? */
   if(pstNode != orxNULL)
   {
+    orxSTRUCTURE_STORAGE *pstStorage;
+    orxSTRUCTURE         *pstLast;
+
     /* Dependig on type */
     switch(sstStructure.astStorage[orxStructure_GetID(_pStructure)].eType)
     {
@@ -511,6 +713,17 @@ orxSTATUS orxFASTCALL orxStructure_Delete(void *_pStructure)
         break;
     }
 
+    /* Gets storage */
+    pstStorage = &(sstStructure.astStorage[orxStructure_GetID(_pStructure)]);
+
+    /* Swap-removes it from packed array */
+    pstLast = pstStorage->apstDenseList[--(pstStorage->u32DenseCounter)];
+    pstStorage->apstDenseList[pstNode->u32DenseIndex] = pstLast;
+    ((orxSTRUCTURE_STORAGE_NODE *)pstLast->hStorageNode)->u32DenseIndex = pstNode->u32DenseIndex;
+
+    /* Frees its handle slot */
+    orxStructure_FreeSlot(orxStructure_GetID(_pStructure), pstNode->u32Slot);
+
     /* Deletes it */
     orxBank_Free(sstStructure.astStorage[orxStructure_GetID(_pStructure)].pstNodeBank, pstNode);
 
@@ -530,6 +743,98 @@ orxSTATUS orxFASTCALL orxStructure_Delete(void *_pStructure)
   return orxSTATUS_SUCCESS;
 }
 
+/** Gets structure handle
+ * @param[in]   _pStructure    Concerned structure
+ * @return      orxSTRUCTURE_HANDLE
+ */
+orxSTRUCTURE_HANDLE orxFASTCALL orxStructure_GetHandle(const void *_pStructure)
+{
+  register const orxSTRUCTURE_STORAGE_NODE *pstNode;
+  register orxSTRUCTURE_ID eID;
+  orxSTRUCTURE_HANDLE hResult;
+
+  /* Checks */
+  orxASSERT(sstStructure.u32Flags & orxSTRUCTURE_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pStructure);
+
+  /* Gets storage node & ID */
+  pstNode = (const orxSTRUCTURE_STORAGE_NODE *)((orxSTRUCTURE *)_pStructure)->hStorageNode;
+  eID     = orxStructure_GetID(_pStructure);
+
+  /* Builds handle: generation | ID | slot index */
+  hResult = (((orxSTRUCTURE_HANDLE)sstStructure.astStorage[eID].astSlotList[pstNode->u32Slot].u32Generation) << orxSTRUCTURE_KU32_HANDLE_SHIFT_GEN)
+          | (((orxSTRUCTURE_HANDLE)eID) << orxSTRUCTURE_KU32_HANDLE_SHIFT_ID)
+          | ((orxSTRUCTURE_HANDLE)pstNode->u32Slot);
+
+  /* Done! */
+  return hResult;
+}
+
+/** Gets structure from its handle
+ * @param[in]   _hHandle       Concerned handle
+ * @return      orxSTRUCTURE / orxNULL if the structure has been deleted
+ */
+orxSTRUCTURE *orxFASTCALL orxStructure_GetFromHandle(orxSTRUCTURE_HANDLE _hHandle)
+{
+  register orxU32 u32ID, u32Slot;
+  register orxSTRUCTURE *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(sstStructure.u32Flags & orxSTRUCTURE_KU32_STATIC_FLAG_READY);
+
+  /* Gets ID & slot index */
+  u32ID   = (orxU32)(_hHandle >> orxSTRUCTURE_KU32_HANDLE_SHIFT_ID) & orxSTRUCTURE_KU32_HANDLE_MASK_ID;
+  u32Slot = (orxU32)(_hHandle & 0xFFFFFFFF);
+
+  /* Valid slot? */
+  if((u32ID < orxSTRUCTURE_ID_NUMBER) && (u32Slot < sstStructure.astStorage[u32ID].u32SlotCounter))
+  {
+    register const orxSTRUCTURE_SLOT *pstSlot;
+
+    /* Gets it */
+    pstSlot = &(sstStructure.astStorage[u32ID].astSlotList[u32Slot]);
+
+    /* Same generation? */
+    if(pstSlot->u32Generation == (orxU32)(_hHandle >> orxSTRUCTURE_KU32_HANDLE_SHIFT_GEN))
+    {
+      /* Updates result */
+      pstResult = pstSlot->pstStructure;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Is the structure referenced by the handle still alive?
+ * @param[in]   _hHandle       Concerned handle
+ * @return      orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxStructure_IsAlive(orxSTRUCTURE_HANDLE _hHandle)
+{
+  /* Done! */
+  return (orxStructure_GetFromHandle(_hHandle) != orxNULL) ? orxTRUE : orxFALSE;
+}
+
+/** Gets all the structures of a given type as a packed array
+ * @param[in]   _eStructureID   Concerned structure ID
+ * @param[out]  _pu32Number     Number of structures in the array
+ * @return      Structure array (valid till next creation/deletion of this type) / orxNULL
+ */
+orxSTRUCTURE *const *orxFASTCALL orxStructure_GetArray(orxSTRUCTURE_ID _eStructureID, orxU32 *_pu32Number)
+{
+  /* Checks */
+  orxASSERT(sstStructure.u32Flags & orxSTRUCTURE_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eStructureID < orxSTRUCTURE_ID_NUMBER);
+  orxASSERT(_pu32Number != orxNULL);
+
+  /* Stores number */
+  *_pu32Number = sstStructure.astStorage[_eStructureID].u32DenseCounter;
+
+  /* Done! */
+  return sstStructure.astStorage[_eStructureID].apstDenseList;
+}
+
 /** Gets structure storage type
  * @param[in]   _eStructureID   Concerned structure ID
  * @return      orxSTRUCTURE_STORAGE_TYPE
@@ -1598,6 +1598,36 @@ orxBODY *orxFASTCALL orxBody_Raycast(const orxVECTOR *_pvStart, const orxVECTOR
   return pstResult;
 }
 
+/** Issues a batch of queries (rays, box & sphere overlaps) to test for potential bodies
+ * @param[in]   _astQueryList   List of queries
+ * @param[in]   _u32QueryNumber Number of queries
+ * @param[out]  _astHitList     List that will receive the hits: hBody will hold the orxBODY and hOwner its owner
+ * @param[in]   _u32HitNumber   Size of the hit list, extra hits are dropped
+ * @return Number of hits written in _astHitList
+ */
+orxU32 orxFASTCALL orxBody_Query(const orxPHYSICS_QUERY *_astQueryList, orxU32 _u32QueryNumber, orxPHYSICS_HIT *_astHitList, orxU32 _u32HitNumber)
+{
+  orxU32 i, u32Result;
+
+  /* Checks */
+  orxASSERT(sstBody.u32Flags & orxBODY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astQueryList != orxNULL) || (_u32QueryNumber == 0));
+  orxASSERT((_astHitList != orxNULL) || (_u32HitNumber == 0));
+
+  /* Issues queries */
+  u32Result = orxPhysics_Query(_astQueryList, _u32QueryNumber, _astHitList, _u32HitNumber);
+
+  /* For all hits */
+  for(i = 0; i < u32Result; i++)
+  {
+    /* Stores its owner */
+    _astHitList[i].hOwner = (orxHANDLE)orxBody_GetOwner(orxBODY(_astHitList[i].hBody));
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Applies physics simulation result to the Body
  * @param[in]   _pstBody                      Concerned body
  * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
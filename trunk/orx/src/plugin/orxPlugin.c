@@ -1286,3 +1286,38 @@ const orxSTRING orxFASTCALL orxPlugin_GetName(orxHANDLE _hPluginHandle)
   /* Done! */
   return zPluginName;
 }
+
+/** Is a core function loaded? Used to probe optional core functions without calling their default implementation
+ * @param[in] _eFunctionID      Concerned core function ID
+ * @return orxTRUE if a plugin provides it, orxFALSE otherwise
+ */
+orxBOOL orxFASTCALL orxPlugin_IsCoreFunctionLoaded(orxPLUGIN_FUNCTION_ID _eFunctionID)
+{
+  const orxPLUGIN_CORE_FUNCTION  *pstCoreFunction;
+  orxU32                          u32PluginIndex, u32FunctionIndex;
+  orxBOOL                         bResult = orxFALSE;
+
+  /* Checks */
+  orxASSERT(sstPlugin.u32Flags & orxPLUGIN_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eFunctionID & orxPLUGIN_KU32_FLAG_CORE_ID);
+
+  /* Gets plugin & function indices */
+  u32PluginIndex    = (_eFunctionID & orxPLUGIN_KU32_MASK_PLUGIN_ID) >> orxPLUGIN_KU32_SHIFT_PLUGIN_ID;
+  u32FunctionIndex  = _eFunctionID & orxPLUGIN_KU32_MASK_FUNCTION_ID;
+
+  /* Checks */
+  orxASSERT(u32PluginIndex < orxPLUGIN_CORE_ID_NUMBER);
+
+  /* Gets core function table */
+  pstCoreFunction = sstPlugin.astCoreInfo[u32PluginIndex].pstCoreFunctionTable;
+
+  /* Core plugin defined and function valid? */
+  if((pstCoreFunction != orxNULL) && (u32FunctionIndex < sstPlugin.astCoreInfo[u32PluginIndex].u32CoreFunctionCounter))
+  {
+    /* Updates result */
+    bResult = (*(pstCoreFunction[u32FunctionIndex].pfnFunction) != pstCoreFunction[u32FunctionIndex].pfnDefaultFunction) ? orxTRUE : orxFALSE;
+  }
+
+  /* Done! */
+  return bResult;
+}
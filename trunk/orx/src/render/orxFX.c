@@ -33,6 +33,7 @@
 #include "memory/orxMemory.h"
 #include "core/orxConfig.h"
 #include "core/orxClock.h"
+#include "core/orxEvent.h"
 #include "object/orxStructure.h"
 #include "utils/orxHashTable.h"
 #include "utils/orxString.h"
@@ -53,6 +54,7 @@
 
 #define orxFX_KU32_FLAG_ENABLED                 0x10000000  /**< Enabled flag */
 #define orxFX_KU32_FLAG_LOOP                    0x20000000  /**< Loop flag */
+#define orxFX_KU32_FLAG_CACHED                  0x40000000  /**< Kept in cache flag */
 
 #define orxFX_KU32_MASK_ALL                     0xFFFFFFFF  /**< All mask */
 
@@ -535,6 +537,55 @@ static orxINLINE void orxFX_DeleteAll()
   return;
 }
 
+/** Event handler
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxFX_EventHandler(const orxEVENT *_pstEvent)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_CONFIG);
+
+  /* Section update? */
+  if(_pstEvent->eID == orxCONFIG_EVENT_SECTION_UPDATE)
+  {
+    orxCONFIG_EVENT_PAYLOAD  *pstPayload;
+    orxFX                    *pstFX;
+    orxU32                    u32ID;
+
+    /* Gets payload */
+    pstPayload = (orxCONFIG_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+
+    /* Gets section ID */
+    u32ID = orxString_ToCRC(pstPayload->zSectionName);
+
+    /* Gets referenced FX */
+    pstFX = (orxFX *)orxHashTable_Get(sstFX.pstReferenceTable, u32ID);
+
+    /* Found? */
+    if(pstFX != orxNULL)
+    {
+      /* Removes it from reference table: current users keep it, new ones will get the updated version */
+      orxHashTable_Remove(sstFX.pstReferenceTable, u32ID);
+
+      /* Was kept in cache? */
+      if(orxStructure_TestFlags(pstFX, orxFX_KU32_FLAG_CACHED) != orxFALSE)
+      {
+        /* Updates flags */
+        orxStructure_SetFlags(pstFX, orxFX_KU32_FLAG_NONE, orxFX_KU32_FLAG_CACHED);
+
+        /* Releases cache reference */
+        orxFX_Delete(pstFX);
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -548,6 +599,7 @@ void orxFASTCALL orxFX_Setup()
   orxModule_AddDependency(orxMODULE_ID_FX, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_FX, orxMODULE_ID_STRUCTURE);
   orxModule_AddDependency(orxMODULE_ID_FX, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_FX, orxMODULE_ID_EVENT);
 
   return;
 }
@@ -576,6 +628,13 @@ orxSTATUS orxFASTCALL orxFX_Init()
     {
       /* Registers structure type */
       eResult = orxSTRUCTURE_REGISTER(FX, orxSTRUCTURE_STORAGE_TYPE_LINKLIST, orxMEMORY_TYPE_MAIN, orxNULL);
+
+      /* Success? */
+      if(eResult != orxSTATUS_FAILURE)
+      {
+        /* Registers config event handler */
+        eResult = orxEvent_AddHandler(orxEVENT_TYPE_CONFIG, orxFX_EventHandler);
+      }
     }
     else
     {
@@ -610,6 +669,9 @@ void orxFASTCALL orxFX_Exit()
   /* Initialized? */
   if(sstFX.u32Flags & orxFX_KU32_STATIC_FLAG_READY)
   {
+    /* Removes config event handler */
+    orxEvent_RemoveHandler(orxEVENT_TYPE_CONFIG, orxFX_EventHandler);
+
     /* Deletes FX list */
     orxFX_DeleteAll();
 
@@ -755,6 +817,9 @@ orxFX *orxFASTCALL orxFX_CreateFromConfig(const orxSTRING _zConfigID)
           {
             /* Increases its reference counter to keep it in cache table */
             orxStructure_IncreaseCounter(pstResult);
+
+            /* Updates flags */
+            orxStructure_SetFlags(pstResult, orxFX_KU32_FLAG_CACHED, orxFX_KU32_FLAG_NONE);
           }
         }
         else
@@ -811,8 +876,12 @@ orxSTATUS orxFASTCALL orxFX_Delete(orxFX *_pstFX)
     /* Not referenced? */
     if(orxStructure_GetRefCounter(_pstFX) == 0)
     {
-      /* Removes from hashtable */
-      orxHashTable_Remove(sstFX.pstReferenceTable, orxString_ToCRC(_pstFX->zReference));
+      /* Still the referenced one? */
+      if(orxHashTable_Get(sstFX.pstReferenceTable, orxString_ToCRC(_pstFX->zReference)) == _pstFX)
+      {
+        /* Removes from hashtable */
+        orxHashTable_Remove(sstFX.pstReferenceTable, orxString_ToCRC(_pstFX->zReference));
+      }
 
       /* Unprotects it */
       orxConfig_ProtectSection(_pstFX->zReference, orxFALSE);
@@ -128,6 +128,18 @@ static orxSTATUS orxFASTCALL orxShaderPointer_EventHandler(const orxEVENT *_pstE
   /* Depending on event ID */
   switch(_pstEvent->eID)
   {
+    case orxRENDER_EVENT_START:
+    {
+      /* Has shader pointers? */
+      if(orxStructure_GetCounter(orxSTRUCTURE_ID_SHADERPOINTER) > 0)
+      {
+        /* Shaders are rendered from main thread: needs display context */
+        orxEvent_SendShort(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_ACQUIRE_CONTEXT);
+      }
+
+      break;
+    }
+
     case orxRENDER_EVENT_VIEWPORT_STOP:
     case orxRENDER_EVENT_OBJECT_STOP:
     {
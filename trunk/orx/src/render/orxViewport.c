@@ -31,6 +31,7 @@
 
 #include "debug/orxDebug.h"
 #include "core/orxConfig.h"
+#include "display/orxDisplay.h"
 #include "math/orxMath.h"
 #include "memory/orxMemory.h"
 #include "object/orxStructure.h"
@@ -52,6 +53,8 @@
 #define orxVIEWPORT_KU32_FLAG_CAMERA            0x00000002  /**< Has camera flag */
 #define orxVIEWPORT_KU32_FLAG_TEXTURE           0x00000004  /**< Has texture flag */
 #define orxVIEWPORT_KU32_FLAG_CLEAR             0x00000008  /**< Clear background before render flag */
+#define orxVIEWPORT_KU32_FLAG_STATIC_CACHE      0x00000010  /**< Static objects are cached flag */
+#define orxVIEWPORT_KU32_FLAG_STATIC_CACHE_VALID 0x00000020 /**< Static cache content is valid flag */
 #define orxVIEWPORT_KU32_FLAG_INTERNAL_TEXTURE  0x10000000  /**< Internal texture handling flag  */
 #define orxVIEWPORT_KU32_FLAG_INTERNAL_SHADER   0x20000000  /**< Internal shader pointer handling flag  */
 #define orxVIEWPORT_KU32_FLAG_INTERNAL_CAMERA   0x40000000  /**< Internal camera handling flag  */
@@ -74,6 +77,7 @@
 #define orxVIEWPORT_KZ_CONFIG_CAMERA            "Camera"
 #define orxVIEWPORT_KZ_CONFIG_BACKGROUND_CLEAR  "BackgroundClear"
 #define orxVIEWPORT_KZ_CONFIG_SHADER_LIST       "ShaderList"
+#define orxVIEWPORT_KZ_CONFIG_STATIC_CACHE      "StaticCache"
 
 #define orxVIEWPORT_KZ_LEFT                     "left"
 #define orxVIEWPORT_KZ_RIGHT                    "right"
@@ -98,6 +102,8 @@ struct __orxVIEWPORT_t
   orxCAMERA        *pstCamera;                /**< Associated camera : 52 */
   orxTEXTURE       *pstTexture;               /**< Associated texture : 56 */
   orxSHADERPOINTER *pstShaderPointer;         /**< Shader pointer : 60 */
+  orxBITMAP        *pstStaticCache;           /**< Static objects cache : 64 */
+  orxU32            u32StaticCacheSignature;  /**< Static objects cache signature : 68 */
 };
 
 
@@ -158,6 +164,7 @@ void orxFASTCALL orxViewport_Setup()
   orxModule_AddDependency(orxMODULE_ID_VIEWPORT, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_VIEWPORT, orxMODULE_ID_STRUCTURE);
   orxModule_AddDependency(orxMODULE_ID_VIEWPORT, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_VIEWPORT, orxMODULE_ID_DISPLAY);
   orxModule_AddDependency(orxMODULE_ID_VIEWPORT, orxMODULE_ID_TEXTURE);
   orxModule_AddDependency(orxMODULE_ID_VIEWPORT, orxMODULE_ID_CAMERA);
   orxModule_AddDependency(orxMODULE_ID_VIEWPORT, orxMODULE_ID_SHADERPOINTER);
@@ -370,6 +377,9 @@ orxVIEWPORT *orxFASTCALL orxViewport_CreateFromConfig(const orxSTRING _zConfigID
         orxViewport_EnableBackgroundClearing(pstResult, orxTRUE);
       }
 
+      /* Updates static cache */
+      orxViewport_EnableStaticCache(pstResult, orxConfig_GetBool(orxVIEWPORT_KZ_CONFIG_STATIC_CACHE));
+
       /* Has background color? */
       if(orxConfig_HasValue(orxVIEWPORT_KZ_CONFIG_BACKGROUND_COLOR) != orxFALSE)
       {
@@ -492,6 +502,9 @@ orxSTATUS orxFASTCALL orxViewport_Delete(orxVIEWPORT *_pstViewport)
     /* Removes camera */
     orxViewport_SetCamera(_pstViewport, orxNULL);
 
+    /* Removes static cache */
+    orxViewport_EnableStaticCache(_pstViewport, orxFALSE);
+
     /* Was linked to a texture? */
     if(_pstViewport->pstTexture != orxNULL)
     {
@@ -749,6 +762,152 @@ orxBOOL orxFASTCALL orxViewport_IsBackgroundClearingEnabled(const orxVIEWPORT *_
   return(orxStructure_TestFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_CLEAR));
 }
 
+/** Enables / disables static objects cache for a viewport
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _bEnable        Enable / disable
+ */
+void orxFASTCALL orxViewport_EnableStaticCache(orxVIEWPORT *_pstViewport, orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates flags */
+    orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_STATIC_CACHE, orxVIEWPORT_KU32_FLAG_NONE);
+  }
+  else
+  {
+    /* Has cache? */
+    if(_pstViewport->pstStaticCache != orxNULL)
+    {
+      /* Deletes it */
+      orxDisplay_DeleteBitmap(_pstViewport->pstStaticCache);
+      _pstViewport->pstStaticCache = orxNULL;
+    }
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_NONE, orxVIEWPORT_KU32_FLAG_STATIC_CACHE | orxVIEWPORT_KU32_FLAG_STATIC_CACHE_VALID);
+  }
+
+  return;
+}
+
+/** Has a viewport static objects cache enabled?
+ * @param[in]   _pstViewport    Concerned viewport
+ * @return      orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxViewport_IsStaticCacheEnabled(const orxVIEWPORT *_pstViewport)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Tests */
+  return(orxStructure_TestFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_STATIC_CACHE));
+}
+
+/** Gets a viewport static objects cache, (re)creating it if its size doesn't match
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _u32Width       Cache width
+ * @param[in]   _u32Height      Cache height
+ * @return      orxBITMAP / orxNULL
+ */
+orxBITMAP *orxFASTCALL orxViewport_GetStaticCache(orxVIEWPORT *_pstViewport, orxU32 _u32Width, orxU32 _u32Height)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+  orxASSERT(orxStructure_TestFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_STATIC_CACHE));
+
+  /* Has cache? */
+  if(_pstViewport->pstStaticCache != orxNULL)
+  {
+    orxFLOAT fWidth, fHeight;
+
+    /* Gets its size */
+    orxDisplay_GetBitmapSize(_pstViewport->pstStaticCache, &fWidth, &fHeight);
+
+    /* Doesn't match? */
+    if((orxF2U(fWidth) != _u32Width) || (orxF2U(fHeight) != _u32Height))
+    {
+      /* Deletes it */
+      orxDisplay_DeleteBitmap(_pstViewport->pstStaticCache);
+      _pstViewport->pstStaticCache = orxNULL;
+    }
+  }
+
+  /* No cache? */
+  if(_pstViewport->pstStaticCache == orxNULL)
+  {
+    /* Creates it */
+    _pstViewport->pstStaticCache = orxDisplay_CreateBitmap(_u32Width, _u32Height);
+
+    /* Invalidates its content */
+    orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_NONE, orxVIEWPORT_KU32_FLAG_STATIC_CACHE_VALID);
+  }
+
+  /* Done! */
+  return _pstViewport->pstStaticCache;
+}
+
+/** Is a viewport static objects cache valid for a signature (camera & static objects state)?
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _u32Signature   Current signature
+ * @return      orxTRUE if cache content is valid for this signature, orxFALSE if it has to be redrawn
+ */
+orxBOOL orxFASTCALL orxViewport_IsStaticCacheValid(const orxVIEWPORT *_pstViewport, orxU32 _u32Signature)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Done! */
+  return((orxStructure_TestFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_STATIC_CACHE_VALID) != orxFALSE)
+      && (_pstViewport->u32StaticCacheSignature == _u32Signature)) ? orxTRUE : orxFALSE;
+}
+
+/** Validates a viewport static objects cache for a signature, once its content has been successfully captured
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _pstCache       Cache bitmap that has been captured, ignored if it's not the current cache anymore
+ * @param[in]   _u32Signature   Signature of the captured content
+ */
+void orxFASTCALL orxViewport_ValidateStaticCache(orxVIEWPORT *_pstViewport, const orxBITMAP *_pstCache, orxU32 _u32Signature)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Still current cache? */
+  if((_pstCache != orxNULL) && (_pstViewport->pstStaticCache == _pstCache))
+  {
+    /* Stores signature */
+    _pstViewport->u32StaticCacheSignature = _u32Signature;
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_STATIC_CACHE_VALID, orxVIEWPORT_KU32_FLAG_NONE);
+  }
+
+  return;
+}
+
+/** Invalidates a viewport static objects cache, forcing it to be redrawn (needed when static objects' textures are modified)
+ * @param[in]   _pstViewport    Concerned viewport
+ */
+void orxFASTCALL orxViewport_InvalidateStaticCache(orxVIEWPORT *_pstViewport)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Updates flags */
+  orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_NONE, orxVIEWPORT_KU32_FLAG_STATIC_CACHE_VALID);
+
+  return;
+}
+
 /** Sets a viewport camera
  * @param[in]   _pstViewport    Concerned viewport
  * @param[in]   _pstCamera      Associated camera
@@ -33,10 +33,13 @@
 #include "memory/orxMemory.h"
 #include "memory/orxBank.h"
 #include "sound/orxSoundSystem.h"
+#include "plugin/orxPlugin.h"
+#include "plugin/define/orxPlugin_CoreDefine.h"
 #include "core/orxConfig.h"
 #include "core/orxClock.h"
 #include "object/orxStructure.h"
 #include "utils/orxHashTable.h"
+#include "utils/orxLinkList.h"
 #include "utils/orxString.h"
 
 
@@ -45,6 +48,7 @@
 #define orxSOUND_KU32_STATIC_FLAG_NONE                  0x00000000  /**< No flags */
 
 #define orxSOUND_KU32_STATIC_FLAG_READY                 0x00000001  /**< Ready flag */
+#define orxSOUND_KU32_STATIC_FLAG_SAMPLE_SIZE           0x00000002  /**< Sample size flag (sound system plugin can report sample sizes) */
 
 #define orxSOUND_KU32_STATIC_MASK_ALL                   0xFFFFFFFF  /**< All mask */
 
@@ -58,9 +62,24 @@
 #define orxSOUND_KU32_MASK_ALL                          0xFFFFFFFF  /**< All mask */
 
 
+/** Sample flags
+ */
+#define orxSOUND_KU32_SAMPLE_FLAG_NONE                  0x00000000  /**< No flags */
+
+#define orxSOUND_KU32_SAMPLE_FLAG_KEEP_IN_CACHE         0x00000001  /**< Keep in cache flag: never evicted */
+
+
 /** Misc defines
  */
 #define orxSOUND_KU32_SAMPLE_BANK_SIZE                  32
+#define orxSOUND_KU32_GROUP_BANK_SIZE                   8
+
+#define orxSOUND_KU32_DEFAULT_CACHE_SIZE                (16 * 1024 * 1024)
+
+#define orxSOUND_KZ_CONFIG_SECTION                      "Sound"
+#define orxSOUND_KZ_CONFIG_CACHE_SIZE                   "CacheSize"
+#define orxSOUND_KZ_CONFIG_PREFETCH_GROUP_LIST          "PrefetchGroupList"
+#define orxSOUND_KZ_CONFIG_SOUND_LIST                   "SoundList"
 
 #define orxSOUND_KZ_CONFIG_SOUND                        "Sound"
 #define orxSOUND_KZ_CONFIG_MUSIC                        "Music"
@@ -80,12 +99,25 @@
  */
 typedef struct __orxSOUND_SAMPLE_t
 {
-  orxSOUNDSYSTEM_SAMPLE  *pstData;                      /**< Sound data : 4 */
-  orxU32                  u32ID;                        /**< Sample ID : 8 */
-  orxU32                  u32Counter;                   /**< Reference counter : 12 */  
+  orxLINKLIST_NODE        stNode;                       /**< Idle list node, first structure member : 12 */
+  orxSOUNDSYSTEM_SAMPLE  *pstData;                      /**< Sound data : 16 */
+  orxU32                  u32ID;                        /**< Sample ID : 20 */
+  orxU32                  u32Counter;                   /**< Reference counter : 24 */
+  orxU32                  u32Size;                      /**< Decoded data size : 28 */
+  orxU32                  u32Flags;                     /**< Sample flags : 32 */
 
 } orxSOUND_SAMPLE;
 
+/** Prefetch group structure
+ */
+typedef struct __orxSOUND_GROUP_t
+{
+  orxSOUND_SAMPLE       **apstSampleList;               /**< Prefetched samples : 4 */
+  orxU32                  u32SampleNumber;              /**< Number of prefetched samples : 8 */
+  orxU32                  u32ID;                        /**< Group ID : 12 */
+
+} orxSOUND_GROUP;
+
 /** Sound structure
  */
 struct __orxSOUND_t
@@ -102,6 +134,15 @@ typedef struct __orxSOUND_STATIC_t
 {
   orxHASHTABLE *pstReferenceTable;                      /**< Reference hash table */
   orxBANK      *pstSampleBank;                          /**< Sample bank */
+  orxHASHTABLE *pstGroupTable;                          /**< Prefetch group hash table */
+  orxBANK      *pstGroupBank;                           /**< Prefetch group bank */
+  orxLINKLIST   stIdleList;                             /**< Unreferenced samples, least recently used first */
+  orxU32        u32Budget;                              /**< Cache budget, in bytes */
+  orxU32        u32ResidentSize;                        /**< Size of all loaded samples, in bytes */
+  orxU32        u32IdleSize;                            /**< Size of unreferenced samples, in bytes */
+  orxU32        u32HitCounter;                          /**< Cache hit counter */
+  orxU32        u32MissCounter;                         /**< Cache miss counter */
+  orxU32        u32EvictionCounter;                     /**< Eviction counter */
   orxU32        u32Flags;                               /**< Control flags */
 
 } orxSOUND_STATIC;
@@ -120,6 +161,63 @@ static orxSOUND_STATIC sstSound;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Deletes a sound sample, whether it's referenced or not
+ * @param[in] _pstSample      Concerned sample
+ */
+static void orxFASTCALL orxSound_DeleteSample(orxSOUND_SAMPLE *_pstSample)
+{
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSample != orxNULL);
+
+  /* Idle? */
+  if(orxLinkList_GetList(&(_pstSample->stNode)) != orxNULL)
+  {
+    /* Removes it from idle list */
+    orxLinkList_Remove(&(_pstSample->stNode));
+
+    /* Updates idle size */
+    sstSound.u32IdleSize -= _pstSample->u32Size;
+  }
+
+  /* Updates resident size */
+  sstSound.u32ResidentSize -= _pstSample->u32Size;
+
+  /* Unloads its data */
+  orxSoundSystem_UnloadSample(_pstSample->pstData);
+
+  /* Removes it from reference table */
+  orxHashTable_Remove(sstSound.pstReferenceTable, _pstSample->u32ID);
+
+  /* Deletes it */
+  orxBank_Free(sstSound.pstSampleBank, _pstSample);
+
+  return;
+}
+
+/** Evicts least recently used unreferenced samples till the cache fits in its budget
+ */
+static void orxFASTCALL orxSound_TrimCache()
+{
+  orxSOUND_SAMPLE *pstSample;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+
+  /* While over budget with idle samples */
+  while((sstSound.u32ResidentSize > sstSound.u32Budget)
+     && ((pstSample = (orxSOUND_SAMPLE *)orxLinkList_GetFirst(&(sstSound.stIdleList))) != orxNULL))
+  {
+    /* Deletes it */
+    orxSound_DeleteSample(pstSample);
+
+    /* Updates eviction counter */
+    sstSound.u32EvictionCounter++;
+  }
+
+  return;
+}
+
 /** Loads a sound sample
  * @return orxSOUND_SAMPLE / orxNULL
  */
@@ -140,8 +238,21 @@ static orxINLINE orxSOUND_SAMPLE *orxSound_LoadSample(const orxSTRING _zFileName
   /* Found? */
   if(pstResult != orxNULL)
   {
+    /* Idle? */
+    if(orxLinkList_GetList(&(pstResult->stNode)) != orxNULL)
+    {
+      /* Removes it from idle list */
+      orxLinkList_Remove(&(pstResult->stNode));
+
+      /* Updates idle size */
+      sstSound.u32IdleSize -= pstResult->u32Size;
+    }
+
     /* Increases its reference counter */
     pstResult->u32Counter++;
+
+    /* Updates hit counter */
+    sstSound.u32HitCounter++;
   }
   else
   {
@@ -151,6 +262,9 @@ static orxINLINE orxSOUND_SAMPLE *orxSound_LoadSample(const orxSTRING _zFileName
     /* Valid? */
     if(pstResult != orxNULL)
     {
+      /* Cleans it */
+      orxMemory_Zero(pstResult, sizeof(orxSOUND_SAMPLE));
+
       /* Loads its data */
       pstResult->pstData = orxSoundSystem_LoadSample(_zFileName);
 
@@ -159,13 +273,30 @@ static orxINLINE orxSOUND_SAMPLE *orxSound_LoadSample(const orxSTRING _zFileName
       && (orxHashTable_Add(sstSound.pstReferenceTable, u32ID, pstResult) != orxSTATUS_FAILURE))
       {
         /* Inits its reference counter */
-        pstResult->u32Counter = 0;
+        pstResult->u32Counter = 1;
 
         /* Stores its ID */
         pstResult->u32ID = u32ID;
+
+        /* Stores its size */
+        pstResult->u32Size = orxFLAG_TEST(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_SAMPLE_SIZE) ? orxSoundSystem_GetSampleSize(pstResult->pstData) : 0;
+
+        /* Updates cache status */
+        sstSound.u32ResidentSize += pstResult->u32Size;
+        sstSound.u32MissCounter++;
+
+        /* Makes room for it */
+        orxSound_TrimCache();
       }
       else
       {
+        /* Has data? */
+        if(pstResult->pstData != orxNULL)
+        {
+          /* Unloads it */
+          orxSoundSystem_UnloadSample(pstResult->pstData);
+        }
+
         /* Deletes it */
         orxBank_Free(sstSound.pstSampleBank, pstResult);
 
@@ -173,39 +304,39 @@ static orxINLINE orxSOUND_SAMPLE *orxSound_LoadSample(const orxSTRING _zFileName
         pstResult = orxNULL;
 
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Failed to add sound to hashtable.");
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Failed to load sample <%s>.", _zFileName);
       }
     }
   }
 
   /* Done! */
-  return pstResult;  
+  return pstResult;
 }
 
-/** Unloads a sound sample
+/** Unloads a sound sample: unreferenced samples stay in cache till they're evicted
  */
 static orxINLINE void orxSound_UnloadSample(orxSOUND_SAMPLE *_pstSample)
 {
   /* Checks */
   orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstSample != orxNULL);
+  orxASSERT(_pstSample->u32Counter != 0);
+
+  /* Updates its reference counter */
+  _pstSample->u32Counter--;
 
-  /* Not referenced anymore? */
-  if(_pstSample->u32Counter == 0)
+  /* Not referenced anymore and not kept in cache? */
+  if((_pstSample->u32Counter == 0)
+  && (!orxFLAG_TEST(_pstSample->u32Flags, orxSOUND_KU32_SAMPLE_FLAG_KEEP_IN_CACHE)))
   {
-    /* Unloads its data */
-    orxSoundSystem_UnloadSample(_pstSample->pstData);
+    /* Adds it as most recently used idle sample */
+    orxLinkList_AddEnd(&(sstSound.stIdleList), &(_pstSample->stNode));
 
-    /* Removes it from reference table */
-    orxHashTable_Remove(sstSound.pstReferenceTable, _pstSample->u32ID);
+    /* Updates idle size */
+    sstSound.u32IdleSize += _pstSample->u32Size;
 
-    /* Deletes it */
-    orxBank_Free(sstSound.pstSampleBank, _pstSample);
-  }
-  else
-  {
-    /* Updates its reference counter */
-    _pstSample->u32Counter--;
+    /* Evicts over budget samples */
+    orxSound_TrimCache();
   }
 
   return;
@@ -224,7 +355,7 @@ static orxINLINE void orxSound_UnloadAllSample()
   while(pstSample != orxNULL)
   {
     /* Deletes it */
-    orxSound_UnloadSample(pstSample);
+    orxSound_DeleteSample(pstSample);
 
     /* Gets first sample */
     pstSample = (orxSOUND_SAMPLE *)orxBank_GetNext(sstSound.pstSampleBank, orxNULL);
@@ -233,6 +364,56 @@ static orxINLINE void orxSound_UnloadAllSample()
   return;
 }
 
+/** Deletes a prefetch group, releasing its samples
+ * @param[in] _pstGroup       Concerned group
+ */
+static void orxFASTCALL orxSound_DeleteGroup(orxSOUND_GROUP *_pstGroup)
+{
+  orxU32 i;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstGroup != orxNULL);
+
+  /* For all its samples */
+  for(i = 0; i < _pstGroup->u32SampleNumber; i++)
+  {
+    /* Releases it */
+    orxSound_UnloadSample(_pstGroup->apstSampleList[i]);
+  }
+
+  /* Has sample list? */
+  if(_pstGroup->apstSampleList != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(_pstGroup->apstSampleList);
+  }
+
+  /* Removes it from group table */
+  orxHashTable_Remove(sstSound.pstGroupTable, _pstGroup->u32ID);
+
+  /* Deletes it */
+  orxBank_Free(sstSound.pstGroupBank, _pstGroup);
+
+  return;
+}
+
+/** Deletes all the prefetch groups
+ */
+static orxINLINE void orxSound_DeleteAllGroup()
+{
+  orxSOUND_GROUP *pstGroup;
+
+  /* While there are groups */
+  while((pstGroup = (orxSOUND_GROUP *)orxBank_GetNext(sstSound.pstGroupBank, orxNULL)) != orxNULL)
+  {
+    /* Deletes it */
+    orxSound_DeleteGroup(pstGroup);
+  }
+
+  return;
+}
+
 /** Deletes all the sounds
  */
 static orxINLINE void orxSound_DeleteAll()
@@ -296,19 +477,39 @@ orxSTATUS orxFASTCALL orxSound_Init()
       /* Creates sample bank */
       sstSound.pstSampleBank = orxBank_Create(orxSOUND_KU32_SAMPLE_BANK_SIZE, sizeof(orxSOUND_SAMPLE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+      /* Creates group table & bank */
+      sstSound.pstGroupTable  = orxHashTable_Create(orxSOUND_KU32_GROUP_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      sstSound.pstGroupBank   = orxBank_Create(orxSOUND_KU32_GROUP_BANK_SIZE, sizeof(orxSOUND_GROUP), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
       /* Valid? */
-      if(sstSound.pstSampleBank != orxNULL)
+      if((sstSound.pstSampleBank != orxNULL)
+      && (sstSound.pstGroupTable != orxNULL)
+      && (sstSound.pstGroupBank != orxNULL))
       {
         /* Registers structure type */
         eResult = orxSTRUCTURE_REGISTER(SOUND, orxSTRUCTURE_STORAGE_TYPE_LINKLIST, orxMEMORY_TYPE_MAIN, orxNULL);
       }
       else
       {
+        /* Deletes everything that was created */
+        if(sstSound.pstSampleBank != orxNULL)
+        {
+          orxBank_Delete(sstSound.pstSampleBank);
+        }
+        if(sstSound.pstGroupTable != orxNULL)
+        {
+          orxHashTable_Delete(sstSound.pstGroupTable);
+        }
+        if(sstSound.pstGroupBank != orxNULL)
+        {
+          orxBank_Delete(sstSound.pstGroupBank);
+        }
+
         /* Deletes reference table */
         orxHashTable_Delete(sstSound.pstReferenceTable);
 
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Failed to create sample bank.");
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Failed to create sample & group storage.");
       }
     }
     else
@@ -331,6 +532,35 @@ orxSTATUS orxFASTCALL orxSound_Init()
   {
     /* Inits Flags */
     orxFLAG_SET(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_READY, orxSOUND_KU32_STATIC_FLAG_NONE);
+
+    /* Can sound system report sample sizes? (older plugins can't, their samples then don't count towards the cache budget) */
+    if(orxPlugin_IsCoreFunctionLoaded(orxPLUGIN_MAKE_CORE_FUNCTION_ID(orxPLUGIN_CORE_ID_SOUNDSYSTEM, orxPLUGIN_FUNCTION_BASE_ID_SOUNDSYSTEM_GET_SAMPLE_SIZE)) != orxFALSE)
+    {
+      /* Updates flags */
+      orxFLAG_SET(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_SAMPLE_SIZE, orxSOUND_KU32_STATIC_FLAG_NONE);
+    }
+
+    /* Pushes config section */
+    orxConfig_PushSection(orxSOUND_KZ_CONFIG_SECTION);
+
+    /* Gets cache budget */
+    sstSound.u32Budget = (orxConfig_HasValue(orxSOUND_KZ_CONFIG_CACHE_SIZE) != orxFALSE) ? orxConfig_GetU32(orxSOUND_KZ_CONFIG_CACHE_SIZE) : orxSOUND_KU32_DEFAULT_CACHE_SIZE;
+
+    /* Has prefetch groups? */
+    if(orxConfig_HasValue(orxSOUND_KZ_CONFIG_PREFETCH_GROUP_LIST) != orxFALSE)
+    {
+      orxS32 i, s32Number;
+
+      /* For all groups */
+      for(i = 0, s32Number = orxConfig_GetListCounter(orxSOUND_KZ_CONFIG_PREFETCH_GROUP_LIST); i < s32Number; i++)
+      {
+        /* Prefetches it */
+        orxSound_PrefetchGroup(orxConfig_GetListString(orxSOUND_KZ_CONFIG_PREFETCH_GROUP_LIST, i));
+      }
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
   }
 
   /* Done! */
@@ -347,6 +577,9 @@ void orxFASTCALL orxSound_Exit()
     /* Deletes all sounds */
     orxSound_DeleteAll();
 
+    /* Deletes all prefetch groups */
+    orxSound_DeleteAllGroup();
+
     /* Deletes all sound samples */
     orxSound_UnloadAllSample();
 
@@ -356,6 +589,10 @@ void orxFASTCALL orxSound_Exit()
     /* Deletes sample bank */
     orxBank_Delete(sstSound.pstSampleBank);
 
+    /* Deletes group table & bank */
+    orxHashTable_Delete(sstSound.pstGroupTable);
+    orxBank_Delete(sstSound.pstGroupBank);
+
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_SOUND);
 
@@ -422,8 +659,8 @@ orxSOUND *orxFASTCALL orxSound_CreateFromConfig(const orxSTRING _zConfigID)
             /* Should keep it in cache? */
             if(orxConfig_GetBool(orxSOUND_KZ_CONFIG_KEEP_IN_CACHE) != orxFALSE)
             {
-              /* Reloads sample to keep it in reference table */
-              orxSound_LoadSample(zSoundName);
+              /* Protects sample from eviction */
+              orxFLAG_SET(pstResult->pstSample->u32Flags, orxSOUND_KU32_SAMPLE_FLAG_KEEP_IN_CACHE, orxSOUND_KU32_SAMPLE_FLAG_NONE);
             }
 
             /* Updates its status */
@@ -1010,3 +1247,211 @@ const orxSTRING orxFASTCALL orxSound_GetName(const orxSOUND *_pstSound)
   /* Done! */
   return zResult;
 }
+
+/** Prefetches a group of sounds: their samples stay loaded till the group is released
+ * @param[in]   _zGroupID     Config ID of the group, its SoundList contains sound config IDs
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxSound_PrefetchGroup(const orxSTRING _zGroupID)
+{
+  orxU32    u32ID;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+  orxASSERT((_zGroupID != orxNULL) && (_zGroupID != orxSTRING_EMPTY));
+
+  /* Gets its ID */
+  u32ID = orxString_ToCRC(_zGroupID);
+
+  /* Already prefetched? */
+  if(orxHashTable_Get(sstSound.pstGroupTable, u32ID) != orxNULL)
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  /* Pushes its section */
+  else if((orxConfig_HasSection(_zGroupID) != orxFALSE)
+       && (orxConfig_PushSection(_zGroupID) != orxSTATUS_FAILURE))
+  {
+    orxSOUND_GROUP *pstGroup;
+
+    /* Allocates group */
+    pstGroup = (orxSOUND_GROUP *)orxBank_Allocate(sstSound.pstGroupBank);
+
+    /* Valid? */
+    if(pstGroup != orxNULL)
+    {
+      orxS32 s32Number;
+
+      /* Inits it */
+      orxMemory_Zero(pstGroup, sizeof(orxSOUND_GROUP));
+      pstGroup->u32ID = u32ID;
+
+      /* Gets its number of sounds */
+      s32Number = orxConfig_GetListCounter(orxSOUND_KZ_CONFIG_SOUND_LIST);
+
+      /* Allocates its sample list */
+      pstGroup->apstSampleList = (s32Number > 0) ? (orxSOUND_SAMPLE **)orxMemory_Allocate(s32Number * sizeof(orxSOUND_SAMPLE *), orxMEMORY_TYPE_MAIN) : orxNULL;
+
+      /* Adds it to group table */
+      if(((s32Number <= 0) || (pstGroup->apstSampleList != orxNULL))
+      && (orxHashTable_Add(sstSound.pstGroupTable, u32ID, pstGroup) != orxSTATUS_FAILURE))
+      {
+        orxS32 i;
+
+        /* For all its sounds */
+        for(i = 0; i < s32Number; i++)
+        {
+          orxSTRING zSoundID;
+
+          /* Gets sound config ID */
+          zSoundID = orxConfig_GetListString(orxSOUND_KZ_CONFIG_SOUND_LIST, i);
+
+          /* Pushes its section */
+          if((zSoundID != orxSTRING_EMPTY)
+          && (orxConfig_HasSection(zSoundID) != orxFALSE)
+          && (orxConfig_PushSection(zSoundID) != orxSTATUS_FAILURE))
+          {
+            /* Is a sound? */
+            if(orxConfig_HasValue(orxSOUND_KZ_CONFIG_SOUND) != orxFALSE)
+            {
+              orxSOUND_SAMPLE *pstSample;
+
+              /* Loads its sample */
+              pstSample = orxSound_LoadSample(orxConfig_GetString(orxSOUND_KZ_CONFIG_SOUND));
+
+              /* Valid? */
+              if(pstSample != orxNULL)
+              {
+                /* Stores it */
+                pstGroup->apstSampleList[pstGroup->u32SampleNumber++] = pstSample;
+              }
+            }
+
+            /* Pops previous section */
+            orxConfig_PopSection();
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Couldn't find sound section (%s) of prefetch group (%s) in config.", zSoundID, _zGroupID);
+          }
+        }
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Has sample list? */
+        if(pstGroup->apstSampleList != orxNULL)
+        {
+          /* Frees it */
+          orxMemory_Free(pstGroup->apstSampleList);
+        }
+
+        /* Deletes group */
+        orxBank_Free(sstSound.pstGroupBank, pstGroup);
+
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Failed to create prefetch group (%s).", _zGroupID);
+      }
+    }
+
+    /* Pops previous section */
+    orxConfig_PopSection();
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Couldn't find prefetch group section (%s) in config.", _zGroupID);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Releases a prefetched group of sounds: its samples can then be evicted once unused
+ * @param[in]   _zGroupID     Config ID of the group
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxSound_ReleaseGroup(const orxSTRING _zGroupID)
+{
+  orxSOUND_GROUP *pstGroup;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+  orxASSERT((_zGroupID != orxNULL) && (_zGroupID != orxSTRING_EMPTY));
+
+  /* Gets group */
+  pstGroup = (orxSOUND_GROUP *)orxHashTable_Get(sstSound.pstGroupTable, orxString_ToCRC(_zGroupID));
+
+  /* Found? */
+  if(pstGroup != orxNULL)
+  {
+    /* Deletes it */
+    orxSound_DeleteGroup(pstGroup);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SOUND, "Prefetch group (%s) isn't loaded.", _zGroupID);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Sets sample cache budget, evicting unused samples if needed
+ * @param[in]   _u32Budget    Budget, in bytes. Unused samples are never kept beyond it, samples in use may exceed it
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxSound_SetCacheBudget(orxU32 _u32Budget)
+{
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+
+  /* Stores it */
+  sstSound.u32Budget = _u32Budget;
+
+  /* Evicts over budget samples */
+  orxSound_TrimCache();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Gets sample cache stats
+ * @param[out]  _pstStats     Cache stats
+ * @return      orxSOUND_CACHE_STATS
+ */
+orxSOUND_CACHE_STATS *orxFASTCALL orxSound_GetCacheStats(orxSOUND_CACHE_STATS *_pstStats)
+{
+  orxU32 u32LoadCounter;
+
+  /* Checks */
+  orxASSERT(sstSound.u32Flags & orxSOUND_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstStats != orxNULL);
+
+  /* Stores counters */
+  _pstStats->u32HitCounter      = sstSound.u32HitCounter;
+  _pstStats->u32MissCounter     = sstSound.u32MissCounter;
+  _pstStats->u32EvictionCounter = sstSound.u32EvictionCounter;
+  _pstStats->u32SampleCounter   = orxBank_GetCounter(sstSound.pstSampleBank);
+  _pstStats->u32IdleCounter     = orxLinkList_GetCounter(&(sstSound.stIdleList));
+  _pstStats->u32ResidentSize    = sstSound.u32ResidentSize;
+  _pstStats->u32IdleSize        = sstSound.u32IdleSize;
+  _pstStats->u32Budget          = sstSound.u32Budget;
+
+  /* Gets hit rate */
+  u32LoadCounter      = sstSound.u32HitCounter + sstSound.u32MissCounter;
+  _pstStats->fHitRate = (u32LoadCounter != 0) ? orxU2F(sstSound.u32HitCounter) / orxU2F(u32LoadCounter) : orxFLOAT_0;
+
+  /* Done! */
+  return _pstStats;
+}
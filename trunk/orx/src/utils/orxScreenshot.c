@@ -30,19 +30,62 @@
 #include "utils/orxScreenshot.h"
 
 #include "debug/orxDebug.h"
+#include "core/orxClock.h"
 #include "core/orxConfig.h"
+#include "core/orxEvent.h"
 #include "display/orxDisplay.h"
 #include "io/orxFile.h"
 #include "io/orxFileSystem.h"
+#include "render/orxRender.h"
 #include "utils/orxString.h"
 #include "memory/orxMemory.h"
 
 
+/** Platform dependent includes & types
+ */
+
+/* Windows */
+#ifdef __orxWINDOWS__
+
+  #define WIN32_LEAN_AND_MEAN
+  #include <windows.h>
+
+  typedef HANDLE                                                orxSCREENSHOT_THREAD;
+  typedef CRITICAL_SECTION                                      orxSCREENSHOT_MUTEX;
+  typedef HANDLE                                                orxSCREENSHOT_SIGNAL;
+
+  #define __orxSCREENSHOT_THREAD__
+
+#else /* __orxWINDOWS__ */
+
+  /* Linux / Mac / IPhone */
+  #if defined(__orxLINUX__) || defined(__orxMAC__) || defined(__orxIPHONE__)
+
+    #include <pthread.h>
+
+    typedef pthread_t                                           orxSCREENSHOT_THREAD;
+    typedef pthread_mutex_t                                     orxSCREENSHOT_MUTEX;
+    typedef pthread_cond_t                                      orxSCREENSHOT_SIGNAL;
+
+    #define __orxSCREENSHOT_THREAD__
+
+  #else /* __orxLINUX__ || __orxMAC__ || __orxIPHONE__ */
+
+    #undef __orxSCREENSHOT_THREAD__
+
+  #endif /* __orxLINUX__ || __orxMAC__ || __orxIPHONE__ */
+
+#endif /* __orxWINDOWS__ */
+
+
 /** Module flags
  */
 #define orxSCREENSHOT_KU32_STATIC_FLAG_NONE                     0x00000000
 
 #define orxSCREENSHOT_KU32_STATIC_FLAG_READY                    0x00000001
+#define orxSCREENSHOT_KU32_STATIC_FLAG_INDEX                    0x00000002  /**< Screenshot index has been computed */
+#define orxSCREENSHOT_KU32_STATIC_FLAG_THREAD                   0x00000004  /**< Encoder thread is running */
+#define orxSCREENSHOT_KU32_STATIC_FLAG_RECORD                   0x00000008  /**< Recording frames */
 
 #define orxSCREENSHOT_KU32_STATIC_MASK_ALL                      0xFFFFFFFF
 
@@ -50,25 +93,114 @@
 /** Misc defines
  */
 #define orxSCREENSHOT_KU32_BUFFER_SIZE                          256
+#define orxSCREENSHOT_KU32_MAX_BUFFER_NUMBER                    64
+#define orxSCREENSHOT_KU32_PNG_BLOCK_SIZE                       65535       /**< Maximum stored deflate block size */
+#define orxSCREENSHOT_KU32_ADLER_MODULO                         65521
+#define orxSCREENSHOT_KU32_ADLER_RUN_SIZE                       5552        /**< Max number of bytes before Adler sums can overflow */
 
 #define orxSCREENSHOT_KZ_CONFIG_SECTION                         "Screenshot"
 #define orxSCREENSHOT_KZ_CONFIG_DIRECTORY                       "Directory"
 #define orxSCREENSHOT_KZ_CONFIG_BASE_NAME                       "BaseName"
 #define orxSCREENSHOT_KZ_CONFIG_EXTENSION                       "Extension"
 #define orxSCREENSHOT_KZ_CONFIG_DIGITS                          "Digits"
+#define orxSCREENSHOT_KZ_CONFIG_BUFFER_NUMBER                   "BufferNumber"
+#define orxSCREENSHOT_KZ_CONFIG_RECORD_FRAME_NUMBER             "RecordFrameNumber"
+#define orxSCREENSHOT_KZ_CONFIG_RECORD_DT                       "RecordDT"
+
+#define orxSCREENSHOT_KZ_EXTENSION_TGA                          "tga"
+#define orxSCREENSHOT_KZ_EXTENSION_PNG                          "png"
+#define orxSCREENSHOT_KZ_EXTENSION_RAW                          "raw"
 
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Encoding format enum
+ */
+typedef enum __orxSCREENSHOT_FORMAT_t
+{
+  orxSCREENSHOT_FORMAT_TGA = 0,
+  orxSCREENSHOT_FORMAT_PNG,
+  orxSCREENSHOT_FORMAT_RAW,
+
+  orxSCREENSHOT_FORMAT_NUMBER,
+
+  orxSCREENSHOT_FORMAT_NONE = orxENUM_NONE                      /**< Not handled by the encoder, saved by the display plugin */
+
+} orxSCREENSHOT_FORMAT;
+
+/** Staging buffer state enum
+ */
+typedef enum __orxSCREENSHOT_BUFFER_STATE_t
+{
+  orxSCREENSHOT_BUFFER_STATE_FREE = 0,
+  orxSCREENSHOT_BUFFER_STATE_PENDING,
+  orxSCREENSHOT_BUFFER_STATE_DONE,
+
+  orxSCREENSHOT_BUFFER_STATE_NUMBER,
+
+  orxSCREENSHOT_BUFFER_STATE_NONE = orxENUM_NONE
+
+} orxSCREENSHOT_BUFFER_STATE;
+
+/** Staging buffer structure
+ */
+typedef struct __orxSCREENSHOT_BUFFER_t
+{
+  orxU8                      *au8Data;                          /**< Frame data (RGBA) : 4 */
+  orxU32                      u32Size;                          /**< Allocated size : 8 */
+  orxU32                      u32Width;                         /**< Frame width : 12 */
+  orxU32                      u32Height;                        /**< Frame height : 16 */
+  orxSCREENSHOT_FORMAT        eFormat;                          /**< Encoding format : 20 */
+  orxSCREENSHOT_BUFFER_STATE  eState;                           /**< State : 24 */
+  orxSTATUS                   eStatus;                          /**< Encoding status : 28 */
+  orxCHAR                     acFileName[orxSCREENSHOT_KU32_BUFFER_SIZE]; /**< File name : 284 */
+
+} orxSCREENSHOT_BUFFER;
+
+/** PNG writer structure
+ */
+typedef struct __orxSCREENSHOT_PNG_t
+{
+  orxFILE  *pstFile;                                            /**< Output file : 4 */
+  orxU32    u32CRC;                                             /**< Current chunk CRC : 8 */
+  orxU32    u32AdlerA, u32AdlerB;                               /**< Deflate stream Adler sums : 16 */
+  orxU32    u32BlockLeft;                                       /**< Bytes left in current stored block : 20 */
+  orxU32    u32DataLeft;                                        /**< Bytes left in deflate stream : 24 */
+  orxSTATUS eStatus;                                            /**< Write status : 28 */
+
+} orxSCREENSHOT_PNG;
+
 /** Static structure
  */
 typedef struct __orxSCREENSHOT_STATIC_t
 {
-  orxU32    u32ScreenshotIndex;                                 /**< Screenshot index */
-  orxU32    u32Flags;                                           /**< Control flags */
-  orxCHAR   acScreenshotBuffer[orxSCREENSHOT_KU32_BUFFER_SIZE]; /**< Screenshot file name buffer */
+  orxU32                  u32ScreenshotIndex;                   /**< Screenshot index */
+  orxU32                  u32NameID;                            /**< Name pattern ID for which the index has been computed */
+  orxU32                  u32Flags;                             /**< Control flags */
+  orxSCREENSHOT_BUFFER   *astBufferList;                        /**< Staging buffer list */
+  orxU32                  u32BufferNumber;                      /**< Number of staging buffers */
+  orxU32                 *au32QueueList;                        /**< Pending buffer queue (FIFO) */
+  orxU32                  u32QueueHead;                         /**< Queue head */
+  orxU32                  u32QueueCounter;                      /**< Number of queued buffers */
+  orxU32                  u32PendingCounter;                    /**< Number of buffers being queued or encoded */
+  orxU32                  u32RecordCounter;                     /**< Number of frames left to record, orxU32_UNDEFINED if unlimited */
+  orxCLOCK               *pstClock;                             /**< Recorded clock */
+  orxCLOCK_MOD_TYPE       eClockModType;                        /**< Recorded clock modifier type, before recording */
+  orxFLOAT                fClockModValue;                       /**< Recorded clock modifier value, before recording */
+  orxU32                  au32CRCTable[256];                    /**< PNG CRC table */
+  orxCHAR                 acScreenshotBuffer[orxSCREENSHOT_KU32_BUFFER_SIZE]; /**< Screenshot file name buffer */
+
+#ifdef __orxSCREENSHOT_THREAD__
+
+  orxSCREENSHOT_THREAD    hThread;                              /**< Encoder thread */
+  orxSCREENSHOT_MUTEX     stMutex;                              /**< Mutex protecting buffer states & queue */
+  orxSCREENSHOT_SIGNAL    stJobSignal;                          /**< Signaled when a buffer is queued */
+  orxSCREENSHOT_SIGNAL    stDoneSignal;                         /**< Signaled when a buffer has been encoded */
+  orxBOOL                 bStopThread;                          /**< Encoder thread stop request */
+
+#endif /* __orxSCREENSHOT_THREAD__ */
 
 } orxSCREENSHOT_STATIC;
 
@@ -86,13 +218,751 @@ static orxSCREENSHOT_STATIC sstScreenshot;
  * Private functions                                                       *
  ***************************************************************************/
 
-/** Computes next screenshot index
+#ifdef __orxSCREENSHOT_THREAD__
+
+/** Locks the encoder queue
+ */
+static orxINLINE void orxScreenshot_Lock()
+{
+#ifdef __orxWINDOWS__
+  EnterCriticalSection(&(sstScreenshot.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_mutex_lock(&(sstScreenshot.stMutex));
+#endif /* __orxWINDOWS__ */
+}
+
+/** Unlocks the encoder queue
+ */
+static orxINLINE void orxScreenshot_Unlock()
+{
+#ifdef __orxWINDOWS__
+  LeaveCriticalSection(&(sstScreenshot.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_mutex_unlock(&(sstScreenshot.stMutex));
+#endif /* __orxWINDOWS__ */
+}
+
+/** Waits for a signal, queue has to be locked and will be locked again upon return
+ * @param[in]   _pstSignal      Signal to wait for
+ */
+static orxINLINE void orxScreenshot_Wait(orxSCREENSHOT_SIGNAL *_pstSignal)
+{
+#ifdef __orxWINDOWS__
+  /* Auto-reset events: as there's a single waiter per signal, a signal sent while unlocked won't be lost */
+  LeaveCriticalSection(&(sstScreenshot.stMutex));
+  WaitForSingleObject(*_pstSignal, INFINITE);
+  EnterCriticalSection(&(sstScreenshot.stMutex));
+#else /* __orxWINDOWS__ */
+  pthread_cond_wait(_pstSignal, &(sstScreenshot.stMutex));
+#endif /* __orxWINDOWS__ */
+}
+
+/** Sends a signal
+ * @param[in]   _pstSignal      Signal to send
+ */
+static orxINLINE void orxScreenshot_Signal(orxSCREENSHOT_SIGNAL *_pstSignal)
+{
+#ifdef __orxWINDOWS__
+  SetEvent(*_pstSignal);
+#else /* __orxWINDOWS__ */
+  pthread_cond_signal(_pstSignal);
+#endif /* __orxWINDOWS__ */
+}
+
+#endif /* __orxSCREENSHOT_THREAD__ */
+
+/** Updates a PNG CRC
+ * @param[in]   _u32CRC         Current CRC
+ * @param[in]   _au8Data        Data to add
+ * @param[in]   _u32Size        Size of data
+ * @return Updated CRC
+ */
+static orxINLINE orxU32 orxScreenshot_UpdateCRC(orxU32 _u32CRC, const orxU8 *_au8Data, orxU32 _u32Size)
+{
+  orxU32 i;
+
+  /* For all bytes */
+  for(i = 0; i < _u32Size; i++)
+  {
+    /* Updates CRC */
+    _u32CRC = sstScreenshot.au32CRCTable[(_u32CRC ^ _au8Data[i]) & 0xFF] ^ (_u32CRC >> 8);
+  }
+
+  /* Done! */
+  return _u32CRC;
+}
+
+/** Stores a big endian 32 bit value
+ * @param[out]  _au8Data        Where to store the value
+ * @param[in]   _u32Value       Value to store
+ */
+static orxINLINE void orxScreenshot_SetU32BE(orxU8 *_au8Data, orxU32 _u32Value)
+{
+  _au8Data[0] = (orxU8)(_u32Value >> 24);
+  _au8Data[1] = (orxU8)(_u32Value >> 16);
+  _au8Data[2] = (orxU8)(_u32Value >> 8);
+  _au8Data[3] = (orxU8)_u32Value;
+}
+
+/** Writes bytes inside the current PNG chunk
+ * @param[in]   _pstPNG         Concerned PNG writer
+ * @param[in]   _au8Data        Data to write
+ * @param[in]   _u32Size        Size of data
+ */
+static orxINLINE void orxScreenshot_WritePNGBytes(orxSCREENSHOT_PNG *_pstPNG, const orxU8 *_au8Data, orxU32 _u32Size)
+{
+  /* Updates chunk CRC */
+  _pstPNG->u32CRC = orxScreenshot_UpdateCRC(_pstPNG->u32CRC, _au8Data, _u32Size);
+
+  /* Writes data */
+  if(orxFile_Write((void *)_au8Data, sizeof(orxU8), _u32Size, _pstPNG->pstFile) != _u32Size)
+  {
+    /* Updates status */
+    _pstPNG->eStatus = orxSTATUS_FAILURE;
+  }
+}
+
+/** Starts a PNG chunk
+ * @param[in]   _pstPNG         Concerned PNG writer
+ * @param[in]   _zType          Chunk type (4 characters)
+ * @param[in]   _u32Size        Chunk data size
+ */
+static orxINLINE void orxScreenshot_StartPNGChunk(orxSCREENSHOT_PNG *_pstPNG, const orxSTRING _zType, orxU32 _u32Size)
+{
+  orxU8 au8Size[4];
+
+  /* Writes size (not part of the CRC) */
+  orxScreenshot_SetU32BE(au8Size, _u32Size);
+  if(orxFile_Write(au8Size, sizeof(orxU8), 4, _pstPNG->pstFile) != 4)
+  {
+    /* Updates status */
+    _pstPNG->eStatus = orxSTATUS_FAILURE;
+  }
+
+  /* Writes type */
+  _pstPNG->u32CRC = 0xFFFFFFFF;
+  orxScreenshot_WritePNGBytes(_pstPNG, (const orxU8 *)_zType, 4);
+}
+
+/** Ends a PNG chunk
+ * @param[in]   _pstPNG         Concerned PNG writer
+ */
+static orxINLINE void orxScreenshot_EndPNGChunk(orxSCREENSHOT_PNG *_pstPNG)
+{
+  orxU8 au8CRC[4];
+
+  /* Writes CRC */
+  orxScreenshot_SetU32BE(au8CRC, _pstPNG->u32CRC ^ 0xFFFFFFFF);
+  if(orxFile_Write(au8CRC, sizeof(orxU8), 4, _pstPNG->pstFile) != 4)
+  {
+    /* Updates status */
+    _pstPNG->eStatus = orxSTATUS_FAILURE;
+  }
+}
+
+/** Writes bytes inside the PNG deflate stream, using stored (uncompressed) blocks
+ * @param[in]   _pstPNG         Concerned PNG writer
+ * @param[in]   _au8Data        Data to write
+ * @param[in]   _u32Size        Size of data
+ */
+static void orxFASTCALL orxScreenshot_WritePNGStream(orxSCREENSHOT_PNG *_pstPNG, const orxU8 *_au8Data, orxU32 _u32Size)
+{
+  /* While there are bytes to write */
+  while(_u32Size > 0)
+  {
+    orxU32 u32Size, i;
+
+    /* Needs a new block? */
+    if(_pstPNG->u32BlockLeft == 0)
+    {
+      orxU8 au8Header[5];
+
+      /* Gets block size */
+      u32Size = orxMIN(_pstPNG->u32DataLeft, orxSCREENSHOT_KU32_PNG_BLOCK_SIZE);
+
+      /* Writes block header: final flag, LEN & NLEN */
+      au8Header[0] = (u32Size == _pstPNG->u32DataLeft) ? 0x01 : 0x00;
+      au8Header[1] = (orxU8)u32Size;
+      au8Header[2] = (orxU8)(u32Size >> 8);
+      au8Header[3] = (orxU8)~u32Size;
+      au8Header[4] = (orxU8)(~u32Size >> 8);
+      orxScreenshot_WritePNGBytes(_pstPNG, au8Header, 5);
+
+      /* Updates block size */
+      _pstPNG->u32BlockLeft = u32Size;
+    }
+
+    /* Gets size to write in this block */
+    u32Size = orxMIN(_u32Size, _pstPNG->u32BlockLeft);
+
+    /* Updates Adler sums */
+    for(i = 0; i < u32Size; i++)
+    {
+      _pstPNG->u32AdlerA += _au8Data[i];
+      _pstPNG->u32AdlerB += _pstPNG->u32AdlerA;
+
+      /* Reaches overflow limit? */
+      if((i % orxSCREENSHOT_KU32_ADLER_RUN_SIZE) == orxSCREENSHOT_KU32_ADLER_RUN_SIZE - 1)
+      {
+        _pstPNG->u32AdlerA %= orxSCREENSHOT_KU32_ADLER_MODULO;
+        _pstPNG->u32AdlerB %= orxSCREENSHOT_KU32_ADLER_MODULO;
+      }
+    }
+    _pstPNG->u32AdlerA %= orxSCREENSHOT_KU32_ADLER_MODULO;
+    _pstPNG->u32AdlerB %= orxSCREENSHOT_KU32_ADLER_MODULO;
+
+    /* Writes data */
+    orxScreenshot_WritePNGBytes(_pstPNG, _au8Data, u32Size);
+
+    /* Updates counters */
+    _pstPNG->u32BlockLeft  -= u32Size;
+    _pstPNG->u32DataLeft   -= u32Size;
+    _au8Data               += u32Size;
+    _u32Size               -= u32Size;
+  }
+}
+
+/** Encodes a staging buffer as PNG (8 bit RGBA, stored deflate blocks)
+ * @param[in]   _pstBuffer      Concerned staging buffer
+ * @param[in]   _pstFile        Output file
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_EncodePNG(const orxSCREENSHOT_BUFFER *_pstBuffer, orxFILE *_pstFile)
+{
+  static const orxU8  sau8Signature[8] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+  orxSCREENSHOT_PNG   stPNG;
+  orxU64              u64DataSize;
+  orxSTATUS           eResult = orxSTATUS_FAILURE;
+
+  /* Gets deflate stream size: filter byte + row, for all rows */
+  u64DataSize = (orxU64)_pstBuffer->u32Height * (orxU64)(_pstBuffer->u32Width * 4 + 1);
+
+  /* Fits in a single IDAT chunk? */
+  if(u64DataSize < (orxU64)0x7F000000)
+  {
+    orxU8   au8Header[13], u8Filter = 0;
+    orxU32  u32BlockNumber, i;
+    const orxU8 *pu8Row;
+
+    /* Inits writer */
+    orxMemory_Zero(&stPNG, sizeof(orxSCREENSHOT_PNG));
+    stPNG.pstFile     = _pstFile;
+    stPNG.eStatus     = orxSTATUS_SUCCESS;
+    stPNG.u32AdlerA   = 1;
+    stPNG.u32DataLeft = (orxU32)u64DataSize;
+
+    /* Writes signature */
+    if(orxFile_Write((void *)sau8Signature, sizeof(orxU8), 8, _pstFile) != 8)
+    {
+      /* Updates status */
+      stPNG.eStatus = orxSTATUS_FAILURE;
+    }
+
+    /* Writes header: size, 8 bit depth, RGBA, no interlace */
+    orxScreenshot_SetU32BE(au8Header, _pstBuffer->u32Width);
+    orxScreenshot_SetU32BE(au8Header + 4, _pstBuffer->u32Height);
+    au8Header[8]  = 8;
+    au8Header[9]  = 6;
+    au8Header[10] = 0;
+    au8Header[11] = 0;
+    au8Header[12] = 0;
+    orxScreenshot_StartPNGChunk(&stPNG, "IHDR", 13);
+    orxScreenshot_WritePNGBytes(&stPNG, au8Header, 13);
+    orxScreenshot_EndPNGChunk(&stPNG);
+
+    /* Gets number of stored blocks */
+    u32BlockNumber = (stPNG.u32DataLeft + orxSCREENSHOT_KU32_PNG_BLOCK_SIZE - 1) / orxSCREENSHOT_KU32_PNG_BLOCK_SIZE;
+
+    /* Starts data chunk: zlib header + blocks + block headers + Adler sum */
+    orxScreenshot_StartPNGChunk(&stPNG, "IDAT", 2 + stPNG.u32DataLeft + 5 * u32BlockNumber + 4);
+
+    /* Writes zlib header (deflate, 32K window, no dictionary) */
+    au8Header[0] = 0x78;
+    au8Header[1] = 0x01;
+    orxScreenshot_WritePNGBytes(&stPNG, au8Header, 2);
+
+    /* For all rows */
+    for(i = 0, pu8Row = _pstBuffer->au8Data; i < _pstBuffer->u32Height; i++, pu8Row += _pstBuffer->u32Width * 4)
+    {
+      /* Writes filter type (none) & row */
+      orxScreenshot_WritePNGStream(&stPNG, &u8Filter, 1);
+      orxScreenshot_WritePNGStream(&stPNG, pu8Row, _pstBuffer->u32Width * 4);
+    }
+
+    /* Writes Adler sum */
+    orxScreenshot_SetU32BE(au8Header, (stPNG.u32AdlerB << 16) | stPNG.u32AdlerA);
+    orxScreenshot_WritePNGBytes(&stPNG, au8Header, 4);
+    orxScreenshot_EndPNGChunk(&stPNG);
+
+    /* Writes end chunk */
+    orxScreenshot_StartPNGChunk(&stPNG, "IEND", 0);
+    orxScreenshot_EndPNGChunk(&stPNG);
+
+    /* Updates result */
+    eResult = stPNG.eStatus;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Encodes a staging buffer as TGA (32 bit BGRA, top-left origin)
+ * @param[in]   _pstBuffer      Concerned staging buffer, its data will be converted in place
+ * @param[in]   _pstFile        Output file
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_EncodeTGA(orxSCREENSHOT_BUFFER *_pstBuffer, orxFILE *_pstFile)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Valid size? */
+  if((_pstBuffer->u32Width <= 0xFFFF) && (_pstBuffer->u32Height <= 0xFFFF))
+  {
+    orxU8   au8Header[18];
+    orxU32  u32Size, i;
+
+    /* Writes header: uncompressed true color, 32 bits, 8 bit alpha, top-left origin */
+    orxMemory_Zero(au8Header, 18 * sizeof(orxU8));
+    au8Header[2]  = 2;
+    au8Header[12] = (orxU8)_pstBuffer->u32Width;
+    au8Header[13] = (orxU8)(_pstBuffer->u32Width >> 8);
+    au8Header[14] = (orxU8)_pstBuffer->u32Height;
+    au8Header[15] = (orxU8)(_pstBuffer->u32Height >> 8);
+    au8Header[16] = 32;
+    au8Header[17] = 0x28;
+
+    /* Converts RGBA to BGRA */
+    for(i = 0, u32Size = _pstBuffer->u32Width * _pstBuffer->u32Height * 4; i < u32Size; i += 4)
+    {
+      orxU8 u8Temp;
+
+      /* Swaps red & blue */
+      u8Temp                        = _pstBuffer->au8Data[i];
+      _pstBuffer->au8Data[i]        = _pstBuffer->au8Data[i + 2];
+      _pstBuffer->au8Data[i + 2]    = u8Temp;
+    }
+
+    /* Writes header & data */
+    if((orxFile_Write(au8Header, sizeof(orxU8), 18, _pstFile) == 18)
+    && (orxFile_Write(_pstBuffer->au8Data, sizeof(orxU8), u32Size, _pstFile) == u32Size))
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Encodes a staging buffer to its file, can be called from the encoder thread: only uses the file module
+ * @param[in]   _pstBuffer      Concerned staging buffer
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_Encode(orxSCREENSHOT_BUFFER *_pstBuffer)
+{
+  orxFILE  *pstFile;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Opens file */
+  pstFile = orxFile_Open(_pstBuffer->acFileName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  /* Valid? */
+  if(pstFile != orxNULL)
+  {
+    /* Depending on format */
+    switch(_pstBuffer->eFormat)
+    {
+      case orxSCREENSHOT_FORMAT_TGA:
+      {
+        /* Encodes it */
+        eResult = orxScreenshot_EncodeTGA(_pstBuffer, pstFile);
+
+        break;
+      }
+
+      case orxSCREENSHOT_FORMAT_PNG:
+      {
+        /* Encodes it */
+        eResult = orxScreenshot_EncodePNG(_pstBuffer, pstFile);
+
+        break;
+      }
+
+      case orxSCREENSHOT_FORMAT_RAW:
+      {
+        orxU32 u32Size;
+
+        /* Gets size */
+        u32Size = _pstBuffer->u32Width * _pstBuffer->u32Height * 4;
+
+        /* Writes data as is */
+        eResult = (orxFile_Write(_pstBuffer->au8Data, sizeof(orxU8), u32Size, pstFile) == u32Size) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+
+    /* Closes file */
+    if(orxFile_Close(pstFile) == orxSTATUS_FAILURE)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Logs an encoded buffer result
+ * @param[in]   _pstBuffer      Concerned staging buffer
+ * @param[in]   _eStatus        Encoding status
+ */
+static orxINLINE void orxScreenshot_LogResult(const orxSCREENSHOT_BUFFER *_pstBuffer, orxSTATUS _eStatus)
+{
+  /* Success? */
+  if(_eStatus != orxSTATUS_FAILURE)
+  {
+    /* Logs */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Screenshot captured to [%s].", _pstBuffer->acFileName);
+  }
+  else
+  {
+    /* Logs */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Couldn't write screenshot to [%s].", _pstBuffer->acFileName);
+  }
+}
+
+/** Recycles encoded buffers and gets a free one, queue has to be locked when the encoder thread is running
+ * @return orxSCREENSHOT_BUFFER / orxNULL
+ */
+static orxINLINE orxSCREENSHOT_BUFFER *orxScreenshot_RecycleBuffers()
+{
+  orxSCREENSHOT_BUFFER *pstResult = orxNULL;
+  orxU32                i;
+
+  /* For all buffers */
+  for(i = 0; i < sstScreenshot.u32BufferNumber; i++)
+  {
+    orxSCREENSHOT_BUFFER *pstBuffer;
+
+    /* Gets it */
+    pstBuffer = &(sstScreenshot.astBufferList[i]);
+
+    /* Encoded? */
+    if(pstBuffer->eState == orxSCREENSHOT_BUFFER_STATE_DONE)
+    {
+      /* Logs result */
+      orxScreenshot_LogResult(pstBuffer, pstBuffer->eStatus);
+
+      /* Frees it */
+      pstBuffer->eState = orxSCREENSHOT_BUFFER_STATE_FREE;
+    }
+
+    /* Free and first one? */
+    if((pstBuffer->eState == orxSCREENSHOT_BUFFER_STATE_FREE) && (pstResult == orxNULL))
+    {
+      /* Updates result */
+      pstResult = pstBuffer;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+#ifdef __orxSCREENSHOT_THREAD__
+
+/** Encoder thread loop: encodes queued buffers till a stop is requested and the queue is empty
+ */
+static void orxFASTCALL orxScreenshot_Run()
+{
+  /* Locks queue */
+  orxScreenshot_Lock();
+
+  for(;;)
+  {
+    orxSCREENSHOT_BUFFER *pstBuffer;
+    orxSTATUS             eStatus;
+
+    /* Waits for a job */
+    while((sstScreenshot.u32QueueCounter == 0) && (sstScreenshot.bStopThread == orxFALSE))
+    {
+      orxScreenshot_Wait(&(sstScreenshot.stJobSignal));
+    }
+
+    /* Nothing left to do? */
+    if(sstScreenshot.u32QueueCounter == 0)
+    {
+      break;
+    }
+
+    /* Pops buffer */
+    pstBuffer = &(sstScreenshot.astBufferList[sstScreenshot.au32QueueList[sstScreenshot.u32QueueHead]]);
+    sstScreenshot.u32QueueHead = (sstScreenshot.u32QueueHead + 1) % sstScreenshot.u32BufferNumber;
+    sstScreenshot.u32QueueCounter--;
+
+    /* Encodes it, unlocked */
+    orxScreenshot_Unlock();
+    eStatus = orxScreenshot_Encode(pstBuffer);
+    orxScreenshot_Lock();
+
+    /* Updates its state */
+    pstBuffer->eStatus  = eStatus;
+    pstBuffer->eState   = orxSCREENSHOT_BUFFER_STATE_DONE;
+    sstScreenshot.u32PendingCounter--;
+
+    /* Notifies main thread */
+    orxScreenshot_Signal(&(sstScreenshot.stDoneSignal));
+  }
+
+  /* Unlocks queue */
+  orxScreenshot_Unlock();
+}
+
+#ifdef __orxWINDOWS__
+
+/** Encoder thread entry point
+ */
+static DWORD WINAPI orxScreenshot_ThreadMain(LPVOID _pContext)
+{
+  /* Runs encoder */
+  orxScreenshot_Run();
+
+  /* Done! */
+  return 0;
+}
+
+#else /* __orxWINDOWS__ */
+
+/** Encoder thread entry point
+ */
+static void *orxScreenshot_ThreadMain(void *_pContext)
+{
+  /* Runs encoder */
+  orxScreenshot_Run();
+
+  /* Done! */
+  return orxNULL;
+}
+
+#endif /* __orxWINDOWS__ */
+
+/** Starts encoder thread
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_StartThread()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Clears stop request */
+  sstScreenshot.bStopThread = orxFALSE;
+
+#ifdef __orxWINDOWS__
+
+  /* Creates synchronization objects */
+  InitializeCriticalSection(&(sstScreenshot.stMutex));
+  sstScreenshot.stJobSignal   = CreateEvent(NULL, FALSE, FALSE, NULL);
+  sstScreenshot.stDoneSignal  = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+  /* Valid? */
+  if((sstScreenshot.stJobSignal != NULL) && (sstScreenshot.stDoneSignal != NULL))
+  {
+    /* Creates thread */
+    sstScreenshot.hThread = CreateThread(NULL, 0, orxScreenshot_ThreadMain, orxNULL, 0, NULL);
+
+    /* Success? */
+    if(sstScreenshot.hThread != NULL)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+
+  /* Failure? */
+  if(eResult == orxSTATUS_FAILURE)
+  {
+    /* Deletes synchronization objects */
+    if(sstScreenshot.stJobSignal != NULL)
+    {
+      CloseHandle(sstScreenshot.stJobSignal);
+    }
+    if(sstScreenshot.stDoneSignal != NULL)
+    {
+      CloseHandle(sstScreenshot.stDoneSignal);
+    }
+    DeleteCriticalSection(&(sstScreenshot.stMutex));
+  }
+
+#else /* __orxWINDOWS__ */
+
+  /* Creates synchronization objects */
+  pthread_mutex_init(&(sstScreenshot.stMutex), NULL);
+  pthread_cond_init(&(sstScreenshot.stJobSignal), NULL);
+  pthread_cond_init(&(sstScreenshot.stDoneSignal), NULL);
+
+  /* Creates thread */
+  if(pthread_create(&(sstScreenshot.hThread), NULL, orxScreenshot_ThreadMain, orxNULL) == 0)
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Deletes synchronization objects */
+    pthread_cond_destroy(&(sstScreenshot.stDoneSignal));
+    pthread_cond_destroy(&(sstScreenshot.stJobSignal));
+    pthread_mutex_destroy(&(sstScreenshot.stMutex));
+  }
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops encoder thread, after all queued buffers have been encoded
+ */
+static void orxFASTCALL orxScreenshot_StopThread()
+{
+  /* Requests stop */
+  orxScreenshot_Lock();
+  sstScreenshot.bStopThread = orxTRUE;
+  orxScreenshot_Signal(&(sstScreenshot.stJobSignal));
+  orxScreenshot_Unlock();
+
+#ifdef __orxWINDOWS__
+
+  /* Waits for thread */
+  WaitForSingleObject(sstScreenshot.hThread, INFINITE);
+
+  /* Deletes thread & synchronization objects */
+  CloseHandle(sstScreenshot.hThread);
+  CloseHandle(sstScreenshot.stDoneSignal);
+  CloseHandle(sstScreenshot.stJobSignal);
+  DeleteCriticalSection(&(sstScreenshot.stMutex));
+
+#else /* __orxWINDOWS__ */
+
+  /* Waits for thread */
+  pthread_join(sstScreenshot.hThread, NULL);
+
+  /* Deletes synchronization objects */
+  pthread_cond_destroy(&(sstScreenshot.stDoneSignal));
+  pthread_cond_destroy(&(sstScreenshot.stJobSignal));
+  pthread_mutex_destroy(&(sstScreenshot.stMutex));
+
+#endif /* __orxWINDOWS__ */
+}
+
+#endif /* __orxSCREENSHOT_THREAD__ */
+
+/** Gets a free staging buffer, waiting for the encoder if none is available
+ * @return orxSCREENSHOT_BUFFER / orxNULL
+ */
+static orxINLINE orxSCREENSHOT_BUFFER *orxScreenshot_GetBuffer()
+{
+  orxSCREENSHOT_BUFFER *pstResult;
+
+  /* No buffers yet? */
+  if(sstScreenshot.astBufferList == orxNULL)
+  {
+    orxU32 u32BufferNumber = orxSCREENSHOT_KU32_DEFAULT_BUFFER_NUMBER;
+
+    /* Pushes section */
+    if((orxConfig_HasSection(orxSCREENSHOT_KZ_CONFIG_SECTION) != orxFALSE)
+    && (orxConfig_PushSection(orxSCREENSHOT_KZ_CONFIG_SECTION) != orxSTATUS_FAILURE))
+    {
+      /* Has buffer number? */
+      if(orxConfig_HasValue(orxSCREENSHOT_KZ_CONFIG_BUFFER_NUMBER) != orxFALSE)
+      {
+        /* Gets it */
+        u32BufferNumber = orxCLAMP(orxConfig_GetU32(orxSCREENSHOT_KZ_CONFIG_BUFFER_NUMBER), 1, orxSCREENSHOT_KU32_MAX_BUFFER_NUMBER);
+      }
+
+      /* Pops previous section */
+      orxConfig_PopSection();
+    }
+
+    /* Allocates buffer & queue lists */
+    sstScreenshot.astBufferList = (orxSCREENSHOT_BUFFER *)orxMemory_Allocate(u32BufferNumber * sizeof(orxSCREENSHOT_BUFFER), orxMEMORY_TYPE_MAIN);
+    sstScreenshot.au32QueueList = (orxU32 *)orxMemory_Allocate(u32BufferNumber * sizeof(orxU32), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if((sstScreenshot.astBufferList != orxNULL) && (sstScreenshot.au32QueueList != orxNULL))
+    {
+      /* Inits them */
+      orxMemory_Zero(sstScreenshot.astBufferList, u32BufferNumber * sizeof(orxSCREENSHOT_BUFFER));
+      sstScreenshot.u32BufferNumber = u32BufferNumber;
+      sstScreenshot.u32QueueHead    = 0;
+      sstScreenshot.u32QueueCounter = 0;
+    }
+    else
+    {
+      /* Frees them */
+      if(sstScreenshot.astBufferList != orxNULL)
+      {
+        orxMemory_Free(sstScreenshot.astBufferList);
+        sstScreenshot.astBufferList = orxNULL;
+      }
+      if(sstScreenshot.au32QueueList != orxNULL)
+      {
+        orxMemory_Free(sstScreenshot.au32QueueList);
+        sstScreenshot.au32QueueList = orxNULL;
+      }
+
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Couldn't allocate %ld screenshot staging buffers.", u32BufferNumber);
+
+      return orxNULL;
+    }
+  }
+
+#ifdef __orxSCREENSHOT_THREAD__
+
+  /* Encoder running? */
+  if(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_THREAD)
+  {
+    /* Locks queue */
+    orxScreenshot_Lock();
+
+    /* Waits till a buffer gets free */
+    while((pstResult = orxScreenshot_RecycleBuffers()) == orxNULL)
+    {
+      orxScreenshot_Wait(&(sstScreenshot.stDoneSignal));
+    }
+
+    /* Unlocks queue */
+    orxScreenshot_Unlock();
+  }
+  else
+
+#endif /* __orxSCREENSHOT_THREAD__ */
+
+  {
+    /* Gets a free buffer */
+    pstResult = orxScreenshot_RecycleBuffers();
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Computes next screenshot file name: the index is only searched once per name pattern, then incremented
+ * @param[out]  _peFormat       Encoding format for this file name
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-static orxINLINE orxSTATUS orxScreenshot_ComputeIndex()
+static orxINLINE orxSTATUS orxScreenshot_ComputeName(orxSCREENSHOT_FORMAT *_peFormat)
 {
   orxSTRING zDirectory, zBaseName, zExtension;
-  orxU32    u32Digits;
+  orxU32    u32Digits, u32NameID;
+  orxCHAR   acExtension[8];
   orxSTATUS eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
@@ -152,33 +1022,149 @@ static orxINLINE orxSTATUS orxScreenshot_ComputeIndex()
     orxConfig_PopSection();
   }
 
-  /* Valid? */
-  if(orxFileSystem_Exists(zDirectory) != orxFALSE)
+  /* Gets search pattern & its ID */
+  orxString_NPrint(sstScreenshot.acScreenshotBuffer, orxSCREENSHOT_KU32_BUFFER_SIZE, "%s/%s*.%s", zDirectory, zBaseName, zExtension);
+  u32NameID = orxString_ToCRC(sstScreenshot.acScreenshotBuffer);
+
+  /* Index not computed yet for this pattern? */
+  if(!(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_INDEX) || (u32NameID != sstScreenshot.u32NameID))
   {
-    do
+    /* Valid directory? */
+    if(orxFileSystem_Exists(zDirectory) != orxFALSE)
     {
-      /* Gets file to find name */
-      orxString_NPrint(sstScreenshot.acScreenshotBuffer, orxSCREENSHOT_KU32_BUFFER_SIZE, "%s/%s%0*ld.%s", zDirectory, zBaseName, u32Digits, sstScreenshot.u32ScreenshotIndex + 1, zExtension);
+      orxFILESYSTEM_INFO  stInfo;
+      orxU32              u32BaseLength;
 
-      /* Updates screenshot index */
-      sstScreenshot.u32ScreenshotIndex++;
+      /* Gets base name length */
+      u32BaseLength = orxString_GetLength(zBaseName);
+
+      /* Clears index */
+      sstScreenshot.u32ScreenshotIndex = 0;
+
+      /* For all matching files, in a single directory pass */
+      if(orxFileSystem_FindFirst(sstScreenshot.acScreenshotBuffer, &stInfo) != orxFALSE)
+      {
+        do
+        {
+          orxU32    u32Index;
+          orxSTRING zRemaining;
+
+          /* Gets its index */
+          if((orxString_ToU32Base(stInfo.zName + u32BaseLength, 10, &u32Index, &zRemaining) != orxSTATUS_FAILURE)
+          && (*zRemaining == '.')
+          && (u32Index > sstScreenshot.u32ScreenshotIndex))
+          {
+            /* Stores it */
+            sstScreenshot.u32ScreenshotIndex = u32Index;
+          }
+        }
+        while(orxFileSystem_FindNext(&stInfo) != orxFALSE);
+
+        /* Closes search */
+        orxFileSystem_FindClose(&stInfo);
+      }
+
+      /* Updates status */
+      sstScreenshot.u32NameID = u32NameID;
+      sstScreenshot.u32Flags |= orxSCREENSHOT_KU32_STATIC_FLAG_INDEX;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Invalid directory [%s]. Please create it to enable screenshots.", zDirectory);
+
+      /* Can't find folder */
+      eResult = orxSTATUS_FAILURE;
     }
-    /* Till not found */
-    while(orxFileSystem_Exists(sstScreenshot.acScreenshotBuffer) != orxFALSE);
   }
-  else
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
   {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Invalid directory [%s]. Please create it to enable screenshots.", zDirectory);
+    /* Gets file name */
+    orxString_NPrint(sstScreenshot.acScreenshotBuffer, orxSCREENSHOT_KU32_BUFFER_SIZE, "%s/%s%0*ld.%s", zDirectory, zBaseName, u32Digits, sstScreenshot.u32ScreenshotIndex + 1, zExtension);
+
+    /* Gets lower case extension */
+    orxString_NCopy(acExtension, zExtension, 7);
+    acExtension[7] = orxCHAR_NULL;
+    orxString_LowerCase(acExtension);
 
-    /* Can't find folder */
-    eResult = orxSTATUS_FAILURE;
+    /* Gets format */
+    if(orxString_Compare(acExtension, orxSCREENSHOT_KZ_EXTENSION_TGA) == 0)
+    {
+      *_peFormat = orxSCREENSHOT_FORMAT_TGA;
+    }
+    else if(orxString_Compare(acExtension, orxSCREENSHOT_KZ_EXTENSION_PNG) == 0)
+    {
+      *_peFormat = orxSCREENSHOT_FORMAT_PNG;
+    }
+    else if(orxString_Compare(acExtension, orxSCREENSHOT_KZ_EXTENSION_RAW) == 0)
+    {
+      *_peFormat = orxSCREENSHOT_FORMAT_RAW;
+    }
+    else
+    {
+      *_peFormat = orxSCREENSHOT_FORMAT_NONE;
+    }
   }
 
   /* Done! */
   return eResult;
 }
 
+/** Event handler: captures recorded frames once rendered
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_EventHandler(const orxEVENT *_pstEvent)
+{
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_RENDER);
+
+  /* Frame about to be rendered while recording? */
+  if((_pstEvent->eID == orxRENDER_EVENT_START)
+  && (sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_RECORD))
+  {
+    /* Frame will be captured from main thread: needs display context */
+    orxEvent_SendShort(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_ACQUIRE_CONTEXT);
+  }
+  /* Frame rendered while recording? */
+  else if((_pstEvent->eID == orxRENDER_EVENT_STOP)
+       && (sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_RECORD))
+  {
+    /* Captures it */
+    orxScreenshot_Capture();
+
+    /* Limited recording? */
+    if(sstScreenshot.u32RecordCounter != orxU32_UNDEFINED)
+    {
+      /* Last frame? */
+      if(--sstScreenshot.u32RecordCounter == 0)
+      {
+        /* Stops recording */
+        orxScreenshot_StopRecording();
+      }
+    }
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Inits the module if its init has been deferred till its first use
+ */
+static orxINLINE void orxScreenshot_InitOnDemand()
+{
+  /* Not initialized? */
+  if(!(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY))
+  {
+    /* Inits it */
+    orxModule_Init(orxMODULE_ID_SCREENSHOT);
+  }
+
+  return;
+}
+
 /***************************************************************************
  * Public functions                                                        *
  ***************************************************************************/
@@ -190,6 +1176,9 @@ void orxFASTCALL orxScreenshot_Setup()
   /* Adds module dependencies */
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_CLOCK);
+  orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_EVENT);
+  orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_FILE);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_FILESYSTEM);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_DISPLAY);
 
@@ -206,11 +1195,64 @@ orxSTATUS orxFASTCALL orxScreenshot_Init()
   /* Not already Initialized? */
   if(!(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY))
   {
+    orxU32 i;
+
     /* Cleans control structure */
     orxMemory_Zero(&sstScreenshot, sizeof(orxSCREENSHOT_STATIC));
 
-    /* Inits flags */
-    sstScreenshot.u32Flags = orxSCREENSHOT_KU32_STATIC_FLAG_READY;
+    /* Computes PNG CRC table */
+    for(i = 0; i < 256; i++)
+    {
+      orxU32 u32Value, j;
+
+      for(j = 0, u32Value = i; j < 8; j++)
+      {
+        u32Value = (u32Value & 1) ? (0xEDB88320 ^ (u32Value >> 1)) : (u32Value >> 1);
+      }
+
+      sstScreenshot.au32CRCTable[i] = u32Value;
+    }
+
+    /* Adds event handler */
+    eResult = orxEvent_AddHandler(orxEVENT_TYPE_RENDER, orxScreenshot_EventHandler);
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Inits flags */
+      sstScreenshot.u32Flags = orxSCREENSHOT_KU32_STATIC_FLAG_READY;
+
+#ifdef __orxSCREENSHOT_THREAD__
+
+      /* Starts encoder thread */
+      if(orxScreenshot_StartThread() != orxSTATUS_FAILURE)
+      {
+        /* Updates flags */
+        sstScreenshot.u32Flags |= orxSCREENSHOT_KU32_STATIC_FLAG_THREAD;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Couldn't start screenshot encoder thread, screenshots will be encoded synchronously.");
+      }
+
+#endif /* __orxSCREENSHOT_THREAD__ */
+
+      /* Pushes section */
+      if((orxConfig_HasSection(orxSCREENSHOT_KZ_CONFIG_SECTION) != orxFALSE)
+      && (orxConfig_PushSection(orxSCREENSHOT_KZ_CONFIG_SECTION) != orxSTATUS_FAILURE))
+      {
+        /* Should record? */
+        if(orxConfig_GetU32(orxSCREENSHOT_KZ_CONFIG_RECORD_FRAME_NUMBER) > 0)
+        {
+          /* Starts recording */
+          orxScreenshot_StartRecording(orxConfig_GetU32(orxSCREENSHOT_KZ_CONFIG_RECORD_FRAME_NUMBER), orxConfig_GetFloat(orxSCREENSHOT_KZ_CONFIG_RECORD_DT));
+        }
+
+        /* Pops previous section */
+        orxConfig_PopSection();
+      }
+    }
   }
   else
   {
@@ -232,8 +1274,51 @@ void orxFASTCALL orxScreenshot_Exit()
   /* Initialized? */
   if(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY)
   {
+    /* Stops recording */
+    orxScreenshot_StopRecording();
+
+    /* Removes event handler */
+    orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, orxScreenshot_EventHandler);
+
+#ifdef __orxSCREENSHOT_THREAD__
+
+    /* Encoder running? */
+    if(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_THREAD)
+    {
+      /* Stops it, once all pending screenshots are written */
+      orxScreenshot_StopThread();
+    }
+
+#endif /* __orxSCREENSHOT_THREAD__ */
+
+    /* Has buffers? */
+    if(sstScreenshot.astBufferList != orxNULL)
+    {
+      orxU32 i;
+
+      /* Recycles encoded buffers */
+      orxScreenshot_RecycleBuffers();
+
+      /* For all buffers */
+      for(i = 0; i < sstScreenshot.u32BufferNumber; i++)
+      {
+        /* Has data? */
+        if(sstScreenshot.astBufferList[i].au8Data != orxNULL)
+        {
+          /* Frees it */
+          orxMemory_Free(sstScreenshot.astBufferList[i].au8Data);
+        }
+      }
+
+      /* Frees buffer & queue lists */
+      orxMemory_Free(sstScreenshot.astBufferList);
+      orxMemory_Free(sstScreenshot.au32QueueList);
+      sstScreenshot.astBufferList = orxNULL;
+      sstScreenshot.au32QueueList = orxNULL;
+    }
+
     /* Updates flags */
-    sstScreenshot.u32Flags &= ~orxSCREENSHOT_KU32_STATIC_FLAG_READY;
+    sstScreenshot.u32Flags &= ~orxSCREENSHOT_KU32_STATIC_MASK_ALL;
   }
   else
   {
@@ -249,28 +1334,280 @@ void orxFASTCALL orxScreenshot_Exit()
  */
 orxSTATUS orxFASTCALL orxScreenshot_Capture()
 {
-  orxSTATUS eResult;
+  orxSCREENSHOT_FORMAT  eFormat;
+  orxSTATUS             eResult;
+
+  /* Inits module on first use */
+  orxScreenshot_InitOnDemand();
 
   /* Checks */
   orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
 
-  /* Computes screenshot index */
-  eResult = orxScreenshot_ComputeIndex();
+  /* Computes screenshot name */
+  eResult = orxScreenshot_ComputeName(&eFormat);
+
+  /* Needs display context to read the screen */
+  orxEvent_SendShort(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_ACQUIRE_CONTEXT);
 
   /* Valid? */
   if(eResult != orxSTATUS_FAILURE)
   {
-    /* Saves it */
-    eResult = orxDisplay_SaveBitmap(orxDisplay_GetScreenBitmap(), sstScreenshot.acScreenshotBuffer);
+    /* Not handled by the encoder? */
+    if(eFormat == orxSCREENSHOT_FORMAT_NONE)
+    {
+      /* Saves it through display plugin */
+      eResult = orxDisplay_SaveBitmap(orxDisplay_GetScreenBitmap(), sstScreenshot.acScreenshotBuffer);
+
+      /* Success? */
+      if(eResult != orxSTATUS_FAILURE)
+      {
+        /* Logs */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Screenshot captured to [%s].", sstScreenshot.acScreenshotBuffer);
+      }
+    }
+    else
+    {
+      orxSCREENSHOT_BUFFER *pstBuffer;
+      orxBITMAP            *pstScreen;
+      orxFLOAT              fWidth, fHeight;
+      orxU32                u32Size;
+
+      /* Gets screen & its size */
+      pstScreen = orxDisplay_GetScreenBitmap();
+      orxDisplay_GetBitmapSize(pstScreen, &fWidth, &fHeight);
+      u32Size = orxF2U(fWidth) * orxF2U(fHeight) * 4;
+
+      /* Gets a staging buffer */
+      pstBuffer = orxScreenshot_GetBuffer();
+
+      /* Valid? */
+      if((pstBuffer != orxNULL) && (u32Size > 0))
+      {
+        /* Not big enough? */
+        if(pstBuffer->u32Size < u32Size)
+        {
+          /* Frees previous data */
+          if(pstBuffer->au8Data != orxNULL)
+          {
+            orxMemory_Free(pstBuffer->au8Data);
+          }
+
+          /* Allocates new one */
+          pstBuffer->au8Data = (orxU8 *)orxMemory_Allocate(u32Size, orxMEMORY_TYPE_MAIN);
+          pstBuffer->u32Size = (pstBuffer->au8Data != orxNULL) ? u32Size : 0;
+        }
+
+        /* Copies frame */
+        if((pstBuffer->au8Data != orxNULL)
+        && (orxDisplay_GetBitmapData(pstScreen, pstBuffer->au8Data, u32Size) != orxSTATUS_FAILURE))
+        {
+          /* Stores frame info */
+          pstBuffer->u32Width   = orxF2U(fWidth);
+          pstBuffer->u32Height  = orxF2U(fHeight);
+          pstBuffer->eFormat    = eFormat;
+          orxString_Copy(pstBuffer->acFileName, sstScreenshot.acScreenshotBuffer);
+
+#ifdef __orxSCREENSHOT_THREAD__
+
+          /* Encoder running? */
+          if(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_THREAD)
+          {
+            /* Queues buffer */
+            orxScreenshot_Lock();
+            pstBuffer->eState = orxSCREENSHOT_BUFFER_STATE_PENDING;
+            sstScreenshot.au32QueueList[(sstScreenshot.u32QueueHead + sstScreenshot.u32QueueCounter) % sstScreenshot.u32BufferNumber] = (orxU32)(pstBuffer - sstScreenshot.astBufferList);
+            sstScreenshot.u32QueueCounter++;
+            sstScreenshot.u32PendingCounter++;
+            orxScreenshot_Signal(&(sstScreenshot.stJobSignal));
+            orxScreenshot_Unlock();
+          }
+          else
+
+#endif /* __orxSCREENSHOT_THREAD__ */
+
+          {
+            /* Encodes it now */
+            orxScreenshot_LogResult(pstBuffer, orxScreenshot_Encode(pstBuffer));
+          }
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Couldn't read screen data for [%s].", sstScreenshot.acScreenshotBuffer);
+
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+      }
+      else
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
 
     /* Success? */
     if(eResult != orxSTATUS_FAILURE)
     {
-      /* Logs */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Screenshot captured to [%s].", sstScreenshot.acScreenshotBuffer);
+      /* Updates running index */
+      sstScreenshot.u32ScreenshotIndex++;
     }
   }
 
   /* Done! */
   return eResult;
 }
+
+/** Waits till all pending screenshots have been written
+ */
+void orxFASTCALL orxScreenshot_Flush()
+{
+  /* Inits module on first use */
+  orxScreenshot_InitOnDemand();
+
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Has buffers? */
+  if(sstScreenshot.astBufferList != orxNULL)
+  {
+#ifdef __orxSCREENSHOT_THREAD__
+
+    /* Encoder running? */
+    if(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_THREAD)
+    {
+      /* Locks queue */
+      orxScreenshot_Lock();
+
+      /* Waits for all pending buffers */
+      while(sstScreenshot.u32PendingCounter > 0)
+      {
+        orxScreenshot_Wait(&(sstScreenshot.stDoneSignal));
+      }
+
+      /* Recycles them */
+      orxScreenshot_RecycleBuffers();
+
+      /* Unlocks queue */
+      orxScreenshot_Unlock();
+    }
+
+#endif /* __orxSCREENSHOT_THREAD__ */
+  }
+
+  return;
+}
+
+/** Starts recording: captures every rendered frame, with the core clock running at a fixed DT
+ * @param[in]   _u32FrameNumber               Number of frames to record, 0 for recording till orxScreenshot_StopRecording is called
+ * @param[in]   _fDT                          Fixed DT to use, <= 0 to keep the current core clock modifier
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxScreenshot_StartRecording(orxU32 _u32FrameNumber, orxFLOAT _fDT)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Inits module on first use */
+  orxScreenshot_InitOnDemand();
+
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Not already recording? */
+  if(!(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_RECORD))
+  {
+    /* Stores frame number */
+    sstScreenshot.u32RecordCounter = (_u32FrameNumber > 0) ? _u32FrameNumber : orxU32_UNDEFINED;
+
+    /* Clears clock */
+    sstScreenshot.pstClock = orxNULL;
+
+    /* Should use a fixed DT? */
+    if(_fDT > orxFLOAT_0)
+    {
+      orxCLOCK *pstClock;
+
+      /* Gets core clock */
+      pstClock = orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE);
+
+      /* Valid? */
+      if(pstClock != orxNULL)
+      {
+        const orxCLOCK_INFO *pstInfo;
+
+        /* Stores its current modifier */
+        pstInfo = orxClock_GetInfo(pstClock);
+        sstScreenshot.eClockModType   = pstInfo->eModType;
+        sstScreenshot.fClockModValue  = pstInfo->fModValue;
+
+        /* Sets fixed DT */
+        orxClock_SetModifier(pstClock, orxCLOCK_MOD_TYPE_FIXED, _fDT);
+
+        /* Stores it */
+        sstScreenshot.pstClock = pstClock;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Can't find core clock, recording without fixed DT.");
+      }
+    }
+
+    /* Updates flags */
+    sstScreenshot.u32Flags |= orxSCREENSHOT_KU32_STATIC_FLAG_RECORD;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Already recording.");
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops recording, restoring core clock modifier
+ */
+void orxFASTCALL orxScreenshot_StopRecording()
+{
+  /* Inits module on first use */
+  orxScreenshot_InitOnDemand();
+
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Recording? */
+  if(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_RECORD)
+  {
+    /* Had a fixed DT? */
+    if(sstScreenshot.pstClock != orxNULL)
+    {
+      /* Restores clock modifier */
+      orxClock_SetModifier(sstScreenshot.pstClock, sstScreenshot.eClockModType, sstScreenshot.fClockModValue);
+      sstScreenshot.pstClock = orxNULL;
+    }
+
+    /* Updates flags */
+    sstScreenshot.u32Flags &= ~orxSCREENSHOT_KU32_STATIC_FLAG_RECORD;
+  }
+
+  return;
+}
+
+/** Is recording?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxScreenshot_IsRecording()
+{
+  /* Inits module on first use */
+  orxScreenshot_InitOnDemand();
+
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return (sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_RECORD) ? orxTRUE : orxFALSE;
+}